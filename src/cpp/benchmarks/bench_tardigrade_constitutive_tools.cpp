@@ -0,0 +1,1205 @@
+/**
+  * \file bench_tardigrade_constitutive_tools.cpp
+  *
+  * Micro-benchmarks for tardigrade_constitutive_tools
+  *
+  * The batched kernels use AVX2/AVX-512 lanes when the library is compiled with
+  * TARDIGRADE_CONSTITUTIVE_TOOLS_BUILD_NATIVE=ON on a supporting host. Comparing the
+  * pointwise and batched timings of a native build and a default build shows the
+  * speedup of the vector lanes.
+  *
+  * Every public function and overload is also timed over a pool of randomized
+  * material points through BM_api. The average number of heap allocations made
+  * through the global operator new is reported as the allocs/call counter.
+  * Jacobian variants are suffixed by their storage i.e. _flatJ for flat vectors,
+  * _matrixJ for floatMatrix, _fixedJ for std::array, _mandelJ for Mandel
+  * notation and _structuredJ for StructuredJacobian.
+  */
+
+#include<tardigrade_constitutive_tools.h>
+#include<benchmark/benchmark.h>
+#include<algorithm>
+#include<cmath>
+#include<cstdlib>
+#include<new>
+#include<random>
+
+typedef tardigradeConstitutiveTools::floatType floatType;
+typedef tardigradeConstitutiveTools::floatVector floatVector;
+typedef tardigradeConstitutiveTools::floatFirstOrderTensor floatFirstOrderTensor;
+typedef tardigradeConstitutiveTools::floatSecondOrderTensor floatSecondOrderTensor;
+typedef tardigradeConstitutiveTools::floatThirdOrderTensor floatThirdOrderTensor;
+typedef tardigradeConstitutiveTools::floatFourthOrderTensor floatFourthOrderTensor;
+typedef tardigradeConstitutiveTools::floatSixthOrderTensor floatSixthOrderTensor;
+typedef tardigradeConstitutiveTools::floatQuaternion floatQuaternion;
+typedef tardigradeConstitutiveTools::uniaxialStrain uniaxialStrain;
+typedef tardigradeConstitutiveTools::planeStrain planeStrain;
+typedef tardigradeConstitutiveTools::axisymmetric axisymmetric;
+typedef tardigradeConstitutiveTools::currentConfiguration currentConfiguration;
+typedef tardigradeConstitutiveTools::referenceConfiguration referenceConfiguration;
+template< class K > using floatKinematicTensor = tardigradeConstitutiveTools::kinematicTensor< K, floatType >;
+template< class K > using floatKinematicJacobian = tardigradeConstitutiveTools::kinematicJacobian< K, floatType >;
+typedef tardigradeConstitutiveTools::floatMatrix floatMatrix;
+typedef tardigradeConstitutiveTools::floatMandelVector floatMandelVector;
+typedef tardigradeConstitutiveTools::floatMandelMatrix floatMandelMatrix;
+typedef tardigradeConstitutiveTools::floatMandelGradient floatMandelGradient;
+typedef tardigradeConstitutiveTools::errorOut errorOut;
+typedef tardigradeConstitutiveTools::statusCode statusCode;
+typedef tardigradeConstitutiveTools::KinematicState KinematicState;
+typedef tardigradeConstitutiveTools::StructuredJacobian StructuredJacobian;
+
+static floatVector makeDeformationGradientBatch( const unsigned int nPoints ){
+    /*!
+     * Form a batch of deformation gradients in structure-of-arrays layout
+     *
+     * \param nPoints: The number of points in the batch
+     */
+
+    floatVector F( 9 * nPoints );
+
+    for ( unsigned int i = 0; i < 9; i++ ){
+
+        for ( unsigned int p = 0; p < nPoints; p++ ){
+
+            F[ i * nPoints + p ] = 0.01 * std::sin( 0.37 * ( 9 * p + i ) ) + ( ( i % 4 == 0 ) ? 1 : 0 );
+
+        }
+
+    }
+
+    return F;
+
+}
+
+static std::vector< floatSecondOrderTensor > makeDeformationGradientPoints( const unsigned int nPoints ){
+    /*!
+     * Form the same deformation gradients as makeDeformationGradientBatch stored point by point
+     *
+     * \param nPoints: The number of points
+     */
+
+    floatVector batch = makeDeformationGradientBatch( nPoints );
+
+    std::vector< floatSecondOrderTensor > F( nPoints );
+
+    for ( unsigned int p = 0; p < nPoints; p++ ){
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            F[ p ][ i ] = batch[ i * nPoints + p ];
+
+        }
+
+    }
+
+    return F;
+
+}
+
+static void BM_computeRightCauchyGreen_pointwise( benchmark::State &state ){
+
+    const unsigned int nPoints = state.range( 0 );
+
+    std::vector< floatSecondOrderTensor > F = makeDeformationGradientPoints( nPoints );
+
+    std::vector< floatSecondOrderTensor > C( nPoints );
+
+    std::vector< floatFourthOrderTensor > dCdF( nPoints );
+
+    for ( auto _ : state ){
+
+        for ( unsigned int p = 0; p < nPoints; p++ ){
+
+            tardigradeConstitutiveTools::computeRightCauchyGreen( F[ p ], C[ p ], dCdF[ p ] );
+
+        }
+
+        benchmark::DoNotOptimize( C.data( ) );
+        benchmark::DoNotOptimize( dCdF.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * nPoints );
+
+}
+
+static void BM_computeRightCauchyGreenBatched( benchmark::State &state ){
+
+    const unsigned int nPoints = state.range( 0 );
+
+    floatVector F = makeDeformationGradientBatch( nPoints );
+
+    floatVector C( 9 * nPoints );
+
+    for ( auto _ : state ){
+
+        tardigradeConstitutiveTools::computeRightCauchyGreenBatched( nPoints, F.data( ), C.data( ) );
+
+        benchmark::DoNotOptimize( C.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * nPoints );
+
+}
+
+static void BM_computeDeformationGradientBatched( benchmark::State &state ){
+
+    const unsigned int nPoints = state.range( 0 );
+
+    floatVector gradU = makeDeformationGradientBatch( nPoints );
+
+    for ( unsigned int p = 0; p < nPoints; p++ ){ for ( unsigned int i = 0; i < 9; i += 4 ){ gradU[ i * nPoints + p ] -= 1; } }
+
+    floatVector F( 9 * nPoints ), dFdGradU( 81 * nPoints );
+
+    for ( auto _ : state ){
+
+        tardigradeConstitutiveTools::computeDeformationGradientBatched( nPoints, gradU.data( ), F.data( ), dFdGradU.data( ), true );
+
+        benchmark::DoNotOptimize( F.data( ) );
+        benchmark::DoNotOptimize( dFdGradU.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * nPoints );
+
+}
+
+static void BM_invertSecondOrderTensor_pointwise( benchmark::State &state ){
+
+    const unsigned int nPoints = state.range( 0 );
+
+    floatVector A = makeDeformationGradientBatch( nPoints );
+
+    floatVector invA( 9 * nPoints ), detA( nPoints );
+
+    for ( auto _ : state ){
+
+        for ( unsigned int p = 0; p < nPoints; p++ ){
+
+            floatSecondOrderTensor _A, _invA;
+
+            for ( unsigned int i = 0; i < 9; i++ ){ _A[ i ] = A[ i * nPoints + p ]; }
+
+            detA[ p ] = tardigradeConstitutiveTools::invertSecondOrderTensor( _A, _invA );
+
+            for ( unsigned int i = 0; i < 9; i++ ){ invA[ i * nPoints + p ] = _invA[ i ]; }
+
+        }
+
+        benchmark::DoNotOptimize( invA.data( ) );
+        benchmark::DoNotOptimize( detA.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * nPoints );
+
+}
+
+static void BM_invertSecondOrderTensorBatched( benchmark::State &state ){
+
+    const unsigned int nPoints = state.range( 0 );
+
+    floatVector A = makeDeformationGradientBatch( nPoints );
+
+    floatVector invA( 9 * nPoints ), detA( nPoints );
+
+    statusCode status;
+
+    for ( auto _ : state ){
+
+        tardigradeConstitutiveTools::invertSecondOrderTensorBatched( nPoints, A.data( ), invA.data( ), detA.data( ), status );
+
+        benchmark::DoNotOptimize( invA.data( ) );
+        benchmark::DoNotOptimize( detA.data( ) );
+        benchmark::DoNotOptimize( status );
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * nPoints );
+
+}
+
+static void BM_computeKinematicsBatched( benchmark::State &state ){
+
+    const unsigned int nPoints = state.range( 0 );
+
+    floatVector gradU = makeDeformationGradientBatch( nPoints );
+
+    for ( unsigned int p = 0; p < nPoints; p++ ){ for ( unsigned int i = 0; i < 9; i += 4 ){ gradU[ i * nPoints + p ] -= 1; } }
+
+    floatVector F( 9 * nPoints ), C( 9 * nPoints ), E( 9 * nPoints );
+
+    for ( auto _ : state ){
+
+        tardigradeConstitutiveTools::computeKinematicsBatched( nPoints, gradU.data( ), F.data( ), C.data( ), E.data( ), false );
+
+        benchmark::DoNotOptimize( E.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * nPoints );
+
+}
+
+static void BM_computeRightCauchyGreenBatched_float( benchmark::State &state ){
+
+    const unsigned int nPoints = state.range( 0 );
+
+    floatVector FDouble = makeDeformationGradientBatch( nPoints );
+
+    std::vector< float > F( FDouble.begin( ), FDouble.end( ) );
+
+    std::vector< float > C( 9 * nPoints );
+
+    for ( auto _ : state ){
+
+        tardigradeConstitutiveTools::computeRightCauchyGreenBatched( nPoints, F.data( ), C.data( ) );
+
+        benchmark::DoNotOptimize( C.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * nPoints );
+
+}
+
+static void BM_computeRightCauchyGreenBatched_jacobian( benchmark::State &state ){
+
+    const unsigned int nPoints = state.range( 0 );
+
+    floatVector F = makeDeformationGradientBatch( nPoints );
+
+    floatVector C( 9 * nPoints ), dCdF( 81 * nPoints );
+
+    for ( auto _ : state ){
+
+        tardigradeConstitutiveTools::computeRightCauchyGreenBatched( nPoints, F.data( ), C.data( ), dCdF.data( ) );
+
+        benchmark::DoNotOptimize( C.data( ) );
+        benchmark::DoNotOptimize( dCdF.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * nPoints );
+
+}
+
+static void BM_computeGreenLagrangeStrain_pointwise( benchmark::State &state ){
+
+    const unsigned int nPoints = state.range( 0 );
+
+    std::vector< floatSecondOrderTensor > F = makeDeformationGradientPoints( nPoints );
+
+    std::vector< floatSecondOrderTensor > E( nPoints );
+
+    std::vector< floatFourthOrderTensor > dEdF( nPoints );
+
+    for ( auto _ : state ){
+
+        for ( unsigned int p = 0; p < nPoints; p++ ){
+
+            tardigradeConstitutiveTools::computeGreenLagrangeStrain( F[ p ], E[ p ], dEdF[ p ] );
+
+        }
+
+        benchmark::DoNotOptimize( E.data( ) );
+        benchmark::DoNotOptimize( dEdF.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * nPoints );
+
+}
+
+static void BM_computeGreenLagrangeStrainBatched( benchmark::State &state ){
+
+    const unsigned int nPoints = state.range( 0 );
+
+    floatVector F = makeDeformationGradientBatch( nPoints );
+
+    floatVector E( 9 * nPoints );
+
+    for ( auto _ : state ){
+
+        tardigradeConstitutiveTools::computeGreenLagrangeStrainBatched( nPoints, F.data( ), E.data( ) );
+
+        benchmark::DoNotOptimize( E.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * nPoints );
+
+}
+
+static void BM_computeGreenLagrangeStrainBatched_jacobian( benchmark::State &state ){
+
+    const unsigned int nPoints = state.range( 0 );
+
+    floatVector F = makeDeformationGradientBatch( nPoints );
+
+    floatVector E( 9 * nPoints ), dEdF( 81 * nPoints );
+
+    for ( auto _ : state ){
+
+        tardigradeConstitutiveTools::computeGreenLagrangeStrainBatched( nPoints, F.data( ), E.data( ), dEdF.data( ) );
+
+        benchmark::DoNotOptimize( E.data( ) );
+        benchmark::DoNotOptimize( dEdF.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * nPoints );
+
+}
+
+static floatVector makeNormalBatch( const unsigned int nFacets ){
+    /*!
+     * Form a batch of unit normals in structure-of-arrays layout
+     *
+     * \param nFacets: The number of facets in the batch
+     */
+
+    floatVector N( 3 * nFacets );
+
+    for ( unsigned int p = 0; p < nFacets; p++ ){
+
+        const floatType theta = 0.37 * p, phi = 0.11 * p;
+
+        N[ 0 * nFacets + p ] = std::cos( theta ) * std::sin( phi + 0.5 );
+        N[ 1 * nFacets + p ] = std::sin( theta ) * std::sin( phi + 0.5 );
+        N[ 2 * nFacets + p ] = std::cos( phi + 0.5 );
+
+    }
+
+    return N;
+
+}
+
+static void BM_computeCurrentSurface_pointwise( benchmark::State &state ){
+
+    const unsigned int nFacets = state.range( 0 );
+
+    floatVector FBatch = makeDeformationGradientBatch( nFacets );
+
+    floatVector NBatch = makeNormalBatch( nFacets );
+
+    std::vector< floatVector > F( nFacets, floatVector( 9 ) ), n( nFacets, floatVector( 3 ) );
+
+    for ( unsigned int p = 0; p < nFacets; p++ ){
+
+        for ( unsigned int i = 0; i < 9; i++ ){ F[ p ][ i ] = FBatch[ i * nFacets + p ]; }
+
+        for ( unsigned int i = 0; i < 3; i++ ){ n[ p ][ i ] = NBatch[ i * nFacets + p ]; }
+
+    }
+
+    std::vector< floatVector > dNormalVectordF( nFacets ), dCurrentAreadF( nFacets );
+
+    for ( auto _ : state ){
+
+        for ( unsigned int p = 0; p < nFacets; p++ ){
+
+            tardigradeConstitutiveTools::computeDCurrentNormalVectorDF( n[ p ], F[ p ], dNormalVectordF[ p ] );
+
+            tardigradeConstitutiveTools::computeDCurrentAreaDF( n[ p ], F[ p ], dCurrentAreadF[ p ] );
+
+        }
+
+        benchmark::DoNotOptimize( dNormalVectordF.data( ) );
+        benchmark::DoNotOptimize( dCurrentAreadF.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * nFacets );
+
+}
+
+static void BM_computeCurrentSurfaceBatched( benchmark::State &state ){
+
+    const unsigned int nFacets = state.range( 0 );
+
+    floatVector F = makeDeformationGradientBatch( nFacets );
+
+    floatVector N = makeNormalBatch( nFacets );
+
+    floatVector n( 3 * nFacets ), r( nFacets ), dndF( 27 * nFacets ), drdF( 9 * nFacets );
+
+    for ( auto _ : state ){
+
+        tardigradeConstitutiveTools::computeCurrentSurfaceBatched( nFacets, N.data( ), F.data( ), n.data( ), r.data( ), dndF.data( ), drdF.data( ) );
+
+        benchmark::DoNotOptimize( dndF.data( ) );
+        benchmark::DoNotOptimize( drdF.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * nFacets );
+
+}
+
+static void BM_computeCurrentSurfaceBatched_sharedF( benchmark::State &state ){
+
+    const unsigned int nFacets = state.range( 0 );
+
+    const floatSecondOrderTensor F = makeDeformationGradientPoints( 1 )[ 0 ];
+
+    floatVector N = makeNormalBatch( nFacets );
+
+    floatVector n( 3 * nFacets ), r( nFacets ), dndF( 27 * nFacets ), drdF( 9 * nFacets );
+
+    for ( auto _ : state ){
+
+        tardigradeConstitutiveTools::computeCurrentSurfaceBatched( nFacets, N.data( ), F, n.data( ), r.data( ), dndF.data( ), drdF.data( ) );
+
+        benchmark::DoNotOptimize( dndF.data( ) );
+        benchmark::DoNotOptimize( drdF.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * nFacets );
+
+}
+
+static void BM_midpointEvolution_vector( benchmark::State &state ){
+
+    const unsigned int nValues = state.range( 0 );
+
+    floatVector Ap( nValues, 1.0 ), DApDt( nValues, 0.25 ), DADt( nValues, 0.5 ), dA, A;
+
+    for ( auto _ : state ){
+
+        tardigradeConstitutiveTools::midpointEvolution( 1e-2, Ap, DApDt, DADt, dA, A, 0.5 );
+
+        benchmark::DoNotOptimize( A.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * nValues );
+
+}
+
+static void BM_midpointEvolutionBatched( benchmark::State &state ){
+
+    const unsigned int nValues = state.range( 0 );
+
+    floatVector A( nValues, 1.0 ), DApDt( nValues, 0.25 ), DADt( nValues, 0.5 );
+
+    statusCode status;
+
+    for ( auto _ : state ){
+
+        tardigradeConstitutiveTools::midpointEvolutionBatched( nValues, 1e-2, DApDt.data( ), DADt.data( ), A.data( ), ( floatType * )nullptr, 0.5, status );
+
+        benchmark::DoNotOptimize( A.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * nValues );
+
+}
+
+static floatSecondOrderTensor makeVelocityGradientIncrement( const floatType scale ){
+    /*!
+     * Form a representative non-symmetric velocity gradient increment
+     *
+     * \param scale: The scale of the increment
+     */
+
+    floatSecondOrderTensor DtL;
+
+    for ( unsigned int i = 0; i < 9; i++ ){
+
+        DtL[ i ] = scale * std::sin( 0.37 * i + 0.1 );
+
+    }
+
+    return DtL;
+
+}
+
+static void BM_computeMatrixExponential( benchmark::State &state ){
+
+    const floatSecondOrderTensor A = makeVelocityGradientIncrement( 1e-3 * state.range( 0 ) );
+
+    floatSecondOrderTensor expA;
+
+    for ( auto _ : state ){
+
+        tardigradeConstitutiveTools::computeMatrixExponential( A, expA );
+
+        benchmark::DoNotOptimize( expA.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+}
+
+static void BM_computeMatrixExponential_jacobian( benchmark::State &state ){
+
+    const floatSecondOrderTensor A = makeVelocityGradientIncrement( 1e-3 * state.range( 0 ) );
+
+    floatSecondOrderTensor expA;
+
+    floatFourthOrderTensor dExpAdA;
+
+    for ( auto _ : state ){
+
+        tardigradeConstitutiveTools::computeMatrixExponential( A, expA, dExpAdA );
+
+        benchmark::DoNotOptimize( expA.data( ) );
+        benchmark::DoNotOptimize( dExpAdA.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+}
+
+static void BM_computeMatrixExponentialScalingAndSquaring( benchmark::State &state ){
+
+    const floatSecondOrderTensor DtL = makeVelocityGradientIncrement( 1e-3 * state.range( 0 ) );
+
+    const floatVector A( DtL.begin( ), DtL.end( ) );
+
+    floatVector expA;
+
+    for ( auto _ : state ){
+
+        tardigradeVectorTools::computeMatrixExponentialScalingAndSquaring( A, 3, expA );
+
+        benchmark::DoNotOptimize( expA.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+}
+
+static void BM_computeMatrixExponentialScalingAndSquaring_jacobian( benchmark::State &state ){
+
+    const floatSecondOrderTensor DtL = makeVelocityGradientIncrement( 1e-3 * state.range( 0 ) );
+
+    const floatVector A( DtL.begin( ), DtL.end( ) );
+
+    floatVector expA, dExpAdA;
+
+    for ( auto _ : state ){
+
+        tardigradeVectorTools::computeMatrixExponentialScalingAndSquaring( A, 3, expA, dExpAdA );
+
+        benchmark::DoNotOptimize( expA.data( ) );
+        benchmark::DoNotOptimize( dExpAdA.data( ) );
+        benchmark::ClobberMemory( );
+
+    }
+
+}
+
+BENCHMARK( BM_computeRightCauchyGreen_pointwise )->Arg( 8 )->Arg( 27 )->Arg( 1024 );
+BENCHMARK( BM_computeRightCauchyGreenBatched )->Arg( 8 )->Arg( 27 )->Arg( 1024 );
+BENCHMARK( BM_computeDeformationGradientBatched )->Arg( 8 )->Arg( 27 )->Arg( 1024 );
+BENCHMARK( BM_invertSecondOrderTensor_pointwise )->Arg( 8 )->Arg( 1000 );
+BENCHMARK( BM_invertSecondOrderTensorBatched )->Arg( 8 )->Arg( 1000 );
+BENCHMARK( BM_computeKinematicsBatched )->Arg( 8 )->Arg( 27 )->Arg( 1024 );
+BENCHMARK( BM_computeRightCauchyGreenBatched_float )->Arg( 8 )->Arg( 27 )->Arg( 1024 );
+BENCHMARK( BM_computeRightCauchyGreenBatched_jacobian )->Arg( 8 )->Arg( 27 )->Arg( 1024 );
+BENCHMARK( BM_computeGreenLagrangeStrain_pointwise )->Arg( 8 )->Arg( 27 )->Arg( 1024 );
+BENCHMARK( BM_computeGreenLagrangeStrainBatched )->Arg( 8 )->Arg( 27 )->Arg( 1024 );
+BENCHMARK( BM_computeGreenLagrangeStrainBatched_jacobian )->Arg( 8 )->Arg( 27 )->Arg( 1024 );
+BENCHMARK( BM_computeCurrentSurface_pointwise )->Arg( 8 )->Arg( 1000 );
+BENCHMARK( BM_computeCurrentSurfaceBatched )->Arg( 8 )->Arg( 1000 );
+BENCHMARK( BM_computeCurrentSurfaceBatched_sharedF )->Arg( 8 )->Arg( 1000 );
+BENCHMARK( BM_midpointEvolution_vector )->Arg( 1024 )->Arg( 1 << 20 );
+BENCHMARK( BM_midpointEvolutionBatched )->Arg( 1024 )->Arg( 1 << 20 );
+
+// The argument is the norm of the matrix in thousandths
+BENCHMARK( BM_computeMatrixExponential )->Arg( 1 )->Arg( 100 )->Arg( 5000 );
+BENCHMARK( BM_computeMatrixExponential_jacobian )->Arg( 1 )->Arg( 100 )->Arg( 5000 );
+BENCHMARK( BM_computeMatrixExponentialScalingAndSquaring )->Arg( 1 )->Arg( 100 )->Arg( 5000 );
+BENCHMARK( BM_computeMatrixExponentialScalingAndSquaring_jacobian )->Arg( 1 )->Arg( 100 )->Arg( 5000 );
+
+static std::size_t allocationCount = 0; //!< The number of calls to the global operator new
+
+void *operator new( std::size_t size ){
+    /*!
+     * Count the heap allocations made through the global operator new
+     *
+     * \param size: The number of bytes to allocate
+     */
+
+    allocationCount++;
+
+    if ( void *ptr = std::malloc( size ? size : 1 ) ){ return ptr; }
+
+    throw std::bad_alloc( );
+
+}
+
+void *operator new( std::size_t size, std::align_val_t alignment ){
+    /*!
+     * Count the over-aligned heap allocations made through the global operator new
+     *
+     * \param size: The number of bytes to allocate
+     * \param alignment: The required alignment of the allocation
+     */
+
+    allocationCount++;
+
+    void *ptr = NULL;
+
+    std::size_t align = std::max( static_cast< std::size_t >( alignment ), sizeof( void * ) );
+
+    if ( posix_memalign( &ptr, align, size ? size : 1 ) == 0 ){ return ptr; }
+
+    throw std::bad_alloc( );
+
+}
+
+void *operator new[]( std::size_t size ){ return operator new( size ); }
+
+void *operator new[]( std::size_t size, std::align_val_t alignment ){ return operator new( size, alignment ); }
+
+void operator delete( void *ptr ) noexcept{
+    /*!
+     * Release the heap allocations made through the replacement operator new. Every other
+     * replacement operator delete forwards here so that the release always matches the allocation.
+     *
+     * \param *ptr: The pointer to release
+     */
+
+    std::free( ptr );
+
+}
+
+void operator delete( void *ptr, std::align_val_t ) noexcept{ operator delete( ptr ); }
+
+void operator delete[]( void *ptr ) noexcept{ operator delete( ptr ); }
+
+void operator delete[]( void *ptr, std::align_val_t ) noexcept{ operator delete( ptr ); }
+
+void operator delete( void *ptr, std::size_t ) noexcept{ operator delete( ptr ); }
+
+void operator delete[]( void *ptr, std::size_t ) noexcept{ operator delete( ptr ); }
+
+void operator delete( void *ptr, std::size_t, std::align_val_t ) noexcept{ operator delete( ptr ); }
+
+void operator delete[]( void *ptr, std::size_t, std::align_val_t ) noexcept{ operator delete( ptr ); }
+
+struct BenchmarkInputs{
+    /*!
+     * A randomized set of physically reasonable inputs for a single material point
+     */
+
+    floatVector F; //!< The deformation gradient
+    floatVector Fp; //!< The previous deformation gradient
+    floatVector gradU; //!< The displacement gradient
+    floatVector L; //!< The velocity gradient
+    floatVector Lp; //!< The previous velocity gradient
+    floatVector deltaL; //!< A perturbation of the velocity gradient
+    floatVector E; //!< The Green-Lagrange strain
+    floatVector e; //!< The Almansi strain
+    floatVector PK2; //!< The second Piola-Kirchhoff stress
+    floatVector cauchy; //!< The Cauchy stress
+    floatVector Q; //!< A rotation matrix
+    floatVector normal; //!< A unit normal vector
+    floatVector alpha; //!< Per-component integration parameters
+    floatVector WLFParameters; //!< The WLF parameters
+    floatSecondOrderTensor FTensor; //!< The deformation gradient in fixed-size storage
+    floatSecondOrderTensor gradUTensor; //!< The displacement gradient in fixed-size storage
+    floatSecondOrderTensor FpTensor; //!< The previous deformation gradient in fixed-size storage
+    floatSecondOrderTensor LTensor; //!< The velocity gradient in fixed-size storage
+    floatSecondOrderTensor LpTensor; //!< The previous velocity gradient in fixed-size storage
+    floatKinematicTensor< planeStrain > planeStrainGradU; //!< The in-plane components of the displacement gradient
+    floatKinematicTensor< axisymmetric > axisymmetricGradU; //!< The in-plane and hoop components of the displacement gradient
+    floatKinematicTensor< uniaxialStrain > uniaxialStrainF; //!< The axial component of the deformation gradient
+    floatKinematicTensor< planeStrain > planeStrainF; //!< The in-plane components of the deformation gradient
+    floatKinematicTensor< axisymmetric > axisymmetricF; //!< The in-plane and hoop components of the deformation gradient
+    floatFirstOrderTensor normalTensor; //!< The unit normal vector in fixed-size storage
+    floatSecondOrderTensor QTensor; //!< The rotation matrix in fixed-size storage
+    floatFirstOrderTensor rotationVector; //!< A rotation vector
+    floatQuaternion q; //!< The unit quaternion of the rotation vector
+    floatSecondOrderTensor DtLTensor; //!< The velocity gradient increment in fixed-size storage
+    floatVector mandelEVector; //!< The Green-Lagrange strain in Mandel notation stored in a vector
+    floatMandelVector mandelE; //!< The Green-Lagrange strain in Mandel notation
+    floatMandelVector mandelPK2; //!< The second Piola-Kirchhoff stress in Mandel notation
+    floatMandelVector mandelCauchy; //!< The Cauchy stress in Mandel notation
+    floatVector dEdF; //!< The Jacobian of the Green-Lagrange strain
+    floatFourthOrderTensor dEdFTensor; //!< The Jacobian of the Green-Lagrange strain in fixed-size storage
+    floatMandelMatrix mandelDCauchyDPK2; //!< The Jacobian of the Cauchy stress w.r.t. the PK2 stress in Mandel notation
+    floatMandelGradient mandelDEDF; //!< The Jacobian of the Green-Lagrange strain in Mandel notation
+    floatType temperature; //!< The temperature
+    KinematicState kinematics; //!< The cached kinematics of F
+    StructuredJacobian structuredDCDF; //!< The Jacobian of the right Cauchy-Green deformation tensor stored as structured terms
+    StructuredJacobian denseDCDF; //!< The Jacobian of the right Cauchy-Green deformation tensor stored as dense components
+
+    explicit BenchmarkInputs( std::mt19937 &generator ) : kinematics( floatSecondOrderTensor( { 1, 0, 0, 0, 1, 0, 0, 0, 1 } ) ){
+        /*!
+         * Draw the inputs from the random number generator
+         *
+         * \param &generator: The random number generator
+         */
+
+        std::normal_distribution< floatType > distribution( 0, 1 );
+
+        auto perturbation = [ & ]( const floatType scale, const floatType diagonal ){
+
+            floatVector A( 9 );
+
+            for ( unsigned int i = 0; i < 9; i++ ){ A[ i ] = scale * distribution( generator ) + ( ( i % 4 == 0 ) ? diagonal : 0 ); }
+
+            return A;
+
+        };
+
+        F = perturbation( 0.05, 1 );
+
+        Fp = perturbation( 0.05, 1 );
+
+        gradU = perturbation( 0.05, 0 );
+
+        L = perturbation( 0.1, 0 );
+
+        Lp = perturbation( 0.1, 0 );
+
+        deltaL = perturbation( 1, 0 );
+
+        PK2 = perturbation( 100, 0 );
+
+        for ( unsigned int i = 0; i < 3; i++ ){ for ( unsigned int j = 0; j < i; j++ ){ PK2[ 3 * j + i ] = PK2[ 3 * i + j ]; } }
+
+        tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, E );
+
+        tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( E, F, e );
+
+        tardigradeConstitutiveTools::pushForwardPK2Stress( PK2, F, cauchy );
+
+        // Rotation about a random axis using the Rodrigues formula
+        floatVector axis = { distribution( generator ), distribution( generator ), distribution( generator ) };
+
+        const floatType axisNorm = std::sqrt( axis[ 0 ] * axis[ 0 ] + axis[ 1 ] * axis[ 1 ] + axis[ 2 ] * axis[ 2 ] );
+
+        for ( unsigned int i = 0; i < 3; i++ ){ axis[ i ] /= axisNorm; }
+
+        const floatType theta = distribution( generator );
+
+        const floatType c = std::cos( theta ), s = std::sin( theta );
+
+        const floatType x = axis[ 0 ], y = axis[ 1 ], z = axis[ 2 ];
+
+        Q = { c + x * x * ( 1 - c ),     x * y * ( 1 - c ) - z * s, x * z * ( 1 - c ) + y * s,
+              y * x * ( 1 - c ) + z * s, c + y * y * ( 1 - c ),     y * z * ( 1 - c ) - x * s,
+              z * x * ( 1 - c ) - y * s, z * y * ( 1 - c ) + x * s, c + z * z * ( 1 - c ) };
+
+        normal = axis;
+
+        WLFParameters = { 27.5, 18.2, 282.7 };
+
+        alpha = floatVector( 9, 0.5 );
+
+        std::copy( F.begin( ), F.end( ), FTensor.begin( ) );
+
+        std::copy( gradU.begin( ), gradU.end( ), gradUTensor.begin( ) );
+
+        std::copy( Fp.begin( ), Fp.end( ), FpTensor.begin( ) );
+
+        std::copy( L.begin( ), L.end( ), LTensor.begin( ) );
+
+        std::copy( Lp.begin( ), Lp.end( ), LpTensor.begin( ) );
+
+        planeStrainGradU = { gradU[ 0 ], gradU[ 1 ], gradU[ 3 ], gradU[ 4 ] };
+
+        axisymmetricGradU = { gradU[ 0 ], gradU[ 1 ], gradU[ 3 ], gradU[ 4 ], gradU[ 8 ] };
+
+        uniaxialStrainF = { F[ 0 ] };
+
+        planeStrainF = { F[ 0 ], F[ 1 ], F[ 3 ], F[ 4 ] };
+
+        axisymmetricF = { F[ 0 ], F[ 1 ], F[ 3 ], F[ 4 ], F[ 8 ] };
+
+        std::copy( normal.begin( ), normal.end( ), normalTensor.begin( ) );
+
+        std::copy( Q.begin( ), Q.end( ), QTensor.begin( ) );
+
+        floatSecondOrderTensor C;
+
+        floatFourthOrderTensor dCdF;
+
+        tardigradeConstitutiveTools::computeRightCauchyGreen( FTensor, C, structuredDCDF );
+
+        structuredDCDF.toDense( dCdF );
+
+        denseDCDF = StructuredJacobian::dense( dCdF );
+
+        for ( unsigned int i = 0; i < 3; i++ ){ rotationVector[ i ] = 0.5 * normal[ i ]; }
+
+        tardigradeConstitutiveTools::rotationVectorToQuaternion( rotationVector, q );
+
+        for ( unsigned int i = 0; i < 9; i++ ){ DtLTensor[ i ] = 1e-2 * L[ i ]; }
+
+        tardigradeConstitutiveTools::computeGreenLagrangeStrain( FTensor, mandelE );
+
+        mandelEVector = floatVector( mandelE.begin( ), mandelE.end( ) );
+
+        floatSecondOrderTensor symmetricTensor;
+
+        std::copy( PK2.begin( ), PK2.end( ), symmetricTensor.begin( ) );
+
+        tardigradeConstitutiveTools::toMandel( symmetricTensor, mandelPK2 );
+
+        floatMandelGradient mandelDCauchyDF;
+
+        tardigradeConstitutiveTools::pushForwardPK2Stress( mandelPK2, FTensor, mandelCauchy, mandelDCauchyDPK2, mandelDCauchyDF );
+
+        tardigradeConstitutiveTools::computeGreenLagrangeStrain( FTensor, symmetricTensor, dEdFTensor );
+
+        tardigradeConstitutiveTools::toMandel( dEdFTensor, mandelDEDF );
+
+        dEdF = floatVector( dEdFTensor.begin( ), dEdFTensor.end( ) );
+
+        temperature = 300 + 10 * distribution( generator );
+
+        kinematics = KinematicState( FTensor );
+
+        kinematics.inverseRightCauchyGreen( );
+
+    }
+
+};
+
+struct BenchmarkOutputs{
+    /*!
+     * Output storage which is reused between calls so that only the allocations made by the functions are counted
+     */
+
+    floatVector v[ 6 ]; //!< Vector outputs
+    floatMatrix m[ 4 ]; //!< Matrix outputs
+    floatType s[ 2 ]; //!< Scalar outputs
+    floatThirdOrderTensor tot[ 1 ]; //!< Fixed-size third order tensor outputs
+    floatSecondOrderTensor t[ 4 ]; //!< Fixed-size second order tensor outputs
+    floatFourthOrderTensor T[ 4 ]; //!< Fixed-size fourth order tensor outputs
+    floatSixthOrderTensor S[ 1 ]; //!< Fixed-size sixth order tensor outputs
+    floatQuaternion q[ 1 ]; //!< Quaternion outputs
+    floatKinematicTensor< uniaxialStrain > us[ 1 ]; //!< Uniaxial strain tensor outputs
+    floatKinematicTensor< planeStrain > ps[ 2 ]; //!< Plane strain tensor outputs
+    floatKinematicJacobian< planeStrain > psJ[ 1 ]; //!< Plane strain Jacobian outputs
+    floatKinematicTensor< axisymmetric > ax[ 2 ]; //!< Axisymmetric tensor outputs
+    floatKinematicJacobian< axisymmetric > axJ[ 1 ]; //!< Axisymmetric Jacobian outputs
+    std::array< floatType, 36 > dQdq[ 1 ]; //!< Derivatives of second order tensors w.r.t. a quaternion
+    floatMandelVector mv[ 2 ]; //!< Mandel vector outputs
+    floatMandelMatrix mm[ 1 ]; //!< Mandel matrix outputs
+    floatMandelGradient mg[ 1 ]; //!< Mandel gradient outputs
+    StructuredJacobian J; //!< Structured Jacobian output
+    statusCode status = statusCode::success; //!< Status output
+    unsigned int dim = 0; //!< Dimension output
+
+};
+
+static const std::vector< BenchmarkInputs > &getBenchmarkInputs( ){
+    /*!
+     * Get the pool of randomized inputs. The pool is cycled through so that the timings are not specific to a
+     * single point.
+     */
+
+    static const std::vector< BenchmarkInputs > inputs = [ ]( ){
+
+        std::mt19937 generator( 12345 );
+
+        std::vector< BenchmarkInputs > pool;
+
+        for ( unsigned int i = 0; i < 64; i++ ){ pool.emplace_back( generator ); }
+
+        return pool;
+
+    }( );
+
+    return inputs;
+
+}
+
+static void consume( errorOut error ){
+    /*!
+     * Abort the benchmark if a function reports an error since the timing would be meaningless
+     *
+     * \param error: The returned error
+     */
+
+    if ( error ){
+
+        error->print( );
+
+        std::abort( );
+
+    }
+
+}
+
+template< class Function >
+static void BM_api( benchmark::State &state, Function function ){
+    /*!
+     * Time a call to a public function over the pool of randomized inputs. The average number of heap allocations
+     * per call is reported as allocs/call. The outputs are sized by an untimed call first so that only the
+     * allocations which occur in the steady state are counted.
+     *
+     * \param &state: The benchmark state
+     * \param function: The function to time which takes the inputs and the outputs
+     */
+
+    const std::vector< BenchmarkInputs > &inputs = getBenchmarkInputs( );
+
+    BenchmarkOutputs outputs;
+
+    function( inputs[ 0 ], outputs );
+
+    unsigned int index = 0;
+
+    const std::size_t initialAllocations = allocationCount;
+
+    for ( auto _ : state ){
+
+        function( inputs[ index ], outputs );
+
+        index = ( index + 1 ) % inputs.size( );
+
+        benchmark::ClobberMemory( );
+
+    }
+
+    state.counters[ "allocs/call" ] = benchmark::Counter( allocationCount - initialAllocations, benchmark::Counter::kAvgIterations );
+
+}
+
+// The public API. The Jacobian variants are suffixed by the storage of the Jacobian i.e. _flatJ or _matrixJ
+BENCHMARK_CAPTURE( BM_api, deltaDirac, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ out.s[ 0 ] = tardigradeConstitutiveTools::deltaDirac( 1, ( unsigned int )( in.temperature ) % 3 ); } );
+BENCHMARK_CAPTURE( BM_api, invertSecondOrderTensor_fixed, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ out.s[ 0 ] = tardigradeConstitutiveTools::invertSecondOrderTensor( in.FTensor, out.t[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, invertSecondOrderTensor_status, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ out.s[ 0 ] = tardigradeConstitutiveTools::invertSecondOrderTensor( in.FTensor, out.t[ 0 ], out.status ); } );
+BENCHMARK_CAPTURE( BM_api, rotateMatrix, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::rotateMatrix( in.cauchy, in.Q, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, rotateMatrix_status, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::rotateMatrix( in.cauchy, in.Q, out.v[ 0 ], out.status ); } );
+BENCHMARK_CAPTURE( BM_api, rotateMatrix_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::rotateMatrix( in.cauchy, in.Q, out.v[ 0 ], out.v[ 1 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, rotateSecondOrderTensor_fixed, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::rotateSecondOrderTensor( in.FTensor, in.QTensor, out.t[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, rotateSecondOrderTensor_fixedJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::rotateSecondOrderTensor( in.FTensor, in.QTensor, out.t[ 0 ], out.T[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, rotateFourthOrderTensor, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::rotateFourthOrderTensor( in.dEdF, in.Q, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, rotateFourthOrderTensor_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::rotateFourthOrderTensor( in.dEdF, in.Q, out.v[ 0 ], out.v[ 1 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, rotateFourthOrderTensor_fixed, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::rotateFourthOrderTensor( in.dEdFTensor, in.QTensor, out.T[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, rotateFourthOrderTensor_fixedJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::rotateFourthOrderTensor( in.dEdFTensor, in.QTensor, out.T[ 0 ], out.S[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, rotateSecondOrderTensorBatched, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::rotateSecondOrderTensorBatched( 1, in.FTensor.data( ), in.QTensor.data( ), out.t[ 0 ].data( ) ); } );
+BENCHMARK_CAPTURE( BM_api, rotateFourthOrderTensorBatched, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::rotateFourthOrderTensorBatched( 1, in.dEdFTensor.data( ), in.QTensor.data( ), out.T[ 0 ].data( ) ); } );
+BENCHMARK_CAPTURE( BM_api, quaternionToRotationMatrix_fixed, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::quaternionToRotationMatrix( in.q, out.t[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, quaternionToRotationMatrix_fixedJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::quaternionToRotationMatrix( in.q, out.t[ 0 ], out.dQdq[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, rotationVectorToRotationMatrix_fixed, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::rotationVectorToRotationMatrix( in.rotationVector, out.t[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, rotationVectorToRotationMatrix_fixedJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::rotationVectorToRotationMatrix( in.rotationVector, out.t[ 0 ], out.tot[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, composeQuaternions_fixed, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::composeQuaternions( in.q, in.q, out.q[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, rotateSecondOrderTensor_quaternion, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::rotateSecondOrderTensor( in.FTensor, in.q, out.t[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, rotateSecondOrderTensor_quaternionJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::rotateSecondOrderTensor( in.FTensor, in.q, out.t[ 0 ], out.dQdq[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, rotateSecondOrderTensor_rotationVectorJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::rotateSecondOrderTensor( in.FTensor, in.rotationVector, out.t[ 0 ], out.tot[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, rotateFourthOrderTensor_quaternion, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::rotateFourthOrderTensor( in.dEdFTensor, in.q, out.T[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, rotateSecondOrderTensorByQuaternionBatched, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::rotateSecondOrderTensorByQuaternionBatched( 1, in.FTensor.data( ), in.q.data( ), out.t[ 0 ].data( ) ); } );
+BENCHMARK_CAPTURE( BM_api, rotateFourthOrderTensorByQuaternionBatched, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::rotateFourthOrderTensorByQuaternionBatched( 1, in.dEdFTensor.data( ), in.q.data( ), out.T[ 0 ].data( ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeDeformationGradient, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDeformationGradient( in.gradU, out.v[ 0 ], true ); } );
+BENCHMARK_CAPTURE( BM_api, computeDeformationGradient_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDeformationGradient( in.gradU, out.v[ 0 ], out.v[ 1 ], true ); } );
+BENCHMARK_CAPTURE( BM_api, computeDeformationGradient_fixed, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDeformationGradient( in.gradUTensor, out.t[ 0 ], true ); } );
+BENCHMARK_CAPTURE( BM_api, computeDeformationGradient_fixedJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDeformationGradient( in.gradUTensor, out.t[ 0 ], out.T[ 0 ], true ); } );
+BENCHMARK_CAPTURE( BM_api, computeDeformationGradient_structuredJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDeformationGradient( in.gradUTensor, out.t[ 0 ], out.J, true ); } );
+BENCHMARK_CAPTURE( BM_api, computeDeformationGradient_planeStrain, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDeformationGradient< planeStrain >( in.planeStrainGradU, out.ps[ 0 ], true ); } );
+BENCHMARK_CAPTURE( BM_api, computeDeformationGradient_planeStrainJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDeformationGradient< planeStrain >( in.planeStrainGradU, out.ps[ 0 ], out.psJ[ 0 ], true ); } );
+BENCHMARK_CAPTURE( BM_api, computeDeformationGradient_axisymmetric, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDeformationGradient< axisymmetric >( in.axisymmetricGradU, out.ax[ 0 ], true ); } );
+BENCHMARK_CAPTURE( BM_api, computeDeformationGradient_axisymmetricJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDeformationGradient< axisymmetric >( in.axisymmetricGradU, out.ax[ 0 ], out.axJ[ 0 ], true ); } );
+BENCHMARK_CAPTURE( BM_api, computeGreenLagrangeStrain_planeStrainJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeGreenLagrangeStrain< planeStrain >( in.planeStrainGradU, out.ps[ 1 ], out.psJ[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeGreenLagrangeStrain_axisymmetricJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeGreenLagrangeStrain< axisymmetric >( in.axisymmetricGradU, out.ax[ 1 ], out.axJ[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, invertDeformationGradient_uniaxialStrain, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ out.s[ 0 ] = tardigradeConstitutiveTools::invertDeformationGradient< uniaxialStrain >( in.uniaxialStrainF, out.us[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, invertDeformationGradient_planeStrain, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ out.s[ 0 ] = tardigradeConstitutiveTools::invertDeformationGradient< planeStrain >( in.planeStrainF, out.ps[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, invertDeformationGradient_axisymmetric, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ out.s[ 0 ] = tardigradeConstitutiveTools::invertDeformationGradient< axisymmetric >( in.axisymmetricF, out.ax[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, expandToThreeDimensions_uniaxialStrain, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::expandToThreeDimensions< uniaxialStrain >( in.uniaxialStrainF, out.t[ 0 ], 1.0 ); } );
+BENCHMARK_CAPTURE( BM_api, expandToThreeDimensions_planeStrain, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::expandToThreeDimensions< planeStrain >( in.planeStrainF, out.t[ 0 ], 1.0 ); } );
+BENCHMARK_CAPTURE( BM_api, expandToThreeDimensions_axisymmetric, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::expandToThreeDimensions< axisymmetric >( in.axisymmetricF, out.t[ 0 ], 1.0 ); } );
+BENCHMARK_CAPTURE( BM_api, computeRightCauchyGreen, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeRightCauchyGreen( in.F, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeRightCauchyGreen_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeRightCauchyGreen( in.F, out.v[ 0 ], out.v[ 1 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeRightCauchyGreen_matrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeRightCauchyGreen( in.F, out.v[ 0 ], out.m[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeRightCauchyGreen_status, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeRightCauchyGreen( in.F, out.v[ 0 ], out.status ); } );
+BENCHMARK_CAPTURE( BM_api, computeRightCauchyGreen_statusFlatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeRightCauchyGreen( in.F, out.v[ 0 ], out.v[ 1 ], out.status ); } );
+BENCHMARK_CAPTURE( BM_api, computeRightCauchyGreen_fixed, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeRightCauchyGreen( in.FTensor, out.t[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeRightCauchyGreen_fixedJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeRightCauchyGreen( in.FTensor, out.t[ 0 ], out.T[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeRightCauchyGreen_structuredJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeRightCauchyGreen( in.FTensor, out.t[ 0 ], out.J ); } );
+BENCHMARK_CAPTURE( BM_api, computeGreenLagrangeStrain, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeGreenLagrangeStrain( in.F, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeGreenLagrangeStrain_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeGreenLagrangeStrain( in.F, out.v[ 0 ], out.v[ 1 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeGreenLagrangeStrain_matrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeGreenLagrangeStrain( in.F, out.v[ 0 ], out.m[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeGreenLagrangeStrain_status, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeGreenLagrangeStrain( in.F, out.v[ 0 ], out.status ); } );
+BENCHMARK_CAPTURE( BM_api, computeGreenLagrangeStrain_statusFlatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeGreenLagrangeStrain( in.F, out.v[ 0 ], out.v[ 1 ], out.status ); } );
+BENCHMARK_CAPTURE( BM_api, computeGreenLagrangeStrain_fixed, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeGreenLagrangeStrain( in.FTensor, out.t[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeGreenLagrangeStrain_fixedJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeGreenLagrangeStrain( in.FTensor, out.t[ 0 ], out.T[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeGreenLagrangeStrain_structuredJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeGreenLagrangeStrain( in.FTensor, out.t[ 0 ], out.J ); } );
+BENCHMARK_CAPTURE( BM_api, computeDGreenLagrangeStrainDF_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeDGreenLagrangeStrainDF( in.F, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeDGreenLagrangeStrainDF_matrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeDGreenLagrangeStrainDF( in.F, out.m[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeDGreenLagrangeStrainDF_status, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDGreenLagrangeStrainDF( in.F, out.v[ 0 ], out.status ); } );
+BENCHMARK_CAPTURE( BM_api, computeDGreenLagrangeStrainDF_fixedJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDGreenLagrangeStrainDF( in.FTensor, out.T[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, decomposeGreenLagrangeStrain, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( in.E, out.v[ 0 ], out.s[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, decomposeGreenLagrangeStrain_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( in.E, out.v[ 0 ], out.s[ 0 ], out.v[ 1 ], out.v[ 2 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, decomposeGreenLagrangeStrain_matrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( in.E, out.v[ 0 ], out.s[ 0 ], out.m[ 0 ], out.v[ 1 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeIsochoricKinematics, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeIsochoricKinematics( in.gradU, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], out.s[ 0 ], true ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeIsochoricKinematics_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeIsochoricKinematics( in.gradU, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], out.s[ 0 ], out.v[ 3 ], out.v[ 4 ], true ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeIsochoricKinematics_fixed, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeIsochoricKinematics( in.gradUTensor, out.t[ 0 ], out.t[ 1 ], out.t[ 2 ], out.s[ 0 ], true ); } );
+BENCHMARK_CAPTURE( BM_api, computeIsochoricKinematics_fixedJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeIsochoricKinematics( in.gradUTensor, out.t[ 0 ], out.t[ 1 ], out.t[ 2 ], out.s[ 0 ], out.T[ 0 ], out.t[ 3 ], true ); } );
+BENCHMARK_CAPTURE( BM_api, mapPK2toCauchy, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::mapPK2toCauchy( in.PK2, in.F, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, WLF, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::WLF( in.temperature, in.WLFParameters, out.s[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, WLF_jacobian, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::WLF( in.temperature, in.WLFParameters, out.s[ 0 ], out.s[ 1 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeDFDt, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeDFDt( in.L, in.F, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeDFDt_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeDFDt( in.L, in.F, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeDFDt_matrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeDFDt( in.L, in.F, out.v[ 0 ], out.m[ 0 ], out.m[ 1 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, midpointEvolution_vectorAlpha, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::midpointEvolution( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], in.alpha ) ); } );
+BENCHMARK_CAPTURE( BM_api, midpointEvolution_vectorAlpha_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::midpointEvolutionFlatJ( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], in.alpha ) ); } );
+BENCHMARK_CAPTURE( BM_api, midpointEvolution_vectorAlpha_flatJp, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::midpointEvolutionFlatJ( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], out.v[ 3 ], in.alpha ) ); } );
+BENCHMARK_CAPTURE( BM_api, midpointEvolution_vectorAlpha_diagonalJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::midpointEvolutionDiagonalJ( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], in.alpha ) ); } );
+BENCHMARK_CAPTURE( BM_api, midpointEvolution_vectorAlpha_diagonalJp, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::midpointEvolutionDiagonalJ( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], out.v[ 3 ], in.alpha ) ); } );
+BENCHMARK_CAPTURE( BM_api, midpointEvolution_vectorAlpha_matrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::midpointEvolution( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.m[ 0 ], in.alpha ) ); } );
+BENCHMARK_CAPTURE( BM_api, midpointEvolution_vectorAlpha_matrixJp, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::midpointEvolution( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.m[ 0 ], out.m[ 1 ], in.alpha ) ); } );
+BENCHMARK_CAPTURE( BM_api, midpointEvolution, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::midpointEvolution( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], 0.5 ) ); } );
+BENCHMARK_CAPTURE( BM_api, midpointEvolution_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::midpointEvolutionFlatJ( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], 0.5 ) ); } );
+BENCHMARK_CAPTURE( BM_api, midpointEvolution_flatJp, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::midpointEvolutionFlatJ( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], out.v[ 3 ], 0.5 ) ); } );
+BENCHMARK_CAPTURE( BM_api, midpointEvolutionBatched, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ out.v[ 1 ].assign( in.Fp.begin( ), in.Fp.end( ) ); out.v[ 0 ].resize( in.Fp.size( ) ); tardigradeConstitutiveTools::midpointEvolutionBatched( in.Fp.size( ), 1e-2, in.Lp.data( ), in.L.data( ), out.v[ 1 ].data( ), out.v[ 0 ].data( ), 0.5, out.status ); } );
+BENCHMARK_CAPTURE( BM_api, midpointEvolutionBatched_vectorAlpha, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ out.v[ 1 ].assign( in.Fp.begin( ), in.Fp.end( ) ); out.v[ 0 ].resize( in.Fp.size( ) ); tardigradeConstitutiveTools::midpointEvolutionBatched( 1, in.Fp.size( ), 1e-2, in.Lp.data( ), in.L.data( ), out.v[ 1 ].data( ), out.v[ 0 ].data( ), in.alpha.data( ), out.status ); } );
+BENCHMARK_CAPTURE( BM_api, midpointEvolution_diagonalJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::midpointEvolutionDiagonalJ( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], 0.5 ) ); } );
+BENCHMARK_CAPTURE( BM_api, midpointEvolution_diagonalJp, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::midpointEvolutionDiagonalJ( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], out.v[ 3 ], 0.5 ) ); } );
+BENCHMARK_CAPTURE( BM_api, midpointEvolution_matrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::midpointEvolution( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.m[ 0 ], 0.5 ) ); } );
+BENCHMARK_CAPTURE( BM_api, midpointEvolution_matrixJp, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::midpointEvolution( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.m[ 0 ], out.m[ 1 ], 0.5 ) ); } );
+BENCHMARK_CAPTURE( BM_api, evolveF_dF, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::evolveF( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], 0.5, 1 ) ); } );
+BENCHMARK_CAPTURE( BM_api, evolveF_dF_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::evolveFFlatJ( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], 0.5, 1 ) ); } );
+BENCHMARK_CAPTURE( BM_api, evolveF_dF_matrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::evolveF( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.m[ 0 ], 0.5, 1 ) ); } );
+BENCHMARK_CAPTURE( BM_api, evolveF, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::evolveF( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], 0.5, 1 ) ); } );
+BENCHMARK_CAPTURE( BM_api, evolveF_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::evolveFFlatJ( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], 0.5, 1 ) ); } );
+BENCHMARK_CAPTURE( BM_api, evolveF_matrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::evolveF( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.m[ 0 ], 0.5, 1 ) ); } );
+BENCHMARK_CAPTURE( BM_api, evolveF_allFlatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::evolveFFlatJ( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], out.v[ 3 ], 0.5, 1 ) ); } );
+BENCHMARK_CAPTURE( BM_api, evolveF_allMatrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::evolveF( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.m[ 0 ], out.m[ 1 ], out.m[ 2 ], 0.5, 1 ) ); } );
+BENCHMARK_CAPTURE( BM_api, evolveF_dF_allFlatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::evolveFFlatJ( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], out.v[ 3 ], out.v[ 4 ], out.v[ 5 ], 0.5, 1 ) ); } );
+BENCHMARK_CAPTURE( BM_api, evolveF_dF_allMatrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::evolveF( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.m[ 0 ], out.m[ 1 ], out.m[ 2 ], out.m[ 3 ], 0.5, 1 ) ); } );
+BENCHMARK_CAPTURE( BM_api, evolveF_mode2_allFlatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::evolveFFlatJ( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], out.v[ 3 ], 0.5, 2 ) ); } );
+BENCHMARK_CAPTURE( BM_api, evolveFJvp, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::evolveFJvp( 1e-2, in.Fp, in.Lp, in.L, in.deltaL, out.v[ 0 ], out.v[ 1 ], 0.5, 1 ) ); } );
+BENCHMARK_CAPTURE( BM_api, evolveFJvp_all, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::evolveFJvp( 1e-2, in.Fp, in.Lp, in.L, in.deltaL, in.gradU, in.deltaL, out.v[ 0 ], out.v[ 1 ], 0.5, 1 ) ); } );
+BENCHMARK_CAPTURE( BM_api, evolveFVjp, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::evolveFVjp( 1e-2, in.Fp, in.Lp, in.L, in.deltaL, out.v[ 0 ], out.v[ 1 ], 0.5, 1 ) ); } );
+BENCHMARK_CAPTURE( BM_api, evolveFVjp_all, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::evolveFVjp( 1e-2, in.Fp, in.Lp, in.L, in.deltaL, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], out.v[ 3 ], 0.5, 1 ) ); } );
+BENCHMARK_CAPTURE( BM_api, evolveF_current, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::evolveF< currentConfiguration >( 1e-2, in.FpTensor, in.LpTensor, in.LTensor, out.t[ 0 ], out.t[ 1 ], 0.5 ); } );
+BENCHMARK_CAPTURE( BM_api, evolveF_currentJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::evolveF< currentConfiguration >( 1e-2, in.FpTensor, in.LpTensor, in.LTensor, out.t[ 0 ], out.t[ 1 ], out.T[ 0 ], 0.5 ); } );
+BENCHMARK_CAPTURE( BM_api, evolveF_current_allJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::evolveF< currentConfiguration >( 1e-2, in.FpTensor, in.LpTensor, in.LTensor, out.t[ 0 ], out.t[ 1 ], out.T[ 0 ], out.T[ 1 ], out.T[ 2 ], out.T[ 3 ], 0.5 ); } );
+BENCHMARK_CAPTURE( BM_api, evolveF_reference_allJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::evolveF< referenceConfiguration >( 1e-2, in.FpTensor, in.LpTensor, in.LTensor, out.t[ 0 ], out.t[ 1 ], out.T[ 0 ], out.T[ 1 ], out.T[ 2 ], out.T[ 3 ], 0.5 ); } );
+BENCHMARK_CAPTURE( BM_api, evolveFAdaptive_current, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ unsigned int n; tardigradeConstitutiveTools::evolveFAdaptive< currentConfiguration >( 1e-2, in.FpTensor, in.LpTensor, in.LTensor, out.t[ 0 ], n, out.status, 0.5, 1e-6 ); } );
+BENCHMARK_CAPTURE( BM_api, evolveFAdaptive_currentJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ unsigned int n; tardigradeConstitutiveTools::evolveFAdaptive< currentConfiguration >( 1e-2, in.FpTensor, in.LpTensor, in.LTensor, out.t[ 0 ], out.T[ 0 ], out.T[ 1 ], out.T[ 2 ], n, out.status, 0.5, 1e-6 ); } );
+BENCHMARK_CAPTURE( BM_api, evolveFAdaptive_largeStepJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ unsigned int n; tardigradeConstitutiveTools::evolveFAdaptive< currentConfiguration >( 1.0, in.FpTensor, in.LpTensor, in.LTensor, out.t[ 0 ], out.T[ 0 ], out.T[ 1 ], out.T[ 2 ], n, out.status, 0.5, 1e-6 ); } );
+BENCHMARK_CAPTURE( BM_api, evolveFAdaptive_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ unsigned int n; consume( tardigradeConstitutiveTools::evolveFAdaptiveFlatJ( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], out.v[ 3 ], n, 0.5, 1, 1e-6 ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeMatrixExponential, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeMatrixExponential( in.DtLTensor, out.t[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeMatrixExponential_fixedJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeMatrixExponential( in.DtLTensor, out.t[ 0 ], out.T[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, evolveFExponentialMap, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::evolveFExponentialMap( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], 0.5 ); } );
+BENCHMARK_CAPTURE( BM_api, evolveFExponentialMap_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::evolveFExponentialMap( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], 0.5 ); } );
+BENCHMARK_CAPTURE( BM_api, evolveFExponentialMap_allFlatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::evolveFExponentialMap( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], out.v[ 3 ], 0.5 ); } );
+BENCHMARK_CAPTURE( BM_api, evolveFMagnus4, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::evolveFMagnus( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], 4 ); } );
+BENCHMARK_CAPTURE( BM_api, evolveFMagnus4_allFlatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::evolveFMagnus( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], out.v[ 3 ], 4 ); } );
+BENCHMARK_CAPTURE( BM_api, evolveFRungeKutta4, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::evolveFRungeKutta4( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, evolveFRungeKutta4_allFlatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::evolveFRungeKutta4( 1e-2, in.Fp, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ], out.v[ 3 ] ); } );
+BENCHMARK_CAPTURE( BM_api, mac, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ out.s[ 0 ] = tardigradeConstitutiveTools::mac( in.L[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, mac_jacobian, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ out.s[ 0 ] = tardigradeConstitutiveTools::mac( in.L[ 0 ], out.s[ 1 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeUnitNormal, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeUnitNormal( in.L, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeUnitNormal_matrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeUnitNormal( in.L, out.v[ 0 ], out.m[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackVelocityGradient, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pullBackVelocityGradient( in.L, in.F, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackVelocityGradient_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pullBackVelocityGradient( in.L, in.F, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackVelocityGradient_matrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pullBackVelocityGradient( in.L, in.F, out.v[ 0 ], out.m[ 0 ], out.m[ 1 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackVelocityGradient_kinematics, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pullBackVelocityGradient( in.L, in.kinematics, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackVelocityGradient_kinematicsFlatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pullBackVelocityGradient( in.L, in.kinematics, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, quadraticThermalExpansion, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::quadraticThermalExpansion( in.temperature, 293.15, in.Lp, in.L, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, quadraticThermalExpansion_jacobian, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::quadraticThermalExpansion( in.temperature, 293.15, in.Lp, in.L, out.v[ 0 ], out.v[ 1 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pushForwardGreenLagrangeStrain, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( in.E, in.F, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pushForwardGreenLagrangeStrain_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( in.E, in.F, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pushForwardGreenLagrangeStrain_matrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( in.E, in.F, out.v[ 0 ], out.m[ 0 ], out.m[ 1 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pushForwardGreenLagrangeStrain_kinematics, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( in.E, in.kinematics, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pushForwardGreenLagrangeStrain_kinematicsFlatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( in.E, in.kinematics, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackAlmansiStrain, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pullBackAlmansiStrain( in.e, in.F, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackAlmansiStrain_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pullBackAlmansiStrain( in.e, in.F, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackAlmansiStrain_matrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pullBackAlmansiStrain( in.e, in.F, out.v[ 0 ], out.m[ 0 ], out.m[ 1 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackAlmansiStrain_kinematics, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pullBackAlmansiStrain( in.e, in.kinematics, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackAlmansiStrain_kinematicsFlatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pullBackAlmansiStrain( in.e, in.kinematics, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeSymmetricPart_dim, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeSymmetricPart( in.L, out.v[ 0 ], out.dim ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeSymmetricPart, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeSymmetricPart( in.L, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeSymmetricPart_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeSymmetricPart( in.L, out.v[ 0 ], out.v[ 1 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeSymmetricPart_matrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::computeSymmetricPart( in.L, out.v[ 0 ], out.m[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pushForwardPK2Stress, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pushForwardPK2Stress( in.PK2, in.F, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pushForwardPK2Stress_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pushForwardPK2Stress( in.PK2, in.F, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pushForwardPK2Stress_matrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pushForwardPK2Stress( in.PK2, in.F, out.v[ 0 ], out.m[ 0 ], out.m[ 1 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pushForwardPK2Stress_kinematics, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pushForwardPK2Stress( in.PK2, in.kinematics, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pushForwardPK2Stress_kinematicsFlatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pushForwardPK2Stress( in.PK2, in.kinematics, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackCauchyStress, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pullBackCauchyStress( in.cauchy, in.F, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackCauchyStress_flatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pullBackCauchyStress( in.cauchy, in.F, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackCauchyStress_matrixJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pullBackCauchyStress( in.cauchy, in.F, out.v[ 0 ], out.m[ 0 ], out.m[ 1 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackCauchyStress_kinematics, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pullBackCauchyStress( in.cauchy, in.kinematics, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackCauchyStress_kinematicsFlatJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::pullBackCauchyStress( in.cauchy, in.kinematics, out.v[ 0 ], out.v[ 1 ], out.v[ 2 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, computeDCurrentNormalVectorDF, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDCurrentNormalVectorDF( in.normal, in.F, out.v[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeDCurrentNormalVectorDF_kinematics, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDCurrentNormalVectorDF( in.normal, in.kinematics, out.v[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeDCurrentAreaWeightedNormalVectorDF, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDCurrentAreaWeightedNormalVectorDF( in.normal, in.F, out.v[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeDCurrentAreaWeightedNormalVectorDF_kinematics, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDCurrentAreaWeightedNormalVectorDF( in.normal, in.kinematics, out.v[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeDCurrentAreaDF, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDCurrentAreaDF( in.normal, in.F, out.v[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeDCurrentAreaDF_kinematics, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDCurrentAreaDF( in.normal, in.kinematics, out.v[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeDCurrentNormalVectorDGradU, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDCurrentNormalVectorDGradU( in.normal, in.gradU, out.v[ 0 ], true ); } );
+BENCHMARK_CAPTURE( BM_api, computeDCurrentAreaWeightedNormalVectorDGradU, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDCurrentAreaWeightedNormalVectorDGradU( in.normal, in.gradU, out.v[ 0 ], true ); } );
+BENCHMARK_CAPTURE( BM_api, computeDCurrentAreaDGradU, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDCurrentAreaDGradU( in.normal, in.gradU, out.v[ 0 ], true ); } );
+BENCHMARK_CAPTURE( BM_api, computeDCurrentNormalVectorDGradU_reference, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDCurrentNormalVectorDGradU( in.normal, in.gradU, out.v[ 0 ], false ); } );
+BENCHMARK_CAPTURE( BM_api, computeDCurrentNormalVectorDGradU_fixed, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDCurrentNormalVectorDGradU( in.normalTensor, in.gradUTensor, out.tot[ 0 ], true ); } );
+BENCHMARK_CAPTURE( BM_api, computeDCurrentAreaWeightedNormalVectorDGradU_fixed, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDCurrentAreaWeightedNormalVectorDGradU( in.normalTensor, in.gradUTensor, out.tot[ 0 ], true ); } );
+BENCHMARK_CAPTURE( BM_api, computeDCurrentAreaDGradU_fixed, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeDCurrentAreaDGradU( in.normalTensor, in.gradUTensor, out.t[ 0 ], true ); } );
+BENCHMARK_CAPTURE( BM_api, KinematicState, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){
+    KinematicState kinematics( in.FTensor );
+    out.s[ 0 ] = kinematics.determinant( ) + kinematics.cofactor( )[ 0 ] + kinematics.inverse( )[ 0 ] + kinematics.rightCauchyGreen( )[ 0 ] + kinematics.inverseRightCauchyGreen( )[ 0 ];
+} );
+BENCHMARK_CAPTURE( BM_api, StructuredJacobian_apply, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){
+    tardigradeConstitutiveTools::computeRightCauchyGreen( in.FTensor, out.t[ 0 ], out.J );
+    out.J.apply( in.gradUTensor, out.t[ 1 ] );
+    out.J.applyTranspose( in.gradUTensor, out.t[ 2 ] );
+} );
+BENCHMARK_CAPTURE( BM_api, StructuredJacobian_compose, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){
+    StructuredJacobian dFdGradU;
+    tardigradeConstitutiveTools::computeDeformationGradient( in.gradUTensor, out.t[ 0 ], dFdGradU, true );
+    tardigradeConstitutiveTools::computeGreenLagrangeStrain( out.t[ 0 ], out.t[ 1 ], out.J );
+    out.J.compose( dFdGradU ).toDense( out.T[ 0 ] );
+} );
+BENCHMARK_CAPTURE( BM_api, StructuredJacobian_addTerm, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){
+    out.J = StructuredJacobian::kronecker( in.FTensor, in.QTensor );
+    out.J += StructuredJacobian::transposedKronecker( in.QTensor, in.FTensor );
+    out.J += StructuredJacobian::rankOne( in.FTensor, in.gradUTensor );
+    out.J += StructuredJacobian::identity( 2 );
+} );
+BENCHMARK_CAPTURE( BM_api, StructuredJacobian_applyStructured, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ in.structuredDCDF.apply( in.gradUTensor, out.t[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, StructuredJacobian_applyDense, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ in.denseDCDF.apply( in.gradUTensor, out.t[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, asMatrix, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ out.s[ 0 ] = tardigradeConstitutiveTools::asMatrix( in.PK2, 3 )[ 1 ][ 2 ]; } );
+BENCHMARK_CAPTURE( BM_api, toMandel, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::toMandel( in.PK2, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, fromMandel, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::fromMandel( in.mandelEVector, out.v[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, toMandel_fixed, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::toMandel( in.FTensor, out.mv[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, fromMandel_fixed, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::fromMandel( in.mandelE, out.t[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, toMandel_mandelJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::toMandel( in.dEdFTensor, out.mm[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, fromMandel_mandelJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::fromMandel( in.mandelDCauchyDPK2, out.T[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, toMandel_mandelGradientJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::toMandel( in.dEdFTensor, out.mg[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, fromMandel_mandelGradientJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::fromMandel( in.mandelDEDF, out.T[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeRightCauchyGreen_mandel, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeRightCauchyGreen( in.FTensor, out.mv[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeRightCauchyGreen_mandelJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeRightCauchyGreen( in.FTensor, out.mv[ 0 ], out.mg[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeGreenLagrangeStrain_mandel, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeGreenLagrangeStrain( in.FTensor, out.mv[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, computeGreenLagrangeStrain_mandelJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::computeGreenLagrangeStrain( in.FTensor, out.mv[ 0 ], out.mg[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, decomposeGreenLagrangeStrain_mandel, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( in.mandelE, out.mv[ 0 ], out.s[ 0 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, decomposeGreenLagrangeStrain_mandelJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ consume( tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( in.mandelE, out.mv[ 0 ], out.s[ 0 ], out.mm[ 0 ], out.mv[ 1 ] ) ); } );
+BENCHMARK_CAPTURE( BM_api, pushForwardGreenLagrangeStrain_mandel, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( in.mandelE, in.FTensor, out.mv[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, pushForwardGreenLagrangeStrain_mandelJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( in.mandelE, in.FTensor, out.mv[ 0 ], out.mm[ 0 ], out.mg[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, pushForwardPK2Stress_mandel, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::pushForwardPK2Stress( in.mandelPK2, in.FTensor, out.mv[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, pushForwardPK2Stress_mandelJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::pushForwardPK2Stress( in.mandelPK2, in.FTensor, out.mv[ 0 ], out.mm[ 0 ], out.mg[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackCauchyStress_mandel, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::pullBackCauchyStress( in.mandelCauchy, in.FTensor, out.mv[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, pullBackCauchyStress_mandelJ, []( const BenchmarkInputs &in, BenchmarkOutputs &out ){ tardigradeConstitutiveTools::pullBackCauchyStress( in.mandelCauchy, in.FTensor, out.mv[ 0 ], out.mm[ 0 ], out.mg[ 0 ] ); } );
+BENCHMARK_CAPTURE( BM_api, statusMessage, []( const BenchmarkInputs &, BenchmarkOutputs &out ){ benchmark::DoNotOptimize( tardigradeConstitutiveTools::statusMessage( out.status ) ); } );
+
+BENCHMARK_MAIN( );
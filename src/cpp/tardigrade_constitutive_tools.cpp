@@ -21,9 +21,169 @@
 #include<tardigrade_constitutive_tools.h>
 
 #include<algorithm>
+#include<cmath>
+#include<cstring>
+#include<limits>
+#include<type_traits>
+
+#ifndef TARDIGRADE_CONSTITUTIVE_TOOLS_DISABLE_SIMD
+    #if defined( __AVX512F__ )
+        #define TARDIGRADE_CONSTITUTIVE_TOOLS_USE_AVX512
+    #endif
+    #if defined( __AVX2__ ) && defined( __FMA__ )
+        #define TARDIGRADE_CONSTITUTIVE_TOOLS_USE_AVX2
+    #endif
+    #if defined( __SSE2__ )
+        #define TARDIGRADE_CONSTITUTIVE_TOOLS_USE_SSE2
+    #endif
+#endif
+
+#if defined( TARDIGRADE_CONSTITUTIVE_TOOLS_USE_AVX512 ) || defined( TARDIGRADE_CONSTITUTIVE_TOOLS_USE_AVX2 ) || defined( TARDIGRADE_CONSTITUTIVE_TOOLS_USE_SSE2 )
+    #include<immintrin.h>
+#endif
+
+// Size checks used by the overloads which report a statusCode. These never allocate or throw and are removed
+// entirely when the library is compiled with TARDIGRADE_CONSTITUTIVE_TOOLS_UNCHECKED
+#ifdef TARDIGRADE_CONSTITUTIVE_TOOLS_UNCHECKED
+    #define TARDIGRADE_CONSTITUTIVE_TOOLS_STATUS_CHECK( condition, code, message )
+#else
+    #define TARDIGRADE_CONSTITUTIVE_TOOLS_STATUS_CHECK( condition, code, message ) \
+        do{ if ( !( condition ) ){ status = setStatus( code, message ); return; } }while( 0 )
+#endif
 
 namespace tardigradeConstitutiveTools{
 
+    static thread_local char statusDetailBuffer[ 256 ] = { '\0' }; //!< The reason for the most recent failure on this thread
+
+    static statusCode setStatus( const statusCode status, const char *message ){
+        /*!
+         * Record the reason for a failure in the thread-local detail buffer and return the status. No
+         * allocations are performed. The buffer is not written if the library was compiled with
+         * TARDIGRADE_CONSTITUTIVE_TOOLS_STATUS_ONLY.
+         *
+         * \param status: The status code of the failure
+         * \param *message: The description of the failure
+         */
+
+#ifndef TARDIGRADE_CONSTITUTIVE_TOOLS_STATUS_ONLY
+        std::strncpy( statusDetailBuffer, message, sizeof( statusDetailBuffer ) - 1 );
+        statusDetailBuffer[ sizeof( statusDetailBuffer ) - 1 ] = '\0';
+#else
+        ( void )message;
+#endif
+
+        return status;
+
+    }
+
+    static statusCode clearStatus( ){
+        /*!
+         * Clear the thread-local failure detail so that statusDetail does not report a stale failure and return
+         * statusCode::success. No allocations are performed.
+         */
+
+        statusDetailBuffer[ 0 ] = '\0';
+
+        return statusCode::success;
+
+    }
+
+    const char *statusMessage( const statusCode status ){
+        /*!
+         * Get a short description of a status code
+         *
+         * \param status: The status code
+         */
+
+        switch ( status ){
+
+            case statusCode::success:
+
+                return "Success";
+
+            case statusCode::sizeMismatch:
+
+                return "The inputs have inconsistent sizes";
+
+            case statusCode::notSquare:
+
+                return "The matrix is not square";
+
+            case statusCode::notThreeDimensional:
+
+                return "The tensor must be 3D";
+
+            case statusCode::outOfRange:
+
+                return "A parameter is outside of its allowed range";
+
+            case statusCode::nearlySingular:
+
+                return "The matrix is singular or nearly singular";
+
+            case statusCode::notConverged:
+
+                return "The procedure did not converge within the allowed number of iterations";
+
+        }
+
+        return "Unknown status";
+
+    }
+
+    const char *statusDetail( ){
+        /*!
+         * Get the reason for the most recent failure of a statusCode overload on the calling thread. The
+         * detail is empty if the most recent call succeeded or if the library was compiled with
+         * TARDIGRADE_CONSTITUTIVE_TOOLS_STATUS_ONLY.
+         */
+
+        return statusDetailBuffer;
+
+    }
+
+    static const char *statusDescription( const statusCode status ){
+        /*!
+         * Get the most specific description of a failure available. This is the thread-local detail if it was
+         * recorded and the generic message of the status code otherwise.
+         *
+         * \param status: The status code of the failure
+         */
+
+        return ( statusDetailBuffer[ 0 ] != '\0' ) ? statusDetailBuffer : statusMessage( status );
+
+    }
+
+    floatMatrixView asMatrix( floatVector &flat, const unsigned int columns ){
+        /*!
+         * Construct a mutable row-major view of a flat vector without copying
+         *
+         * \param &flat: The flat vector stored in row-major order
+         * \param columns: The number of columns. The number of rows is the size of the vector divided by the number of columns.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( ( columns == 0 ) ? flat.empty( ) : ( flat.size( ) % columns == 0 ),
+                                      "The vector of size " + std::to_string( flat.size( ) ) + " can't be viewed with " + std::to_string( columns ) + " columns" );
+
+        return floatMatrixView( flat.data( ), ( columns == 0 ) ? 0 : flat.size( ) / columns, columns );
+
+    }
+
+    constFloatMatrixView asMatrix( const floatVector &flat, const unsigned int columns ){
+        /*!
+         * Construct a read-only row-major view of a flat vector without copying
+         *
+         * \param &flat: The flat vector stored in row-major order
+         * \param columns: The number of columns. The number of rows is the size of the vector divided by the number of columns.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( ( columns == 0 ) ? flat.empty( ) : ( flat.size( ) % columns == 0 ),
+                                      "The vector of size " + std::to_string( flat.size( ) ) + " can't be viewed with " + std::to_string( columns ) + " columns" );
+
+        return constFloatMatrixView( flat.data( ), ( columns == 0 ) ? 0 : flat.size( ) / columns, columns );
+
+    }
+
     floatType deltaDirac(const unsigned int i, const unsigned int j){
         /*!
          * The delta dirac function \f$\delta\f$
@@ -55,2565 +215,9941 @@ namespace tardigradeConstitutiveTools{
          */
 
         //Check the size of A
-        if (A.size() != Q.size()){
-            return new errorNode("rotateMatrix", "A and Q must have the same number of values");
+        if ( A.size( ) != Q.size( ) ){
+            return new errorNode( "rotateMatrix", "A and Q must have the same number of values" );
         }
 
         //Set the dimension to be the square-root of the size of A
-        const unsigned int dim = std::sqrt(A.size());
-        if (A.size() % dim != 0){
-            return new errorNode("rotateMatrix", "A must be square");
+        const unsigned int dim = std::round( std::sqrt( A.size( ) ) );
+        if ( dim * dim != A.size( ) ){
+            return new errorNode( "rotateMatrix", "A must be square" );
         }
 
-        //Resize rotated A
-        rotatedA.resize(A.size());
+        statusCode status;
 
-        for (unsigned int i=0; i<dim; i++){
-            for (unsigned int j=0; j<dim; j++){
-                for (unsigned int I=0; I<dim; I++){
-                    for (unsigned int J=0; J<dim; J++){
-                        rotatedA[i*dim + j] += Q[I*dim + i] * A[I*dim + J] * Q[J*dim + j];
-                    }
-                }
-            }
+        rotateMatrix( A, Q, rotatedA, status );
+
+        if ( status != statusCode::success ){
+            return new errorNode( "rotateMatrix", statusDescription( status ) );
         }
 
         return NULL;
     }
 
-    void computeDeformationGradient( const floatVector &displacementGradient, floatVector &F, const bool isCurrent ){
+    void rotateMatrix( const floatVector &A, const floatVector &Q, floatVector &rotatedA, statusCode &status ){
         /*!
-         * Compute the deformation gradient from the gradient of the displacement
-         *
-         * If isCurrent = false
-         *
-         * \f$ \bf{F} = \frac{\partial \bf{u}}{\partial \bf{X} } u_i + \bf{I} \f$
-         *
-         * else if isCurrent = true
+         * Rotate a matrix \f$A\f$ using the orthogonal matrix \f$Q\f$ with the form
+         * 
+         * \f$A'_{ij} = Q_{Ii} A_{IJ} Q_{Jj}\f$
          *
-         * \f$ \bf{F} = \left(\bf{I} - \frac{\partial \bf{u}}{\partial \bf{x}}\right)^{-1} \f$
+         * Failures are reported through the status code without allocating or throwing.
          *
-         * \param &displacementGradient: The gradient of the displacement with respect to either the
-         *     current or previous position.
-         * \param &F: The deformation gradient
-         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
-         *     or reference (false) position.
+         * \param &A: The matrix to be rotated ( \f$A\f$ )
+         * \param &Q: The rotation matrix ( \f$Q\f$Q )
+         * \param &rotatedA: The rotated matrix ( \f$A'\f$ )
+         * \param &status: The status of the operation
          */
 
-        const unsigned int dim = ( unsigned int )std::pow( displacementGradient.size( ), 0.5 );
-        const unsigned int sot_dim = dim * dim;
+        status = clearStatus( );
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( displacementGradient.size( ) == sot_dim, "The displacement gradienthas " + std::to_string( displacementGradient.size( ) ) + " values but the dimension has been determined to be " + std::to_string( dim ) + "." );
+        //Check the size of A
+        TARDIGRADE_CONSTITUTIVE_TOOLS_STATUS_CHECK( A.size( ) == Q.size( ), statusCode::sizeMismatch, "A and Q must have the same number of values" );
 
-        F = floatVector( sot_dim, 0 );
+        //Set the dimension to be the square-root of the size of A
+        const unsigned int dim = std::round( std::sqrt( A.size( ) ) );
 
-        std::copy( displacementGradient.begin( ),
-                   displacementGradient.end( ),
-                   F.begin( ) );
+        TARDIGRADE_CONSTITUTIVE_TOOLS_STATUS_CHECK( dim * dim == A.size( ), statusCode::notSquare, "A must be square" );
 
-        if ( isCurrent ){
+        //Initialize rotated A
+        rotatedA.assign( A.size( ), 0 );
 
-            std::transform( F.cbegin( ), F.cend( ), F.begin( ), std::negate< floatType >( ) );
+        // Factor the rotation as A' = ( Q^T A ) Q so that each component of Q^T A is only formed once
+        for ( unsigned int i = 0; i < dim; i++ ){
 
-            for ( unsigned int i = 0; i < dim; i++ ){ F[ dim * i + i ] += 1; }
+            for ( unsigned int J = 0; J < dim; J++ ){
 
-            Eigen::Map< Eigen::Matrix< floatType, -1, -1 > > map( F.data( ), dim, dim );
-            map = map.inverse( ).eval( );
+                floatType QTA_iJ = 0;
 
-        }
-        else{
+                for ( unsigned int I = 0; I < dim; I++ ){
 
-            for ( unsigned int i = 0; i < dim; i++ ){ F[ dim * i + i ] += 1.; }
+                    QTA_iJ += Q[ dim * I + i ] * A[ dim * I + J ];
 
-        }
+                }
 
-        return;
+                for ( unsigned int j = 0; j < dim; j++ ){
+
+                    rotatedA[ dim * i + j ] += QTA_iJ * Q[ dim * J + j ];
+
+                }
+
+            }
+
+        }
 
     }
 
-    void computeDeformationGradient( const floatVector &displacementGradient, floatVector &F, floatVector &dFdGradU, const bool isCurrent ){
+    errorOut rotateMatrix( const floatVector &A, const floatVector &Q, floatVector &rotatedA, floatVector &dRotatedAdQ ){
         /*!
-         * Compute the deformation gradient from the gradient of the displacement
-         *
-         * If isCurrent = false
+         * Rotate a matrix \f$A\f$ using the orthogonal matrix \f$Q\f$ with the form
          *
-         * \f$ \bf{F} = \frac{\partial \bf{u}}{\partial \bf{X} } u_i + \bf{I} \f$
+         * \f$A'_{ij} = Q_{Ii} A_{IJ} Q_{Jj}\f$
          *
-         * else if isCurrent = true
+         * and compute the derivative w.r.t. the rotation matrix
          *
-         * \f$ \bf{F} = \left(\bf{I} - \frac{\partial \bf{u}}{\partial \bf{x}}\right)^{-1} \f$
+         * \f$\frac{\partial A'_{ij}}{\partial Q_{kl}} = \delta_{il} A_{kJ} Q_{Jj} + Q_{Ii} A_{Ik} \delta_{jl}\f$
          *
-         * \param &displacementGradient: The gradient of the displacement with respect to either the
-         *     current or previous position.
-         * \param &F: The deformation gradient
-         * \param &dFdGradU: The derivative of the deformation gradient w.r.t. the displacement gradient
-         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
-         *     or reference (false) position.
+         * \param &A: The matrix to be rotated ( \f$A\f$ )
+         * \param &Q: The rotation matrix ( \f$Q\f$ )
+         * \param &rotatedA: The rotated matrix ( \f$A'\f$ )
+         * \param &dRotatedAdQ: The derivative of the rotated matrix w.r.t. the rotation matrix
          */
 
-        const unsigned int dim = ( unsigned int )std::pow( displacementGradient.size( ), 0.5 );
-        const unsigned int sot_dim = dim * dim;
-
-        TARDIGRADE_ERROR_TOOLS_CHECK( displacementGradient.size( ) == sot_dim, "The displacement gradienthas " + std::to_string( displacementGradient.size( ) ) + " values but the dimension has been determined to be " + std::to_string( dim ) + "." );
+        TARDIGRADE_ERROR_TOOLS_CATCH( rotateMatrix( A, Q, rotatedA ) );
 
-        F = floatVector( sot_dim, 0 );
+        const unsigned int dim = std::round( std::sqrt( A.size( ) ) );
 
-        dFdGradU = floatVector( sot_dim * sot_dim, 0 );
+        const unsigned int sot_dim = dim * dim;
 
-        std::copy( displacementGradient.begin( ),
-                   displacementGradient.end( ),
-                   F.begin( ) );
+        dRotatedAdQ.assign( sot_dim * sot_dim, 0 );
 
-        if ( isCurrent ){
+        for ( unsigned int a = 0; a < dim; a++ ){
 
-            std::transform( F.cbegin( ), F.cend( ), F.begin( ), std::negate< floatType >( ) );
+            for ( unsigned int b = 0; b < dim; b++ ){
 
-            for ( unsigned int i = 0; i < dim; i++ ){ F[ dim * i + i ] += 1; }
+                // AQ_ab = A_aJ Q_Jb and QTA_ba = Q_Ib A_Ia
+                floatType AQ_ab  = 0;
 
-            Eigen::Map< Eigen::Matrix< floatType, -1, -1 > > map( F.data( ), dim, dim );
-            map = map.inverse( ).eval( );
+                floatType QTA_ba = 0;
 
-            for ( unsigned int i = 0; i < dim; i++ ){
+                for ( unsigned int I = 0; I < dim; I++ ){
 
-                for ( unsigned int j = 0; j < dim; j++ ){
+                    AQ_ab  += A[ dim * a + I ] * Q[ dim * I + b ];
 
-                    for ( unsigned int k = 0; k < dim; k++ ){
+                    QTA_ba += Q[ dim * I + b ] * A[ dim * I + a ];
 
-                        for ( unsigned int l = 0; l < dim; l++ ){
+                }
 
-                            dFdGradU[ dim * sot_dim * i + sot_dim * j + dim * k + l ]
-                                = F[ dim * i + k ] * F[ dim * l + j ];
+                for ( unsigned int l = 0; l < dim; l++ ){
 
-                        }
+                    // i = l and k = a, j = b
+                    dRotatedAdQ[ sot_dim * ( dim * l + b ) + dim * a + l ] += AQ_ab;
 
-                    }
+                    // j = l and k = a, i = b
+                    dRotatedAdQ[ sot_dim * ( dim * b + l ) + dim * a + l ] += QTA_ba;
 
                 }
 
             }
 
-        }
-        else{
-
-            for ( unsigned int i = 0; i < dim; i++ ){ F[ dim * i + i ] += 1.; }
-
-            for ( unsigned int i = 0; i < sot_dim; i++ ){ dFdGradU[ sot_dim * i + i ] += 1; }
-
         }
 
-        return;
+        return NULL;
 
     }
 
-    errorOut computeRightCauchyGreen( const floatVector &deformationGradient, floatVector &C ){
+    template< typename T >
+    static void rotateFourthOrderIndex( const fourthOrderTensor< T > &C, const secondOrderTensor< T > &Q, const unsigned int position,
+                                 fourthOrderTensor< T > &result ){
         /*!
-         * Compute the Right Cauchy-Green deformation tensor ( \f$C\f$ )
-         *
-         * \f$C_{IJ} = F_{iI} F_{iJ}\f$
-         *
-         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ )
-         * \param &C: The resulting Right Cauchy-Green deformation tensor ( \f$C\f$ )
+         * Rotate a single index of a fourth order tensor i.e. for position 0
          *
-         * The deformation gradient is organized as F11, F12, F13, F21, F22, F23, F31, F32, F33
+         * \f$R_{iJKL} = Q_{Ii} C_{IJKL}\f$
          *
-         * The Right Cauchy-Green deformation tensor is organized as C11, C12, C13, C21, C22, C23, C31, C32, C33
+         * \param &C: The fourth order tensor
+         * \param &Q: The rotation matrix
+         * \param position: The index to rotate ( 0, 1, 2, or 3 )
+         * \param &result: The tensor with the index rotated. Must not alias C.
          */
 
-        //Assume 3D
         constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( deformationGradient.size( ) == sot_dim, "The deformation gradient must be 3D" );
+        constexpr unsigned int strides[ 4 ] = { 27, 9, 3, 1 };
 
-        C = floatVector( sot_dim, 0 );
+        const unsigned int stride = strides[ position ];
 
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F( deformationGradient.data( ), dim, dim );
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > C_map( C.data( ), dim, dim );
+        // The indices before the rotated index are the outer blocks and the indices after it are contiguous
+        for ( unsigned int outer = 0; outer < 81; outer += dim * stride ){
 
-        C_map = ( F.transpose( ) * F ).eval( );
+            const T *C0 = C.data( ) + outer;
+            const T *C1 = C0 + stride;
+            const T *C2 = C1 + stride;
 
-        return NULL;
-    }
+            for ( unsigned int i = 0; i < dim; i++ ){
 
-    errorOut computeRightCauchyGreen( const floatVector &deformationGradient, floatVector &C, floatMatrix &dCdF ){
-        /*!
-         * Compute the Right Cauchy-Green deformation tensor ( \f$C\f$ ) from the deformation gradient ( \f$F\f$ )
-         * 
-         * \f$C_{IJ} = F_{iI} F_{iJ}\f$
-         * 
-         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ )
-         * \param &C: The resulting Right Cauchy-Green deformation tensor ( \f$C\f$ )
-         * \param &dCdF: The Jacobian of the Right Cauchy-Green deformation tensor
-         *     with regards to the deformation gradient ( \f$\frac{\partial C}{\partial F}\f$ ).
-         *
-         * The deformation gradient is organized as F11, F12, F13, F21, F22, F23, F31, F32, F33
-         *
-         * The Right Cauchy-Green deformation tensor is organized as C11, C12, C13, C21, C22, C23, C31, C32, C33
-         */
+                const T Q0i = Q[ dim * 0 + i ], Q1i = Q[ dim * 1 + i ], Q2i = Q[ dim * 2 + i ];
 
-        constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
+                T *R = result.data( ) + outer + i * stride;
 
-        floatVector _dCdF;
+                for ( unsigned int inner = 0; inner < stride; inner++ ){
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( computeRightCauchyGreen( deformationGradient, C, _dCdF ) );
+                    R[ inner ] = Q0i * C0[ inner ] + Q1i * C1[ inner ] + Q2i * C2[ inner ];
 
-        dCdF = tardigradeVectorTools::inflate( _dCdF, sot_dim, sot_dim );
+                }
 
-        return NULL;
+            }
+
+        }
 
     }
 
-    errorOut computeRightCauchyGreen( const floatVector &deformationGradient, floatVector &C, floatVector &dCdF ){
+    template< typename T >
+    void rotateSecondOrderTensor( const secondOrderTensor< T > &A, const secondOrderTensor< T > &Q, secondOrderTensor< T > &rotatedA ){
         /*!
-         * Compute the Right Cauchy-Green deformation tensor ( \f$C\f$ ) from the deformation gradient ( \f$F\f$ )
-         * 
-         * \f$C_{IJ} = F_{iI} F_{iJ}\f$
-         * 
-         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ )
-         * \param &C: The resulting Right Cauchy-Green deformation tensor ( \f$C\f$ )
-         * \param &dCdF: The Jacobian of the Right Cauchy-Green deformation tensor
-         *     with regards to the deformation gradient ( \f$\frac{\partial C}{\partial F}\f$ ).
+         * Rotate a second order tensor \f$A\f$ using the orthogonal matrix \f$Q\f$ in the factored form
          *
-         * The deformation gradient is organized as F11, F12, F13, F21, F22, F23, F31, F32, F33
+         * \f$A'_{ij} = Q_{Ii} \left( A_{IJ} Q_{Jj} \right)\f$
          *
-         * The Right Cauchy-Green deformation tensor is organized as C11, C12, C13, C21, C22, C23, C31, C32, C33
+         * \param &A: The second order tensor to be rotated ( \f$A\f$ )
+         * \param &Q: The rotation matrix ( \f$Q\f$ )
+         * \param &rotatedA: The rotated second order tensor ( \f$A'\f$ )
          */
 
-        //Assume 3D
         constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( computeRightCauchyGreen( deformationGradient, C ) );
-        
-        //Assemble the Jacobian
-        
-        dCdF = floatVector( sot_dim * sot_dim, 0 );
-        
+        secondOrderTensor< T > AQ;
+
         for ( unsigned int I = 0; I < dim; I++ ){
-            for ( unsigned int J = 0; J < dim; J++ ){
-                for ( unsigned int k = 0; k < dim; k++ ){
-                    dCdF[ dim * sot_dim * I + sot_dim * J + dim * k + I ] += deformationGradient[ dim * k + J ];
-                    dCdF[ dim * sot_dim * I + sot_dim * J + dim * k + J ] += deformationGradient[ dim * k + I ];
-                }
+
+            for ( unsigned int j = 0; j < dim; j++ ){
+
+                AQ[ dim * I + j ] = A[ dim * I + 0 ] * Q[ dim * 0 + j ] + A[ dim * I + 1 ] * Q[ dim * 1 + j ] + A[ dim * I + 2 ] * Q[ dim * 2 + j ];
+
             }
+
         }
 
-        return NULL;
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            for ( unsigned int j = 0; j < dim; j++ ){
+
+                rotatedA[ dim * i + j ] = Q[ dim * 0 + i ] * AQ[ dim * 0 + j ] + Q[ dim * 1 + i ] * AQ[ dim * 1 + j ] + Q[ dim * 2 + i ] * AQ[ dim * 2 + j ];
+
+            }
+
+        }
 
     }
 
-    errorOut computeGreenLagrangeStrain( const floatVector &deformationGradient,
-                                         floatVector &E ){
+    template< typename T >
+    void rotateSecondOrderTensor( const secondOrderTensor< T > &A, const secondOrderTensor< T > &Q, secondOrderTensor< T > &rotatedA,
+                                  fourthOrderTensor< T > &dRotatedAdQ ){
         /*!
-         * Compute the Green-Lagrange strain ( \f$E\f$ ) from the deformation gradient ( \f$F\f$ ). The operation is:
+         * Rotate a second order tensor \f$A\f$ using the orthogonal matrix \f$Q\f$ and compute the derivative
+         * w.r.t. the rotation matrix
          *
-         * \f$E = 0.5 (F_{iI} F_{iJ} - \delta_{IJ})\f$
-         *
-         * Where \f$F\f$ is the deformation gradient and \f$\delta\f$ is the kronecker delta.
-         *
-         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
-         * \param &E: The resulting Green-Lagrange strain ( \f$E\f$ ).
-         *
-         * The deformation gradient is organized as  F11, F12, F13, F21, F22, F23, F31, F32, F33
+         * \f$\frac{\partial A'_{ij}}{\partial Q_{kl}} = \delta_{il} \left(A Q\right)_{kj} + \delta_{jl} \left(Q^T A\right)_{ik}\f$
          *
-         * The Green-Lagrange strain is organized as E11, E12, E13, E21, E22, E23, E31, E32, E33
+         * \param &A: The second order tensor to be rotated ( \f$A\f$ )
+         * \param &Q: The rotation matrix ( \f$Q\f$ )
+         * \param &rotatedA: The rotated second order tensor ( \f$A'\f$ )
+         * \param &dRotatedAdQ: The derivative of the rotated tensor w.r.t. the rotation matrix
          */
 
-        if ( deformationGradient.size( ) != 9 ){
-            return new errorNode( "computeGreenLagrangeStrain", "The deformation gradient must be 3D." );
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        secondOrderTensor< T > AQ, QTA;
+
+        for ( unsigned int a = 0; a < dim; a++ ){
+
+            for ( unsigned int b = 0; b < dim; b++ ){
+
+                AQ[ dim * a + b ]  = A[ dim * a + 0 ] * Q[ dim * 0 + b ] + A[ dim * a + 1 ] * Q[ dim * 1 + b ] + A[ dim * a + 2 ] * Q[ dim * 2 + b ];
+
+                QTA[ dim * a + b ] = Q[ dim * 0 + a ] * A[ dim * 0 + b ] + Q[ dim * 1 + a ] * A[ dim * 1 + b ] + Q[ dim * 2 + a ] * A[ dim * 2 + b ];
+
+            }
+
         }
 
-        constexpr unsigned int dim=3;
-        E.resize( dim * dim );
+        std::fill( dRotatedAdQ.begin( ), dRotatedAdQ.end( ), 0 );
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            for ( unsigned int j = 0; j < dim; j++ ){
+
+                rotatedA[ dim * i + j ] = QTA[ dim * i + 0 ] * Q[ dim * 0 + j ] + QTA[ dim * i + 1 ] * Q[ dim * 1 + j ] + QTA[ dim * i + 2 ] * Q[ dim * 2 + j ];
+
+                for ( unsigned int k = 0; k < dim; k++ ){
+
+                    dRotatedAdQ[ sot_dim * ( dim * i + j ) + dim * k + i ] += AQ[ dim * k + j ];
+
+                    dRotatedAdQ[ sot_dim * ( dim * i + j ) + dim * k + j ] += QTA[ dim * i + k ];
 
-        for ( unsigned int I = 0; I < dim; I++ ){
-            E[ dim * I + I ] -= 1;
-            for ( unsigned int J = 0; J < dim; J++ ){
-                for ( unsigned int i = 0; i < dim; i++ ){
-                    E[ dim * I + J ] += deformationGradient[ dim * i + I ] * deformationGradient[ dim * i + J ];
                 }
-                E[ dim * I + J ] *= 0.5;
+
             }
+
         }
-        return NULL;
+
     }
 
-    errorOut computeGreenLagrangeStrain( const floatVector &deformationGradient, floatVector &E, floatMatrix &dEdF){
+    template< typename T >
+    void rotateFourthOrderTensor( const fourthOrderTensor< T > &C, const secondOrderTensor< T > &Q, fourthOrderTensor< T > &rotatedC ){
         /*!
-         * Compute the Green-Lagrange strain ( \f$E\f$ ) from the deformation gradient ( \f$F\f$ ) and it's jacobian.
+         * Rotate a fourth order tensor \f$C\f$ using the orthogonal matrix \f$Q\f$
          *
-         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
-         * \param &E: The resulting Green-Lagrange strain ( \f$E\f$ ).
-         * \param &dEdF: The jacobian of the Green-Lagrange strain w.r.t. the
-         *     deformation gradient ( \f$\frac{\partial E}{\partial F}\f$ ).
+         * \f$C'_{ijkl} = Q_{Ii} Q_{Jj} Q_{Kk} Q_{Ll} C_{IJKL}\f$
          *
-         * The deformation gradient is organized as  F11, F12, F13, F21, F22, F23, F31, F32, F33
+         * The rotation is performed one index at a time so that the cost is \f$O\left(dim^5\right)\f$ rather
+         * than \f$O\left(dim^8\right)\f$
          *
-         * The Green-Lagrange strain is organized as E11, E12, E13, E21, E22, E23, E31, E32, E33
+         * \param &C: The fourth order tensor to be rotated ( \f$C\f$ )
+         * \param &Q: The rotation matrix ( \f$Q\f$ )
+         * \param &rotatedC: The rotated fourth order tensor ( \f$C'\f$ )
          */
 
-        floatVector _dEdF;
+        fourthOrderTensor< T > temp1, temp2;
 
-        errorOut error = computeGreenLagrangeStrain( deformationGradient, E, _dEdF );
+        rotateFourthOrderIndex( C, Q, 0, temp1 );
 
-        if ( error ){
-            errorOut result = new errorNode( "computeGreenLagrangeStrain (jacobian)", "Error in computation of Green-Lagrange strain" );
-            result->addNext( error );
-            return result;
-        }
+        rotateFourthOrderIndex( temp1, Q, 1, temp2 );
 
-        dEdF = tardigradeVectorTools::inflate( _dEdF, deformationGradient.size( ), deformationGradient.size( ) );
+        rotateFourthOrderIndex( temp2, Q, 2, temp1 );
 
-        return NULL;
+        rotateFourthOrderIndex( temp1, Q, 3, rotatedC );
 
     }
 
-    errorOut computeGreenLagrangeStrain( const floatVector &deformationGradient, floatVector &E, floatVector &dEdF){
+    template< typename T >
+    void rotateFourthOrderTensor( const fourthOrderTensor< T > &C, const secondOrderTensor< T > &Q, fourthOrderTensor< T > &rotatedC,
+                                  sixthOrderTensor< T > &dRotatedCdQ ){
         /*!
-         * Compute the Green-Lagrange strain ( \f$E\f$ ) from the deformation gradient ( \f$F\f$ ) and it's jacobian.
+         * Rotate a fourth order tensor \f$C\f$ using the orthogonal matrix \f$Q\f$ and compute the derivative
+         * w.r.t. the rotation matrix
          *
-         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
-         * \param &E: The resulting Green-Lagrange strain ( \f$E\f$ ).
-         * \param &dEdF: The jacobian of the Green-Lagrange strain w.r.t. the
-         *     deformation gradient ( \f$\frac{\partial E}{\partial F}\f$ ).
+         * \f$\frac{\partial C'_{ijkl}}{\partial Q_{ab}} = \delta_{ib} P^{(0)}_{ajkl} + \delta_{jb} P^{(1)}_{iakl} + \delta_{kb} P^{(2)}_{ijal} + \delta_{lb} P^{(3)}_{ijka}\f$
          *
-         * The deformation gradient is organized as  F11, F12, F13, F21, F22, F23, F31, F32, F33
+         * where \f$P^{(p)}\f$ is \f$C\f$ with every index except index \f$p\f$ rotated.
          *
-         * The Green-Lagrange strain is organized as E11, E12, E13, E21, E22, E23, E31, E32, E33
+         * \param &C: The fourth order tensor to be rotated ( \f$C\f$ )
+         * \param &Q: The rotation matrix ( \f$Q\f$ )
+         * \param &rotatedC: The rotated fourth order tensor ( \f$C'\f$ )
+         * \param &dRotatedCdQ: The derivative of the rotated tensor w.r.t. the rotation matrix
          */
-        
-        errorOut error = computeGreenLagrangeStrain( deformationGradient, E );
 
-        if ( error ){
-            errorOut result = new errorNode( "computeGreenLagrangeStrain (jacobian)", "Error in computation of Green-Lagrange strain" );
-            result->addNext( error );
-            return result;
-        }
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+        constexpr unsigned int strides[ 4 ] = { 27, 9, 3, 1 };
 
-        error = computeDGreenLagrangeStrainDF( deformationGradient, dEdF );
+        // Rotating indices 0 and 1 is shared by P^(2) and P^(3) and rotating indices 2 and 3 by P^(0) and P^(1)
+        fourthOrderTensor< T > R01, R23, temp, P;
+
+        rotateFourthOrderIndex( C, Q, 0, temp );
+
+        rotateFourthOrderIndex( temp, Q, 1, R01 );
+
+        rotateFourthOrderIndex( C, Q, 2, temp );
+
+        rotateFourthOrderIndex( temp, Q, 3, R23 );
+
+        std::fill( dRotatedCdQ.begin( ), dRotatedCdQ.end( ), 0 );
+
+        for ( unsigned int position = 0; position < 4; position++ ){
+
+            // Rotate every index of C except position
+            switch ( position ){
+
+                case 0: rotateFourthOrderIndex( R23, Q, 1, P ); break;
+
+                case 1: rotateFourthOrderIndex( R23, Q, 0, P ); break;
+
+                case 2: rotateFourthOrderIndex( R01, Q, 3, P ); break;
+
+                default: rotateFourthOrderIndex( R01, Q, 2, P ); break;
+
+            }
+
+            const unsigned int stride = strides[ position ];
+
+            for ( unsigned int index = 0; index < 81; index++ ){
+
+                const unsigned int b = ( index / stride ) % dim;
+
+                const unsigned int base = index - b * stride;
+
+                for ( unsigned int a = 0; a < dim; a++ ){
+
+                    dRotatedCdQ[ sot_dim * index + dim * a + b ] += P[ base + a * stride ];
+
+                }
+
+            }
 
-        if ( error ){
-            errorOut result = new errorNode( "computeGreenLagrangeStrain (jacobian)", "Error in computation of Green-Lagrange strain jacobian" );
-            result->addNext( error );
-            return result;
         }
 
-        return NULL;
+        rotateFourthOrderIndex( R01, Q, 2, temp );
+
+        rotateFourthOrderIndex( temp, Q, 3, rotatedC );
+
     }
 
-    errorOut computeDGreenLagrangeStrainDF(const floatVector &deformationGradient, floatMatrix &dEdF){
+    template< typename T >
+    void rotateSecondOrderTensorBatched( const unsigned int nPoints, const T *A, const T *Q, T *rotatedA ){
         /*!
-         * Compute the derivative of the Green-Lagrange strain ( \f$E\f$ )w.r.t. the deformation gradient ( \f$F\f$ ).
+         * Rotate a batch of second order tensors, each with its own rotation matrix
          *
-         * \f$\frac{\partial E_{IJ}}{\partial F_{kK}} = 0.5 ( \delta_{IK} F_{kJ} + F_{kI} \delta_{JK})\f$
+         * The batch is stored in structure-of-arrays layout i.e. component \f$ij\f$ of point \f$p\f$ is located
+         * at \f$( 3 i + j ) n_{points} + p\f$.
          *
-         * Where \f$F\f$ is the deformation gradient and \f$\delta\f$ is the kronecker delta.
+         * \param &nPoints: The number of points in the batch
+         * \param *A: The second order tensors to be rotated ( \f$9 n_{points}\f$ values )
+         * \param *Q: The rotation matrices ( \f$9 n_{points}\f$ values )
+         * \param *rotatedA: The rotated second order tensors ( \f$9 n_{points}\f$ values )
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        const std::size_t n = nPoints;
+
+        for ( std::size_t p = 0; p < n; p++ ){
+
+            secondOrderTensor< T > _A, _Q, _rotatedA;
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ _A[ i ] = A[ i * n + p ]; _Q[ i ] = Q[ i * n + p ]; }
+
+            rotateSecondOrderTensor( _A, _Q, _rotatedA );
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ rotatedA[ i * n + p ] = _rotatedA[ i ]; }
+
+        }
+
+    }
+
+    template< typename T >
+    void rotateFourthOrderTensorBatched( const unsigned int nPoints, const T *C, const T *Q, T *rotatedC ){
+        /*!
+         * Rotate a batch of fourth order tensors, each with its own rotation matrix
          *
-         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
-         * \param &dEdF: The resulting gradient ( \f$\frac{\partial E}{\partial F}\f$ ).
+         * The batch is stored in structure-of-arrays layout i.e. component \f$ijkl\f$ of point \f$p\f$ is located
+         * at \f$( 27 i + 9 j + 3 k + l ) n_{points} + p\f$ and component \f$ij\f$ of the rotation matrix at
+         * \f$( 3 i + j ) n_{points} + p\f$.
          *
-         * The deformation gradient is organized as  F11, F12, F13, F21, F22, F23, F31, F32, F33
+         * \param &nPoints: The number of points in the batch
+         * \param *C: The fourth order tensors to be rotated ( \f$81 n_{points}\f$ values )
+         * \param *Q: The rotation matrices ( \f$9 n_{points}\f$ values )
+         * \param *rotatedC: The rotated fourth order tensors ( \f$81 n_{points}\f$ values )
          */
 
-        floatVector _dEdF;
+        constexpr unsigned int sot_dim = 9;
+        constexpr unsigned int fot_dim = 81;
 
-        errorOut error = computeDGreenLagrangeStrainDF( deformationGradient, _dEdF );
+        const std::size_t n = nPoints;
 
-        if ( error ){
+        for ( std::size_t p = 0; p < n; p++ ){
 
-            errorOut result = new errorNode( "computeDGreenLagrangeStrainDF", "Error in computation of the derivative of the Green-Lagrange strain w.r.t. F" );
+            fourthOrderTensor< T > _C, _rotatedC;
 
-            result->addNext( error );
+            secondOrderTensor< T > _Q;
 
-            return result;
+            for ( unsigned int i = 0; i < fot_dim; i++ ){ _C[ i ] = C[ i * n + p ]; }
 
-        }
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ _Q[ i ] = Q[ i * n + p ]; }
 
-        dEdF = tardigradeVectorTools::inflate( _dEdF, deformationGradient.size( ), deformationGradient.size( ) );
+            rotateFourthOrderTensor( _C, _Q, _rotatedC );
 
-        return NULL;
+            for ( unsigned int i = 0; i < fot_dim; i++ ){ rotatedC[ i * n + p ] = _rotatedC[ i ]; }
+
+        }
 
     }
 
-    errorOut computeDGreenLagrangeStrainDF(const floatVector &deformationGradient, floatVector &dEdF){
+    errorOut rotateFourthOrderTensor( const floatVector &C, const floatVector &Q, floatVector &rotatedC ){
         /*!
-         * Compute the derivative of the Green-Lagrange strain ( \f$E\f$ )w.r.t. the deformation gradient ( \f$F\f$ ).
-         *
-         * \f$\frac{\partial E_{IJ}}{\partial F_{kK}} = 0.5 ( \delta_{IK} F_{kJ} + F_{kI} \delta_{JK})\f$
-         *
-         * Where \f$F\f$ is the deformation gradient and \f$\delta\f$ is the kronecker delta.
+         * Rotate a fourth order tensor \f$C\f$ using the orthogonal matrix \f$Q\f$
          *
-         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
-         * \param &dEdF: The resulting gradient ( \f$\frac{\partial E}{\partial F}\f$ ).
+         * \f$C'_{ijkl} = Q_{Ii} Q_{Jj} Q_{Kk} Q_{Ll} C_{IJKL}\f$
          *
-         * The deformation gradient is organized as  F11, F12, F13, F21, F22, F23, F31, F32, F33
+         * \param &C: The fourth order tensor to be rotated ( \f$C\f$ )
+         * \param &Q: The rotation matrix ( \f$Q\f$ )
+         * \param &rotatedC: The rotated fourth order tensor ( \f$C'\f$ )
          */
 
-        if ( deformationGradient.size( ) != 9 ){
-            return new errorNode( "decomposeGreenLagrangeStrain", "the Green-Lagrange strain must be 3D" );
-        }
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+        constexpr unsigned int fot_dim = sot_dim * sot_dim;
 
-        dEdF = floatVector( 81, 0 );
-        for ( unsigned int I = 0; I < 3; I++ ){
-            for ( unsigned int J = 0; J < 3; J++ ){
-                for ( unsigned int k = 0; k < 3; k++ ){
-                    dEdF[ 3 * 9 * I + 9 * J + 3 * k + I ] += 0.5 * deformationGradient[ 3 * k + J ];
-                    dEdF[ 3 * 9 * I + 9 * J + 3 * k + J ] += 0.5 * deformationGradient[ 3 * k + I ];
-                }
-            }
-        }
+        TARDIGRADE_ERROR_TOOLS_CHECK( C.size( ) == fot_dim, "The fourth order tensor must have " + std::to_string( fot_dim ) + " elements and it has " + std::to_string( C.size( ) ) );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( Q.size( ) == sot_dim, "The rotation matrix must have " + std::to_string( sot_dim ) + " elements and it has " + std::to_string( Q.size( ) ) );
+
+        floatFourthOrderTensor _C, _rotatedC;
+
+        floatSecondOrderTensor _Q;
+
+        std::copy( C.begin( ), C.end( ), _C.begin( ) );
+
+        std::copy( Q.begin( ), Q.end( ), _Q.begin( ) );
+
+        rotateFourthOrderTensor( _C, _Q, _rotatedC );
+
+        rotatedC.assign( _rotatedC.begin( ), _rotatedC.end( ) );
 
         return NULL;
+
     }
 
-    errorOut decomposeGreenLagrangeStrain( const floatVector &E, floatVector &Ebar, floatType &J ){
+    errorOut rotateFourthOrderTensor( const floatVector &C, const floatVector &Q, floatVector &rotatedC, floatVector &dRotatedCdQ ){
         /*!
-         * Decompose the Green-Lagrange strain tensor ( \f$E\f$ ) into isochoric ( \f$\bar{E}\f$ ) and volumetric ( \f$J\f$ ) parts where
-         *
-         * \f$J = det(F) = sqrt(det(2*E + I))\f$
+         * Rotate a fourth order tensor \f$C\f$ using the orthogonal matrix \f$Q\f$ and compute the derivative
+         * w.r.t. the rotation matrix
          *
-         * \f$\bar{E}_{IJ} = 0.5*((1/(J**(2/3))) F_{iI} F_{iJ} - I_{IJ}) = (1/(J**(2/3)))*E_{IJ} + 0.5(1/(J**(2/3)) - 1)*I_{IJ}\f$
+         * \f$C'_{ijkl} = Q_{Ii} Q_{Jj} Q_{Kk} Q_{Ll} C_{IJKL}\f$
          *
-         * \param &E: The Green-Lagrange strain tensor ( \f$E\f$ )
-         * \param &Ebar: The isochoric Green-Lagrange strain tensor ( \f$\bar{E}\f$ ).
-         *     format = E11, E12, E13, E21, E22, E23, E31, E32, E33
-         * \param &J: The Jacobian of deformation ( \f$J\f$ )
+         * \param &C: The fourth order tensor to be rotated ( \f$C\f$ )
+         * \param &Q: The rotation matrix ( \f$Q\f$ )
+         * \param &rotatedC: The rotated fourth order tensor ( \f$C'\f$ )
+         * \param &dRotatedCdQ: The derivative of the rotated tensor w.r.t. the rotation matrix
          */
 
         constexpr unsigned int dim = 3;
         constexpr unsigned int sot_dim = dim * dim;
+        constexpr unsigned int fot_dim = sot_dim * sot_dim;
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( E.size() == sot_dim, "the Green-Lagrange strain must be 3D");
+        TARDIGRADE_ERROR_TOOLS_CHECK( C.size( ) == fot_dim, "The fourth order tensor must have " + std::to_string( fot_dim ) + " elements and it has " + std::to_string( C.size( ) ) );
 
-        //Construct the identity tensor
-        floatVector F_squared = 2 * E;
-        for ( unsigned int i = 0; i < dim; i++ ){ F_squared[ dim * i + i ] += 1; }
+        TARDIGRADE_ERROR_TOOLS_CHECK( Q.size( ) == sot_dim, "The rotation matrix must have " + std::to_string( sot_dim ) + " elements and it has " + std::to_string( Q.size( ) ) );
 
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F_squared_map( F_squared.data( ), dim, dim );
+        floatFourthOrderTensor _C, _rotatedC;
 
-        floatType Jsq = F_squared_map.determinant( );
+        floatSecondOrderTensor _Q;
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( Jsq > 0, "the determinant of the Green-Lagrange strain is negative");
+        floatSixthOrderTensor _dRotatedCdQ;
 
-        J = sqrt(Jsq);
-        Ebar = E/(pow(J, 2./3));
-       
-        for ( unsigned int i = 0; i < dim; i++ ){ Ebar[ dim * i + i ] += 0.5*(1/pow(J, 2./3) - 1); }
+        std::copy( C.begin( ), C.end( ), _C.begin( ) );
+
+        std::copy( Q.begin( ), Q.end( ), _Q.begin( ) );
+
+        rotateFourthOrderTensor( _C, _Q, _rotatedC, _dRotatedCdQ );
+
+        rotatedC.assign( _rotatedC.begin( ), _rotatedC.end( ) );
+
+        dRotatedCdQ.assign( _dRotatedCdQ.begin( ), _dRotatedCdQ.end( ) );
 
         return NULL;
+
     }
 
-    errorOut decomposeGreenLagrangeStrain(const floatVector &E, floatVector &Ebar, floatType &J,
-                                          floatVector &dEbardE, floatVector &dJdE){
+    template< typename T >
+    void quaternionToRotationMatrix( const quaternion< T > &q, secondOrderTensor< T > &Q ){
         /*!
-         * Decompose the Green-Lagrange strain tensor ( \f$E\f$ ) into isochoric ( \f$\bar{E}\f$ ) and volumetric ( \f$J\f$ ) parts where
-         *
-         * \f$J = det(F) = sqrt(det(2*E + I))\f$
+         * Form the rotation matrix of a unit quaternion \f$q = \left(w, x, y, z\right)\f$
          *
-         * \f$\bar{E}_{IJ} = 0.5*((1/(J**(2/3))) F_{iI} F_{iJ} - I_{IJ}) = (1/(J**(2/3)))*E_{IJ} + 0.5(1/(J**(2/3)) - 1)*I_{IJ}\f$
+         * \f$Q = \begin{bmatrix} 1 - 2\left(y^2 + z^2\right) & 2\left(xy - wz\right) & 2\left(xz + wy\right)\\
+         *                        2\left(xy + wz\right) & 1 - 2\left(x^2 + z^2\right) & 2\left(yz - wx\right)\\
+         *                        2\left(xz - wy\right) & 2\left(yz + wx\right) & 1 - 2\left(x^2 + y^2\right) \end{bmatrix}\f$
          *
-         * \param &E: The Green-Lagrange strain tensor ( \f$E\f$ )
-         * \param &Ebar: The isochoric Green-Lagrange strain tensor ( \f$\bar{E}\f$ ).
-         *     format = E11, E12, E13, E21, E22, E23, E31, E32, E33
-         * \param &J: The Jacobian of deformation ( \f$J\f$ )
-         * \param &dEbardE: The derivative of the isochoric Green-Lagrange strain
-         *     tensor w.r.t. the total strain tensor ( \f$\frac{\partial \bar{E}}{\partial E}\f$ ).
-         * \param &dJdE: The derivative of the jacobian of deformation w.r.t. the
-         *     Green-Lagrange strain tensor ( \f$\frac{\partial J}{\partial E}\f$ ).
+         * \param &q: The unit quaternion
+         * \param &Q: The rotation matrix
          */
 
-        constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
+        const T w = q[ 0 ], x = q[ 1 ], y = q[ 2 ], z = q[ 3 ];
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( decomposeGreenLagrangeStrain(E, Ebar, J) );
+        Q = { 1 - 2 * ( y * y + z * z ),     2 * ( x * y - w * z ),     2 * ( x * z + w * y ),
+                  2 * ( x * y + w * z ), 1 - 2 * ( x * x + z * z ),     2 * ( y * z - w * x ),
+                  2 * ( x * z - w * y ),     2 * ( y * z + w * x ), 1 - 2 * ( x * x + y * y ) };
 
-        //Compute the derivative of the jacobian of deformation w.r.t. the Green-Lagrange strain
-        dJdE = 2 * E;
-        for ( unsigned int i = 0; i < 3; i++ ){ dJdE[ dim * i + i ] += 1; };
+    }
 
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > dJdE_map( dJdE.data( ), dim, dim );
+    template< typename T >
+    void quaternionToRotationMatrix( const quaternion< T > &q, secondOrderTensor< T > &Q, std::array< T, 36 > &dQdq ){
+        /*!
+         * Form the rotation matrix of a unit quaternion \f$q = \left(w, x, y, z\right)\f$ and its derivative
+         * w.r.t. the components of the quaternion. The derivative is of the unit quaternion formula and so is
+         * not projected onto the tangent space of the unit sphere.
+         *
+         * \param &q: The unit quaternion
+         * \param &Q: The rotation matrix
+         * \param &dQdq: The derivative of the rotation matrix w.r.t. the quaternion stored 9x4 in row-major order
+         */
 
-        dJdE_map = ( J * dJdE_map.inverse( ) ).eval( );
+        quaternionToRotationMatrix( q, Q );
 
-        //Compute the derivative of the isochoric part of the Green-Lagrange strain w.r.t. the Green-Lagrange strain
-        floatVector eye( sot_dim );
-        for ( unsigned int i = 0; i < dim; i++ ){ eye[ dim * i + i ] = 1.; };
-        floatMatrix EYE = tardigradeVectorTools::eye<floatType>(9);
+        const T w2 = 2 * q[ 0 ], x2 = 2 * q[ 1 ], y2 = 2 * q[ 2 ], z2 = 2 * q[ 3 ];
 
-        floatType invJ23 = 1./pow(J, 2./3);
-        floatType invJ53 = 1./pow(J, 5./3);
+        //        d/dw     d/dx         d/dy         d/dz
+        dQdq = {     0,      0, -2 * y2, -2 * z2,
+                   -z2,     y2,      x2,     -w2,
+                    y2,     z2,      w2,      x2,
+                    z2,     y2,      x2,      w2,
+                     0, -2 * x2,      0, -2 * z2,
+                   -x2,    -w2,      z2,      y2,
+                   -y2,     z2,     -w2,      x2,
+                    x2,     w2,      z2,      y2,
+                     0, -2 * x2, -2 * y2,      0 };
 
-        dEbardE = floatVector( sot_dim * sot_dim, 0 );
+    }
 
-        for ( unsigned int i = 0; i < sot_dim; i++ ){
-            dEbardE[ sot_dim * i + i ] += invJ23;
-        }
+    template< typename T >
+    static void rotationVectorQuaternionFactors( const T theta, T &c, T &s, T &g ){
+        /*!
+         * Compute the factors of the quaternion of a rotation vector with magnitude \f$\theta\f$
+         *
+         * \f$c = \cos\left(\frac{\theta}{2}\right)\f$, \f$s = \frac{1}{\theta} \sin\left(\frac{\theta}{2}\right)\f$,
+         * and \f$g = \frac{1}{\theta} \frac{ds}{d\theta}\f$
+         *
+         * Taylor series are used for small rotations so that the factors are well defined at \f$\theta = 0\f$
+         *
+         * \param theta: The magnitude of the rotation vector
+         * \param &c: The cosine factor
+         * \param &s: The scaled sine factor
+         * \param &g: The scaled derivative of the scaled sine factor
+         */
 
-        for ( unsigned int i = 0; i < dim; i++ ){
+        const T theta2 = theta * theta;
 
-            for ( unsigned int j = 0; j < dim; j++ ){
+        c = std::cos( 0.5 * theta );
 
-                for ( unsigned int k = 0; k < dim; k++ ){
+        if ( theta < 1e-3 ){
 
-                    dEbardE[ sot_dim * dim * i + sot_dim * i + dim * j + k ] -= (1./3) * invJ53 * dJdE[ dim * j + k ];
+            s = 0.5 - theta2 / 48 + theta2 * theta2 / 3840;
 
-                    for ( unsigned int l = 0; l < dim; l++ ){
+            g = -1. / 24 + theta2 / 960;
 
-                        dEbardE[ sot_dim * dim * i + sot_dim * j + dim * k + l ] -= (2./3) * invJ53 * E[ dim * i + j ] * dJdE[ dim * k + l ];
+        }
+        else{
 
-                    }
+            const T sinHalf = std::sin( 0.5 * theta );
 
-                }
+            s = sinHalf / theta;
 
-            }
+            g = ( 0.5 * theta * c - sinHalf ) / ( theta2 * theta );
 
         }
 
-        return NULL;
     }
 
-    errorOut decomposeGreenLagrangeStrain(const floatVector &E, floatVector &Ebar, floatType &J,
-                                          floatMatrix &dEbardE, floatVector &dJdE){
+    template< typename T >
+    void rotationVectorToQuaternion( const firstOrderTensor< T > &rotationVector, quaternion< T > &q ){
         /*!
-         * Decompose the Green-Lagrange strain tensor ( \f$E\f$ ) into isochoric ( \f$\bar{E}\f$ ) and volumetric ( \f$J\f$ ) parts where
-         *
-         * \f$J = det(F) = sqrt(det(2*E + I))\f$
+         * Form the unit quaternion of a rotation vector \f$\theta n_i\f$
          *
-         * \f$\bar{E}_{IJ} = 0.5*((1/(J**(2/3))) F_{iI} F_{iJ} - I_{IJ}) = (1/(J**(2/3)))*E_{IJ} + 0.5(1/(J**(2/3)) - 1)*I_{IJ}\f$
+         * \f$q = \left( \cos\left(\frac{\theta}{2}\right), \sin\left(\frac{\theta}{2}\right) n_i \right)\f$
          *
-         * \param &E: The Green-Lagrange strain tensor ( \f$E\f$ )
-         * \param &Ebar: The isochoric Green-Lagrange strain tensor ( \f$\bar{E}\f$ ).
-         *     format = E11, E12, E13, E21, E22, E23, E31, E32, E33
-         * \param &J: The Jacobian of deformation ( \f$J\f$ )
-         * \param &dEbardE: The derivative of the isochoric Green-Lagrange strain
-         *     tensor w.r.t. the total strain tensor ( \f$\frac{\partial \bar{E}}{\partial E}\f$ ).
-         * \param &dJdE: The derivative of the jacobian of deformation w.r.t. the
-         *     Green-Lagrange strain tensor ( \f$\frac{\partial J}{\partial E}\f$ ).
+         * \param &rotationVector: The rotation vector i.e. the axis of rotation scaled by the angle in radians
+         * \param &q: The unit quaternion
          */
 
-        constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
+        const T theta = std::sqrt( rotationVector[ 0 ] * rotationVector[ 0 ] + rotationVector[ 1 ] * rotationVector[ 1 ] + rotationVector[ 2 ] * rotationVector[ 2 ] );
 
-        floatVector _dEbardE;
+        T c, s, g;
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( decomposeGreenLagrangeStrain( E, Ebar, J, _dEbardE, dJdE ) );
+        rotationVectorQuaternionFactors( theta, c, s, g );
 
-        dEbardE = tardigradeVectorTools::inflate( _dEbardE, sot_dim, sot_dim );
+        q = { c, s * rotationVector[ 0 ], s * rotationVector[ 1 ], s * rotationVector[ 2 ] };
 
-        return NULL;
     }
 
-    errorOut mapPK2toCauchy(const floatVector &PK2Stress, const floatVector &deformationGradient, floatVector &cauchyStress){
+    template< typename T >
+    void rotationVectorToQuaternion( const firstOrderTensor< T > &rotationVector, quaternion< T > &q, std::array< T, 12 > &dqdRotationVector ){
         /*!
-         * Map the PK2 stress ( \f$P^{II}\f$ ) to the current configuration resulting in the Cauchy stress ( \f$\sigma\f$ ).
+         * Form the unit quaternion of a rotation vector and its derivative w.r.t. the rotation vector
          *
-         * \f$\sigma_{ij} = (1/det(F)) F_{iI} P^{II}_{IJ} F_{jJ}\f$
+         * \f$\frac{\partial q_0}{\partial v_k} = -\frac{1}{2} s v_k\f$
          *
-         * where \f$F\f$ is the deformation gradient
+         * \f$\frac{\partial q_i}{\partial v_k} = s \delta_{ik} + g v_i v_k\f$
          *
-         * \param &PK2Stress: The Second Piola-Kirchoff stress ( \f$P^{II}\f$ )
-         * \param &deformationGradient: The total deformation gradient ( \f$F\f$ ).
-         * \param &cauchyStress: The Cauchy stress (\f$\sigma\f$ ).
+         * \param &rotationVector: The rotation vector i.e. the axis of rotation scaled by the angle in radians
+         * \param &q: The unit quaternion
+         * \param &dqdRotationVector: The derivative of the quaternion w.r.t. the rotation vector stored 4x3 in row-major order
          */
 
         constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( PK2Stress.size( ) == sot_dim, "The cauchy stress must have nine components (3D)");
+        const T theta = std::sqrt( rotationVector[ 0 ] * rotationVector[ 0 ] + rotationVector[ 1 ] * rotationVector[ 1 ] + rotationVector[ 2 ] * rotationVector[ 2 ] );
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( deformationGradient.size() == PK2Stress.size(), "The deformation gradient and the PK2 stress don't have the same size");
+        T c, s, g;
 
-        //Compute the determinant of the deformation gradient
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > map( deformationGradient.data( ), dim, dim );
-        floatType detF = map.determinant( );
+        rotationVectorQuaternionFactors( theta, c, s, g );
 
-        //Initialize the Cauchy stress
-        floatVector temp_sot( sot_dim, 0 );
-        cauchyStress = floatVector( sot_dim, 0);
+        q = { c, s * rotationVector[ 0 ], s * rotationVector[ 1 ], s * rotationVector[ 2 ] };
 
-        for (unsigned int i=0; i<dim; i++){
-            for (unsigned int I=0; I<dim; I++){
-                for (unsigned int j=0; j<dim; j++){
-                    temp_sot[ dim * i + j ] += deformationGradient[ 3 * i + I ] * PK2Stress[ 3 * I + j ];
-                }
-            }
-        }
+        for ( unsigned int k = 0; k < dim; k++ ){
 
-        temp_sot /= detF;
+            dqdRotationVector[ k ] = -0.5 * s * rotationVector[ k ];
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                dqdRotationVector[ dim * ( i + 1 ) + k ] = g * rotationVector[ i ] * rotationVector[ k ] + ( i == k ? s : 0 );
 
-        for ( unsigned int i = 0; i < dim; i++ ){
-            for ( unsigned int j = 0; j < dim; j++ ){
-                for ( unsigned int I = 0; I < dim; I++ ){
-                        cauchyStress[ dim * i + j ] += temp_sot[ dim * i + I ]*deformationGradient[ 3 * j + I ];
-                }
             }
+
         }
-        return NULL;
+
     }
 
-    errorOut WLF(const floatType &temperature, const floatVector &WLFParameters, floatType &factor){
+    template< typename T >
+    void rotationVectorToRotationMatrix( const firstOrderTensor< T > &rotationVector, secondOrderTensor< T > &Q ){
         /*!
-         * An implementation of the Williams-Landel-Ferry equation.
+         * Form the rotation matrix of a rotation vector
          *
-         * \f$factor = 10**((-C_1*(T - T_r))/(C_2 + T - T_r))\f$
-         *
-         * where \f$T\f$ is the temperature, \f$T_r\f$ is the reference temperature, and \f$C_1\f$ and \f$C_2\f$ are parameters
+         * \param &rotationVector: The rotation vector i.e. the axis of rotation scaled by the angle in radians
+         * \param &Q: The rotation matrix
+         */
+
+        quaternion< T > q;
+
+        rotationVectorToQuaternion( rotationVector, q );
+
+        quaternionToRotationMatrix( q, Q );
+
+    }
+
+    template< typename T >
+    void rotationVectorToRotationMatrix( const firstOrderTensor< T > &rotationVector, secondOrderTensor< T > &Q, thirdOrderTensor< T > &dQdRotationVector ){
+        /*!
+         * Form the rotation matrix of a rotation vector and its derivative w.r.t. the rotation vector
          *
-         * \param &temperature: The temperature \f$T\f$
-         * \param &WLFParameters: The parameters for the function [\f$T_r\f$, \f$C_1\f$, \f$C_2\f$]
-         * \param &factor: The shift factor
+         * \param &rotationVector: The rotation vector i.e. the axis of rotation scaled by the angle in radians
+         * \param &Q: The rotation matrix
+         * \param &dQdRotationVector: The derivative of the rotation matrix w.r.t. the rotation vector stored 9x3 in row-major order
          */
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( WLFParameters.size() == 3, "The parameters have the wrong number of terms");
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
 
-        floatType Tr = WLFParameters[0];
-        floatType C1 = WLFParameters[1];
-        floatType C2 = WLFParameters[2];
+        quaternion< T > q;
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( !tardigradeVectorTools::fuzzyEquals(C2 + (temperature - Tr), 0.), "Zero in the denominator");
+        std::array< T, 12 > dqdRotationVector;
 
-        factor = pow(10., -C1*(temperature - Tr)/(C2 + (temperature - Tr)));
+        std::array< T, 36 > dQdq;
+
+        rotationVectorToQuaternion( rotationVector, q, dqdRotationVector );
+
+        quaternionToRotationMatrix( q, Q, dQdq );
+
+        for ( unsigned int I = 0; I < sot_dim; I++ ){
+
+            for ( unsigned int k = 0; k < dim; k++ ){
+
+                dQdRotationVector[ dim * I + k ] = dQdq[ 4 * I + 0 ] * dqdRotationVector[ dim * 0 + k ]
+                                                 + dQdq[ 4 * I + 1 ] * dqdRotationVector[ dim * 1 + k ]
+                                                 + dQdq[ 4 * I + 2 ] * dqdRotationVector[ dim * 2 + k ]
+                                                 + dQdq[ 4 * I + 3 ] * dqdRotationVector[ dim * 3 + k ];
+
+            }
+
+        }
 
-        return NULL;
     }
 
-    errorOut WLF(const floatType &temperature, const floatVector &WLFParameters, floatType &factor, floatType &dfactordT){
+    template< typename T >
+    void composeQuaternions( const quaternion< T > &q1, const quaternion< T > &q2, quaternion< T > &q ){
         /*!
-         * An implementation of the Williams-Landel-Ferry equation that also returns the gradient w.r.t. \f$T\f$
+         * Compose two rotations using the Hamilton product \f$q = q_1 q_2\f$ so that the rotation matrix of
+         * \f$q\f$ is \f$Q\left(q_1\right) Q\left(q_2\right)\f$ i.e. the rotation \f$q_2\f$ is applied first.
          *
-         * \param &temperature: The temperature ( \f$T\f$ )
-         * \param &WLFParameters: The parameters for the function [\f$T_r\f$, \f$C_1\f$, \f$C_2\f$]
-         * \param &factor: The shift factor
-         * \param &dfactordT: The derivative of the shift factor w.r.t. the temperature ( \f$\frac{\partial factor}{\partial T}\f$ )
+         * \param &q1: The second rotation
+         * \param &q2: The first rotation
+         * \param &q: The composed rotation. May alias either input.
          */
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( WLF(temperature, WLFParameters, factor) );
+        const T w1 = q1[ 0 ], x1 = q1[ 1 ], y1 = q1[ 2 ], z1 = q1[ 3 ];
 
-        floatType Tr = WLFParameters[0];
-        floatType C1 = WLFParameters[1];
-        floatType C2 = WLFParameters[2];
+        const T w2 = q2[ 0 ], x2 = q2[ 1 ], y2 = q2[ 2 ], z2 = q2[ 3 ];
 
-        dfactordT = std::log(10)*factor*(-C1/(C2 + temperature - Tr) + (C1*(temperature - Tr)/pow(C2 + temperature - Tr, 2)));
+        q = { w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2,
+              w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2,
+              w1 * y2 - x1 * z2 + y1 * w2 + z1 * x2,
+              w1 * z2 + x1 * y2 - y1 * x2 + z1 * w2 };
 
-        return NULL;
     }
 
-    errorOut computeDFDt(const floatVector &velocityGradient, const floatVector &deformationGradient, floatVector &DFDt){
+    template< typename T >
+    void composeQuaternions( const quaternion< T > &q1, const quaternion< T > &q2, quaternion< T > &q,
+                             std::array< T, 16 > &dqdq1, std::array< T, 16 > &dqdq2 ){
         /*!
-         * Compute the total time derivative of the deformation gradient.
+         * Compose two rotations using the Hamilton product \f$q = q_1 q_2\f$ and compute the derivatives w.r.t.
+         * both rotations. The product is bilinear so the derivatives are the left and right multiplication
+         * matrices of the quaternions.
+         *
+         * \param &q1: The second rotation
+         * \param &q2: The first rotation
+         * \param &q: The composed rotation. May alias either input.
+         * \param &dqdq1: The derivative of the composed rotation w.r.t. q1 stored 4x4 in row-major order
+         * \param &dqdq2: The derivative of the composed rotation w.r.t. q2 stored 4x4 in row-major order
+         */
+
+        const T w1 = q1[ 0 ], x1 = q1[ 1 ], y1 = q1[ 2 ], z1 = q1[ 3 ];
+
+        const T w2 = q2[ 0 ], x2 = q2[ 1 ], y2 = q2[ 2 ], z2 = q2[ 3 ];
+
+        dqdq1 = { w2, -x2, -y2, -z2,
+                  x2,  w2,  z2, -y2,
+                  y2, -z2,  w2,  x2,
+                  z2,  y2, -x2,  w2 };
+
+        dqdq2 = { w1, -x1, -y1, -z1,
+                  x1,  w1, -z1,  y1,
+                  y1,  z1,  w1, -x1,
+                  z1, -y1,  x1,  w1 };
+
+        q = { w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2,
+              w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2,
+              w1 * y2 - x1 * z2 + y1 * w2 + z1 * x2,
+              w1 * z2 + x1 * y2 - y1 * x2 + z1 * w2 };
+
+    }
+
+    template< typename T >
+    void rotateSecondOrderTensor( const secondOrderTensor< T > &A, const quaternion< T > &q, secondOrderTensor< T > &rotatedA ){
+        /*!
+         * Rotate a second order tensor using the rotation matrix of a unit quaternion
          *
-         * \f$\dot{F}_{iI} = L_{ij} F_{jI}\f$
+         * \f$A'_{ij} = Q_{Ii} A_{IJ} Q_{Jj}\f$
          *
-         * \param &velocityGradient: The velocity gradient \f$L_{ij}\f$
-         * \param &deformationGradient: The deformation gradient \f$F_{iI}\f$
-         * \param &DFDt: The total time derivative of the deformation gradient
+         * \param &A: The second order tensor to be rotated ( \f$A\f$ )
+         * \param &q: The unit quaternion
+         * \param &rotatedA: The rotated second order tensor ( \f$A'\f$ )
          */
 
-        //Assume 3D
-        constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
+        secondOrderTensor< T > Q;
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( velocityGradient.size() == deformationGradient.size(), "The velocity gradient and deformation gradient must have the same size");
+        quaternionToRotationMatrix( q, Q );
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( velocityGradient.size() == sot_dim, "The velocity gradient doesn't have enough entries");
+        rotateSecondOrderTensor( A, Q, rotatedA );
 
-        DFDt = floatVector(velocityGradient.size(), 0);
+    }
+
+    template< typename T >
+    void rotateSecondOrderTensor( const secondOrderTensor< T > &A, const quaternion< T > &q, secondOrderTensor< T > &rotatedA,
+                                  std::array< T, 36 > &dRotatedAdq ){
+        /*!
+         * Rotate a second order tensor using the rotation matrix of a unit quaternion and compute the derivative
+         * w.r.t. the quaternion
+         *
+         * \param &A: The second order tensor to be rotated ( \f$A\f$ )
+         * \param &q: The unit quaternion
+         * \param &rotatedA: The rotated second order tensor ( \f$A'\f$ )
+         * \param &dRotatedAdq: The derivative of the rotated tensor w.r.t. the quaternion stored 9x4 in row-major order
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        secondOrderTensor< T > Q;
+
+        std::array< T, 36 > dQdq;
+
+        fourthOrderTensor< T > dRotatedAdQ;
+
+        quaternionToRotationMatrix( q, Q, dQdq );
+
+        rotateSecondOrderTensor( A, Q, rotatedA, dRotatedAdQ );
+
+        std::fill( dRotatedAdq.begin( ), dRotatedAdq.end( ), 0 );
+
+        for ( unsigned int I = 0; I < sot_dim; I++ ){
+
+            for ( unsigned int K = 0; K < sot_dim; K++ ){
+
+                for ( unsigned int a = 0; a < 4; a++ ){
+
+                    dRotatedAdq[ 4 * I + a ] += dRotatedAdQ[ sot_dim * I + K ] * dQdq[ 4 * K + a ];
 
-        for (unsigned int i=0; i<dim; i++){
-            for (unsigned int I=0; I<dim; I++){
-                for (unsigned int j=0; j<dim; j++){
-                    DFDt[dim*i + I] += velocityGradient[dim*i + j] * deformationGradient[dim*j + I];
                 }
+
             }
+
         }
-        return NULL;
+
     }
 
-    errorOut computeDFDt(const floatVector &velocityGradient, const floatVector &deformationGradient, floatVector &DFDt,
-                         floatVector &dDFDtdL, floatVector &dDFDtdF){
+    template< typename T >
+    void rotateSecondOrderTensor( const secondOrderTensor< T > &A, const firstOrderTensor< T > &rotationVector, secondOrderTensor< T > &rotatedA ){
         /*!
-         * Compute the total time derivative of the deformation gradient
-         * and return the partial derivatives w.r.t. L and F.
+         * Rotate a second order tensor using the rotation matrix of a rotation vector
          *
-         * \f$\dot{F}_{iI} = L_{ij} F_{jI}\f$
-         * \f$\frac{\partial \dot{F}_{iI}}{\partial L_{kl}} = \delta_{ik} F{lI}\f$
-         * \f$\frac{\partial \dot{F}_{iI}}{\partial F_{kK}} = L_{ik} \delta{IK}\f$
+         * \param &A: The second order tensor to be rotated ( \f$A\f$ )
+         * \param &rotationVector: The rotation vector i.e. the axis of rotation scaled by the angle in radians
+         * \param &rotatedA: The rotated second order tensor ( \f$A'\f$ )
+         */
+
+        secondOrderTensor< T > Q;
+
+        rotationVectorToRotationMatrix( rotationVector, Q );
+
+        rotateSecondOrderTensor( A, Q, rotatedA );
+
+    }
+
+    template< typename T >
+    void rotateSecondOrderTensor( const secondOrderTensor< T > &A, const firstOrderTensor< T > &rotationVector, secondOrderTensor< T > &rotatedA,
+                                  thirdOrderTensor< T > &dRotatedAdRotationVector ){
+        /*!
+         * Rotate a second order tensor using the rotation matrix of a rotation vector and compute the derivative
+         * w.r.t. the rotation vector
          *
-         * \param &velocityGradient: The velocity gradient \f$L_{ij}\f$
-         * \param &deformationGradient: The deformation gradient \f$F_{iI}\f$
-         * \param &DFDt: The total time derivative of the deformation gradient
-         * \param &dDFDtdL: The derivative of the total time derivative of the deformation gradient
-         *     with respect to the velocity gradient.
-         * \param &dDFDtdF: The derivative of the total time derivative of the deformation gradient
-         *     with respect to the deformation gradient.
+         * \param &A: The second order tensor to be rotated ( \f$A\f$ )
+         * \param &rotationVector: The rotation vector i.e. the axis of rotation scaled by the angle in radians
+         * \param &rotatedA: The rotated second order tensor ( \f$A'\f$ )
+         * \param &dRotatedAdRotationVector: The derivative of the rotated tensor w.r.t. the rotation vector stored 9x3 in row-major order
          */
 
-        //Assume 3D
         constexpr unsigned int dim = 3;
         constexpr unsigned int sot_dim = dim * dim;
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( computeDFDt(velocityGradient, deformationGradient, DFDt) );
+        secondOrderTensor< T > Q;
 
-        //Form the identity tensor
-        floatVector eye(dim*dim, 0);
-        tardigradeVectorTools::eye(eye);
+        thirdOrderTensor< T > dQdRotationVector;
 
-        //Form the partial w.r.t. L and F
-        dDFDtdL = floatVector( sot_dim * sot_dim, 0 );
-        dDFDtdF = floatVector( sot_dim * sot_dim, 0 );;
+        fourthOrderTensor< T > dRotatedAdQ;
+
+        rotationVectorToRotationMatrix( rotationVector, Q, dQdRotationVector );
+
+        rotateSecondOrderTensor( A, Q, rotatedA, dRotatedAdQ );
+
+        std::fill( dRotatedAdRotationVector.begin( ), dRotatedAdRotationVector.end( ), 0 );
+
+        for ( unsigned int I = 0; I < sot_dim; I++ ){
+
+            for ( unsigned int K = 0; K < sot_dim; K++ ){
+
+                for ( unsigned int k = 0; k < dim; k++ ){
+
+                    dRotatedAdRotationVector[ dim * I + k ] += dRotatedAdQ[ sot_dim * I + K ] * dQdRotationVector[ dim * K + k ];
 
-        for (unsigned int i=0; i<dim; i++){
-            for (unsigned int I=0; I<dim; I++){
-                for (unsigned int k=0; k<dim; k++){
-                    dDFDtdL[ sot_dim * dim * i + sot_dim * I + dim * i + k] = deformationGradient[ dim * k + I ];
-                    dDFDtdF[ sot_dim * dim * i + sot_dim * I + dim * k + I] = velocityGradient[ dim * i + k ];
                 }
+
             }
+
         }
 
-        return NULL;
     }
 
-    errorOut computeDFDt(const floatVector &velocityGradient, const floatVector &deformationGradient, floatVector &DFDt,
-                         floatMatrix &dDFDtdL, floatMatrix &dDFDtdF){
+    template< typename T >
+    void rotateFourthOrderTensor( const fourthOrderTensor< T > &C, const quaternion< T > &q, fourthOrderTensor< T > &rotatedC ){
         /*!
-         * Compute the total time derivative of the deformation gradient
-         * and return the partial derivatives w.r.t. L and F.
+         * Rotate a fourth order tensor using the rotation matrix of a unit quaternion
          *
-         * \f$\dot{F}_{iI} = L_{ij} F_{jI}\f$
-         * \f$\frac{\partial \dot{F}_{iI}}{\partial L_{kl}} = \delta_{ik} F{lI}\f$
-         * \f$\frac{\partial \dot{F}_{iI}}{\partial F_{kK}} = L_{ik} \delta{IK}\f$
+         * \f$C'_{ijkl} = Q_{Ii} Q_{Jj} Q_{Kk} Q_{Ll} C_{IJKL}\f$
          *
-         * \param &velocityGradient: The velocity gradient \f$L_{ij}\f$
-         * \param &deformationGradient: The deformation gradient \f$F_{iI}\f$
-         * \param &DFDt: The total time derivative of the deformation gradient
-         * \param &dDFDtdL: The derivative of the total time derivative of the deformation gradient
-         *     with respect to the velocity gradient.
-         * \param &dDFDtdF: The derivative of the total time derivative of the deformation gradient
-         *     with respect to the deformation gradient.
+         * \param &C: The fourth order tensor to be rotated ( \f$C\f$ )
+         * \param &q: The unit quaternion
+         * \param &rotatedC: The rotated fourth order tensor ( \f$C'\f$ )
          */
 
-        //Assume 3D
-        constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
+        secondOrderTensor< T > Q;
 
-        floatVector _dDFDtdL, _dDFDtdF;
+        quaternionToRotationMatrix( q, Q );
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( computeDFDt( velocityGradient, deformationGradient, DFDt, _dDFDtdL, _dDFDtdF ) );
+        rotateFourthOrderTensor( C, Q, rotatedC );
+
+    }
+
+    template< typename T >
+    void rotateFourthOrderTensor( const fourthOrderTensor< T > &C, const firstOrderTensor< T > &rotationVector, fourthOrderTensor< T > &rotatedC ){
+        /*!
+         * Rotate a fourth order tensor using the rotation matrix of a rotation vector
+         *
+         * \param &C: The fourth order tensor to be rotated ( \f$C\f$ )
+         * \param &rotationVector: The rotation vector i.e. the axis of rotation scaled by the angle in radians
+         * \param &rotatedC: The rotated fourth order tensor ( \f$C'\f$ )
+         */
 
-        dDFDtdL = tardigradeVectorTools::inflate( _dDFDtdL, sot_dim, sot_dim );
+        secondOrderTensor< T > Q;
 
-        dDFDtdF = tardigradeVectorTools::inflate( _dDFDtdF, sot_dim, sot_dim );
+        rotationVectorToRotationMatrix( rotationVector, Q );
+
+        rotateFourthOrderTensor( C, Q, rotatedC );
 
-        return NULL;
     }
 
-    errorOut midpointEvolution( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
-                                floatVector &dA, floatVector &A, const floatVector &alpha ){
+    template< typename T >
+    void rotateSecondOrderTensorByQuaternionBatched( const unsigned int nPoints, const T *A, const T *q, T *rotatedA ){
         /*!
-         * Perform midpoint rule based evolution of a vector.
-         *
-         * alpha=0 (implicit)
+         * Rotate a batch of second order tensors, each with its own unit quaternion. The rotation matrices are
+         * formed on the fly so only four values per point are read for the orientation.
          *
-         * alpha=1 (explicit)
+         * The batch is stored in structure-of-arrays layout i.e. component \f$ij\f$ of point \f$p\f$ is located
+         * at \f$( 3 i + j ) n_{points} + p\f$ and component \f$a\f$ of its quaternion at \f$a n_{points} + p\f$.
          *
-         * \param &Dt: The change in time.
-         * \param &Ap: The previous value of the vector
-         * \param &DApDt: The previous time rate of change of the vector.
-         * \param &DADt: The current time rate of change of the vector.
-         * \param &dA: The change in the vector
-         * \param &A: The current value of the vector.
-         * \param &alpha: The integration parameter.
+         * \param &nPoints: The number of points in the batch
+         * \param *A: The second order tensors to be rotated ( \f$9 n_{points}\f$ values )
+         * \param *q: The unit quaternions ( \f$4 n_{points}\f$ values )
+         * \param *rotatedA: The rotated second order tensors ( \f$9 n_{points}\f$ values )
          */
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( ( Ap.size( ) == DApDt.size( ) ) && ( Ap.size( ) == DADt.size( ) ), "The size of the previous value of the vector and the two rates are not equal" );
-
-        TARDIGRADE_ERROR_TOOLS_CHECK( Ap.size( ) == alpha.size( ), "The size of the alpha vector is not the same size as the previous vector value" );
+        constexpr unsigned int sot_dim = 9;
 
-        dA = floatVector( Ap.size( ), 0 );
+        const std::size_t n = nPoints;
 
-        A = floatVector( Ap.size( ), 0 );
+        for ( std::size_t p = 0; p < n; p++ ){
 
-        unsigned int i = 0;
+            secondOrderTensor< T > _A, _Q, _rotatedA;
 
-        for ( auto ai = alpha.begin( ); ai != alpha.end( ); ai++, i++ ){
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ _A[ i ] = A[ i * n + p ]; }
 
-            TARDIGRADE_ERROR_TOOLS_CHECK( ( ( *ai ) >= 0) && ( ( *ai ) <= 1 ), "Alpha must be between 0 and 1" );
+            quaternionToRotationMatrix( quaternion< T >( { q[ 0 * n + p ], q[ 1 * n + p ], q[ 2 * n + p ], q[ 3 * n + p ] } ), _Q );
 
-            dA[ i ] = Dt * ( *ai * DApDt[ i ] + ( 1 - *ai ) * DADt[ i ] );
+            rotateSecondOrderTensor( _A, _Q, _rotatedA );
 
-            A[ i ]  = Ap[ i ] + dA[ i ];
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ rotatedA[ i * n + p ] = _rotatedA[ i ]; }
 
         }
 
-        return NULL;
-
     }
 
-    errorOut midpointEvolutionFlatJ( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
-                                     floatVector &dA, floatVector &A, floatVector &DADADt, const floatVector &alpha ){
+    template< typename T >
+    void rotateFourthOrderTensorByQuaternionBatched( const unsigned int nPoints, const T *C, const T *q, T *rotatedC ){
         /*!
-         * Perform midpoint rule based evolution of a vector and return the jacobian.
+         * Rotate a batch of fourth order tensors, each with its own unit quaternion. The rotation matrices are
+         * formed on the fly so only four values per point are read for the orientation.
          *
-         * alpha=0 (implicit)
-         *
-         * alpha=1 (explicit)
+         * The batch is stored in structure-of-arrays layout i.e. component \f$ijkl\f$ of point \f$p\f$ is located
+         * at \f$( 27 i + 9 j + 3 k + l ) n_{points} + p\f$ and component \f$a\f$ of its quaternion at
+         * \f$a n_{points} + p\f$.
          *
-         * \param &Dt: The change in time.
-         * \param &Ap: The previous value of the vector
-         * \param &DApDt: The previous time rate of change of the vector.
-         * \param &DADt: The current time rate of change of the vector.
-         * \param &A: The change in value of the vector.
-         * \param &A: The current value of the vector.
-         * \param &DADADt: The gradient of A w.r.t. the current rate of change.
-         * \param &alpha: The integration parameter.
+         * \param &nPoints: The number of points in the batch
+         * \param *C: The fourth order tensors to be rotated ( \f$81 n_{points}\f$ values )
+         * \param *q: The unit quaternions ( \f$4 n_{points}\f$ values )
+         * \param *rotatedC: The rotated fourth order tensors ( \f$81 n_{points}\f$ values )
          */
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, alpha ) )
+        constexpr unsigned int fot_dim = 81;
 
-        const unsigned int A_size = A.size( );
+        const std::size_t n = nPoints;
 
-        DADADt = floatVector( A_size * A_size, 0 );
+        for ( std::size_t p = 0; p < n; p++ ){
 
-        unsigned int i = 0;
+            fourthOrderTensor< T > _C, _rotatedC;
 
-        for ( auto ai = alpha.begin( ); ai != alpha.end( ); ai++, i++ ){
+            secondOrderTensor< T > _Q;
 
-            DADADt[ A_size * i + i ] = Dt * ( 1 - *ai );
+            for ( unsigned int i = 0; i < fot_dim; i++ ){ _C[ i ] = C[ i * n + p ]; }
 
-        }
+            quaternionToRotationMatrix( quaternion< T >( { q[ 0 * n + p ], q[ 1 * n + p ], q[ 2 * n + p ], q[ 3 * n + p ] } ), _Q );
 
-        return NULL;
+            rotateFourthOrderTensor( _C, _Q, _rotatedC );
+
+            for ( unsigned int i = 0; i < fot_dim; i++ ){ rotatedC[ i * n + p ] = _rotatedC[ i ]; }
+
+        }
 
     }
 
-    errorOut midpointEvolution( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
-                                floatVector &dA, floatVector &A, floatMatrix &DADADt, const floatVector &alpha ){
+    template< typename T >
+    static T determinantSecondOrderTensor( const secondOrderTensor< T > &A ){
         /*!
-         * Perform midpoint rule based evolution of a vector and return the jacobian.
-         *
-         * alpha=0 (implicit)
-         *
-         * alpha=1 (explicit)
+         * Compute the determinant of a 3x3 matrix by cofactor expansion along the first row. Used when only the
+         * determinant is required so the remaining cofactors of invertSecondOrderTensor are not formed.
          *
-         * \param &Dt: The change in time.
-         * \param &Ap: The previous value of the vector
-         * \param &DApDt: The previous time rate of change of the vector.
-         * \param &DADt: The current time rate of change of the vector.
-         * \param &A: The change in value of the vector.
-         * \param &A: The current value of the vector.
-         * \param &DADADt: The gradient of A w.r.t. the current rate of change.
-         * \param &alpha: The integration parameter.
+         * \param &A: The matrix stored in row-major order
          */
 
-        floatVector _DADADt;
+        return A[ 0 ] * ( A[ 4 ] * A[ 8 ] - A[ 5 ] * A[ 7 ] )
+             + A[ 1 ] * ( A[ 5 ] * A[ 6 ] - A[ 3 ] * A[ 8 ] )
+             + A[ 2 ] * ( A[ 3 ] * A[ 7 ] - A[ 4 ] * A[ 6 ] );
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( midpointEvolutionFlatJ( Dt, Ap, DApDt, DADt, dA, A, _DADADt, alpha ) )
+    }
 
-        DADADt = tardigradeVectorTools::inflate( _DADADt, A.size( ), A.size( ) );
+    template< typename T >
+    T invertSecondOrderTensor( const secondOrderTensor< T > &A, secondOrderTensor< T > &invA ){
+        /*!
+         * Compute the inverse of a 3x3 matrix from its cofactors and return the determinant. This is the shared
+         * closed-form inverse used by all of the routines which require the inverse of the deformation gradient.
+         * No checks are performed so a singular matrix results in non-finite values.
+         *
+         * \param &A: The matrix stored in row-major order
+         * \param &invA: The inverse of the matrix stored in row-major order. Must not alias A.
+         */
 
-        return NULL;
+        invA[ 0 ] = A[ 4 ] * A[ 8 ] - A[ 5 ] * A[ 7 ];
+        invA[ 3 ] = A[ 5 ] * A[ 6 ] - A[ 3 ] * A[ 8 ];
+        invA[ 6 ] = A[ 3 ] * A[ 7 ] - A[ 4 ] * A[ 6 ];
+        invA[ 1 ] = A[ 2 ] * A[ 7 ] - A[ 1 ] * A[ 8 ];
+        invA[ 4 ] = A[ 0 ] * A[ 8 ] - A[ 2 ] * A[ 6 ];
+        invA[ 7 ] = A[ 1 ] * A[ 6 ] - A[ 0 ] * A[ 7 ];
+        invA[ 2 ] = A[ 1 ] * A[ 5 ] - A[ 2 ] * A[ 4 ];
+        invA[ 5 ] = A[ 2 ] * A[ 3 ] - A[ 0 ] * A[ 5 ];
+        invA[ 8 ] = A[ 0 ] * A[ 4 ] - A[ 1 ] * A[ 3 ];
 
-    }
+        const T det = A[ 0 ] * invA[ 0 ] + A[ 1 ] * invA[ 3 ] + A[ 2 ] * invA[ 6 ];
 
+        const T invDet = 1 / det;
 
-    errorOut midpointEvolutionFlatJ( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
-                                     floatVector &dA, floatVector &A, floatVector &DADADt, floatVector &DADADtp,
-                                     const floatVector &alpha ){
+        for ( unsigned int i = 0; i < 9; i++ ){ invA[ i ] *= invDet; }
+
+        return det;
+
+    }
+
+    template< typename T >
+    static inline bool isNearlySingular( const T det, const T normSquared, const T tolerance ){
         /*!
-         * Perform midpoint rule based evolution of a vector and return the jacobian.
-         *
-         * alpha=0 (implicit)
+         * Check if a 3x3 matrix is singular or nearly singular. The check is scale invariant and compares the
+         * determinant to that of the identity scaled to the same Frobenius norm i.e. the matrix is reported as
+         * nearly singular if
          *
-         * alpha=1 (explicit)
+         * \f$ \left| \det\left( A \right) \right| \leq \text{tolerance} \left( \frac{A_{ij} A_{ij}}{3} \right)^{\frac{3}{2}} \f$
          *
-         * Note that the gradient of A w.r.t. Ap is identity and the gradient of dA w.r.t. Ap is zero
+         * The right hand side is formed as the cube of the root mean square of the components rather than by
+         * squaring the determinant so that the check only overflows or underflows when the determinant itself
+         * does. Non-finite determinants are also reported.
          *
-         * \param &Dt: The change in time.
-         * \param &Ap: The previous value of the vector
-         * \param &DApDt: The previous time rate of change of the vector.
-         * \param &DADt: The current time rate of change of the vector.
-         * \param &A: The change in value of the vector.
-         * \param &A: The current value of the vector.
-         * \param &DADADt: The gradient of A w.r.t. the current rate of change.
-         * \param &DADADtp: The gradient of A w.r.t. the previous rate of change.
-         * \param &alpha: The integration parameter.
+         * \param det: The determinant of the matrix
+         * \param normSquared: The squared Frobenius norm of the matrix
+         * \param tolerance: The relative tolerance
          */
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( midpointEvolutionFlatJ( Dt, Ap, DApDt, DADt, dA, A, DADADt, alpha ) );
+        const T rms = std::sqrt( normSquared / 3 );
 
-        const unsigned int A_size = A.size( );
+        return !std::isfinite( det ) || !( std::fabs( det ) > tolerance * rms * rms * rms );
 
-        DADADtp = floatVector( A_size * A_size, 0 );
+    }
 
-        unsigned int i = 0;
+    template< typename T >
+    T invertSecondOrderTensor( const secondOrderTensor< T > &A, secondOrderTensor< T > &invA, statusCode &status, const T tolerance ){
+        /*!
+         * Compute the inverse of a 3x3 matrix from its cofactors and return the determinant. Singular and nearly
+         * singular matrices are reported through the status rather than by throwing. The inverse is still computed
+         * in this case but should not be used.
+         *
+         * \param &A: The matrix stored in row-major order
+         * \param &invA: The inverse of the matrix stored in row-major order. Must not alias A.
+         * \param &status: The status of the operation
+         * \param tolerance: The relative tolerance on the determinant below which the matrix is reported as nearly singular
+         */
 
-        for ( auto ai = alpha.begin( ); ai != alpha.end( ); ai++, i++ ){
+        status = clearStatus( );
 
-            DADADtp[ A_size * i + i ] = Dt * ( *ai );
+        const T det = invertSecondOrderTensor( A, invA );
+
+        T normSquared = 0;
+
+        for ( unsigned int i = 0; i < 9; i++ ){ normSquared += A[ i ] * A[ i ]; }
+
+        if ( isNearlySingular( det, normSquared, tolerance ) ){
+
+            status = setStatus( statusCode::nearlySingular, "The 3x3 matrix is singular or nearly singular" );
 
         }
 
-        return NULL;
+        return det;
 
     }
 
-    errorOut midpointEvolution( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
-                                floatVector &dA, floatVector &A, floatMatrix &DADADt, floatMatrix &DADADtp,
-                                const floatVector &alpha ){
+    template< typename T >
+    void computeDeformationGradient( const secondOrderTensor< T > &displacementGradient, secondOrderTensor< T > &F, const bool isCurrent ){
         /*!
-         * Perform midpoint rule based evolution of a vector and return the jacobian.
+         * Compute the deformation gradient from the gradient of the displacement using fixed-size storage.
+         * No heap allocations are performed.
          *
-         * alpha=0 (implicit)
+         * If isCurrent = false
          *
-         * alpha=1 (explicit)
+         * \f$ \bf{F} = \frac{\partial \bf{u}}{\partial \bf{X} } u_i + \bf{I} \f$
          *
-         * Note that the gradient of A w.r.t. Ap is identity and the gradient of dA w.r.t. Ap is zero
+         * else if isCurrent = true
          *
-         * \param &Dt: The change in time.
-         * \param &Ap: The previous value of the vector
-         * \param &DApDt: The previous time rate of change of the vector.
-         * \param &DADt: The current time rate of change of the vector.
-         * \param &A: The change in value of the vector.
-         * \param &A: The current value of the vector.
-         * \param &DADADt: The gradient of A w.r.t. the current rate of change.
-         * \param &DADADtp: The gradient of A w.r.t. the previous rate of change.
-         * \param &alpha: The integration parameter.
+         * \f$ \bf{F} = \left(\bf{I} - \frac{\partial \bf{u}}{\partial \bf{x}}\right)^{-1} \f$
+         *
+         * \param &displacementGradient: The gradient of the displacement with respect to either the
+         *     current or previous position.
+         * \param &F: The deformation gradient
+         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
+         *     or reference (false) position.
          */
 
-        floatVector _DADADt, _DADADtp;
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( midpointEvolutionFlatJ( Dt, Ap, DApDt, DADt, dA, A, _DADADt, _DADADtp, alpha ) );
+        if ( isCurrent ){
 
-        DADADt  = tardigradeVectorTools::inflate( _DADADt,  A.size( ), A.size( ) );
+            secondOrderTensor< T > inverseF;
 
-        DADADtp = tardigradeVectorTools::inflate( _DADADtp, A.size( ), A.size( ) );
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ inverseF[ i ] = -displacementGradient[ i ]; }
 
-        return NULL;
+            for ( unsigned int i = 0; i < dim; i++ ){ inverseF[ dim * i + i ] += 1; }
 
-    }
+            secondOrderTensor< T > G;
 
-    errorOut midpointEvolution( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
-                                floatVector &dA, floatVector &A, const floatType alpha ){
-        /*!
-         * Perform midpoint rule based evolution of a vector. Defaults to the trapezoidal rule.
-         *
-         * alpha=0 (implicit)
-         *
-         * alpha=1 (explicit)
-         *
-         * \param &Dt: The change in time.
-         * \param &Ap: The previous value of the vector
-         * \param &DApDt: The previous time rate of change of the vector.
-         * \param &DADt: The current time rate of change of the vector.
-         * \param &dA: The change in the value of the vector.
-         * \param &A: The current value of the vector.
-         * \param alpha: The integration parameter.
-         */
+            invertSecondOrderTensor( inverseF, G );
 
-        return midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, alpha * floatVector( Ap.size( ), 1 ) );
+            // Form F = I + ( I - gradU )^{-1} gradU so that the round-off is relative to the displacement gradient
+            for ( unsigned int i = 0; i < dim; i++ ){
 
-    }
+                for ( unsigned int j = 0; j < dim; j++ ){
 
-    errorOut midpointEvolutionFlatJ( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
-                                     floatVector &dA, floatVector &A, floatVector &DADADt, const floatType alpha ){
-        /*!
-         * Perform midpoint rule based evolution of a vector. Defaults to the trapezoidal rule.
-         *
-         * alpha=0 (implicit)
-         *
-         * alpha=1 (explicit)
-         *
-         * \param &Dt: The change in time.
-         * \param &Ap: The previous value of the vector
-         * \param &DApDt: The previous time rate of change of the vector.
-         * \param *DADt: The current time rate of change of the vector.
-         * \param &dA: The change in the vector
-         * \param &A: The current value of the vector.
-         * \param &DADADt: The derivative of the vector w.r.t. the rate of change of the vector.
-         * \param alpha: The integration parameter.
-         */
+                    F[ dim * i + j ] = G[ dim * i + 0 ] * displacementGradient[ dim * 0 + j ]
+                                     + G[ dim * i + 1 ] * displacementGradient[ dim * 1 + j ]
+                                     + G[ dim * i + 2 ] * displacementGradient[ dim * 2 + j ];
 
-        return midpointEvolutionFlatJ( Dt, Ap, DApDt, DADt, dA, A, DADADt, alpha * floatVector( Ap.size( ), 1 ) );
+                }
 
-    }
+                F[ dim * i + i ] += 1;
 
-    errorOut midpointEvolutionFlatJ( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
-                                     floatVector &dA, floatVector &A, floatVector &DADADt, floatVector &DADADtp,
-                                     const floatType alpha ){
-        /*!
-         * Perform midpoint rule based evolution of a vector. Defaults to the trapezoidal rule.
-         *
-         * alpha=0 (implicit)
-         *
-         * alpha=1 (explicit)
-         * 
-         * Note that the gradient of A w.r.t. Ap is identity and the gradient of dA w.r.t. Ap is zero
-         *
-         * \param &Dt: The change in time.
-         * \param &Ap: The previous value of the vector
-         * \param &DApDt: The previous time rate of change of the vector.
-         * \param *DADt: The current time rate of change of the vector.
-         * \param &dA: The change in the vector
-         * \param &A: The current value of the vector.
-         * \param &DADADt: The derivative of the vector w.r.t. the rate of change of the vector.
-         * \param &DADADtp: The derivative of the vector w.r.t. the previous rate of change of the vector.
-         * \param alpha: The integration parameter.
-         */
+            }
 
-        return midpointEvolutionFlatJ( Dt, Ap, DApDt, DADt, dA, A, DADADt, DADADtp, alpha * floatVector( Ap.size( ), 1 ) );
+        }
+        else{
 
-    }
+            F = displacementGradient;
 
-    errorOut midpointEvolution( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
-                                floatVector &dA, floatVector &A, floatMatrix &DADADt, const floatType alpha ){
-        /*!
-         * Perform midpoint rule based evolution of a vector. Defaults to the trapezoidal rule.
-         *
-         * alpha=0 (implicit)
-         *
-         * alpha=1 (explicit)
-         *
-         * \param &Dt: The change in time.
-         * \param &Ap: The previous value of the vector
-         * \param &DApDt: The previous time rate of change of the vector.
-         * \param *DADt: The current time rate of change of the vector.
-         * \param &dA: The change in the vector
-         * \param &A: The current value of the vector.
-         * \param &DADADt: The derivative of the vector w.r.t. the rate of change of the vector.
-         * \param alpha: The integration parameter.
-         */
+            for ( unsigned int i = 0; i < dim; i++ ){ F[ dim * i + i ] += 1.; }
 
-        return midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, DADADt, alpha * floatVector( Ap.size( ), 1 ) );
+        }
 
     }
 
-    errorOut midpointEvolution( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
-                                floatVector &dA, floatVector &A, floatMatrix &DADADt, floatMatrix &DADADtp,
-                                const floatType alpha ){
+    template< typename T >
+    void computeDeformationGradient( const secondOrderTensor< T > &displacementGradient, secondOrderTensor< T > &F, fourthOrderTensor< T > &dFdGradU, const bool isCurrent ){
         /*!
-         * Perform midpoint rule based evolution of a vector. Defaults to the trapezoidal rule.
-         *
-         * alpha=0 (implicit)
+         * Compute the deformation gradient from the gradient of the displacement using fixed-size storage.
+         * No heap allocations are performed.
          *
-         * alpha=1 (explicit)
-         * 
-         * Note that the gradient of A w.r.t. Ap is identity and the gradient of dA w.r.t. Ap is zero
+         * If isCurrent = false
          *
-         * \param &Dt: The change in time.
-         * \param &Ap: The previous value of the vector
-         * \param &DApDt: The previous time rate of change of the vector.
-         * \param *DADt: The current time rate of change of the vector.
-         * \param &dA: The change in the vector
-         * \param &A: The current value of the vector.
-         * \param &DADADt: The derivative of the vector w.r.t. the rate of change of the vector.
-         * \param &DADADtp: The derivative of the vector w.r.t. the previous rate of change of the vector.
-         * \param alpha: The integration parameter.
-         */
-
-        return midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, DADADt, DADADtp, alpha * floatVector( Ap.size( ), 1 ) );
-
-    }
-
-    errorOut evolveF(const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
-                     floatVector &dF, floatVector &deformationGradient, const floatType alpha, const unsigned int mode){
-        /*!
-         * Evolve the deformation gradient ( F ) using the midpoint integration method.
+         * \f$ \bf{F} = \frac{\partial \bf{u}}{\partial \bf{X} } u_i + \bf{I} \f$
          *
-         * mode 1:
-         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
+         * else if isCurrent = true
          *
-         * mode 2:
-         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
+         * \f$ \bf{F} = \left(\bf{I} - \frac{\partial \bf{u}}{\partial \bf{x}}\right)^{-1} \f$
          *
-         * \param &Dt: The change in time.
-         * \param &previousDeformationGradient: The previous value of the deformation gradient
-         * \param &Lp: The previous velocity gradient in the current configuration (mode 1) or
-         *     reference configuration (mode 2).
-         * \param &L: The current velocity gradient in the current configuration (mode 1) or
-         *     reference configuration (mode 2).
-         * \param &dF: The change in the deformation gradient \f$\Delta \bf{F}\f$ such that \f$F_{iI}^{t+1} = F_{iI}^t + \Delta F_{iI}\f$
-         * \param &deformationGradient: The computed current deformation gradient.
-         * \param alpha: The integration parameter.
-         * \param mode: The mode of the ODE. Whether the velocity gradient is known in the
-         *     current (mode 1) or reference (mode 2) configuration.
+         * \param &displacementGradient: The gradient of the displacement with respect to either the
+         *     current or previous position.
+         * \param &F: The deformation gradient
+         * \param &dFdGradU: The derivative of the deformation gradient w.r.t. the displacement gradient
+         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
+         *     or reference (false) position.
          */
 
-        //Assumes 3D
         constexpr unsigned int dim = 3;
         constexpr unsigned int sot_dim = dim * dim;
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( previousDeformationGradient.size( ) == sot_dim, "The deformation gradient doesn't have enough terms (require 9 for 3D)" );
-
-        TARDIGRADE_ERROR_TOOLS_CHECK( Lp.size( ) == previousDeformationGradient.size( ), "The previous velocity gradient and deformation gradient aren't the same size" );
-
-        TARDIGRADE_ERROR_TOOLS_CHECK( previousDeformationGradient.size( ) == L.size( ), "The previous deformation gradient and the current velocity gradient aren't the same size" );
-
-        TARDIGRADE_ERROR_TOOLS_CHECK( ( mode == 1 ) || ( mode == 2 ), "The mode of evolution is not recognized" );
-
-        //Compute L^{t + \alpha}
-        floatVector LtpAlpha = alpha * Lp + ( 1 - alpha ) * L;
-
-        //Compute the right hand side
+        computeDeformationGradient( displacementGradient, F, isCurrent );
 
-        floatVector RHS( sot_dim, 0 );
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > Fp( previousDeformationGradient.data( ), dim, dim );
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > Lt( LtpAlpha.data( ), dim, dim );
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > RHS_map( RHS.data( ), dim, dim );
+        dFdGradU.fill( 0 );
 
-        if ( mode == 1 ){
-            RHS_map = ( Lt * Fp ).eval( );
-        }
-        if ( mode == 2 ){
-            RHS_map = ( Fp * Lt ).eval( );
-        }
+        if ( isCurrent ){
 
-        RHS *= Dt;
+            for ( unsigned int i = 0; i < dim; i++ ){
 
-        //Compute the left-hand side
-        floatVector eye( dim * dim );
+                for ( unsigned int j = 0; j < dim; j++ ){
 
-        tardigradeVectorTools::eye( eye );
+                    for ( unsigned int k = 0; k < dim; k++ ){
 
-        floatVector invLHS = -Dt * ( 1 - alpha ) * L;
-        for ( unsigned int i = 0; i < dim; i++ ){ invLHS[ dim * i + i ] += 1; }
+                        for ( unsigned int l = 0; l < dim; l++ ){
 
-        dF = floatVector( sot_dim, 0 );
+                            dFdGradU[ dim * sot_dim * i + sot_dim * j + dim * k + l ]
+                                = F[ dim * i + k ] * F[ dim * l + j ];
 
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > invLHS_map( invLHS.data( ), dim, dim );
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > dF_map( dF.data( ), dim, dim );
+                        }
 
-        invLHS_map = invLHS_map.inverse( ).eval( );
+                    }
 
-        if ( mode == 1 ){
+                }
 
-            dF_map = ( invLHS_map * RHS_map ).eval( );
+            }
 
         }
-        if ( mode == 2 ){
+        else{
 
-            dF_map = ( RHS_map * invLHS_map ).eval( );
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ dFdGradU[ sot_dim * i + i ] = 1; }
 
         }
 
-        deformationGradient = previousDeformationGradient + dF;
-
-        return NULL;
-
     }
 
-    errorOut evolveF(const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
-                     floatVector &deformationGradient, const floatType alpha, const unsigned int mode){
+    void computeDeformationGradient( const floatVector &displacementGradient, floatVector &F, const bool isCurrent ){
         /*!
-         * Evolve the deformation gradient ( F ) using the midpoint integration method.
+         * Compute the deformation gradient from the gradient of the displacement
          *
-         * mode 1:
-         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
+         * If isCurrent = false
          *
-         * mode 2:
-         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
+         * \f$ \bf{F} = \frac{\partial \bf{u}}{\partial \bf{X} } u_i + \bf{I} \f$
+         *
+         * else if isCurrent = true
+         *
+         * \f$ \bf{F} = \left(\bf{I} - \frac{\partial \bf{u}}{\partial \bf{x}}\right)^{-1} \f$
+         *
+         * One, two, and three dimensional displacement gradients are forwarded to the fixed-size overloads.
+         *
+         * \param &displacementGradient: The gradient of the displacement with respect to either the
+         *     current or previous position.
+         * \param &F: The deformation gradient
+         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
+         *     or reference (false) position.
+         */
+
+        const unsigned int dim = ( unsigned int )std::pow( displacementGradient.size( ), 0.5 );
+        const unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( displacementGradient.size( ) == sot_dim, "The displacement gradienthas " + std::to_string( displacementGradient.size( ) ) + " values but the dimension has been determined to be " + std::to_string( dim ) + "." );
+
+        if ( dim == 3 ){
+
+            floatSecondOrderTensor _displacementGradient, _F;
+
+            std::copy( displacementGradient.begin( ), displacementGradient.end( ), _displacementGradient.begin( ) );
+
+            computeDeformationGradient( _displacementGradient, _F, isCurrent );
+
+            F.assign( _F.begin( ), _F.end( ) );
+
+            return;
+
+        }
+        else if ( dim == 2 ){
+
+            kinematicTensor< planeStrain, floatType > _displacementGradient, _F;
+
+            std::copy( displacementGradient.begin( ), displacementGradient.end( ), _displacementGradient.begin( ) );
+
+            computeDeformationGradient< planeStrain >( _displacementGradient, _F, isCurrent );
+
+            F.assign( _F.begin( ), _F.end( ) );
+
+            return;
+
+        }
+        else if ( dim == 1 ){
+
+            kinematicTensor< uniaxialStrain, floatType > _F;
+
+            computeDeformationGradient< uniaxialStrain >( { displacementGradient[ 0 ] }, _F, isCurrent );
+
+            F.assign( _F.begin( ), _F.end( ) );
+
+            return;
+
+        }
+
+        F = floatVector( sot_dim, 0 );
+
+        std::copy( displacementGradient.begin( ),
+                   displacementGradient.end( ),
+                   F.begin( ) );
+
+        if ( isCurrent ){
+
+            std::transform( F.cbegin( ), F.cend( ), F.begin( ), std::negate< floatType >( ) );
+
+            for ( unsigned int i = 0; i < dim; i++ ){ F[ dim * i + i ] += 1; }
+
+            Eigen::Map< Eigen::Matrix< floatType, -1, -1 > > map( F.data( ), dim, dim );
+            map = map.inverse( ).eval( );
+
+        }
+        else{
+
+            for ( unsigned int i = 0; i < dim; i++ ){ F[ dim * i + i ] += 1.; }
+
+        }
+
+        return;
+
+    }
+
+    void computeDeformationGradient( const floatVector &displacementGradient, floatVector &F, floatVector &dFdGradU, const bool isCurrent ){
+        /*!
+         * Compute the deformation gradient from the gradient of the displacement
+         *
+         * If isCurrent = false
+         *
+         * \f$ \bf{F} = \frac{\partial \bf{u}}{\partial \bf{X} } u_i + \bf{I} \f$
+         *
+         * else if isCurrent = true
+         *
+         * \f$ \bf{F} = \left(\bf{I} - \frac{\partial \bf{u}}{\partial \bf{x}}\right)^{-1} \f$
+         *
+         * One, two, and three dimensional displacement gradients are forwarded to the fixed-size overloads.
+         *
+         * \param &displacementGradient: The gradient of the displacement with respect to either the
+         *     current or previous position.
+         * \param &F: The deformation gradient
+         * \param &dFdGradU: The derivative of the deformation gradient w.r.t. the displacement gradient
+         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
+         *     or reference (false) position.
+         */
+
+        const unsigned int dim = ( unsigned int )std::pow( displacementGradient.size( ), 0.5 );
+        const unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( displacementGradient.size( ) == sot_dim, "The displacement gradienthas " + std::to_string( displacementGradient.size( ) ) + " values but the dimension has been determined to be " + std::to_string( dim ) + "." );
+
+        if ( dim == 3 ){
+
+            floatSecondOrderTensor _displacementGradient, _F;
+
+            floatFourthOrderTensor _dFdGradU;
+
+            std::copy( displacementGradient.begin( ), displacementGradient.end( ), _displacementGradient.begin( ) );
+
+            computeDeformationGradient( _displacementGradient, _F, _dFdGradU, isCurrent );
+
+            F.assign( _F.begin( ), _F.end( ) );
+
+            dFdGradU.assign( _dFdGradU.begin( ), _dFdGradU.end( ) );
+
+            return;
+
+        }
+        else if ( dim == 2 ){
+
+            kinematicTensor< planeStrain, floatType > _displacementGradient, _F;
+
+            kinematicJacobian< planeStrain, floatType > _dFdGradU;
+
+            std::copy( displacementGradient.begin( ), displacementGradient.end( ), _displacementGradient.begin( ) );
+
+            computeDeformationGradient< planeStrain >( _displacementGradient, _F, _dFdGradU, isCurrent );
+
+            F.assign( _F.begin( ), _F.end( ) );
+
+            dFdGradU.assign( _dFdGradU.begin( ), _dFdGradU.end( ) );
+
+            return;
+
+        }
+        else if ( dim == 1 ){
+
+            kinematicTensor< uniaxialStrain, floatType > _F;
+
+            kinematicJacobian< uniaxialStrain, floatType > _dFdGradU;
+
+            computeDeformationGradient< uniaxialStrain >( { displacementGradient[ 0 ] }, _F, _dFdGradU, isCurrent );
+
+            F.assign( _F.begin( ), _F.end( ) );
+
+            dFdGradU.assign( _dFdGradU.begin( ), _dFdGradU.end( ) );
+
+            return;
+
+        }
+
+        F = floatVector( sot_dim, 0 );
+
+        dFdGradU = floatVector( sot_dim * sot_dim, 0 );
+
+        std::copy( displacementGradient.begin( ),
+                   displacementGradient.end( ),
+                   F.begin( ) );
+
+        if ( isCurrent ){
+
+            std::transform( F.cbegin( ), F.cend( ), F.begin( ), std::negate< floatType >( ) );
+
+            for ( unsigned int i = 0; i < dim; i++ ){ F[ dim * i + i ] += 1; }
+
+            Eigen::Map< Eigen::Matrix< floatType, -1, -1 > > map( F.data( ), dim, dim );
+            map = map.inverse( ).eval( );
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                for ( unsigned int j = 0; j < dim; j++ ){
+
+                    for ( unsigned int k = 0; k < dim; k++ ){
+
+                        for ( unsigned int l = 0; l < dim; l++ ){
+
+                            dFdGradU[ dim * sot_dim * i + sot_dim * j + dim * k + l ]
+                                = F[ dim * i + k ] * F[ dim * l + j ];
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+        }
+        else{
+
+            for ( unsigned int i = 0; i < dim; i++ ){ F[ dim * i + i ] += 1.; }
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ dFdGradU[ sot_dim * i + i ] += 1; }
+
+        }
+
+        return;
+
+    }
+
+    template< unsigned int n, typename T >
+    static T invertSquareBlock( const T *A, T *invA ){
+        /*!
+         * Compute the inverse of a small square matrix stored in row-major order and return the determinant
+         *
+         * \param *A: The matrix ( \f$n^2\f$ values )
+         * \param *invA: The inverse of the matrix ( \f$n^2\f$ values )
+         */
+
+        static_assert( ( n == 1 ) || ( n == 2 ), "Only one and two dimensional blocks are supported. Use invertSecondOrderTensor in 3D." );
+
+        if constexpr ( n == 1 ){
+
+            invA[ 0 ] = 1 / A[ 0 ];
+
+            return A[ 0 ];
+
+        }
+        else{
+
+            const T det = A[ 0 ] * A[ 3 ] - A[ 1 ] * A[ 2 ];
+
+            const T invDet = 1 / det;
+
+            const T a0 = A[ 0 ], a1 = A[ 1 ], a2 = A[ 2 ], a3 = A[ 3 ];
+
+            invA[ 0 ] =  a3 * invDet;
+            invA[ 1 ] = -a1 * invDet;
+            invA[ 2 ] = -a2 * invDet;
+            invA[ 3 ] =  a0 * invDet;
+
+            return det;
+
+        }
+
+    }
+
+    template< class K, typename T >
+    T invertDeformationGradient( const kinematicTensor< K, T > &deformationGradient, kinematicTensor< K, T > &inverseDeformationGradient ){
+        /*!
+         * Compute the inverse of a deformation gradient under the kinematic assumption K and return its determinant.
+         * The block of general components is inverted in closed form and the hoop components are inverted
+         * independently.
+         *
+         * \param &deformationGradient: The deformation gradient ( \f$F\f$ )
+         * \param &inverseDeformationGradient: The inverse of the deformation gradient ( \f$F^{-1}\f$ )
+         */
+
+        if constexpr ( std::is_same< K, threeDimensional >::value ){
+
+            return invertSecondOrderTensor( deformationGradient, inverseDeformationGradient );
+
+        }
+        else{
+
+            constexpr unsigned int block_size = K::blockDim * K::blockDim;
+
+            T J = invertSquareBlock< K::blockDim >( deformationGradient.data( ), inverseDeformationGradient.data( ) );
+
+            for ( unsigned int h = block_size; h < K::size; h++ ){
+
+                J *= deformationGradient[ h ];
+
+                inverseDeformationGradient[ h ] = 1 / deformationGradient[ h ];
+
+            }
+
+            return J;
+
+        }
+
+    }
+
+    template< class K, typename T >
+    void computeDeformationGradient( const kinematicTensor< K, T > &displacementGradient, kinematicTensor< K, T > &F, const bool isCurrent ){
+        /*!
+         * Compute the deformation gradient from the gradient of the displacement under the kinematic assumption K.
+         * Only the stored components are computed and the inverse is fixed-size.
+         *
+         * If isCurrent = false
+         *
+         * \f$ \bf{F} = \frac{\partial \bf{u}}{\partial \bf{X} } + \bf{I} \f$
+         *
+         * else if isCurrent = true
+         *
+         * \f$ \bf{F} = \left(\bf{I} - \frac{\partial \bf{u}}{\partial \bf{x}}\right)^{-1} \f$
+         *
+         * For axisymmetric analyses the hoop component of the displacement gradient is \f$\frac{u_r}{R}\f$
+         * or \f$\frac{u_r}{r}\f$ respectively.
+         *
+         * \param &displacementGradient: The gradient of the displacement with respect to either the
+         *     current or previous position.
+         * \param &F: The deformation gradient
+         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
+         *     or reference (false) position.
+         */
+
+        if constexpr ( std::is_same< K, threeDimensional >::value ){
+
+            computeDeformationGradient< T >( displacementGradient, F, isCurrent );
+
+        }
+        else{
+
+            constexpr unsigned int block_size = K::blockDim * K::blockDim;
+
+            kinematicTensor< K, T > A;
+
+            const T sign = isCurrent ? -1 : 1;
+
+            for ( unsigned int i = 0; i < K::size; i++ ){ A[ i ] = sign * displacementGradient[ i ]; }
+
+            for ( unsigned int i = 0; i < K::blockDim; i++ ){ A[ K::blockDim * i + i ] += 1; }
+
+            for ( unsigned int h = block_size; h < K::size; h++ ){ A[ h ] += 1; }
+
+            if ( isCurrent ){
+
+                invertDeformationGradient< K >( A, F );
+
+            }
+            else{
+
+                F = A;
+
+            }
+
+        }
+
+    }
+
+    template< class K, typename T >
+    void computeDeformationGradient( const kinematicTensor< K, T > &displacementGradient, kinematicTensor< K, T > &F,
+                                     kinematicJacobian< K, T > &dFdGradU, const bool isCurrent ){
+        /*!
+         * Compute the deformation gradient from the gradient of the displacement under the kinematic assumption K
+         * along with its derivative w.r.t. the stored components of the displacement gradient.
+         *
+         * \param &displacementGradient: The gradient of the displacement with respect to either the
+         *     current or previous position.
+         * \param &F: The deformation gradient
+         * \param &dFdGradU: The derivative of the deformation gradient w.r.t. the displacement gradient
+         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
+         *     or reference (false) position.
+         */
+
+        if constexpr ( std::is_same< K, threeDimensional >::value ){
+
+            computeDeformationGradient< T >( displacementGradient, F, dFdGradU, isCurrent );
+
+        }
+        else{
+
+            constexpr unsigned int bd = K::blockDim;
+            constexpr unsigned int block_size = bd * bd;
+            constexpr unsigned int size = K::size;
+
+            computeDeformationGradient< K >( displacementGradient, F, isCurrent );
+
+            dFdGradU.fill( 0 );
+
+            if ( isCurrent ){
+
+                for ( unsigned int i = 0; i < bd; i++ ){
+
+                    for ( unsigned int j = 0; j < bd; j++ ){
+
+                        for ( unsigned int k = 0; k < bd; k++ ){
+
+                            for ( unsigned int l = 0; l < bd; l++ ){
+
+                                dFdGradU[ size * ( bd * i + j ) + bd * k + l ] = F[ bd * i + k ] * F[ bd * l + j ];
+
+                            }
+
+                        }
+
+                    }
+
+                }
+
+                for ( unsigned int h = block_size; h < size; h++ ){ dFdGradU[ size * h + h ] = F[ h ] * F[ h ]; }
+
+            }
+            else{
+
+                for ( unsigned int i = 0; i < size; i++ ){ dFdGradU[ size * i + i ] = 1; }
+
+            }
+
+        }
+
+    }
+
+    template< class K, typename T >
+    void computeRightCauchyGreen( const kinematicTensor< K, T > &deformationGradient, kinematicTensor< K, T > &C ){
+        /*!
+         * Compute the Right Cauchy-Green deformation tensor ( \f$C_{IJ} = F_{iI} F_{iJ}\f$ ) under the kinematic
+         * assumption K
+         *
+         * \param &deformationGradient: The deformation gradient
+         * \param &C: The resulting Right Cauchy-Green deformation tensor
+         */
+
+        if constexpr ( std::is_same< K, threeDimensional >::value ){
+
+            computeRightCauchyGreen< T >( deformationGradient, C );
+
+        }
+        else{
+
+            constexpr unsigned int bd = K::blockDim;
+            constexpr unsigned int block_size = bd * bd;
+
+            for ( unsigned int I = 0; I < bd; I++ ){
+
+                for ( unsigned int J = 0; J < bd; J++ ){
+
+                    C[ bd * I + J ] = 0;
+
+                    for ( unsigned int k = 0; k < bd; k++ ){
+
+                        C[ bd * I + J ] += deformationGradient[ bd * k + I ] * deformationGradient[ bd * k + J ];
+
+                    }
+
+                }
+
+            }
+
+            for ( unsigned int h = block_size; h < K::size; h++ ){ C[ h ] = deformationGradient[ h ] * deformationGradient[ h ]; }
+
+        }
+
+    }
+
+    template< class K, typename T >
+    void computeRightCauchyGreen( const kinematicTensor< K, T > &deformationGradient, kinematicTensor< K, T > &C, kinematicJacobian< K, T > &dCdF ){
+        /*!
+         * Compute the Right Cauchy-Green deformation tensor ( \f$C_{IJ} = F_{iI} F_{iJ}\f$ ) under the kinematic
+         * assumption K along with its derivative w.r.t. the stored components of the deformation gradient
+         *
+         * \param &deformationGradient: The deformation gradient
+         * \param &C: The resulting Right Cauchy-Green deformation tensor
+         * \param &dCdF: The derivative of the Right Cauchy-Green deformation tensor w.r.t. the deformation gradient
+         */
+
+        if constexpr ( std::is_same< K, threeDimensional >::value ){
+
+            computeRightCauchyGreen< T >( deformationGradient, C, dCdF );
+
+        }
+        else{
+
+            constexpr unsigned int bd = K::blockDim;
+            constexpr unsigned int block_size = bd * bd;
+            constexpr unsigned int size = K::size;
+
+            computeRightCauchyGreen< K >( deformationGradient, C );
+
+            dCdF.fill( 0 );
+
+            for ( unsigned int I = 0; I < bd; I++ ){
+
+                for ( unsigned int J = 0; J < bd; J++ ){
+
+                    for ( unsigned int k = 0; k < bd; k++ ){
+
+                        dCdF[ size * ( bd * I + J ) + bd * k + I ] += deformationGradient[ bd * k + J ];
+
+                        dCdF[ size * ( bd * I + J ) + bd * k + J ] += deformationGradient[ bd * k + I ];
+
+                    }
+
+                }
+
+            }
+
+            for ( unsigned int h = block_size; h < size; h++ ){ dCdF[ size * h + h ] = 2 * deformationGradient[ h ]; }
+
+        }
+
+    }
+
+    template< class K, typename T >
+    void computeGreenLagrangeStrain( const kinematicTensor< K, T > &deformationGradient, kinematicTensor< K, T > &E ){
+        /*!
+         * Compute the Green-Lagrange strain ( \f$E_{IJ} = \frac{1}{2} \left( F_{iI} F_{iJ} - \delta_{IJ} \right)\f$ )
+         * under the kinematic assumption K
+         *
+         * \param &deformationGradient: The deformation gradient
+         * \param &E: The Green-Lagrange strain
+         */
+
+        if constexpr ( std::is_same< K, threeDimensional >::value ){
+
+            computeGreenLagrangeStrain< T >( deformationGradient, E );
+
+        }
+        else{
+
+            constexpr unsigned int block_size = K::blockDim * K::blockDim;
+
+            computeRightCauchyGreen< K >( deformationGradient, E );
+
+            for ( unsigned int i = 0; i < K::blockDim; i++ ){ E[ K::blockDim * i + i ] -= 1; }
+
+            for ( unsigned int h = block_size; h < K::size; h++ ){ E[ h ] -= 1; }
+
+            for ( unsigned int i = 0; i < K::size; i++ ){ E[ i ] *= 0.5; }
+
+        }
+
+    }
+
+    template< class K, typename T >
+    void computeGreenLagrangeStrain( const kinematicTensor< K, T > &deformationGradient, kinematicTensor< K, T > &E, kinematicJacobian< K, T > &dEdF ){
+        /*!
+         * Compute the Green-Lagrange strain ( \f$E_{IJ} = \frac{1}{2} \left( F_{iI} F_{iJ} - \delta_{IJ} \right)\f$ )
+         * under the kinematic assumption K along with its derivative w.r.t. the stored components of the
+         * deformation gradient
+         *
+         * \param &deformationGradient: The deformation gradient
+         * \param &E: The Green-Lagrange strain
+         * \param &dEdF: The derivative of the Green-Lagrange strain w.r.t. the deformation gradient
+         */
+
+        if constexpr ( std::is_same< K, threeDimensional >::value ){
+
+            computeGreenLagrangeStrain< T >( deformationGradient, E, dEdF );
+
+        }
+        else{
+
+            constexpr unsigned int block_size = K::blockDim * K::blockDim;
+
+            computeRightCauchyGreen< K >( deformationGradient, E, dEdF );
+
+            for ( unsigned int i = 0; i < K::blockDim; i++ ){ E[ K::blockDim * i + i ] -= 1; }
+
+            for ( unsigned int h = block_size; h < K::size; h++ ){ E[ h ] -= 1; }
+
+            for ( unsigned int i = 0; i < K::size; i++ ){ E[ i ] *= 0.5; }
+
+            for ( unsigned int i = 0; i < K::size * K::size; i++ ){ dEdF[ i ] *= 0.5; }
+
+        }
+
+    }
+
+    template< class K, typename T >
+    void expandToThreeDimensions( const kinematicTensor< K, T > &A, secondOrderTensor< T > &A3D, const T undeformedDiagonal ){
+        /*!
+         * Expand the stored components of a second order tensor under the kinematic assumption K to a full 3D
+         * second order tensor so that it may be passed to the three dimensional functions. The block of general
+         * components occupies the leading rows and columns and the hoop components the following diagonal entries
+         * i.e. axisymmetric tensors are expanded in \f$\left(r, z, \theta\right)\f$ order.
+         *
+         * \param &A: The stored components of the tensor
+         * \param &A3D: The full 3D tensor
+         * \param &undeformedDiagonal: The value of the diagonal components which are not stored e.g. 1 for the
+         *     deformation gradient and 0 for the displacement gradient or the Green-Lagrange strain
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int bd = K::blockDim;
+        constexpr unsigned int block_size = bd * bd;
+
+        A3D.fill( 0 );
+
+        for ( unsigned int i = 0; i < dim; i++ ){ A3D[ dim * i + i ] = undeformedDiagonal; }
+
+        for ( unsigned int i = 0; i < bd; i++ ){
+
+            for ( unsigned int j = 0; j < bd; j++ ){
+
+                A3D[ dim * i + j ] = A[ bd * i + j ];
+
+            }
+
+        }
+
+        for ( unsigned int h = block_size; h < K::size; h++ ){
+
+            const unsigned int d = bd + h - block_size;
+
+            A3D[ dim * d + d ] = A[ h ];
+
+        }
+
+    }
+
+    template< typename T >
+    void computeRightCauchyGreen( const secondOrderTensor< T > &deformationGradient, secondOrderTensor< T > &C ){
+        /*!
+         * Compute the Right Cauchy-Green deformation tensor ( \f$C\f$ ) using fixed-size storage.
+         * No heap allocations are performed.
+         *
+         * \f$C_{IJ} = F_{iI} F_{iJ}\f$
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ )
+         * \param &C: The resulting Right Cauchy-Green deformation tensor ( \f$C\f$ )
+         *
+         * The deformation gradient is organized as F11, F12, F13, F21, F22, F23, F31, F32, F33
+         *
+         * The Right Cauchy-Green deformation tensor is organized as C11, C12, C13, C21, C22, C23, C31, C32, C33
+         */
+
+        constexpr unsigned int dim = 3;
+
+        Eigen::Map< const Eigen::Matrix< T, dim, dim, Eigen::RowMajor > > F( deformationGradient.data( ) );
+        Eigen::Map< Eigen::Matrix< T, dim, dim, Eigen::RowMajor > > C_map( C.data( ) );
+
+        C_map = ( F.transpose( ) * F ).eval( );
+
+    }
+
+    template< typename T >
+    void computeRightCauchyGreen( const secondOrderTensor< T > &deformationGradient, secondOrderTensor< T > &C, fourthOrderTensor< T > &dCdF ){
+        /*!
+         * Compute the Right Cauchy-Green deformation tensor ( \f$C\f$ ) from the deformation gradient ( \f$F\f$ )
+         * using fixed-size storage. No heap allocations are performed.
+         *
+         * \f$C_{IJ} = F_{iI} F_{iJ}\f$
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ )
+         * \param &C: The resulting Right Cauchy-Green deformation tensor ( \f$C\f$ )
+         * \param &dCdF: The Jacobian of the Right Cauchy-Green deformation tensor
+         *     with regards to the deformation gradient ( \f$\frac{\partial C}{\partial F}\f$ ).
+         *
+         * The deformation gradient is organized as F11, F12, F13, F21, F22, F23, F31, F32, F33
+         *
+         * The Right Cauchy-Green deformation tensor is organized as C11, C12, C13, C21, C22, C23, C31, C32, C33
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        computeRightCauchyGreen( deformationGradient, C );
+
+        dCdF.fill( 0 );
+
+        for ( unsigned int I = 0; I < dim; I++ ){
+            for ( unsigned int J = 0; J < dim; J++ ){
+                for ( unsigned int k = 0; k < dim; k++ ){
+                    dCdF[ dim * sot_dim * I + sot_dim * J + dim * k + I ] += deformationGradient[ dim * k + J ];
+                    dCdF[ dim * sot_dim * I + sot_dim * J + dim * k + J ] += deformationGradient[ dim * k + I ];
+                }
+            }
+        }
+
+    }
+
+    errorOut computeRightCauchyGreen( const floatVector &deformationGradient, floatVector &C ){
+        /*!
+         * Compute the Right Cauchy-Green deformation tensor ( \f$C\f$ )
+         *
+         * \f$C_{IJ} = F_{iI} F_{iJ}\f$
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ )
+         * \param &C: The resulting Right Cauchy-Green deformation tensor ( \f$C\f$ )
+         *
+         * The deformation gradient is organized as F11, F12, F13, F21, F22, F23, F31, F32, F33
+         *
+         * The Right Cauchy-Green deformation tensor is organized as C11, C12, C13, C21, C22, C23, C31, C32, C33
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( deformationGradient.size( ) == 9, "The deformation gradient must be 3D" );
+
+        statusCode status;
+
+        computeRightCauchyGreen( deformationGradient, C, status );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( status == statusCode::success, statusDescription( status ) );
+
+        return NULL;
+    }
+
+    errorOut computeRightCauchyGreen( const floatVector &deformationGradient, floatVector &C, floatMatrix &dCdF ){
+        /*!
+         * Compute the Right Cauchy-Green deformation tensor ( \f$C\f$ ) from the deformation gradient ( \f$F\f$ )
+         * 
+         * \f$C_{IJ} = F_{iI} F_{iJ}\f$
+         * 
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ )
+         * \param &C: The resulting Right Cauchy-Green deformation tensor ( \f$C\f$ )
+         * \param &dCdF: The Jacobian of the Right Cauchy-Green deformation tensor
+         *     with regards to the deformation gradient ( \f$\frac{\partial C}{\partial F}\f$ ).
+         *
+         * The deformation gradient is organized as F11, F12, F13, F21, F22, F23, F31, F32, F33
+         *
+         * The Right Cauchy-Green deformation tensor is organized as C11, C12, C13, C21, C22, C23, C31, C32, C33
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        floatVector _dCdF;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( computeRightCauchyGreen( deformationGradient, C, _dCdF ) );
+
+        asMatrix( _dCdF, sot_dim ).copyTo( dCdF );
+
+        return NULL;
+
+    }
+
+    errorOut computeRightCauchyGreen( const floatVector &deformationGradient, floatVector &C, floatVector &dCdF ){
+        /*!
+         * Compute the Right Cauchy-Green deformation tensor ( \f$C\f$ ) from the deformation gradient ( \f$F\f$ )
+         * 
+         * \f$C_{IJ} = F_{iI} F_{iJ}\f$
+         * 
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ )
+         * \param &C: The resulting Right Cauchy-Green deformation tensor ( \f$C\f$ )
+         * \param &dCdF: The Jacobian of the Right Cauchy-Green deformation tensor
+         *     with regards to the deformation gradient ( \f$\frac{\partial C}{\partial F}\f$ ).
+         *
+         * The deformation gradient is organized as F11, F12, F13, F21, F22, F23, F31, F32, F33
+         *
+         * The Right Cauchy-Green deformation tensor is organized as C11, C12, C13, C21, C22, C23, C31, C32, C33
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( deformationGradient.size( ) == 9, "The deformation gradient must be 3D" );
+
+        statusCode status;
+
+        computeRightCauchyGreen( deformationGradient, C, dCdF, status );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( status == statusCode::success, statusDescription( status ) );
+
+        return NULL;
+
+    }
+
+    void computeRightCauchyGreen( const floatVector &deformationGradient, floatVector &C, statusCode &status ){
+        /*!
+         * Compute the Right Cauchy-Green deformation tensor ( \f$C\f$ )
+         *
+         * \f$C_{IJ} = F_{iI} F_{iJ}\f$
+         *
+         * Failures are reported through the status code without allocating or throwing. C is only
+         * re-allocated if its capacity is too small.
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ )
+         * \param &C: The resulting Right Cauchy-Green deformation tensor ( \f$C\f$ )
+         * \param &status: The status of the operation
+         */
+
+        //Assume 3D
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        status = clearStatus( );
+
+        TARDIGRADE_CONSTITUTIVE_TOOLS_STATUS_CHECK( deformationGradient.size( ) == sot_dim, statusCode::notThreeDimensional, "The deformation gradient must be 3D" );
+
+        floatSecondOrderTensor _deformationGradient, _C;
+
+        std::copy( deformationGradient.begin( ), deformationGradient.begin( ) + sot_dim, _deformationGradient.begin( ) );
+
+        computeRightCauchyGreen( _deformationGradient, _C );
+
+        C.assign( _C.begin( ), _C.end( ) );
+
+    }
+
+    void computeRightCauchyGreen( const floatVector &deformationGradient, floatVector &C, floatVector &dCdF, statusCode &status ){
+        /*!
+         * Compute the Right Cauchy-Green deformation tensor ( \f$C\f$ ) from the deformation gradient ( \f$F\f$ )
+         * and its Jacobian.
+         *
+         * \f$C_{IJ} = F_{iI} F_{iJ}\f$
+         *
+         * Failures are reported through the status code without allocating or throwing. The outputs are only
+         * re-allocated if their capacities are too small.
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ )
+         * \param &C: The resulting Right Cauchy-Green deformation tensor ( \f$C\f$ )
+         * \param &dCdF: The Jacobian of the Right Cauchy-Green deformation tensor
+         *     with regards to the deformation gradient ( \f$\frac{\partial C}{\partial F}\f$ ).
+         * \param &status: The status of the operation
+         */
+
+        //Assume 3D
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        status = clearStatus( );
+
+        TARDIGRADE_CONSTITUTIVE_TOOLS_STATUS_CHECK( deformationGradient.size( ) == sot_dim, statusCode::notThreeDimensional, "The deformation gradient must be 3D" );
+
+        floatSecondOrderTensor _deformationGradient, _C;
+
+        floatFourthOrderTensor _dCdF;
+
+        std::copy( deformationGradient.begin( ), deformationGradient.begin( ) + sot_dim, _deformationGradient.begin( ) );
+
+        computeRightCauchyGreen( _deformationGradient, _C, _dCdF );
+
+        C.assign( _C.begin( ), _C.end( ) );
+
+        dCdF.assign( _dCdF.begin( ), _dCdF.end( ) );
+
+    }
+
+    template< typename T >
+    void computeGreenLagrangeStrain( const secondOrderTensor< T > &deformationGradient, secondOrderTensor< T > &E ){
+        /*!
+         * Compute the Green-Lagrange strain ( \f$E\f$ ) from the deformation gradient ( \f$F\f$ ) using fixed-size
+         * storage. No heap allocations are performed. The operation is:
+         *
+         * \f$E = 0.5 (F_{iI} F_{iJ} - \delta_{IJ})\f$
+         *
+         * Where \f$F\f$ is the deformation gradient and \f$\delta\f$ is the kronecker delta.
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
+         * \param &E: The resulting Green-Lagrange strain ( \f$E\f$ ).
+         *
+         * The deformation gradient is organized as  F11, F12, F13, F21, F22, F23, F31, F32, F33
+         *
+         * The Green-Lagrange strain is organized as E11, E12, E13, E21, E22, E23, E31, E32, E33
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        computeRightCauchyGreen( deformationGradient, E );
+
+        for ( unsigned int I = 0; I < dim; I++ ){ E[ dim * I + I ] -= 1; }
+
+        for ( unsigned int I = 0; I < sot_dim; I++ ){ E[ I ] *= T( 0.5 ); }
+
+    }
+
+    template< typename T >
+    void computeGreenLagrangeStrain( const secondOrderTensor< T > &deformationGradient, secondOrderTensor< T > &E, fourthOrderTensor< T > &dEdF ){
+        /*!
+         * Compute the Green-Lagrange strain ( \f$E\f$ ) from the deformation gradient ( \f$F\f$ ) and it's jacobian
+         * using fixed-size storage. No heap allocations are performed.
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
+         * \param &E: The resulting Green-Lagrange strain ( \f$E\f$ ).
+         * \param &dEdF: The jacobian of the Green-Lagrange strain w.r.t. the
+         *     deformation gradient ( \f$\frac{\partial E}{\partial F}\f$ ).
+         *
+         * The deformation gradient is organized as  F11, F12, F13, F21, F22, F23, F31, F32, F33
+         *
+         * The Green-Lagrange strain is organized as E11, E12, E13, E21, E22, E23, E31, E32, E33
+         */
+
+        computeGreenLagrangeStrain( deformationGradient, E );
+
+        computeDGreenLagrangeStrainDF( deformationGradient, dEdF );
+
+    }
+
+    template< typename T >
+    void computeDGreenLagrangeStrainDF( const secondOrderTensor< T > &deformationGradient, fourthOrderTensor< T > &dEdF ){
+        /*!
+         * Compute the derivative of the Green-Lagrange strain ( \f$E\f$ )w.r.t. the deformation gradient ( \f$F\f$ )
+         * using fixed-size storage. No heap allocations are performed.
+         *
+         * \f$\frac{\partial E_{IJ}}{\partial F_{kK}} = 0.5 ( \delta_{IK} F_{kJ} + F_{kI} \delta_{JK})\f$
+         *
+         * Where \f$F\f$ is the deformation gradient and \f$\delta\f$ is the kronecker delta.
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
+         * \param &dEdF: The resulting gradient ( \f$\frac{\partial E}{\partial F}\f$ ).
+         *
+         * The deformation gradient is organized as  F11, F12, F13, F21, F22, F23, F31, F32, F33
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        dEdF.fill( 0 );
+
+        for ( unsigned int I = 0; I < dim; I++ ){
+            for ( unsigned int J = 0; J < dim; J++ ){
+                for ( unsigned int k = 0; k < dim; k++ ){
+                    dEdF[ dim * sot_dim * I + sot_dim * J + dim * k + I ] += T( 0.5 ) * deformationGradient[ dim * k + J ];
+                    dEdF[ dim * sot_dim * I + sot_dim * J + dim * k + J ] += T( 0.5 ) * deformationGradient[ dim * k + I ];
+                }
+            }
+        }
+
+    }
+
+    errorOut computeGreenLagrangeStrain( const floatVector &deformationGradient,
+                                         floatVector &E ){
+        /*!
+         * Compute the Green-Lagrange strain ( \f$E\f$ ) from the deformation gradient ( \f$F\f$ ). The operation is:
+         *
+         * \f$E = 0.5 (F_{iI} F_{iJ} - \delta_{IJ})\f$
+         *
+         * Where \f$F\f$ is the deformation gradient and \f$\delta\f$ is the kronecker delta.
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
+         * \param &E: The resulting Green-Lagrange strain ( \f$E\f$ ).
+         *
+         * The deformation gradient is organized as  F11, F12, F13, F21, F22, F23, F31, F32, F33
+         *
+         * The Green-Lagrange strain is organized as E11, E12, E13, E21, E22, E23, E31, E32, E33
+         */
+
+        if ( deformationGradient.size( ) != 9 ){
+            return new errorNode( "computeGreenLagrangeStrain", "The deformation gradient must be 3D." );
+        }
+
+        statusCode status;
+
+        computeGreenLagrangeStrain( deformationGradient, E, status );
+
+        if ( status != statusCode::success ){
+            return new errorNode( "computeGreenLagrangeStrain", statusDescription( status ) );
+        }
+
+        return NULL;
+    }
+
+    errorOut computeGreenLagrangeStrain( const floatVector &deformationGradient, floatVector &E, floatMatrix &dEdF){
+        /*!
+         * Compute the Green-Lagrange strain ( \f$E\f$ ) from the deformation gradient ( \f$F\f$ ) and it's jacobian.
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
+         * \param &E: The resulting Green-Lagrange strain ( \f$E\f$ ).
+         * \param &dEdF: The jacobian of the Green-Lagrange strain w.r.t. the
+         *     deformation gradient ( \f$\frac{\partial E}{\partial F}\f$ ).
+         *
+         * The deformation gradient is organized as  F11, F12, F13, F21, F22, F23, F31, F32, F33
+         *
+         * The Green-Lagrange strain is organized as E11, E12, E13, E21, E22, E23, E31, E32, E33
+         */
+
+        floatVector _dEdF;
+
+        errorOut error = computeGreenLagrangeStrain( deformationGradient, E, _dEdF );
+
+        if ( error ){
+            errorOut result = new errorNode( "computeGreenLagrangeStrain (jacobian)", "Error in computation of Green-Lagrange strain" );
+            result->addNext( error );
+            return result;
+        }
+
+        asMatrix( _dEdF, deformationGradient.size( ) ).copyTo( dEdF );
+
+        return NULL;
+
+    }
+
+    errorOut computeGreenLagrangeStrain( const floatVector &deformationGradient, floatVector &E, floatVector &dEdF){
+        /*!
+         * Compute the Green-Lagrange strain ( \f$E\f$ ) from the deformation gradient ( \f$F\f$ ) and it's jacobian.
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
+         * \param &E: The resulting Green-Lagrange strain ( \f$E\f$ ).
+         * \param &dEdF: The jacobian of the Green-Lagrange strain w.r.t. the
+         *     deformation gradient ( \f$\frac{\partial E}{\partial F}\f$ ).
+         *
+         * The deformation gradient is organized as  F11, F12, F13, F21, F22, F23, F31, F32, F33
+         *
+         * The Green-Lagrange strain is organized as E11, E12, E13, E21, E22, E23, E31, E32, E33
+         */
+
+        if ( deformationGradient.size( ) != 9 ){
+            return new errorNode( "computeGreenLagrangeStrain (jacobian)", "The deformation gradient must be 3D." );
+        }
+
+        statusCode status;
+
+        computeGreenLagrangeStrain( deformationGradient, E, dEdF, status );
+
+        if ( status != statusCode::success ){
+            return new errorNode( "computeGreenLagrangeStrain (jacobian)", statusDescription( status ) );
+        }
+
+        return NULL;
+    }
+
+    void computeGreenLagrangeStrain( const floatVector &deformationGradient, floatVector &E, statusCode &status ){
+        /*!
+         * Compute the Green-Lagrange strain ( \f$E\f$ ) from the deformation gradient ( \f$F\f$ ).
+         *
+         * \f$E = 0.5 (F_{iI} F_{iJ} - \delta_{IJ})\f$
+         *
+         * Failures are reported through the status code without allocating or throwing. E is only re-allocated
+         * if its capacity is too small.
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
+         * \param &E: The resulting Green-Lagrange strain ( \f$E\f$ ).
+         * \param &status: The status of the operation
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        status = clearStatus( );
+
+        TARDIGRADE_CONSTITUTIVE_TOOLS_STATUS_CHECK( deformationGradient.size( ) == sot_dim, statusCode::notThreeDimensional, "The deformation gradient must be 3D." );
+
+        floatSecondOrderTensor _deformationGradient, _E;
+
+        std::copy( deformationGradient.begin( ), deformationGradient.begin( ) + sot_dim, _deformationGradient.begin( ) );
+
+        computeGreenLagrangeStrain( _deformationGradient, _E );
+
+        E.assign( _E.begin( ), _E.end( ) );
+
+    }
+
+    void computeGreenLagrangeStrain( const floatVector &deformationGradient, floatVector &E, floatVector &dEdF, statusCode &status ){
+        /*!
+         * Compute the Green-Lagrange strain ( \f$E\f$ ) from the deformation gradient ( \f$F\f$ ) and it's jacobian.
+         *
+         * Failures are reported through the status code without allocating or throwing. The outputs are only
+         * re-allocated if their capacities are too small.
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
+         * \param &E: The resulting Green-Lagrange strain ( \f$E\f$ ).
+         * \param &dEdF: The jacobian of the Green-Lagrange strain w.r.t. the
+         *     deformation gradient ( \f$\frac{\partial E}{\partial F}\f$ ).
+         * \param &status: The status of the operation
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        status = clearStatus( );
+
+        TARDIGRADE_CONSTITUTIVE_TOOLS_STATUS_CHECK( deformationGradient.size( ) == sot_dim, statusCode::notThreeDimensional, "The deformation gradient must be 3D." );
+
+        floatSecondOrderTensor _deformationGradient, _E;
+
+        floatFourthOrderTensor _dEdF;
+
+        std::copy( deformationGradient.begin( ), deformationGradient.begin( ) + sot_dim, _deformationGradient.begin( ) );
+
+        computeGreenLagrangeStrain( _deformationGradient, _E, _dEdF );
+
+        E.assign( _E.begin( ), _E.end( ) );
+
+        dEdF.assign( _dEdF.begin( ), _dEdF.end( ) );
+
+    }
+
+    errorOut computeDGreenLagrangeStrainDF(const floatVector &deformationGradient, floatMatrix &dEdF){
+        /*!
+         * Compute the derivative of the Green-Lagrange strain ( \f$E\f$ )w.r.t. the deformation gradient ( \f$F\f$ ).
+         *
+         * \f$\frac{\partial E_{IJ}}{\partial F_{kK}} = 0.5 ( \delta_{IK} F_{kJ} + F_{kI} \delta_{JK})\f$
+         *
+         * Where \f$F\f$ is the deformation gradient and \f$\delta\f$ is the kronecker delta.
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
+         * \param &dEdF: The resulting gradient ( \f$\frac{\partial E}{\partial F}\f$ ).
+         *
+         * The deformation gradient is organized as  F11, F12, F13, F21, F22, F23, F31, F32, F33
+         */
+
+        floatVector _dEdF;
+
+        errorOut error = computeDGreenLagrangeStrainDF( deformationGradient, _dEdF );
+
+        if ( error ){
+
+            errorOut result = new errorNode( "computeDGreenLagrangeStrainDF", "Error in computation of the derivative of the Green-Lagrange strain w.r.t. F" );
+
+            result->addNext( error );
+
+            return result;
+
+        }
+
+        asMatrix( _dEdF, deformationGradient.size( ) ).copyTo( dEdF );
+
+        return NULL;
+
+    }
+
+    errorOut computeDGreenLagrangeStrainDF(const floatVector &deformationGradient, floatVector &dEdF){
+        /*!
+         * Compute the derivative of the Green-Lagrange strain ( \f$E\f$ )w.r.t. the deformation gradient ( \f$F\f$ ).
+         *
+         * \f$\frac{\partial E_{IJ}}{\partial F_{kK}} = 0.5 ( \delta_{IK} F_{kJ} + F_{kI} \delta_{JK})\f$
+         *
+         * Where \f$F\f$ is the deformation gradient and \f$\delta\f$ is the kronecker delta.
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
+         * \param &dEdF: The resulting gradient ( \f$\frac{\partial E}{\partial F}\f$ ).
+         *
+         * The deformation gradient is organized as  F11, F12, F13, F21, F22, F23, F31, F32, F33
+         */
+
+        if ( deformationGradient.size( ) != 9 ){
+            return new errorNode( "computeDGreenLagrangeStrainDF", "The deformation gradient must be 3D." );
+        }
+
+        statusCode status;
+
+        computeDGreenLagrangeStrainDF( deformationGradient, dEdF, status );
+
+        if ( status != statusCode::success ){
+            return new errorNode( "computeDGreenLagrangeStrainDF", statusDescription( status ) );
+        }
+
+        return NULL;
+    }
+
+    void computeDGreenLagrangeStrainDF( const floatVector &deformationGradient, floatVector &dEdF, statusCode &status ){
+        /*!
+         * Compute the derivative of the Green-Lagrange strain ( \f$E\f$ )w.r.t. the deformation gradient ( \f$F\f$ ).
+         *
+         * \f$\frac{\partial E_{IJ}}{\partial F_{kK}} = 0.5 ( \delta_{IK} F_{kJ} + F_{kI} \delta_{JK})\f$
+         *
+         * Failures are reported through the status code without allocating or throwing. dEdF is only
+         * re-allocated if its capacity is too small.
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
+         * \param &dEdF: The resulting gradient ( \f$\frac{\partial E}{\partial F}\f$ ).
+         * \param &status: The status of the operation
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        status = clearStatus( );
+
+        TARDIGRADE_CONSTITUTIVE_TOOLS_STATUS_CHECK( deformationGradient.size( ) == sot_dim, statusCode::notThreeDimensional, "The deformation gradient must be 3D." );
+
+        floatSecondOrderTensor _deformationGradient;
+
+        floatFourthOrderTensor _dEdF;
+
+        std::copy( deformationGradient.begin( ), deformationGradient.begin( ) + sot_dim, _deformationGradient.begin( ) );
+
+        computeDGreenLagrangeStrainDF( _deformationGradient, _dEdF );
+
+        dEdF.assign( _dEdF.begin( ), _dEdF.end( ) );
+
+    }
+
+    StructuredJacobian::StructuredJacobian( ) : _nTerms( 0 ), _hasDense( false ){
+        /*!
+         * Construct a zero Jacobian
+         */
+
+    }
+
+    StructuredJacobian StructuredJacobian::identity( const floatType scale ){
+        /*!
+         * Construct the scaled identity Jacobian
+         *
+         * \f$J_{ijkl} = s \delta_{ik} \delta_{lj}\f$
+         *
+         * \param scale: The scale factor \f$s\f$
+         */
+
+        StructuredJacobian J;
+
+        Term term;
+        term.type = termType::identity;
+        term.scale = scale;
+
+        J.addTerm( term );
+
+        return J;
+
+    }
+
+    StructuredJacobian StructuredJacobian::kronecker( const floatSecondOrderTensor &A, const floatSecondOrderTensor &B, const floatType scale ){
+        /*!
+         * Construct a Kronecker product Jacobian
+         *
+         * \f$J_{ijkl} = s A_{ik} B_{lj}\f$
+         *
+         * \param &A: The left tensor
+         * \param &B: The right tensor
+         * \param scale: The scale factor \f$s\f$
+         */
+
+        StructuredJacobian J;
+
+        J.addTerm( { termType::kronecker, scale, A, B } );
+
+        return J;
+
+    }
+
+    StructuredJacobian StructuredJacobian::transposedKronecker( const floatSecondOrderTensor &A, const floatSecondOrderTensor &B, const floatType scale ){
+        /*!
+         * Construct a transposed Kronecker product Jacobian
+         *
+         * \f$J_{ijkl} = s A_{il} B_{kj}\f$
+         *
+         * \param &A: The left tensor
+         * \param &B: The right tensor
+         * \param scale: The scale factor \f$s\f$
+         */
+
+        StructuredJacobian J;
+
+        J.addTerm( { termType::transposedKronecker, scale, A, B } );
+
+        return J;
+
+    }
+
+    StructuredJacobian StructuredJacobian::rankOne( const floatSecondOrderTensor &A, const floatSecondOrderTensor &B, const floatType scale ){
+        /*!
+         * Construct a rank one Jacobian
+         *
+         * \f$J_{ijkl} = s A_{ij} B_{kl}\f$
+         *
+         * \param &A: The output side tensor
+         * \param &B: The input side tensor
+         * \param scale: The scale factor \f$s\f$
+         */
+
+        StructuredJacobian J;
+
+        J.addTerm( { termType::rankOne, scale, A, B } );
+
+        return J;
+
+    }
+
+    StructuredJacobian StructuredJacobian::dense( const floatFourthOrderTensor &J ){
+        /*!
+         * Construct a Jacobian without any structure
+         *
+         * \param &J: The dense Jacobian in row-major order
+         */
+
+        StructuredJacobian result;
+
+        result._hasDense = true;
+
+        result._dense = J;
+
+        return result;
+
+    }
+
+    StructuredJacobian &StructuredJacobian::operator+=( const StructuredJacobian &other ){
+        /*!
+         * Add another Jacobian to this one
+         *
+         * \param &other: The Jacobian to add
+         */
+
+        for ( unsigned int t = 0; t < other._nTerms; t++ ){
+
+            addTerm( other._terms[ t ] );
+
+        }
+
+        if ( other._hasDense ){
+
+            if ( !_hasDense ){
+
+                _dense.fill( 0 );
+
+                _hasDense = true;
+
+            }
+
+            for ( unsigned int i = 0; i < _dense.size( ); i++ ){ _dense[ i ] += other._dense[ i ]; }
+
+        }
+
+        return *this;
+
+    }
+
+    StructuredJacobian &StructuredJacobian::operator*=( const floatType scale ){
+        /*!
+         * Scale the Jacobian
+         *
+         * \param scale: The scale factor
+         */
+
+        for ( unsigned int t = 0; t < _nTerms; t++ ){ _terms[ t ].scale *= scale; }
+
+        if ( _hasDense ){
+
+            for ( unsigned int i = 0; i < _dense.size( ); i++ ){ _dense[ i ] *= scale; }
+
+        }
+
+        return *this;
+
+    }
+
+    void StructuredJacobian::apply( const floatSecondOrderTensor &X, floatSecondOrderTensor &Y ) const{
+        /*!
+         * Contract the Jacobian with a second order tensor
+         *
+         * \f$Y_{ij} = J_{ijkl} X_{kl}\f$
+         *
+         * \param &X: The tensor to contract with
+         * \param &Y: The result
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        applyStructured( X, Y );
+
+        if ( _hasDense ){
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){
+
+                for ( unsigned int j = 0; j < sot_dim; j++ ){
+
+                    Y[ i ] += _dense[ sot_dim * i + j ] * X[ j ];
+
+                }
+
+            }
+
+        }
+
+    }
+
+    void StructuredJacobian::applyTranspose( const floatSecondOrderTensor &X, floatSecondOrderTensor &Y ) const{
+        /*!
+         * Contract a second order tensor with the Jacobian from the left
+         *
+         * \f$Y_{kl} = X_{ij} J_{ijkl}\f$
+         *
+         * \param &X: The tensor to contract with
+         * \param &Y: The result
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        Y.fill( 0 );
+
+        floatSecondOrderTensor _Y;
+
+        for ( unsigned int t = 0; t < _nTerms; t++ ){
+
+            applyTermTranspose( _terms[ t ], X, _Y );
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ Y[ i ] += _Y[ i ]; }
+
+        }
+
+        if ( _hasDense ){
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){
+
+                for ( unsigned int j = 0; j < sot_dim; j++ ){
+
+                    Y[ j ] += X[ i ] * _dense[ sot_dim * i + j ];
+
+                }
+
+            }
+
+        }
+
+    }
+
+    StructuredJacobian StructuredJacobian::compose( const StructuredJacobian &other ) const{
+        /*!
+         * Compose this Jacobian with another i.e. apply the chain rule
+         *
+         * \f$R_{ijmn} = J_{ijkl} K_{klmn}\f$
+         *
+         * Products of structured terms remain structured. Any dense part is only combined with the other
+         * Jacobian through contractions.
+         *
+         * \param &other: The Jacobian \f$K\f$ to compose with
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        StructuredJacobian result;
+
+        for ( unsigned int a = 0; a < _nTerms; a++ ){
+
+            for ( unsigned int b = 0; b < other._nTerms; b++ ){
+
+                result.addTerm( composeTerms( _terms[ a ], other._terms[ b ] ) );
+
+            }
+
+        }
+
+        if ( !_hasDense && !other._hasDense ){
+
+            return result;
+
+        }
+
+        if ( !result._hasDense ){
+
+            result._dense.fill( 0 );
+
+            result._hasDense = true;
+
+        }
+
+        floatSecondOrderTensor X, Y;
+
+        if ( _hasDense ){
+
+            // Each row of the dense part is contracted with the full other Jacobian
+            for ( unsigned int i = 0; i < sot_dim; i++ ){
+
+                std::copy( _dense.begin( ) + sot_dim * i, _dense.begin( ) + sot_dim * ( i + 1 ), X.begin( ) );
+
+                other.applyTranspose( X, Y );
+
+                for ( unsigned int j = 0; j < sot_dim; j++ ){ result._dense[ sot_dim * i + j ] += Y[ j ]; }
+
+            }
+
+        }
+
+        if ( other._hasDense ){
+
+            // Each column of the other dense part is contracted with the structured part of this Jacobian
+            for ( unsigned int j = 0; j < sot_dim; j++ ){
+
+                for ( unsigned int i = 0; i < sot_dim; i++ ){ X[ i ] = other._dense[ sot_dim * i + j ]; }
+
+                applyStructured( X, Y );
+
+                for ( unsigned int i = 0; i < sot_dim; i++ ){ result._dense[ sot_dim * i + j ] += Y[ i ]; }
+
+            }
+
+        }
+
+        return result;
+
+    }
+
+    void StructuredJacobian::toDense( floatFourthOrderTensor &J ) const{
+        /*!
+         * Expand the Jacobian to the dense row-major representation
+         *
+         * \param &J: The dense Jacobian
+         */
+
+        if ( _hasDense ){
+
+            J = _dense;
+
+        }
+        else{
+
+            J.fill( 0 );
+
+        }
+
+        for ( unsigned int t = 0; t < _nTerms; t++ ){
+
+            addTermToDense( _terms[ t ], J );
+
+        }
+
+    }
+
+    floatVector StructuredJacobian::toVector( ) const{
+        /*!
+         * Expand the Jacobian to the flattened row-major floatVector representation used by the rest of the library
+         */
+
+        floatFourthOrderTensor J;
+
+        toDense( J );
+
+        return floatVector( J.begin( ), J.end( ) );
+
+    }
+
+    unsigned int StructuredJacobian::numTerms( ) const{
+        /*!
+         * Get the number of structured terms in use
+         */
+
+        return _nTerms;
+
+    }
+
+    bool StructuredJacobian::hasDense( ) const{
+        /*!
+         * Get whether the Jacobian has a dense part
+         */
+
+        return _hasDense;
+
+    }
+
+    void StructuredJacobian::addTerm( const Term &term ){
+        /*!
+         * Add a structured term to the Jacobian. Identity terms are merged with an existing identity term and
+         * terms which do not fit in the fixed capacity are accumulated into the dense part.
+         *
+         * \param &term: The term to add
+         */
+
+        if ( term.type == termType::identity ){
+
+            for ( unsigned int t = 0; t < _nTerms; t++ ){
+
+                if ( _terms[ t ].type == termType::identity ){
+
+                    _terms[ t ].scale += term.scale;
+
+                    return;
+
+                }
+
+            }
+
+        }
+
+        if ( _nTerms < maxTerms ){
+
+            _terms[ _nTerms ] = term;
+
+            _nTerms++;
+
+            return;
+
+        }
+
+        if ( !_hasDense ){
+
+            _dense.fill( 0 );
+
+            _hasDense = true;
+
+        }
+
+        addTermToDense( term, _dense );
+
+    }
+
+    void StructuredJacobian::applyStructured( const floatSecondOrderTensor &X, floatSecondOrderTensor &Y ) const{
+        /*!
+         * Contract the structured terms of the Jacobian with a second order tensor
+         *
+         * \param &X: The tensor to contract with
+         * \param &Y: The result
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        Y.fill( 0 );
+
+        floatSecondOrderTensor _Y;
+
+        for ( unsigned int t = 0; t < _nTerms; t++ ){
+
+            applyTerm( _terms[ t ], X, _Y );
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ Y[ i ] += _Y[ i ]; }
+
+        }
+
+    }
+
+    void StructuredJacobian::applyTerm( const Term &term, const floatSecondOrderTensor &X, floatSecondOrderTensor &Y ){
+        /*!
+         * Contract a single structured term with a second order tensor
+         *
+         * \param &term: The structured term
+         * \param &X: The tensor to contract with
+         * \param &Y: The result
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > A( term.A.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > B( term.B.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > X_map( X.data( ) );
+        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > Y_map( Y.data( ) );
+
+        switch ( term.type ){
+
+            case termType::identity:
+
+                Y_map = term.scale * X_map;
+
+                break;
+
+            case termType::kronecker:
+
+                Y_map = ( term.scale * A * X_map * B ).eval( );
+
+                break;
+
+            case termType::transposedKronecker:
+
+                Y_map = ( term.scale * A * X_map.transpose( ) * B ).eval( );
+
+                break;
+
+            case termType::rankOne:{
+
+                floatType BX = 0;
+
+                for ( unsigned int i = 0; i < sot_dim; i++ ){ BX += term.B[ i ] * X[ i ]; }
+
+                Y_map = ( term.scale * BX ) * A;
+
+                break;
+
+            }
+
+        }
+
+    }
+
+    void StructuredJacobian::applyTermTranspose( const Term &term, const floatSecondOrderTensor &X, floatSecondOrderTensor &Y ){
+        /*!
+         * Contract a second order tensor with a single structured term from the left
+         *
+         * \param &term: The structured term
+         * \param &X: The tensor to contract with
+         * \param &Y: The result
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > A( term.A.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > B( term.B.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > X_map( X.data( ) );
+        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > Y_map( Y.data( ) );
+
+        switch ( term.type ){
+
+            case termType::identity:
+
+                Y_map = term.scale * X_map;
+
+                break;
+
+            case termType::kronecker:
+
+                Y_map = ( term.scale * A.transpose( ) * X_map * B.transpose( ) ).eval( );
+
+                break;
+
+            case termType::transposedKronecker:
+
+                Y_map = ( term.scale * B * X_map.transpose( ) * A ).eval( );
+
+                break;
+
+            case termType::rankOne:{
+
+                floatType XA = 0;
+
+                for ( unsigned int i = 0; i < sot_dim; i++ ){ XA += X[ i ] * term.A[ i ]; }
+
+                Y_map = ( term.scale * XA ) * B;
+
+                break;
+
+            }
+
+        }
+
+    }
+
+    StructuredJacobian::Term StructuredJacobian::composeTerms( const Term &a, const Term &b ){
+        /*!
+         * Compose two structured terms \f$R_{ijmn} = a_{ijkl} b_{klmn}\f$. The result is always a single
+         * structured term.
+         *
+         * \param &a: The outer term
+         * \param &b: The inner term
+         */
+
+        constexpr unsigned int dim = 3;
+
+        Term result;
+
+        if ( a.type == termType::identity ){
+
+            result = b;
+
+            result.scale *= a.scale;
+
+            return result;
+
+        }
+
+        if ( b.type == termType::identity ){
+
+            result = a;
+
+            result.scale *= b.scale;
+
+            return result;
+
+        }
+
+        result.scale = a.scale * b.scale;
+
+        if ( b.type == termType::rankOne ){
+
+            // a : ( b.A ( b.B : X ) ) = ( a : b.A ) ( b.B : X )
+            result.type = termType::rankOne;
+
+            Term unscaled = a;
+
+            unscaled.scale = 1;
+
+            applyTerm( unscaled, b.A, result.A );
+
+            result.B = b.B;
+
+            return result;
+
+        }
+
+        if ( a.type == termType::rankOne ){
+
+            // a.A ( a.B : ( b : X ) ) = a.A ( ( a.B : b ) : X )
+            result.type = termType::rankOne;
+
+            Term unscaled = b;
+
+            unscaled.scale = 1;
+
+            result.A = a.A;
+
+            applyTermTranspose( unscaled, a.B, result.B );
+
+            return result;
+
+        }
+
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > aA( a.A.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > aB( a.B.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > bA( b.A.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > bB( b.B.data( ) );
+        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > rA( result.A.data( ) );
+        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > rB( result.B.data( ) );
+
+        if ( a.type == termType::kronecker ){
+
+            // aA ( bA X bB ) aB = ( aA bA ) X ( bB aB ) and aA ( bA X^T bB ) aB = ( aA bA ) X^T ( bB aB )
+            result.type = b.type;
+
+            rA = aA * bA;
+
+            rB = bB * aB;
+
+        }
+        else{
+
+            // aA ( bA X bB )^T aB = ( aA bB^T ) X^T ( bA^T aB ) and aA ( bA X^T bB )^T aB = ( aA bB^T ) X ( bA^T aB )
+            result.type = ( b.type == termType::kronecker ) ? termType::transposedKronecker : termType::kronecker;
+
+            rA = aA * bB.transpose( );
+
+            rB = bA.transpose( ) * aB;
+
+        }
+
+        return result;
+
+    }
+
+    void StructuredJacobian::addTermToDense( const Term &term, floatFourthOrderTensor &J ){
+        /*!
+         * Add the dense representation of a structured term to a dense Jacobian
+         *
+         * \param &term: The structured term
+         * \param &J: The dense Jacobian
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            for ( unsigned int j = 0; j < dim; j++ ){
+
+                for ( unsigned int k = 0; k < dim; k++ ){
+
+                    for ( unsigned int l = 0; l < dim; l++ ){
+
+                        floatType value = 0;
+
+                        switch ( term.type ){
+
+                            case termType::identity:
+
+                                value = ( ( i == k ) && ( j == l ) ) ? 1 : 0;
+
+                                break;
+
+                            case termType::kronecker:
+
+                                value = term.A[ dim * i + k ] * term.B[ dim * l + j ];
+
+                                break;
+
+                            case termType::transposedKronecker:
+
+                                value = term.A[ dim * i + l ] * term.B[ dim * k + j ];
+
+                                break;
+
+                            case termType::rankOne:
+
+                                value = term.A[ dim * i + j ] * term.B[ dim * k + l ];
+
+                                break;
+
+                        }
+
+                        J[ dim * sot_dim * i + sot_dim * j + dim * k + l ] += term.scale * value;
+
+                    }
+
+                }
+
+            }
+
+        }
+
+    }
+
+    void computeDeformationGradient( const floatSecondOrderTensor &displacementGradient, floatSecondOrderTensor &F, StructuredJacobian &dFdGradU, const bool isCurrent ){
+        /*!
+         * Compute the deformation gradient from the gradient of the displacement and the structured Jacobian
+         * w.r.t. the displacement gradient.
+         *
+         * If isCurrent = false the Jacobian is the identity. If isCurrent = true
+         *
+         * \f$\frac{\partial F_{ij}}{\partial \left(\frac{\partial u_k}{\partial x_l}\right)} = F_{ik} F_{lj}\f$
+         *
+         * which is stored as a Kronecker product.
+         *
+         * \param &displacementGradient: The gradient of the displacement with respect to either the
+         *     current or previous position.
+         * \param &F: The deformation gradient
+         * \param &dFdGradU: The structured derivative of the deformation gradient w.r.t. the displacement gradient
+         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
+         *     or reference (false) position.
+         */
+
+        computeDeformationGradient( displacementGradient, F, isCurrent );
+
+        if ( isCurrent ){
+
+            dFdGradU = StructuredJacobian::kronecker( F, F );
+
+        }
+        else{
+
+            dFdGradU = StructuredJacobian::identity( );
+
+        }
+
+    }
+
+    void computeRightCauchyGreen( const floatSecondOrderTensor &deformationGradient, floatSecondOrderTensor &C, StructuredJacobian &dCdF ){
+        /*!
+         * Compute the Right Cauchy-Green deformation tensor ( \f$C\f$ ) and the structured Jacobian w.r.t. the
+         * deformation gradient
+         *
+         * \f$\frac{\partial C_{IJ}}{\partial F_{kL}} = \delta_{IL} F_{kJ} + F_{kI} \delta_{JL}\f$
+         *
+         * i.e. \f$dC = dF^T F + F^T dF\f$ which is stored as the sum of a transposed Kronecker product and a
+         * Kronecker product.
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ )
+         * \param &C: The resulting Right Cauchy-Green deformation tensor ( \f$C\f$ )
+         * \param &dCdF: The structured Jacobian of the Right Cauchy-Green deformation tensor
+         *     with regards to the deformation gradient ( \f$\frac{\partial C}{\partial F}\f$ ).
+         */
+
+        constexpr unsigned int dim = 3;
+
+        computeRightCauchyGreen( deformationGradient, C );
+
+        const floatSecondOrderTensor eye = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+        floatSecondOrderTensor FT;
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            for ( unsigned int j = 0; j < dim; j++ ){
+
+                FT[ dim * i + j ] = deformationGradient[ dim * j + i ];
+
+            }
+
+        }
+
+        dCdF = StructuredJacobian::transposedKronecker( eye, deformationGradient );
+
+        dCdF += StructuredJacobian::kronecker( FT, eye );
+
+    }
+
+    void computeGreenLagrangeStrain( const floatSecondOrderTensor &deformationGradient, floatSecondOrderTensor &E, StructuredJacobian &dEdF ){
+        /*!
+         * Compute the Green-Lagrange strain ( \f$E\f$ ) and the structured Jacobian w.r.t. the deformation
+         * gradient ( \f$F\f$ )
+         *
+         * \f$dE = \frac{1}{2} \left( dF^T F + F^T dF \right)\f$
+         *
+         * \param &deformationGradient: A reference to the deformation gradient ( \f$F\f$ ).
+         * \param &E: The resulting Green-Lagrange strain ( \f$E\f$ ).
+         * \param &dEdF: The structured jacobian of the Green-Lagrange strain w.r.t. the
+         *     deformation gradient ( \f$\frac{\partial E}{\partial F}\f$ ).
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        computeRightCauchyGreen( deformationGradient, E, dEdF );
+
+        for ( unsigned int I = 0; I < dim; I++ ){ E[ dim * I + I ] -= 1; }
+
+        for ( unsigned int I = 0; I < sot_dim; I++ ){ E[ I ] *= 0.5; }
+
+        dEdF *= 0.5;
+
+    }
+
+    KinematicState::KinematicState( const floatVector &deformationGradient ) :
+        _J( 0 ), _hasInverse( false ), _hasRightCauchyGreen( false ), _hasInverseRightCauchyGreen( false ){
+        /*!
+         * Construct the kinematic state from a deformation gradient stored in a vector
+         *
+         * \param &deformationGradient: The deformation gradient \f$F_{iI}\f$ in row-major form (all nine components)
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( deformationGradient.size( ) == _F.size( ), "The deformation gradient must be a second order tensor of size " + std::to_string( _F.size( ) ) + " and it has " + std::to_string( deformationGradient.size( ) ) + " elements" );
+
+        std::copy( deformationGradient.begin( ), deformationGradient.end( ), _F.begin( ) );
+
+    }
+
+    KinematicState::KinematicState( const floatSecondOrderTensor &deformationGradient ) :
+        _F( deformationGradient ), _J( 0 ), _hasInverse( false ), _hasRightCauchyGreen( false ), _hasInverseRightCauchyGreen( false ){
+        /*!
+         * Construct the kinematic state from a fixed-size deformation gradient
+         *
+         * \param &deformationGradient: The deformation gradient \f$F_{iI}\f$ in row-major form
+         */
+
+    }
+
+    const floatSecondOrderTensor &KinematicState::deformationGradient( ) const{
+        /*!
+         * Get the deformation gradient \f$F_{iI}\f$
+         */
+
+        return _F;
+
+    }
+
+    floatType KinematicState::determinant( ) const{
+        /*!
+         * Get the determinant of the deformation gradient \f$J = \det\left(F\right)\f$
+         */
+
+        if ( !_hasInverse ){ computeInverse( ); }
+
+        return _J;
+
+    }
+
+    const floatSecondOrderTensor &KinematicState::inverse( ) const{
+        /*!
+         * Get the inverse of the deformation gradient \f$F_{Ii}^{-1}\f$
+         */
+
+        if ( !_hasInverse ){ computeInverse( ); }
+
+        return _invF;
+
+    }
+
+    const floatSecondOrderTensor &KinematicState::cofactor( ) const{
+        /*!
+         * Get the cofactor of the deformation gradient \f$\text{cof}\left(F\right)_{iI} = J F_{Ii}^{-1} = \frac{\partial J}{\partial F_{iI}}\f$
+         */
+
+        if ( !_hasInverse ){ computeInverse( ); }
+
+        return _cofactor;
+
+    }
+
+    const floatSecondOrderTensor &KinematicState::rightCauchyGreen( ) const{
+        /*!
+         * Get the right Cauchy-Green deformation tensor \f$C_{IJ} = F_{iI} F_{iJ}\f$
+         */
+
+        constexpr unsigned int dim = 3;
+
+        if ( !_hasRightCauchyGreen ){
+
+            for ( unsigned int I = 0; I < dim; I++ ){
+
+                for ( unsigned int J = I; J < dim; J++ ){
+
+                    _C[ dim * I + J ] = _F[ I ] * _F[ J ] + _F[ dim + I ] * _F[ dim + J ] + _F[ 2 * dim + I ] * _F[ 2 * dim + J ];
+
+                    _C[ dim * J + I ] = _C[ dim * I + J ];
+
+                }
+
+            }
+
+            _hasRightCauchyGreen = true;
+
+        }
+
+        return _C;
+
+    }
+
+    const floatSecondOrderTensor &KinematicState::inverseRightCauchyGreen( ) const{
+        /*!
+         * Get the inverse of the right Cauchy-Green deformation tensor \f$C_{IJ}^{-1} = F_{Ii}^{-1} F_{Ji}^{-1}\f$
+         */
+
+        constexpr unsigned int dim = 3;
+
+        if ( !_hasInverseRightCauchyGreen ){
+
+            const floatSecondOrderTensor &invF = inverse( );
+
+            for ( unsigned int I = 0; I < dim; I++ ){
+
+                for ( unsigned int J = I; J < dim; J++ ){
+
+                    _invC[ dim * I + J ] = invF[ dim * I ] * invF[ dim * J ] + invF[ dim * I + 1 ] * invF[ dim * J + 1 ] + invF[ dim * I + 2 ] * invF[ dim * J + 2 ];
+
+                    _invC[ dim * J + I ] = _invC[ dim * I + J ];
+
+                }
+
+            }
+
+            _hasInverseRightCauchyGreen = true;
+
+        }
+
+        return _invC;
+
+    }
+
+    void KinematicState::computeInverse( ) const{
+        /*!
+         * Compute the determinant and inverse of the deformation gradient with the shared closed-form inverse and
+         * form the cofactor from them
+         */
+
+        constexpr unsigned int dim = 3;
+
+        _J = invertSecondOrderTensor( _F, _invF );
+
+        for ( unsigned int I = 0; I < dim; I++ ){
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                _cofactor[ dim * i + I ] = _J * _invF[ dim * I + i ];
+
+            }
+
+        }
+
+        _hasInverse = true;
+
+    }
+
+    template< typename T >
+    struct ScalarLane{
+        /*!
+         * Single point lane used for the scalar tail of the batched kernels
+         */
+
+        typedef T scalar; //!< The scalar type
+
+        typedef T type; //!< The lane storage type
+
+        static constexpr unsigned int width = 1; //!< The number of points processed per lane
+
+        static inline type load( const scalar *x ){ return *x; } //!< Load a lane from memory
+
+        static inline void store( scalar *x, const type &v ){ *x = v; } //!< Store a lane to memory
+
+        static inline type set1( const scalar v ){ return v; } //!< Broadcast a value to the lane
+
+        static inline type add( const type &a, const type &b ){ return a + b; } //!< Add two lanes
+
+        static inline type sub( const type &a, const type &b ){ return a - b; } //!< Subtract two lanes
+
+        static inline type mul( const type &a, const type &b ){ return a * b; } //!< Multiply two lanes
+
+        static inline type div( const type &a, const type &b ){ return a / b; } //!< Divide two lanes
+
+        static inline type fmadd( const type &a, const type &b, const type &c ){ return a * b + c; } //!< Compute a * b + c
+
+    };
+
+#ifdef TARDIGRADE_CONSTITUTIVE_TOOLS_USE_SSE2
+    struct Sse2Lane{
+        /*!
+         * Two point SSE2 lane for the batched kernels
+         */
+
+        typedef double scalar; //!< The scalar type
+
+        typedef __m128d type; //!< The lane storage type
+
+        static constexpr unsigned int width = 2; //!< The number of points processed per lane
+
+        static inline type load( const scalar *x ){ return _mm_loadu_pd( x ); } //!< Load a lane from memory
+
+        static inline void store( scalar *x, const type &v ){ _mm_storeu_pd( x, v ); } //!< Store a lane to memory
+
+        static inline type set1( const scalar v ){ return _mm_set1_pd( v ); } //!< Broadcast a value to the lane
+
+        static inline type add( const type &a, const type &b ){ return _mm_add_pd( a, b ); } //!< Add two lanes
+
+        static inline type sub( const type &a, const type &b ){ return _mm_sub_pd( a, b ); } //!< Subtract two lanes
+
+        static inline type mul( const type &a, const type &b ){ return _mm_mul_pd( a, b ); } //!< Multiply two lanes
+
+        static inline type div( const type &a, const type &b ){ return _mm_div_pd( a, b ); } //!< Divide two lanes
+
+        static inline type fmadd( const type &a, const type &b, const type &c ){ return _mm_add_pd( _mm_mul_pd( a, b ), c ); } //!< Compute a * b + c
+
+    };
+
+    struct Sse2FloatLane{
+        /*!
+         * Four point single precision SSE2 lane for the batched kernels
+         */
+
+        typedef float scalar; //!< The scalar type
+
+        typedef __m128 type; //!< The lane storage type
+
+        static constexpr unsigned int width = 4; //!< The number of points processed per lane
+
+        static inline type load( const scalar *x ){ return _mm_loadu_ps( x ); } //!< Load a lane from memory
+
+        static inline void store( scalar *x, const type &v ){ _mm_storeu_ps( x, v ); } //!< Store a lane to memory
+
+        static inline type set1( const scalar v ){ return _mm_set1_ps( v ); } //!< Broadcast a value to the lane
+
+        static inline type add( const type &a, const type &b ){ return _mm_add_ps( a, b ); } //!< Add two lanes
+
+        static inline type sub( const type &a, const type &b ){ return _mm_sub_ps( a, b ); } //!< Subtract two lanes
+
+        static inline type mul( const type &a, const type &b ){ return _mm_mul_ps( a, b ); } //!< Multiply two lanes
+
+        static inline type div( const type &a, const type &b ){ return _mm_div_ps( a, b ); } //!< Divide two lanes
+
+        static inline type fmadd( const type &a, const type &b, const type &c ){ return _mm_add_ps( _mm_mul_ps( a, b ), c ); } //!< Compute a * b + c
+
+    };
+#endif
+
+#ifdef TARDIGRADE_CONSTITUTIVE_TOOLS_USE_AVX2
+    struct Avx2Lane{
+        /*!
+         * Four point AVX2 lane for the batched kernels
+         */
+
+        typedef double scalar; //!< The scalar type
+
+        typedef __m256d type; //!< The lane storage type
+
+        static constexpr unsigned int width = 4; //!< The number of points processed per lane
+
+        static inline type load( const scalar *x ){ return _mm256_loadu_pd( x ); } //!< Load a lane from memory
+
+        static inline void store( scalar *x, const type &v ){ _mm256_storeu_pd( x, v ); } //!< Store a lane to memory
+
+        static inline type set1( const scalar v ){ return _mm256_set1_pd( v ); } //!< Broadcast a value to the lane
+
+        static inline type add( const type &a, const type &b ){ return _mm256_add_pd( a, b ); } //!< Add two lanes
+
+        static inline type sub( const type &a, const type &b ){ return _mm256_sub_pd( a, b ); } //!< Subtract two lanes
+
+        static inline type mul( const type &a, const type &b ){ return _mm256_mul_pd( a, b ); } //!< Multiply two lanes
+
+        static inline type div( const type &a, const type &b ){ return _mm256_div_pd( a, b ); } //!< Divide two lanes
+
+        static inline type fmadd( const type &a, const type &b, const type &c ){ return _mm256_fmadd_pd( a, b, c ); } //!< Compute a * b + c
+
+    };
+
+    struct Avx2FloatLane{
+        /*!
+         * Eight point single precision AVX2 lane for the batched kernels
+         */
+
+        typedef float scalar; //!< The scalar type
+
+        typedef __m256 type; //!< The lane storage type
+
+        static constexpr unsigned int width = 8; //!< The number of points processed per lane
+
+        static inline type load( const scalar *x ){ return _mm256_loadu_ps( x ); } //!< Load a lane from memory
+
+        static inline void store( scalar *x, const type &v ){ _mm256_storeu_ps( x, v ); } //!< Store a lane to memory
+
+        static inline type set1( const scalar v ){ return _mm256_set1_ps( v ); } //!< Broadcast a value to the lane
+
+        static inline type add( const type &a, const type &b ){ return _mm256_add_ps( a, b ); } //!< Add two lanes
+
+        static inline type sub( const type &a, const type &b ){ return _mm256_sub_ps( a, b ); } //!< Subtract two lanes
+
+        static inline type mul( const type &a, const type &b ){ return _mm256_mul_ps( a, b ); } //!< Multiply two lanes
+
+        static inline type div( const type &a, const type &b ){ return _mm256_div_ps( a, b ); } //!< Divide two lanes
+
+        static inline type fmadd( const type &a, const type &b, const type &c ){ return _mm256_fmadd_ps( a, b, c ); } //!< Compute a * b + c
+
+    };
+#endif
+
+#ifdef TARDIGRADE_CONSTITUTIVE_TOOLS_USE_AVX512
+    struct Avx512Lane{
+        /*!
+         * Eight point AVX-512 lane for the batched kernels
+         */
+
+        typedef double scalar; //!< The scalar type
+
+        typedef __m512d type; //!< The lane storage type
+
+        static constexpr unsigned int width = 8; //!< The number of points processed per lane
+
+        static inline type load( const scalar *x ){ return _mm512_loadu_pd( x ); } //!< Load a lane from memory
+
+        static inline void store( scalar *x, const type &v ){ _mm512_storeu_pd( x, v ); } //!< Store a lane to memory
+
+        static inline type set1( const scalar v ){ return _mm512_set1_pd( v ); } //!< Broadcast a value to the lane
+
+        static inline type add( const type &a, const type &b ){ return _mm512_add_pd( a, b ); } //!< Add two lanes
+
+        static inline type sub( const type &a, const type &b ){ return _mm512_sub_pd( a, b ); } //!< Subtract two lanes
+
+        static inline type mul( const type &a, const type &b ){ return _mm512_mul_pd( a, b ); } //!< Multiply two lanes
+
+        static inline type div( const type &a, const type &b ){ return _mm512_div_pd( a, b ); } //!< Divide two lanes
+
+        static inline type fmadd( const type &a, const type &b, const type &c ){ return _mm512_fmadd_pd( a, b, c ); } //!< Compute a * b + c
+
+    };
+
+    struct Avx512FloatLane{
+        /*!
+         * Sixteen point single precision AVX-512 lane for the batched kernels
+         */
+
+        typedef float scalar; //!< The scalar type
+
+        typedef __m512 type; //!< The lane storage type
+
+        static constexpr unsigned int width = 16; //!< The number of points processed per lane
+
+        static inline type load( const scalar *x ){ return _mm512_loadu_ps( x ); } //!< Load a lane from memory
+
+        static inline void store( scalar *x, const type &v ){ _mm512_storeu_ps( x, v ); } //!< Store a lane to memory
+
+        static inline type set1( const scalar v ){ return _mm512_set1_ps( v ); } //!< Broadcast a value to the lane
+
+        static inline type add( const type &a, const type &b ){ return _mm512_add_ps( a, b ); } //!< Add two lanes
+
+        static inline type sub( const type &a, const type &b ){ return _mm512_sub_ps( a, b ); } //!< Subtract two lanes
+
+        static inline type mul( const type &a, const type &b ){ return _mm512_mul_ps( a, b ); } //!< Multiply two lanes
+
+        static inline type div( const type &a, const type &b ){ return _mm512_div_ps( a, b ); } //!< Divide two lanes
+
+        static inline type fmadd( const type &a, const type &b, const type &c ){ return _mm512_fmadd_ps( a, b, c ); } //!< Compute a * b + c
+
+    };
+#endif
+
+    template< class Lane >
+    static std::size_t rightCauchyGreenLanes( const unsigned int nPoints, std::size_t p, const typename Lane::scalar *deformationGradient,
+                                        typename Lane::scalar *C, typename Lane::scalar *E ){
+        /*!
+         * Compute the Right Cauchy-Green deformation tensor and the Green-Lagrange strain for as many complete
+         * lanes of points as are available starting at point p. Either of the outputs may be NULL in which case
+         * it is not computed.
+         *
+         * \param &nPoints: The number of points in the batch
+         * \param p: The first point to process
+         * \param *deformationGradient: The deformation gradients in structure-of-arrays layout
+         * \param *C: The Right Cauchy-Green deformation tensors
+         * \param *E: The Green-Lagrange strains
+         *
+         * Returns the index of the first point which has not been processed
+         */
+
+        typedef typename Lane::type T;
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        const std::size_t n = nPoints;
+
+        const T one  = Lane::set1( 1 );
+        const T half = Lane::set1( 0.5 );
+
+        for ( ; p + Lane::width <= n; p += Lane::width ){
+
+            T F[ sot_dim ];
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ F[ i ] = Lane::load( deformationGradient + i * n + p ); }
+
+            T _C[ sot_dim ];
+
+            for ( unsigned int I = 0; I < dim; I++ ){
+
+                for ( unsigned int J = I; J < dim; J++ ){
+
+                    _C[ dim * I + J ] = Lane::mul( F[ I ], F[ J ] );
+                    _C[ dim * I + J ] = Lane::fmadd( F[ dim + I ], F[ dim + J ], _C[ dim * I + J ] );
+                    _C[ dim * I + J ] = Lane::fmadd( F[ 2 * dim + I ], F[ 2 * dim + J ], _C[ dim * I + J ] );
+
+                    _C[ dim * J + I ] = _C[ dim * I + J ];
+
+                }
+
+            }
+
+            if ( C ){
+
+                for ( unsigned int i = 0; i < sot_dim; i++ ){ Lane::store( C + i * n + p, _C[ i ] ); }
+
+            }
+
+            if ( E ){
+
+                for ( unsigned int I = 0; I < dim; I++ ){
+
+                    for ( unsigned int J = 0; J < dim; J++ ){
+
+                        Lane::store( E + ( dim * I + J ) * n + p, Lane::mul( half, ( I == J ) ? Lane::sub( _C[ dim * I + J ], one ) : _C[ dim * I + J ] ) );
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        return p;
+
+    }
+
+    template< class Lane >
+    static std::size_t rightCauchyGreenJacobianLanes( const unsigned int nPoints, const std::size_t pBegin, const typename Lane::scalar *deformationGradient,
+                                                const typename Lane::scalar scale, typename Lane::scalar *dCdF ){
+        /*!
+         * Compute the scaled Jacobian of the Right Cauchy-Green deformation tensor w.r.t. the deformation gradient
+         * for as many complete lanes of points as are available starting at point pBegin.
+         *
+         * \f$\frac{\partial C_{IJ}}{\partial F_{kL}} = \delta_{IL} F_{kJ} + F_{kI} \delta_{JL}\f$
+         *
+         * The components are looped over in the outer loop so that each component is written as a contiguous
+         * stream.
+         *
+         * \param &nPoints: The number of points in the batch
+         * \param pBegin: The first point to process
+         * \param *deformationGradient: The deformation gradients in structure-of-arrays layout
+         * \param scale: The scale factor applied to the Jacobian i.e. 1 for \f$\frac{\partial C}{\partial F}\f$
+         *     and 0.5 for \f$\frac{\partial E}{\partial F}\f$
+         * \param *dCdF: The scaled Jacobians
+         *
+         * Returns the index of the first point which has not been processed
+         */
+
+        typedef typename Lane::type T;
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        const std::size_t n = nPoints;
+
+        const std::size_t pEnd = pBegin + ( ( n - pBegin ) / Lane::width ) * Lane::width;
+
+        if ( pEnd == pBegin ){ return pEnd; }
+
+        const T zero = Lane::set1( 0 );
+        const T s = Lane::set1( scale );
+
+        for ( unsigned int I = 0; I < dim; I++ ){
+
+            for ( unsigned int J = 0; J < dim; J++ ){
+
+                for ( unsigned int k = 0; k < dim; k++ ){
+
+                    const typename Lane::scalar *F_kI = deformationGradient + ( dim * k + I ) * n;
+
+                    const typename Lane::scalar *F_kJ = deformationGradient + ( dim * k + J ) * n;
+
+                    for ( unsigned int L = 0; L < dim; L++ ){
+
+                        typename Lane::scalar *dCdF_IJkL = dCdF + ( dim * sot_dim * I + sot_dim * J + dim * k + L ) * n;
+
+                        // Only the L = I and L = J terms are non-zero
+                        if ( ( L == I ) && ( L == J ) ){
+
+                            const T factor = Lane::add( s, s );
+
+                            for ( std::size_t p = pBegin; p < pEnd; p += Lane::width ){
+
+                                Lane::store( dCdF_IJkL + p, Lane::mul( factor, Lane::load( F_kI + p ) ) );
+
+                            }
+
+                        }
+                        else if ( ( L == I ) || ( L == J ) ){
+
+                            const typename Lane::scalar *F_k = ( L == I ) ? F_kJ : F_kI;
+
+                            for ( std::size_t p = pBegin; p < pEnd; p += Lane::width ){
+
+                                Lane::store( dCdF_IJkL + p, Lane::mul( s, Lane::load( F_k + p ) ) );
+
+                            }
+
+                        }
+                        else{
+
+                            for ( std::size_t p = pBegin; p < pEnd; p += Lane::width ){
+
+                                Lane::store( dCdF_IJkL + p, zero );
+
+                            }
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        return pEnd;
+
+    }
+
+    template< class Lane >
+    static std::size_t rightCauchyGreenBatchedLanes( const unsigned int nPoints, std::size_t p, const typename Lane::scalar *deformationGradient,
+                                               typename Lane::scalar *C, typename Lane::scalar *E, typename Lane::scalar *dCdF, typename Lane::scalar *dEdF ){
+        /*!
+         * Compute the Right Cauchy-Green deformation tensor, the Green-Lagrange strain and their Jacobians w.r.t.
+         * the deformation gradient for as many complete lanes of points as are available starting at point p.
+         * Any of the outputs may be NULL in which case they are not computed.
+         *
+         * \param &nPoints: The number of points in the batch
+         * \param p: The first point to process
+         * \param *deformationGradient: The deformation gradients in structure-of-arrays layout
+         * \param *C: The Right Cauchy-Green deformation tensors
+         * \param *E: The Green-Lagrange strains
+         * \param *dCdF: The Jacobians of the Right Cauchy-Green deformation tensors w.r.t. the deformation gradients
+         * \param *dEdF: The Jacobians of the Green-Lagrange strains w.r.t. the deformation gradients
+         *
+         * Returns the index of the first point which has not been processed
+         */
+
+        if ( dCdF ){ rightCauchyGreenJacobianLanes< Lane >( nPoints, p, deformationGradient, 1.0, dCdF ); }
+
+        if ( dEdF ){ rightCauchyGreenJacobianLanes< Lane >( nPoints, p, deformationGradient, 0.5, dEdF ); }
+
+        return rightCauchyGreenLanes< Lane >( nPoints, p, deformationGradient, C, E );
+
+    }
+
+    template< typename T >
+    static void rightCauchyGreenBatched( const unsigned int nPoints, const T *deformationGradient,
+                                  T *C, T *E, T *dCdF, T *dEdF ){
+        /*!
+         * Dispatch the batched Right Cauchy-Green kernel to the widest lanes supported by the build for the scalar
+         * type followed by the narrower lanes and finally the scalar tail.
+         *
+         * \param &nPoints: The number of points in the batch
+         * \param *deformationGradient: The deformation gradients in structure-of-arrays layout
+         * \param *C: The Right Cauchy-Green deformation tensors (may be NULL)
+         * \param *E: The Green-Lagrange strains (may be NULL)
+         * \param *dCdF: The Jacobians of the Right Cauchy-Green deformation tensors w.r.t. the deformation gradients (may be NULL)
+         * \param *dEdF: The Jacobians of the Green-Lagrange strains w.r.t. the deformation gradients (may be NULL)
+         */
+
+        std::size_t p = 0;
+
+        if constexpr ( std::is_same< T, double >::value ){
+
+#ifdef TARDIGRADE_CONSTITUTIVE_TOOLS_USE_AVX512
+            p = rightCauchyGreenBatchedLanes< Avx512Lane >( nPoints, p, deformationGradient, C, E, dCdF, dEdF );
+#endif
+
+#ifdef TARDIGRADE_CONSTITUTIVE_TOOLS_USE_AVX2
+            p = rightCauchyGreenBatchedLanes< Avx2Lane >( nPoints, p, deformationGradient, C, E, dCdF, dEdF );
+#endif
+
+#ifdef TARDIGRADE_CONSTITUTIVE_TOOLS_USE_SSE2
+            p = rightCauchyGreenBatchedLanes< Sse2Lane >( nPoints, p, deformationGradient, C, E, dCdF, dEdF );
+#endif
+
+        }
+        else if constexpr ( std::is_same< T, float >::value ){
+
+#ifdef TARDIGRADE_CONSTITUTIVE_TOOLS_USE_AVX512
+            p = rightCauchyGreenBatchedLanes< Avx512FloatLane >( nPoints, p, deformationGradient, C, E, dCdF, dEdF );
+#endif
+
+#ifdef TARDIGRADE_CONSTITUTIVE_TOOLS_USE_AVX2
+            p = rightCauchyGreenBatchedLanes< Avx2FloatLane >( nPoints, p, deformationGradient, C, E, dCdF, dEdF );
+#endif
+
+#ifdef TARDIGRADE_CONSTITUTIVE_TOOLS_USE_SSE2
+            p = rightCauchyGreenBatchedLanes< Sse2FloatLane >( nPoints, p, deformationGradient, C, E, dCdF, dEdF );
+#endif
+
+        }
+
+        rightCauchyGreenBatchedLanes< ScalarLane< T > >( nPoints, p, deformationGradient, C, E, dCdF, dEdF );
+
+    }
+
+    template< class Lane >
+    static std::size_t invertSecondOrderTensorLanes( const unsigned int nPoints, std::size_t p, const typename Lane::scalar *A,
+                                               const typename Lane::scalar diagonal, const typename Lane::scalar sign,
+                                               typename Lane::scalar *invA, typename Lane::scalar *detA,
+                                               const typename Lane::scalar tolerance, bool *isSingular ){
+        /*!
+         * Compute the closed-form inverse and determinant of the 3x3 matrices \f$B = d I + s A\f$ for as many
+         * complete lanes of points as are available starting at point p. Shifting and scaling the input allows
+         * the inverse of \f$I - \nabla u\f$ to be formed without a separate pass over memory. All of the
+         * components of a point are loaded before any are stored so the inverse may overwrite the input.
+         *
+         * \param &nPoints: The number of points in the batch
+         * \param p: The first point to process
+         * \param *A: The matrices in structure-of-arrays layout
+         * \param diagonal: The value \f$d\f$ added to the diagonal
+         * \param sign: The scale factor \f$s\f$ of the matrices
+         * \param *invA: The inverses of the shifted matrices in structure-of-arrays layout
+         * \param *detA: The determinants of the shifted matrices (may be NULL)
+         * \param tolerance: The relative tolerance for the near-singularity check
+         * \param *isSingular: Set to true if any of the matrices is nearly singular. The check is skipped if NULL.
+         *
+         * Returns the index of the first point which has not been processed
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        typedef typename Lane::type T;
+
+        typedef typename Lane::scalar scalar;
+
+        const std::size_t n = nPoints;
+
+        const T d = Lane::set1( diagonal );
+        const T s = Lane::set1( sign );
+        const T one = Lane::set1( 1 );
+
+        for ( ; p + Lane::width <= n; p += Lane::width ){
+
+            T a[ sot_dim ];
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ a[ i ] = Lane::mul( s, Lane::load( A + i * n + p ) ); }
+
+            a[ 0 ] = Lane::add( a[ 0 ], d );
+            a[ 4 ] = Lane::add( a[ 4 ], d );
+            a[ 8 ] = Lane::add( a[ 8 ], d );
+
+            T c[ sot_dim ];
+
+            c[ 0 ] = Lane::sub( Lane::mul( a[ 4 ], a[ 8 ] ), Lane::mul( a[ 5 ], a[ 7 ] ) );
+            c[ 3 ] = Lane::sub( Lane::mul( a[ 5 ], a[ 6 ] ), Lane::mul( a[ 3 ], a[ 8 ] ) );
+            c[ 6 ] = Lane::sub( Lane::mul( a[ 3 ], a[ 7 ] ), Lane::mul( a[ 4 ], a[ 6 ] ) );
+            c[ 1 ] = Lane::sub( Lane::mul( a[ 2 ], a[ 7 ] ), Lane::mul( a[ 1 ], a[ 8 ] ) );
+            c[ 4 ] = Lane::sub( Lane::mul( a[ 0 ], a[ 8 ] ), Lane::mul( a[ 2 ], a[ 6 ] ) );
+            c[ 7 ] = Lane::sub( Lane::mul( a[ 1 ], a[ 6 ] ), Lane::mul( a[ 0 ], a[ 7 ] ) );
+            c[ 2 ] = Lane::sub( Lane::mul( a[ 1 ], a[ 5 ] ), Lane::mul( a[ 2 ], a[ 4 ] ) );
+            c[ 5 ] = Lane::sub( Lane::mul( a[ 2 ], a[ 3 ] ), Lane::mul( a[ 0 ], a[ 5 ] ) );
+            c[ 8 ] = Lane::sub( Lane::mul( a[ 0 ], a[ 4 ] ), Lane::mul( a[ 1 ], a[ 3 ] ) );
+
+            const T det = Lane::fmadd( a[ 2 ], c[ 6 ], Lane::fmadd( a[ 1 ], c[ 3 ], Lane::mul( a[ 0 ], c[ 0 ] ) ) );
+
+            const T invDet = Lane::div( one, det );
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ Lane::store( invA + i * n + p, Lane::mul( c[ i ], invDet ) ); }
+
+            if ( detA ){ Lane::store( detA + p, det ); }
+
+            if ( isSingular ){
+
+                T normSquared = Lane::mul( a[ 0 ], a[ 0 ] );
+
+                for ( unsigned int i = 1; i < sot_dim; i++ ){ normSquared = Lane::fmadd( a[ i ], a[ i ], normSquared ); }
+
+                scalar _det[ Lane::width ], _normSquared[ Lane::width ];
+
+                Lane::store( _det, det );
+
+                Lane::store( _normSquared, normSquared );
+
+                for ( unsigned int l = 0; l < Lane::width; l++ ){
+
+                    if ( isNearlySingular( _det[ l ], _normSquared[ l ], tolerance ) ){ *isSingular = true; }
+
+                }
+
+            }
+
+        }
+
+        return p;
+
+    }
+
+    template< typename T >
+    void invertSecondOrderTensorBatched( const unsigned int nPoints, const T *A, const T diagonal, const T sign,
+                                         T *invA, T *detA, const T tolerance, bool *isSingular ){
+        /*!
+         * Dispatch the batched closed-form inverse of \f$d I + s A\f$ to the widest lanes supported by the build for
+         * the scalar type followed by the narrower lanes and finally the scalar tail.
+         *
+         * \param &nPoints: The number of points in the batch
+         * \param *A: The matrices in structure-of-arrays layout
+         * \param diagonal: The value \f$d\f$ added to the diagonal
+         * \param sign: The scale factor \f$s\f$ of the matrices
+         * \param *invA: The inverses of the shifted matrices in structure-of-arrays layout. May alias A.
+         * \param *detA: The determinants of the shifted matrices (may be NULL)
+         * \param tolerance: The relative tolerance for the near-singularity check
+         * \param *isSingular: Set to true if any of the matrices is nearly singular. The check is skipped if NULL.
+         */
+
+        std::size_t p = 0;
+
+        if constexpr ( std::is_same< T, double >::value ){
+
+#ifdef TARDIGRADE_CONSTITUTIVE_TOOLS_USE_AVX512
+            p = invertSecondOrderTensorLanes< Avx512Lane >( nPoints, p, A, diagonal, sign, invA, detA, tolerance, isSingular );
+#endif
+
+#ifdef TARDIGRADE_CONSTITUTIVE_TOOLS_USE_AVX2
+            p = invertSecondOrderTensorLanes< Avx2Lane >( nPoints, p, A, diagonal, sign, invA, detA, tolerance, isSingular );
+#endif
+
+#ifdef TARDIGRADE_CONSTITUTIVE_TOOLS_USE_SSE2
+            p = invertSecondOrderTensorLanes< Sse2Lane >( nPoints, p, A, diagonal, sign, invA, detA, tolerance, isSingular );
+#endif
+
+        }
+        else if constexpr ( std::is_same< T, float >::value ){
+
+#ifdef TARDIGRADE_CONSTITUTIVE_TOOLS_USE_AVX512
+            p = invertSecondOrderTensorLanes< Avx512FloatLane >( nPoints, p, A, diagonal, sign, invA, detA, tolerance, isSingular );
+#endif
+
+#ifdef TARDIGRADE_CONSTITUTIVE_TOOLS_USE_AVX2
+            p = invertSecondOrderTensorLanes< Avx2FloatLane >( nPoints, p, A, diagonal, sign, invA, detA, tolerance, isSingular );
+#endif
+
+#ifdef TARDIGRADE_CONSTITUTIVE_TOOLS_USE_SSE2
+            p = invertSecondOrderTensorLanes< Sse2FloatLane >( nPoints, p, A, diagonal, sign, invA, detA, tolerance, isSingular );
+#endif
+
+        }
+
+        invertSecondOrderTensorLanes< ScalarLane< T > >( nPoints, p, A, diagonal, sign, invA, detA, tolerance, isSingular );
+
+    }
+
+    template< typename T >
+    void invertSecondOrderTensorBatched( const unsigned int nPoints, const T *A, T *invA, T *detA, statusCode &status, const T tolerance ){
+        /*!
+         * Compute the closed-form inverses and determinants of a batch of 3x3 matrices. The points are processed
+         * in the SIMD lanes selected when the library is compiled. Singular and nearly singular matrices are
+         * reported through the status rather than by throwing and every point is still processed.
+         *
+         * The batch is stored in structure-of-arrays layout i.e. component \f$ij\f$ of point \f$p\f$ is located
+         * at \f$( 3 i + j ) n_{points} + p\f$.
+         *
+         * \param &nPoints: The number of points in the batch
+         * \param *A: The matrices ( \f$9 n_{points}\f$ values )
+         * \param *invA: The inverses of the matrices ( \f$9 n_{points}\f$ values ). May alias A.
+         * \param *detA: The determinants of the matrices ( \f$n_{points}\f$ values, may be NULL )
+         * \param &status: The status of the operation. nearlySingular if any of the matrices is nearly singular.
+         * \param tolerance: The relative tolerance on the determinant below which a matrix is reported as nearly singular
+         */
+
+        status = clearStatus( );
+
+        bool isSingular = false;
+
+        invertSecondOrderTensorBatched( nPoints, A, T( 0 ), T( 1 ), invA, detA, tolerance, &isSingular );
+
+        if ( isSingular ){
+
+            status = setStatus( statusCode::nearlySingular, "At least one of the 3x3 matrices of the batch is singular or nearly singular" );
+
+        }
+
+    }
+
+    template< typename T >
+    void computeDeformationGradientBatched( const unsigned int nPoints, const T *displacementGradient, T *F, const bool isCurrent ){
+        /*!
+         * Compute the deformation gradient from the gradient of the displacement for a batch of points.
+         *
+         * The batch is stored in structure-of-arrays layout i.e. the nine components of the tensors are stored
+         * as nine contiguous arrays of length nPoints so that component \f$ij\f$ of point \f$p\f$ is located at
+         * \f$( 3 i + j ) n_{points} + p\f$. Looping over the points in the inner-most loop allows the compiler
+         * to vectorize across points.
+         *
+         * If isCurrent = false
+         *
+         * \f$ \bf{F} = \frac{\partial \bf{u}}{\partial \bf{X} } u_i + \bf{I} \f$
+         *
+         * else if isCurrent = true
+         *
+         * \f$ \bf{F} = \left(\bf{I} - \frac{\partial \bf{u}}{\partial \bf{x}}\right)^{-1} \f$
+         *
+         * \param &nPoints: The number of points in the batch
+         * \param *displacementGradient: The gradients of the displacement ( \f$9 n_{points}\f$ values )
+         * \param *F: The deformation gradients ( \f$9 n_{points}\f$ values )
+         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
+         *     or reference (false) position.
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        const T *gradU = displacementGradient;
+
+        const std::size_t n = nPoints;
+
+        if ( isCurrent ){
+
+            // Invert I - gradU without forming it in memory
+            invertSecondOrderTensorBatched( nPoints, gradU, T( 1 ), T( -1 ), F, ( T * )NULL, T( 0 ), ( bool * )NULL );
+
+        }
+        else{
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){
+
+                const T delta = ( i % ( dim + 1 ) == 0 ) ? 1 : 0;
+
+                for ( std::size_t p = 0; p < n; p++ ){
+
+                    F[ i * n + p ] = gradU[ i * n + p ] + delta;
+
+                }
+
+            }
+
+        }
+
+    }
+
+    template< typename T >
+    void computeDeformationGradientBatched( const unsigned int nPoints, const T *displacementGradient, T *F, T *dFdGradU, const bool isCurrent ){
+        /*!
+         * Compute the deformation gradient from the gradient of the displacement and its Jacobian for a batch of points.
+         *
+         * The batch is stored in structure-of-arrays layout. See the overload without the Jacobian for details.
+         * The Jacobian is stored as 81 contiguous arrays of length nPoints so that component \f$ijkl\f$ of point
+         * \f$p\f$ is located at \f$( 27 i + 9 j + 3 k + l ) n_{points} + p\f$.
+         *
+         * \param &nPoints: The number of points in the batch
+         * \param *displacementGradient: The gradients of the displacement ( \f$9 n_{points}\f$ values )
+         * \param *F: The deformation gradients ( \f$9 n_{points}\f$ values )
+         * \param *dFdGradU: The derivative of the deformation gradients w.r.t. the displacement gradients
+         *     ( \f$81 n_{points}\f$ values )
+         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
+         *     or reference (false) position.
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        const std::size_t n = nPoints;
+
+        computeDeformationGradientBatched( nPoints, displacementGradient, F, isCurrent );
+
+        if ( isCurrent ){
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                for ( unsigned int j = 0; j < dim; j++ ){
+
+                    for ( unsigned int k = 0; k < dim; k++ ){
+
+                        for ( unsigned int l = 0; l < dim; l++ ){
+
+                            T *dFdGradU_ijkl = dFdGradU + ( dim * sot_dim * i + sot_dim * j + dim * k + l ) * n;
+
+                            const T *F_ik = F + ( dim * i + k ) * n;
+
+                            const T *F_lj = F + ( dim * l + j ) * n;
+
+                            for ( std::size_t p = 0; p < n; p++ ){
+
+                                dFdGradU_ijkl[ p ] = F_ik[ p ] * F_lj[ p ];
+
+                            }
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+        }
+        else{
+
+            std::fill( dFdGradU, dFdGradU + sot_dim * sot_dim * n, 0 );
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){
+
+                std::fill( dFdGradU + ( sot_dim * i + i ) * n, dFdGradU + ( sot_dim * i + i + 1 ) * n, 1 );
+
+            }
+
+        }
+
+    }
+
+    template< typename T >
+    void computeRightCauchyGreenBatched( const unsigned int nPoints, const T *deformationGradient, T *C ){
+        /*!
+         * Compute the Right Cauchy-Green deformation tensor ( \f$C\f$ ) for a batch of points
+         *
+         * \f$C_{IJ} = F_{iI} F_{iJ}\f$
+         *
+         * The batch is stored in structure-of-arrays layout i.e. component \f$IJ\f$ of point \f$p\f$ is
+         * located at \f$( 3 I + J ) n_{points} + p\f$.
+         *
+         * \param &nPoints: The number of points in the batch
+         * \param *deformationGradient: The deformation gradients ( \f$9 n_{points}\f$ values )
+         * \param *C: The resulting Right Cauchy-Green deformation tensors ( \f$9 n_{points}\f$ values )
+         */
+
+        rightCauchyGreenBatched< T >( nPoints, deformationGradient, C, NULL, NULL, NULL );
+
+    }
+
+    template< typename T >
+    void computeRightCauchyGreenBatched( const unsigned int nPoints, const T *deformationGradient, T *C, T *dCdF ){
+        /*!
+         * Compute the Right Cauchy-Green deformation tensor ( \f$C\f$ ) and its Jacobian w.r.t. the deformation
+         * gradient for a batch of points
+         *
+         * \f$C_{IJ} = F_{iI} F_{iJ}\f$
+         *
+         * \f$\frac{\partial C_{IJ}}{\partial F_{kK}} = \delta_{IK} F_{kJ} + F_{kI} \delta_{JK}\f$
+         *
+         * The batch is stored in structure-of-arrays layout i.e. component \f$IJ\f$ of point \f$p\f$ is
+         * located at \f$( 3 I + J ) n_{points} + p\f$ and component \f$IJkK\f$ of the Jacobian is located at
+         * \f$( 27 I + 9 J + 3 k + K ) n_{points} + p\f$.
+         *
+         * \param &nPoints: The number of points in the batch
+         * \param *deformationGradient: The deformation gradients ( \f$9 n_{points}\f$ values )
+         * \param *C: The resulting Right Cauchy-Green deformation tensors ( \f$9 n_{points}\f$ values )
+         * \param *dCdF: The Jacobians of the Right Cauchy-Green deformation tensors w.r.t. the deformation
+         *     gradients ( \f$81 n_{points}\f$ values )
+         */
+
+        rightCauchyGreenBatched< T >( nPoints, deformationGradient, C, NULL, dCdF, NULL );
+
+    }
+
+    template< typename T >
+    void computeGreenLagrangeStrainBatched( const unsigned int nPoints, const T *deformationGradient, T *E ){
+        /*!
+         * Compute the Green-Lagrange strain ( \f$E\f$ ) from the deformation gradient ( \f$F\f$ ) for a batch of points
+         *
+         * \f$E = 0.5 (F_{iI} F_{iJ} - \delta_{IJ})\f$
+         *
+         * The batch is stored in structure-of-arrays layout i.e. component \f$IJ\f$ of point \f$p\f$ is
+         * located at \f$( 3 I + J ) n_{points} + p\f$.
+         *
+         * \param &nPoints: The number of points in the batch
+         * \param *deformationGradient: The deformation gradients ( \f$9 n_{points}\f$ values )
+         * \param *E: The resulting Green-Lagrange strains ( \f$9 n_{points}\f$ values )
+         */
+
+        rightCauchyGreenBatched< T >( nPoints, deformationGradient, NULL, E, NULL, NULL );
+
+    }
+
+    template< typename T >
+    void computeGreenLagrangeStrainBatched( const unsigned int nPoints, const T *deformationGradient, T *E, T *dEdF ){
+        /*!
+         * Compute the Green-Lagrange strain ( \f$E\f$ ) from the deformation gradient ( \f$F\f$ ) and its Jacobian
+         * for a batch of points
+         *
+         * The batch is stored in structure-of-arrays layout i.e. component \f$IJ\f$ of point \f$p\f$ is
+         * located at \f$( 3 I + J ) n_{points} + p\f$ and component \f$IJkK\f$ of the Jacobian is located at
+         * \f$( 27 I + 9 J + 3 k + K ) n_{points} + p\f$.
+         *
+         * \param &nPoints: The number of points in the batch
+         * \param *deformationGradient: The deformation gradients ( \f$9 n_{points}\f$ values )
+         * \param *E: The resulting Green-Lagrange strains ( \f$9 n_{points}\f$ values )
+         * \param *dEdF: The Jacobians of the Green-Lagrange strains w.r.t. the deformation gradients
+         *     ( \f$81 n_{points}\f$ values )
+         */
+
+        rightCauchyGreenBatched< T >( nPoints, deformationGradient, NULL, E, NULL, dEdF );
+
+    }
+
+    template< typename T >
+    void computeKinematicsBatched( const unsigned int nPoints, const T *displacementGradient,
+                                   T *F, T *C, T *E, const bool isCurrent ){
+        /*!
+         * Compute the deformation gradient, the Right Cauchy-Green deformation tensor, and the Green-Lagrange
+         * strain from the displacement gradient for a batch of points.
+         *
+         * The batch is stored in structure-of-arrays layout i.e. component \f$IJ\f$ of point \f$p\f$ is
+         * located at \f$( 3 I + J ) n_{points} + p\f$.
+         *
+         * \param &nPoints: The number of points in the batch
+         * \param *displacementGradient: The gradients of the displacement ( \f$9 n_{points}\f$ values )
+         * \param *F: The deformation gradients ( \f$9 n_{points}\f$ values )
+         * \param *C: The Right Cauchy-Green deformation tensors ( \f$9 n_{points}\f$ values )
+         * \param *E: The Green-Lagrange strains ( \f$9 n_{points}\f$ values )
+         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
+         *     or reference (false) position.
+         */
+
+        computeDeformationGradientBatched( nPoints, displacementGradient, F, isCurrent );
+
+        rightCauchyGreenBatched< T >( nPoints, F, C, E, NULL, NULL );
+
+    }
+
+    template< typename T >
+    void computeKinematicsBatched( const unsigned int nPoints, const T *displacementGradient,
+                                   T *F, T *C, T *E,
+                                   T *dFdGradU, T *dCdF, T *dEdF, const bool isCurrent ){
+        /*!
+         * Compute the deformation gradient, the Right Cauchy-Green deformation tensor, the Green-Lagrange
+         * strain and their Jacobians from the displacement gradient for a batch of points.
+         *
+         * The batch is stored in structure-of-arrays layout i.e. component \f$IJ\f$ of point \f$p\f$ is
+         * located at \f$( 3 I + J ) n_{points} + p\f$ and component \f$IJkL\f$ of a Jacobian is located at
+         * \f$( 27 I + 9 J + 3 k + L ) n_{points} + p\f$.
+         *
+         * \param &nPoints: The number of points in the batch
+         * \param *displacementGradient: The gradients of the displacement ( \f$9 n_{points}\f$ values )
+         * \param *F: The deformation gradients ( \f$9 n_{points}\f$ values )
+         * \param *C: The Right Cauchy-Green deformation tensors ( \f$9 n_{points}\f$ values )
+         * \param *E: The Green-Lagrange strains ( \f$9 n_{points}\f$ values )
+         * \param *dFdGradU: The Jacobians of the deformation gradients w.r.t. the displacement gradients
+         *     ( \f$81 n_{points}\f$ values )
+         * \param *dCdF: The Jacobians of the Right Cauchy-Green deformation tensors w.r.t. the deformation
+         *     gradients ( \f$81 n_{points}\f$ values )
+         * \param *dEdF: The Jacobians of the Green-Lagrange strains w.r.t. the deformation gradients
+         *     ( \f$81 n_{points}\f$ values )
+         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
+         *     or reference (false) position.
+         */
+
+        computeDeformationGradientBatched( nPoints, displacementGradient, F, dFdGradU, isCurrent );
+
+        rightCauchyGreenBatched< T >( nPoints, F, C, E, dCdF, dEdF );
+
+    }
+
+    template< typename T >
+    static inline void currentSurfaceFacet( const std::size_t n, const std::size_t p, const T *referenceNormal,
+                                     const secondOrderTensor< T > &invF, const T J,
+                                     T *currentNormal, T *areaRatio, T *dCurrentNormaldF, T *dAreaRatiodF ){
+        /*!
+         * Map facet p of a batch to the current configuration using Nanson's formula given the inverse and the
+         * determinant of its deformation gradient. See computeCurrentSurfaceBatched for the layout.
+         *
+         * \param n: The number of facets in the batch
+         * \param p: The facet to map
+         * \param *referenceNormal: The reference unit normals
+         * \param &invF: The inverse of the deformation gradient of the facet
+         * \param J: The determinant of the deformation gradient of the facet
+         * \param *currentNormal: The current unit normals
+         * \param *areaRatio: The ratios of the current to the reference areas
+         * \param *dCurrentNormaldF: The derivatives of the current normals w.r.t. the deformation gradients (may be NULL)
+         * \param *dAreaRatiodF: The derivatives of the area ratios w.r.t. the deformation gradients (may be NULL)
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        const T N0 = referenceNormal[ 0 * n + p ], N1 = referenceNormal[ 1 * n + p ], N2 = referenceNormal[ 2 * n + p ];
+
+        // Area weighted current normal w_i = J F^{-1}_{Ji} N_J
+        T w[ dim ];
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            w[ i ] = J * ( invF[ dim * 0 + i ] * N0 + invF[ dim * 1 + i ] * N1 + invF[ dim * 2 + i ] * N2 );
+
+        }
+
+        const T r = std::sqrt( w[ 0 ] * w[ 0 ] + w[ 1 ] * w[ 1 ] + w[ 2 ] * w[ 2 ] );
+
+        const T nv[ dim ] = { w[ 0 ] / r, w[ 1 ] / r, w[ 2 ] / r };
+
+        for ( unsigned int i = 0; i < dim; i++ ){ currentNormal[ i * n + p ] = nv[ i ]; }
+
+        areaRatio[ p ] = r;
+
+        if ( !dCurrentNormaldF && !dAreaRatiodF ){ return; }
+
+        T invF_n[ dim ];
+
+        for ( unsigned int B = 0; B < dim; B++ ){
+
+            invF_n[ B ] = invF[ dim * B + 0 ] * nv[ 0 ] + invF[ dim * B + 1 ] * nv[ 1 ] + invF[ dim * B + 2 ] * nv[ 2 ];
+
+        }
+
+        if ( dCurrentNormaldF ){
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                for ( unsigned int b = 0; b < dim; b++ ){
+
+                    for ( unsigned int B = 0; B < dim; B++ ){
+
+                        dCurrentNormaldF[ ( sot_dim * i + dim * b + B ) * n + p ] = nv[ b ] * ( nv[ i ] * invF_n[ B ] - invF[ dim * B + i ] );
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        if ( dAreaRatiodF ){
+
+            for ( unsigned int b = 0; b < dim; b++ ){
+
+                for ( unsigned int B = 0; B < dim; B++ ){
+
+                    dAreaRatiodF[ ( dim * b + B ) * n + p ] = r * ( invF[ dim * B + b ] - nv[ b ] * invF_n[ B ] );
+
+                }
+
+            }
+
+        }
+
+    }
+
+    template< typename T >
+    void computeCurrentSurfaceBatched( const unsigned int nFacets, const T *referenceNormal, const T *deformationGradient,
+                                       T *currentNormal, T *areaRatio ){
+        /*!
+         * Map a batch of surface facets to the current configuration using Nanson's formula
+         *
+         * \f$ n_i da = J F^{-1}_{Ji} N_J dA \f$
+         *
+         * The batch is stored in structure-of-arrays layout i.e. component \f$i\f$ of the normal of facet \f$p\f$
+         * is located at \f$i n_{facets} + p\f$ and component \f$iJ\f$ of its deformation gradient at
+         * \f$( 3 i + J ) n_{facets} + p\f$.
+         *
+         * \param &nFacets: The number of facets in the batch
+         * \param *referenceNormal: The reference unit normals ( \f$3 n_{facets}\f$ values )
+         * \param *deformationGradient: The deformation gradients ( \f$9 n_{facets}\f$ values )
+         * \param *currentNormal: The current unit normals ( \f$3 n_{facets}\f$ values )
+         * \param *areaRatio: The ratios of the current to the reference areas \f$\frac{da}{dA}\f$ ( \f$n_{facets}\f$ values )
+         */
+
+        computeCurrentSurfaceBatched< T >( nFacets, referenceNormal, deformationGradient, currentNormal, areaRatio, NULL, NULL );
+
+    }
+
+    template< typename T >
+    void computeCurrentSurfaceBatched( const unsigned int nFacets, const T *referenceNormal, const T *deformationGradient,
+                                       T *currentNormal, T *areaRatio, T *dCurrentNormaldF, T *dAreaRatiodF ){
+        /*!
+         * Map a batch of surface facets to the current configuration using Nanson's formula and compute the
+         * derivatives w.r.t. the deformation gradients. The deformation gradient of each facet is only inverted
+         * once.
+         *
+         * \f$ \frac{\partial n_i}{\partial F_{bB}} = n_b \left( n_i F^{-1}_{Bj} n_j - F^{-1}_{Bi} \right) \f$
+         *
+         * \f$ \frac{\partial}{\partial F_{bB}} \frac{da}{dA} = \frac{da}{dA} \left( F^{-1}_{Bb} - n_b F^{-1}_{Bj} n_j \right) \f$
+         *
+         * The batch is stored in structure-of-arrays layout. See the overload without the derivatives for details.
+         * Component \f$ibB\f$ of the derivative of the normal of facet \f$p\f$ is located at
+         * \f$( 9 i + 3 b + B ) n_{facets} + p\f$ and component \f$bB\f$ of the derivative of the area ratio at
+         * \f$( 3 b + B ) n_{facets} + p\f$.
+         *
+         * \param &nFacets: The number of facets in the batch
+         * \param *referenceNormal: The reference unit normals ( \f$3 n_{facets}\f$ values )
+         * \param *deformationGradient: The deformation gradients ( \f$9 n_{facets}\f$ values )
+         * \param *currentNormal: The current unit normals ( \f$3 n_{facets}\f$ values )
+         * \param *areaRatio: The ratios of the current to the reference areas \f$\frac{da}{dA}\f$ ( \f$n_{facets}\f$ values )
+         * \param *dCurrentNormaldF: The derivatives of the current normals w.r.t. the deformation gradients
+         *     ( \f$27 n_{facets}\f$ values )
+         * \param *dAreaRatiodF: The derivatives of the area ratios w.r.t. the deformation gradients ( \f$9 n_{facets}\f$ values )
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        const std::size_t n = nFacets;
+
+        for ( std::size_t p = 0; p < n; p++ ){
+
+            secondOrderTensor< T > F, invF;
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ F[ i ] = deformationGradient[ i * n + p ]; }
+
+            const T J = invertSecondOrderTensor( F, invF );
+
+            currentSurfaceFacet( n, p, referenceNormal, invF, J, currentNormal, areaRatio, dCurrentNormaldF, dAreaRatiodF );
+
+        }
+
+    }
+
+    template< typename T >
+    void computeCurrentSurfaceBatched( const unsigned int nFacets, const T *referenceNormal, const secondOrderTensor< T > &deformationGradient,
+                                       T *currentNormal, T *areaRatio ){
+        /*!
+         * Map a batch of surface facets which share a single deformation gradient, e.g. the quadrature points of
+         * an element face, to the current configuration using Nanson's formula
+         *
+         * \f$ n_i da = J F^{-1}_{Ji} N_J dA \f$
+         *
+         * The normals are stored in structure-of-arrays layout i.e. component \f$i\f$ of the normal of facet
+         * \f$p\f$ is located at \f$i n_{facets} + p\f$.
+         *
+         * \param &nFacets: The number of facets in the batch
+         * \param *referenceNormal: The reference unit normals ( \f$3 n_{facets}\f$ values )
+         * \param &deformationGradient: The deformation gradient shared by all of the facets
+         * \param *currentNormal: The current unit normals ( \f$3 n_{facets}\f$ values )
+         * \param *areaRatio: The ratios of the current to the reference areas \f$\frac{da}{dA}\f$ ( \f$n_{facets}\f$ values )
+         */
+
+        computeCurrentSurfaceBatched< T >( nFacets, referenceNormal, deformationGradient, currentNormal, areaRatio, NULL, NULL );
+
+    }
+
+    template< typename T >
+    void computeCurrentSurfaceBatched( const unsigned int nFacets, const T *referenceNormal, const secondOrderTensor< T > &deformationGradient,
+                                       T *currentNormal, T *areaRatio, T *dCurrentNormaldF, T *dAreaRatiodF ){
+        /*!
+         * Map a batch of surface facets which share a single deformation gradient to the current configuration
+         * using Nanson's formula and compute the derivatives w.r.t. the deformation gradient. The deformation
+         * gradient is only inverted once for the whole batch.
+         *
+         * The layout of the outputs is the same as when each facet has its own deformation gradient so that
+         * the derivatives of facet \f$p\f$ are located at \f$( 9 i + 3 b + B ) n_{facets} + p\f$ and
+         * \f$( 3 b + B ) n_{facets} + p\f$.
+         *
+         * \param &nFacets: The number of facets in the batch
+         * \param *referenceNormal: The reference unit normals ( \f$3 n_{facets}\f$ values )
+         * \param &deformationGradient: The deformation gradient shared by all of the facets
+         * \param *currentNormal: The current unit normals ( \f$3 n_{facets}\f$ values )
+         * \param *areaRatio: The ratios of the current to the reference areas \f$\frac{da}{dA}\f$ ( \f$n_{facets}\f$ values )
+         * \param *dCurrentNormaldF: The derivatives of the current normals w.r.t. the deformation gradient
+         *     ( \f$27 n_{facets}\f$ values )
+         * \param *dAreaRatiodF: The derivatives of the area ratios w.r.t. the deformation gradient ( \f$9 n_{facets}\f$ values )
+         */
+
+        secondOrderTensor< T > invF;
+
+        const T J = invertSecondOrderTensor( deformationGradient, invF );
+
+        for ( std::size_t p = 0; p < nFacets; p++ ){
+
+            currentSurfaceFacet( nFacets, p, referenceNormal, invF, J, currentNormal, areaRatio, dCurrentNormaldF, dAreaRatiodF );
+
+        }
+
+    }
+
+    errorOut decomposeGreenLagrangeStrain( const floatVector &E, floatVector &Ebar, floatType &J ){
+        /*!
+         * Decompose the Green-Lagrange strain tensor ( \f$E\f$ ) into isochoric ( \f$\bar{E}\f$ ) and volumetric ( \f$J\f$ ) parts where
+         *
+         * \f$J = det(F) = sqrt(det(2*E + I))\f$
+         *
+         * \f$\bar{E}_{IJ} = 0.5*((1/(J**(2/3))) F_{iI} F_{iJ} - I_{IJ}) = (1/(J**(2/3)))*E_{IJ} + 0.5(1/(J**(2/3)) - 1)*I_{IJ}\f$
+         *
+         * \param &E: The Green-Lagrange strain tensor ( \f$E\f$ )
+         * \param &Ebar: The isochoric Green-Lagrange strain tensor ( \f$\bar{E}\f$ ).
+         *     format = E11, E12, E13, E21, E22, E23, E31, E32, E33
+         * \param &J: The Jacobian of deformation ( \f$J\f$ )
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( E.size() == sot_dim, "the Green-Lagrange strain must be 3D");
+
+        //Compute the determinant of the right Cauchy-Green deformation tensor
+        floatSecondOrderTensor C;
+        for ( unsigned int i = 0; i < sot_dim; i++ ){ C[ i ] = 2 * E[ i ]; }
+        for ( unsigned int i = 0; i < dim; i++ ){ C[ dim * i + i ] += 1; }
+
+        floatType Jsq = determinantSecondOrderTensor( C );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( Jsq > 0, "the determinant of the Green-Lagrange strain is negative");
+
+        J = sqrt(Jsq);
+        Ebar = E/(pow(J, 2./3));
+       
+        for ( unsigned int i = 0; i < dim; i++ ){ Ebar[ dim * i + i ] += 0.5*(1/pow(J, 2./3) - 1); }
+
+        return NULL;
+    }
+
+    errorOut decomposeGreenLagrangeStrain(const floatVector &E, floatVector &Ebar, floatType &J,
+                                          floatVector &dEbardE, floatVector &dJdE){
+        /*!
+         * Decompose the Green-Lagrange strain tensor ( \f$E\f$ ) into isochoric ( \f$\bar{E}\f$ ) and volumetric ( \f$J\f$ ) parts where
+         *
+         * \f$J = det(F) = sqrt(det(2*E + I))\f$
+         *
+         * \f$\bar{E}_{IJ} = 0.5*((1/(J**(2/3))) F_{iI} F_{iJ} - I_{IJ}) = (1/(J**(2/3)))*E_{IJ} + 0.5(1/(J**(2/3)) - 1)*I_{IJ}\f$
+         *
+         * \param &E: The Green-Lagrange strain tensor ( \f$E\f$ )
+         * \param &Ebar: The isochoric Green-Lagrange strain tensor ( \f$\bar{E}\f$ ).
+         *     format = E11, E12, E13, E21, E22, E23, E31, E32, E33
+         * \param &J: The Jacobian of deformation ( \f$J\f$ )
+         * \param &dEbardE: The derivative of the isochoric Green-Lagrange strain
+         *     tensor w.r.t. the total strain tensor ( \f$\frac{\partial \bar{E}}{\partial E}\f$ ).
+         * \param &dJdE: The derivative of the jacobian of deformation w.r.t. the
+         *     Green-Lagrange strain tensor ( \f$\frac{\partial J}{\partial E}\f$ ).
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( decomposeGreenLagrangeStrain(E, Ebar, J) );
+
+        //Compute the derivative of the jacobian of deformation w.r.t. the Green-Lagrange strain
+        floatSecondOrderTensor C, invC;
+        for ( unsigned int i = 0; i < sot_dim; i++ ){ C[ i ] = 2 * E[ i ]; }
+        for ( unsigned int i = 0; i < dim; i++ ){ C[ dim * i + i ] += 1; }
+
+        invertSecondOrderTensor( C, invC );
+
+        dJdE = floatVector( sot_dim );
+        for ( unsigned int i = 0; i < sot_dim; i++ ){ dJdE[ i ] = J * invC[ i ]; }
+
+        //Compute the derivative of the isochoric part of the Green-Lagrange strain w.r.t. the Green-Lagrange strain
+        floatVector eye( sot_dim );
+        for ( unsigned int i = 0; i < dim; i++ ){ eye[ dim * i + i ] = 1.; };
+        floatMatrix EYE = tardigradeVectorTools::eye<floatType>(9);
+
+        floatType invJ23 = 1./pow(J, 2./3);
+        floatType invJ53 = 1./pow(J, 5./3);
+
+        dEbardE = floatVector( sot_dim * sot_dim, 0 );
+
+        for ( unsigned int i = 0; i < sot_dim; i++ ){
+            dEbardE[ sot_dim * i + i ] += invJ23;
+        }
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            for ( unsigned int j = 0; j < dim; j++ ){
+
+                for ( unsigned int k = 0; k < dim; k++ ){
+
+                    dEbardE[ sot_dim * dim * i + sot_dim * i + dim * j + k ] -= (1./3) * invJ53 * dJdE[ dim * j + k ];
+
+                    for ( unsigned int l = 0; l < dim; l++ ){
+
+                        dEbardE[ sot_dim * dim * i + sot_dim * j + dim * k + l ] -= (2./3) * invJ53 * E[ dim * i + j ] * dJdE[ dim * k + l ];
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        return NULL;
+    }
+
+    errorOut decomposeGreenLagrangeStrain(const floatVector &E, floatVector &Ebar, floatType &J,
+                                          floatMatrix &dEbardE, floatVector &dJdE){
+        /*!
+         * Decompose the Green-Lagrange strain tensor ( \f$E\f$ ) into isochoric ( \f$\bar{E}\f$ ) and volumetric ( \f$J\f$ ) parts where
+         *
+         * \f$J = det(F) = sqrt(det(2*E + I))\f$
+         *
+         * \f$\bar{E}_{IJ} = 0.5*((1/(J**(2/3))) F_{iI} F_{iJ} - I_{IJ}) = (1/(J**(2/3)))*E_{IJ} + 0.5(1/(J**(2/3)) - 1)*I_{IJ}\f$
+         *
+         * \param &E: The Green-Lagrange strain tensor ( \f$E\f$ )
+         * \param &Ebar: The isochoric Green-Lagrange strain tensor ( \f$\bar{E}\f$ ).
+         *     format = E11, E12, E13, E21, E22, E23, E31, E32, E33
+         * \param &J: The Jacobian of deformation ( \f$J\f$ )
+         * \param &dEbardE: The derivative of the isochoric Green-Lagrange strain
+         *     tensor w.r.t. the total strain tensor ( \f$\frac{\partial \bar{E}}{\partial E}\f$ ).
+         * \param &dJdE: The derivative of the jacobian of deformation w.r.t. the
+         *     Green-Lagrange strain tensor ( \f$\frac{\partial J}{\partial E}\f$ ).
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        floatVector _dEbardE;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( decomposeGreenLagrangeStrain( E, Ebar, J, _dEbardE, dJdE ) );
+
+        asMatrix( _dEbardE, sot_dim ).copyTo( dEbardE );
+
+        return NULL;
+    }
+
+    template< typename T >
+    void computeIsochoricKinematics( const secondOrderTensor< T > &displacementGradient, secondOrderTensor< T > &F,
+                                     secondOrderTensor< T > &E, secondOrderTensor< T > &Ebar, T &J, const bool isCurrent ){
+        /*!
+         * Compute the deformation gradient, the Green-Lagrange strain, and its isochoric and volumetric parts from
+         * the displacement gradient in a single pass. The determinant is taken from the deformation gradient
+         * directly rather than from \f$2E + I\f$.
+         *
+         * \f$J = det\left( F \right)\f$
+         *
+         * \f$E_{IJ} = \frac{1}{2} \left( F_{iI} F_{iJ} - \delta_{IJ} \right)\f$
+         *
+         * \f$\bar{E}_{IJ} = \frac{1}{2} \left( J^{-\frac{2}{3}} F_{iI} F_{iJ} - \delta_{IJ} \right)\f$
+         *
+         * \param &displacementGradient: The gradient of the displacement with respect to either the
+         *     current or reference position.
+         * \param &F: The deformation gradient
+         * \param &E: The Green-Lagrange strain
+         * \param &Ebar: The isochoric Green-Lagrange strain
+         * \param &J: The determinant of the deformation gradient
+         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
+         *     or reference (false) position.
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        if ( isCurrent ){
+
+            secondOrderTensor< T > inverseF;
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ inverseF[ i ] = -displacementGradient[ i ]; }
+
+            for ( unsigned int i = 0; i < dim; i++ ){ inverseF[ dim * i + i ] += 1; }
+
+            J = 1 / invertSecondOrderTensor( inverseF, F );
+
+        }
+        else{
+
+            F = displacementGradient;
+
+            for ( unsigned int i = 0; i < dim; i++ ){ F[ dim * i + i ] += 1; }
+
+            J = F[ 0 ] * ( F[ 4 ] * F[ 8 ] - F[ 5 ] * F[ 7 ] ) + F[ 1 ] * ( F[ 5 ] * F[ 6 ] - F[ 3 ] * F[ 8 ] ) + F[ 2 ] * ( F[ 3 ] * F[ 7 ] - F[ 4 ] * F[ 6 ] );
+
+        }
+
+        const T invJ23 = 1 / std::cbrt( J * J );
+
+        for ( unsigned int I = 0; I < dim; I++ ){
+
+            for ( unsigned int J_ = I; J_ < dim; J_++ ){
+
+                const T C = F[ I ] * F[ J_ ] + F[ dim + I ] * F[ dim + J_ ] + F[ 2 * dim + I ] * F[ 2 * dim + J_ ];
+
+                const T delta = ( I == J_ ) ? 1 : 0;
+
+                E[ dim * I + J_ ] = T( 0.5 ) * ( C - delta );
+
+                E[ dim * J_ + I ] = E[ dim * I + J_ ];
+
+                Ebar[ dim * I + J_ ] = T( 0.5 ) * ( invJ23 * C - delta );
+
+                Ebar[ dim * J_ + I ] = Ebar[ dim * I + J_ ];
+
+            }
+
+        }
+
+    }
+
+    template< typename T >
+    void computeIsochoricKinematics( const secondOrderTensor< T > &displacementGradient, secondOrderTensor< T > &F,
+                                     secondOrderTensor< T > &E, secondOrderTensor< T > &Ebar, T &J,
+                                     fourthOrderTensor< T > &dEbardGradU, secondOrderTensor< T > &dJdGradU, const bool isCurrent ){
+        /*!
+         * Compute the deformation gradient, the Green-Lagrange strain, and its isochoric and volumetric parts from
+         * the displacement gradient in a single pass along with the Jacobians of the isochoric strain and the
+         * determinant w.r.t. the displacement gradient. The Jacobians are formed in closed form so the
+         * intermediate Jacobians w.r.t. \f$F\f$ and \f$E\f$ are never formed.
+         *
+         * If isCurrent = false where \f$H_{kl} = \frac{\partial u_k}{\partial X_l}\f$
+         *
+         * \f$\frac{\partial J}{\partial H_{kl}} = J F_{lk}^{-1}\f$
+         *
+         * \f$\frac{\partial \bar{E}_{IJ}}{\partial H_{kl}} = \frac{1}{2} J^{-\frac{2}{3}} \left( \delta_{Jl} F_{kI} + \delta_{Il} F_{kJ} - \frac{2}{3} C_{IJ} F_{lk}^{-1} \right)\f$
+         *
+         * else if isCurrent = true where \f$H_{kl} = \frac{\partial u_k}{\partial x_l}\f$
+         *
+         * \f$\frac{\partial J}{\partial H_{kl}} = J F_{lk}\f$
+         *
+         * \f$\frac{\partial \bar{E}_{IJ}}{\partial H_{kl}} = \frac{1}{2} J^{-\frac{2}{3}} \left( C_{Ik} F_{lJ} + C_{Jk} F_{lI} - \frac{2}{3} C_{IJ} F_{lk} \right)\f$
+         *
+         * \param &displacementGradient: The gradient of the displacement with respect to either the
+         *     current or reference position.
+         * \param &F: The deformation gradient
+         * \param &E: The Green-Lagrange strain
+         * \param &Ebar: The isochoric Green-Lagrange strain
+         * \param &J: The determinant of the deformation gradient
+         * \param &dEbardGradU: The Jacobian of the isochoric Green-Lagrange strain w.r.t. the displacement gradient
+         * \param &dJdGradU: The Jacobian of the determinant of the deformation gradient w.r.t. the displacement gradient
+         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
+         *     or reference (false) position.
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        computeIsochoricKinematics( displacementGradient, F, E, Ebar, J, isCurrent );
+
+        const T invJ23 = 1 / std::cbrt( J * J );
+
+        // The right Cauchy-Green deformation tensor and the derivative of the log of the determinant
+        secondOrderTensor< T > C, dLogJdGradU;
+
+        for ( unsigned int i = 0; i < sot_dim; i++ ){ C[ i ] = 2 * E[ i ]; }
+
+        for ( unsigned int i = 0; i < dim; i++ ){ C[ dim * i + i ] += 1; }
+
+        if ( isCurrent ){
+
+            for ( unsigned int k = 0; k < dim; k++ ){
+
+                for ( unsigned int l = 0; l < dim; l++ ){
+
+                    dLogJdGradU[ dim * k + l ] = F[ dim * l + k ];
+
+                }
+
+            }
+
+        }
+        else{
+
+            secondOrderTensor< T > inverseF;
+
+            invertSecondOrderTensor( F, inverseF );
+
+            for ( unsigned int k = 0; k < dim; k++ ){
+
+                for ( unsigned int l = 0; l < dim; l++ ){
+
+                    dLogJdGradU[ dim * k + l ] = inverseF[ dim * l + k ];
+
+                }
+
+            }
+
+        }
+
+        for ( unsigned int i = 0; i < sot_dim; i++ ){ dJdGradU[ i ] = J * dLogJdGradU[ i ]; }
+
+        const T halfInvJ23 = T( 0.5 ) * invJ23;
+
+        for ( unsigned int I = 0; I < dim; I++ ){
+
+            for ( unsigned int J_ = 0; J_ < dim; J_++ ){
+
+                const T scaledC = C[ dim * I + J_ ] * T( 2. / 3 );
+
+                for ( unsigned int k = 0; k < dim; k++ ){
+
+                    for ( unsigned int l = 0; l < dim; l++ ){
+
+                        T value = -scaledC * dLogJdGradU[ dim * k + l ];
+
+                        if ( isCurrent ){
+
+                            value += C[ dim * I + k ] * F[ dim * l + J_ ] + C[ dim * J_ + k ] * F[ dim * l + I ];
+
+                        }
+                        else{
+
+                            if ( J_ == l ){ value += F[ dim * k + I ]; }
+
+                            if ( I == l ){ value += F[ dim * k + J_ ]; }
+
+                        }
+
+                        dEbardGradU[ dim * sot_dim * I + sot_dim * J_ + dim * k + l ] = halfInvJ23 * value;
+
+                    }
+
+                }
+
+            }
+
+        }
+
+    }
+
+    errorOut computeIsochoricKinematics( const floatVector &displacementGradient, floatVector &F, floatVector &E,
+                                         floatVector &Ebar, floatType &J, const bool isCurrent ){
+        /*!
+         * Compute the deformation gradient, the Green-Lagrange strain, and its isochoric and volumetric parts from
+         * the displacement gradient in a single pass.
+         *
+         * \param &displacementGradient: The gradient of the displacement with respect to either the
+         *     current or reference position.
+         * \param &F: The deformation gradient
+         * \param &E: The Green-Lagrange strain
+         * \param &Ebar: The isochoric Green-Lagrange strain
+         * \param &J: The determinant of the deformation gradient
+         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
+         *     or reference (false) position.
+         */
+
+        floatSecondOrderTensor _gradU, _F, _E, _Ebar;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( displacementGradient.size( ) == _gradU.size( ), "The displacement gradient must be 3D" );
+
+        std::copy( displacementGradient.begin( ), displacementGradient.end( ), _gradU.begin( ) );
+
+        computeIsochoricKinematics( _gradU, _F, _E, _Ebar, J, isCurrent );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( J > 0, "The determinant of the deformation gradient must be positive" );
+
+        F.assign( _F.begin( ), _F.end( ) );
+
+        E.assign( _E.begin( ), _E.end( ) );
+
+        Ebar.assign( _Ebar.begin( ), _Ebar.end( ) );
+
+        return NULL;
+
+    }
+
+    errorOut computeIsochoricKinematics( const floatVector &displacementGradient, floatVector &F, floatVector &E,
+                                         floatVector &Ebar, floatType &J, floatVector &dEbardGradU, floatVector &dJdGradU,
+                                         const bool isCurrent ){
+        /*!
+         * Compute the deformation gradient, the Green-Lagrange strain, and its isochoric and volumetric parts from
+         * the displacement gradient in a single pass along with the Jacobians of the isochoric strain and the
+         * determinant w.r.t. the displacement gradient.
+         *
+         * \param &displacementGradient: The gradient of the displacement with respect to either the
+         *     current or reference position.
+         * \param &F: The deformation gradient
+         * \param &E: The Green-Lagrange strain
+         * \param &Ebar: The isochoric Green-Lagrange strain
+         * \param &J: The determinant of the deformation gradient
+         * \param &dEbardGradU: The Jacobian of the isochoric Green-Lagrange strain w.r.t. the displacement gradient
+         * \param &dJdGradU: The Jacobian of the determinant of the deformation gradient w.r.t. the displacement gradient
+         * \param &isCurrent: Boolean indicating whether the gradient is taken w.r.t. the current (true)
+         *     or reference (false) position.
+         */
+
+        floatSecondOrderTensor _gradU, _F, _E, _Ebar, _dJdGradU;
+
+        floatFourthOrderTensor _dEbardGradU;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( displacementGradient.size( ) == _gradU.size( ), "The displacement gradient must be 3D" );
+
+        std::copy( displacementGradient.begin( ), displacementGradient.end( ), _gradU.begin( ) );
+
+        computeIsochoricKinematics( _gradU, _F, _E, _Ebar, J, _dEbardGradU, _dJdGradU, isCurrent );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( J > 0, "The determinant of the deformation gradient must be positive" );
+
+        F.assign( _F.begin( ), _F.end( ) );
+
+        E.assign( _E.begin( ), _E.end( ) );
+
+        Ebar.assign( _Ebar.begin( ), _Ebar.end( ) );
+
+        dEbardGradU.assign( _dEbardGradU.begin( ), _dEbardGradU.end( ) );
+
+        dJdGradU.assign( _dJdGradU.begin( ), _dJdGradU.end( ) );
+
+        return NULL;
+
+    }
+
+    errorOut mapPK2toCauchy(const floatVector &PK2Stress, const floatVector &deformationGradient, floatVector &cauchyStress){
+        /*!
+         * Map the PK2 stress ( \f$P^{II}\f$ ) to the current configuration resulting in the Cauchy stress ( \f$\sigma\f$ ).
+         *
+         * \f$\sigma_{ij} = (1/det(F)) F_{iI} P^{II}_{IJ} F_{jJ}\f$
+         *
+         * where \f$F\f$ is the deformation gradient
+         *
+         * \param &PK2Stress: The Second Piola-Kirchoff stress ( \f$P^{II}\f$ )
+         * \param &deformationGradient: The total deformation gradient ( \f$F\f$ ).
+         * \param &cauchyStress: The Cauchy stress (\f$\sigma\f$ ).
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( PK2Stress.size( ) == sot_dim, "The cauchy stress must have nine components (3D)");
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( deformationGradient.size() == PK2Stress.size(), "The deformation gradient and the PK2 stress don't have the same size");
+
+        //Compute the determinant of the deformation gradient
+        floatSecondOrderTensor F;
+        std::copy( deformationGradient.begin( ), deformationGradient.end( ), F.begin( ) );
+        floatType detF = determinantSecondOrderTensor( F );
+
+        //Initialize the Cauchy stress
+        floatVector temp_sot( sot_dim, 0 );
+        cauchyStress = floatVector( sot_dim, 0);
+
+        for (unsigned int i=0; i<dim; i++){
+            for (unsigned int I=0; I<dim; I++){
+                for (unsigned int j=0; j<dim; j++){
+                    temp_sot[ dim * i + j ] += deformationGradient[ 3 * i + I ] * PK2Stress[ 3 * I + j ];
+                }
+            }
+        }
+
+        temp_sot /= detF;
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+            for ( unsigned int j = 0; j < dim; j++ ){
+                for ( unsigned int I = 0; I < dim; I++ ){
+                        cauchyStress[ dim * i + j ] += temp_sot[ dim * i + I ]*deformationGradient[ 3 * j + I ];
+                }
+            }
+        }
+        return NULL;
+    }
+
+    errorOut WLF(const floatType &temperature, const floatVector &WLFParameters, floatType &factor){
+        /*!
+         * An implementation of the Williams-Landel-Ferry equation.
+         *
+         * \f$factor = 10**((-C_1*(T - T_r))/(C_2 + T - T_r))\f$
+         *
+         * where \f$T\f$ is the temperature, \f$T_r\f$ is the reference temperature, and \f$C_1\f$ and \f$C_2\f$ are parameters
+         *
+         * \param &temperature: The temperature \f$T\f$
+         * \param &WLFParameters: The parameters for the function [\f$T_r\f$, \f$C_1\f$, \f$C_2\f$]
+         * \param &factor: The shift factor
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( WLFParameters.size() == 3, "The parameters have the wrong number of terms");
+
+        floatType Tr = WLFParameters[0];
+        floatType C1 = WLFParameters[1];
+        floatType C2 = WLFParameters[2];
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( !tardigradeVectorTools::fuzzyEquals(C2 + (temperature - Tr), 0.), "Zero in the denominator");
+
+        factor = pow(10., -C1*(temperature - Tr)/(C2 + (temperature - Tr)));
+
+        return NULL;
+    }
+
+    errorOut WLF(const floatType &temperature, const floatVector &WLFParameters, floatType &factor, floatType &dfactordT){
+        /*!
+         * An implementation of the Williams-Landel-Ferry equation that also returns the gradient w.r.t. \f$T\f$
+         *
+         * \param &temperature: The temperature ( \f$T\f$ )
+         * \param &WLFParameters: The parameters for the function [\f$T_r\f$, \f$C_1\f$, \f$C_2\f$]
+         * \param &factor: The shift factor
+         * \param &dfactordT: The derivative of the shift factor w.r.t. the temperature ( \f$\frac{\partial factor}{\partial T}\f$ )
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( WLF(temperature, WLFParameters, factor) );
+
+        floatType Tr = WLFParameters[0];
+        floatType C1 = WLFParameters[1];
+        floatType C2 = WLFParameters[2];
+
+        dfactordT = std::log(10)*factor*(-C1/(C2 + temperature - Tr) + (C1*(temperature - Tr)/pow(C2 + temperature - Tr, 2)));
+
+        return NULL;
+    }
+
+    errorOut computeDFDt(const floatVector &velocityGradient, const floatVector &deformationGradient, floatVector &DFDt){
+        /*!
+         * Compute the total time derivative of the deformation gradient.
+         *
+         * \f$\dot{F}_{iI} = L_{ij} F_{jI}\f$
+         *
+         * \param &velocityGradient: The velocity gradient \f$L_{ij}\f$
+         * \param &deformationGradient: The deformation gradient \f$F_{iI}\f$
+         * \param &DFDt: The total time derivative of the deformation gradient
+         */
+
+        //Assume 3D
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( velocityGradient.size() == deformationGradient.size(), "The velocity gradient and deformation gradient must have the same size");
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( velocityGradient.size() == sot_dim, "The velocity gradient doesn't have enough entries");
+
+        DFDt = floatVector(velocityGradient.size(), 0);
+
+        for (unsigned int i=0; i<dim; i++){
+            for (unsigned int I=0; I<dim; I++){
+                for (unsigned int j=0; j<dim; j++){
+                    DFDt[dim*i + I] += velocityGradient[dim*i + j] * deformationGradient[dim*j + I];
+                }
+            }
+        }
+        return NULL;
+    }
+
+    errorOut computeDFDt(const floatVector &velocityGradient, const floatVector &deformationGradient, floatVector &DFDt,
+                         floatVector &dDFDtdL, floatVector &dDFDtdF){
+        /*!
+         * Compute the total time derivative of the deformation gradient
+         * and return the partial derivatives w.r.t. L and F.
+         *
+         * \f$\dot{F}_{iI} = L_{ij} F_{jI}\f$
+         * \f$\frac{\partial \dot{F}_{iI}}{\partial L_{kl}} = \delta_{ik} F{lI}\f$
+         * \f$\frac{\partial \dot{F}_{iI}}{\partial F_{kK}} = L_{ik} \delta{IK}\f$
+         *
+         * \param &velocityGradient: The velocity gradient \f$L_{ij}\f$
+         * \param &deformationGradient: The deformation gradient \f$F_{iI}\f$
+         * \param &DFDt: The total time derivative of the deformation gradient
+         * \param &dDFDtdL: The derivative of the total time derivative of the deformation gradient
+         *     with respect to the velocity gradient.
+         * \param &dDFDtdF: The derivative of the total time derivative of the deformation gradient
+         *     with respect to the deformation gradient.
+         */
+
+        //Assume 3D
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( computeDFDt(velocityGradient, deformationGradient, DFDt) );
+
+        //Form the identity tensor
+        floatVector eye(dim*dim, 0);
+        tardigradeVectorTools::eye(eye);
+
+        //Form the partial w.r.t. L and F
+        dDFDtdL = floatVector( sot_dim * sot_dim, 0 );
+        dDFDtdF = floatVector( sot_dim * sot_dim, 0 );;
+
+        for (unsigned int i=0; i<dim; i++){
+            for (unsigned int I=0; I<dim; I++){
+                for (unsigned int k=0; k<dim; k++){
+                    dDFDtdL[ sot_dim * dim * i + sot_dim * I + dim * i + k] = deformationGradient[ dim * k + I ];
+                    dDFDtdF[ sot_dim * dim * i + sot_dim * I + dim * k + I] = velocityGradient[ dim * i + k ];
+                }
+            }
+        }
+
+        return NULL;
+    }
+
+    errorOut computeDFDt(const floatVector &velocityGradient, const floatVector &deformationGradient, floatVector &DFDt,
+                         floatMatrix &dDFDtdL, floatMatrix &dDFDtdF){
+        /*!
+         * Compute the total time derivative of the deformation gradient
+         * and return the partial derivatives w.r.t. L and F.
+         *
+         * \f$\dot{F}_{iI} = L_{ij} F_{jI}\f$
+         * \f$\frac{\partial \dot{F}_{iI}}{\partial L_{kl}} = \delta_{ik} F{lI}\f$
+         * \f$\frac{\partial \dot{F}_{iI}}{\partial F_{kK}} = L_{ik} \delta{IK}\f$
+         *
+         * \param &velocityGradient: The velocity gradient \f$L_{ij}\f$
+         * \param &deformationGradient: The deformation gradient \f$F_{iI}\f$
+         * \param &DFDt: The total time derivative of the deformation gradient
+         * \param &dDFDtdL: The derivative of the total time derivative of the deformation gradient
+         *     with respect to the velocity gradient.
+         * \param &dDFDtdF: The derivative of the total time derivative of the deformation gradient
+         *     with respect to the deformation gradient.
+         */
+
+        //Assume 3D
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        floatVector _dDFDtdL, _dDFDtdF;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( computeDFDt( velocityGradient, deformationGradient, DFDt, _dDFDtdL, _dDFDtdF ) );
+
+        asMatrix( _dDFDtdL, sot_dim ).copyTo( dDFDtdL );
+
+        asMatrix( _dDFDtdF, sot_dim ).copyTo( dDFDtdF );
+
+        return NULL;
+    }
+
+    errorOut midpointEvolution( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                floatVector &dA, floatVector &A, const floatVector &alpha ){
+        /*!
+         * Perform midpoint rule based evolution of a vector.
+         *
+         * alpha=0 (implicit)
+         *
+         * alpha=1 (explicit)
+         *
+         * \param &Dt: The change in time.
+         * \param &Ap: The previous value of the vector
+         * \param &DApDt: The previous time rate of change of the vector.
+         * \param &DADt: The current time rate of change of the vector.
+         * \param &dA: The change in the vector
+         * \param &A: The current value of the vector.
+         * \param &alpha: The integration parameter.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( ( Ap.size( ) == DApDt.size( ) ) && ( Ap.size( ) == DADt.size( ) ), "The size of the previous value of the vector and the two rates are not equal" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( Ap.size( ) == alpha.size( ), "The size of the alpha vector is not the same size as the previous vector value" );
+
+        dA = floatVector( Ap.size( ), 0 );
+
+        A = floatVector( Ap.size( ), 0 );
+
+        unsigned int i = 0;
+
+        for ( auto ai = alpha.begin( ); ai != alpha.end( ); ai++, i++ ){
+
+            TARDIGRADE_ERROR_TOOLS_CHECK( ( ( *ai ) >= 0) && ( ( *ai ) <= 1 ), "Alpha must be between 0 and 1" );
+
+            dA[ i ] = Dt * ( *ai * DApDt[ i ] + ( 1 - *ai ) * DADt[ i ] );
+
+            A[ i ]  = Ap[ i ] + dA[ i ];
+
+        }
+
+        return NULL;
+
+    }
+
+    errorOut midpointEvolutionFlatJ( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                     floatVector &dA, floatVector &A, floatVector &DADADt, const floatVector &alpha ){
+        /*!
+         * Perform midpoint rule based evolution of a vector and return the jacobian.
+         *
+         * alpha=0 (implicit)
+         *
+         * alpha=1 (explicit)
+         *
+         * \param &Dt: The change in time.
+         * \param &Ap: The previous value of the vector
+         * \param &DApDt: The previous time rate of change of the vector.
+         * \param &DADt: The current time rate of change of the vector.
+         * \param &A: The change in value of the vector.
+         * \param &A: The current value of the vector.
+         * \param &DADADt: The gradient of A w.r.t. the current rate of change.
+         * \param &alpha: The integration parameter.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, alpha ) )
+
+        const unsigned int A_size = A.size( );
+
+        DADADt = floatVector( A_size * A_size, 0 );
+
+        unsigned int i = 0;
+
+        for ( auto ai = alpha.begin( ); ai != alpha.end( ); ai++, i++ ){
+
+            DADADt[ A_size * i + i ] = Dt * ( 1 - *ai );
+
+        }
+
+        return NULL;
+
+    }
+
+    errorOut midpointEvolution( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                floatVector &dA, floatVector &A, floatMatrix &DADADt, const floatVector &alpha ){
+        /*!
+         * Perform midpoint rule based evolution of a vector and return the jacobian.
+         *
+         * alpha=0 (implicit)
+         *
+         * alpha=1 (explicit)
+         *
+         * \param &Dt: The change in time.
+         * \param &Ap: The previous value of the vector
+         * \param &DApDt: The previous time rate of change of the vector.
+         * \param &DADt: The current time rate of change of the vector.
+         * \param &A: The change in value of the vector.
+         * \param &A: The current value of the vector.
+         * \param &DADADt: The gradient of A w.r.t. the current rate of change.
+         * \param &alpha: The integration parameter.
+         */
+
+        floatVector _DADADt;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( midpointEvolutionFlatJ( Dt, Ap, DApDt, DADt, dA, A, _DADADt, alpha ) )
+
+        asMatrix( _DADADt, A.size( ) ).copyTo( DADADt );
+
+        return NULL;
+
+    }
+
+
+    errorOut midpointEvolutionFlatJ( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                     floatVector &dA, floatVector &A, floatVector &DADADt, floatVector &DADADtp,
+                                     const floatVector &alpha ){
+        /*!
+         * Perform midpoint rule based evolution of a vector and return the jacobian.
+         *
+         * alpha=0 (implicit)
+         *
+         * alpha=1 (explicit)
+         *
+         * Note that the gradient of A w.r.t. Ap is identity and the gradient of dA w.r.t. Ap is zero
+         *
+         * \param &Dt: The change in time.
+         * \param &Ap: The previous value of the vector
+         * \param &DApDt: The previous time rate of change of the vector.
+         * \param &DADt: The current time rate of change of the vector.
+         * \param &A: The change in value of the vector.
+         * \param &A: The current value of the vector.
+         * \param &DADADt: The gradient of A w.r.t. the current rate of change.
+         * \param &DADADtp: The gradient of A w.r.t. the previous rate of change.
+         * \param &alpha: The integration parameter.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( midpointEvolutionFlatJ( Dt, Ap, DApDt, DADt, dA, A, DADADt, alpha ) );
+
+        const unsigned int A_size = A.size( );
+
+        DADADtp = floatVector( A_size * A_size, 0 );
+
+        unsigned int i = 0;
+
+        for ( auto ai = alpha.begin( ); ai != alpha.end( ); ai++, i++ ){
+
+            DADADtp[ A_size * i + i ] = Dt * ( *ai );
+
+        }
+
+        return NULL;
+
+    }
+
+    errorOut midpointEvolution( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                floatVector &dA, floatVector &A, floatMatrix &DADADt, floatMatrix &DADADtp,
+                                const floatVector &alpha ){
+        /*!
+         * Perform midpoint rule based evolution of a vector and return the jacobian.
+         *
+         * alpha=0 (implicit)
+         *
+         * alpha=1 (explicit)
+         *
+         * Note that the gradient of A w.r.t. Ap is identity and the gradient of dA w.r.t. Ap is zero
+         *
+         * \param &Dt: The change in time.
+         * \param &Ap: The previous value of the vector
+         * \param &DApDt: The previous time rate of change of the vector.
+         * \param &DADt: The current time rate of change of the vector.
+         * \param &A: The change in value of the vector.
+         * \param &A: The current value of the vector.
+         * \param &DADADt: The gradient of A w.r.t. the current rate of change.
+         * \param &DADADtp: The gradient of A w.r.t. the previous rate of change.
+         * \param &alpha: The integration parameter.
+         */
+
+        floatVector _DADADt, _DADADtp;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( midpointEvolutionFlatJ( Dt, Ap, DApDt, DADt, dA, A, _DADADt, _DADADtp, alpha ) );
+
+        asMatrix( _DADADt,  A.size( ) ).copyTo( DADADt );
+
+        asMatrix( _DADADtp, A.size( ) ).copyTo( DADADtp );
+
+        return NULL;
+
+    }
+
+    errorOut midpointEvolution( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                floatVector &dA, floatVector &A, const floatType alpha ){
+        /*!
+         * Perform midpoint rule based evolution of a vector. Defaults to the trapezoidal rule.
+         *
+         * alpha=0 (implicit)
+         *
+         * alpha=1 (explicit)
+         *
+         * \param &Dt: The change in time.
+         * \param &Ap: The previous value of the vector
+         * \param &DApDt: The previous time rate of change of the vector.
+         * \param &DADt: The current time rate of change of the vector.
+         * \param &dA: The change in the value of the vector.
+         * \param &A: The current value of the vector.
+         * \param alpha: The integration parameter.
+         */
+
+        return midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, alpha * floatVector( Ap.size( ), 1 ) );
+
+    }
+
+    errorOut midpointEvolutionFlatJ( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                     floatVector &dA, floatVector &A, floatVector &DADADt, const floatType alpha ){
+        /*!
+         * Perform midpoint rule based evolution of a vector. Defaults to the trapezoidal rule.
+         *
+         * alpha=0 (implicit)
+         *
+         * alpha=1 (explicit)
+         *
+         * \param &Dt: The change in time.
+         * \param &Ap: The previous value of the vector
+         * \param &DApDt: The previous time rate of change of the vector.
+         * \param *DADt: The current time rate of change of the vector.
+         * \param &dA: The change in the vector
+         * \param &A: The current value of the vector.
+         * \param &DADADt: The derivative of the vector w.r.t. the rate of change of the vector.
+         * \param alpha: The integration parameter.
+         */
+
+        return midpointEvolutionFlatJ( Dt, Ap, DApDt, DADt, dA, A, DADADt, alpha * floatVector( Ap.size( ), 1 ) );
+
+    }
+
+    errorOut midpointEvolutionFlatJ( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                     floatVector &dA, floatVector &A, floatVector &DADADt, floatVector &DADADtp,
+                                     const floatType alpha ){
+        /*!
+         * Perform midpoint rule based evolution of a vector. Defaults to the trapezoidal rule.
+         *
+         * alpha=0 (implicit)
+         *
+         * alpha=1 (explicit)
+         * 
+         * Note that the gradient of A w.r.t. Ap is identity and the gradient of dA w.r.t. Ap is zero
+         *
+         * \param &Dt: The change in time.
+         * \param &Ap: The previous value of the vector
+         * \param &DApDt: The previous time rate of change of the vector.
+         * \param *DADt: The current time rate of change of the vector.
+         * \param &dA: The change in the vector
+         * \param &A: The current value of the vector.
+         * \param &DADADt: The derivative of the vector w.r.t. the rate of change of the vector.
+         * \param &DADADtp: The derivative of the vector w.r.t. the previous rate of change of the vector.
+         * \param alpha: The integration parameter.
+         */
+
+        return midpointEvolutionFlatJ( Dt, Ap, DApDt, DADt, dA, A, DADADt, DADADtp, alpha * floatVector( Ap.size( ), 1 ) );
+
+    }
+
+    errorOut midpointEvolution( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                floatVector &dA, floatVector &A, floatMatrix &DADADt, const floatType alpha ){
+        /*!
+         * Perform midpoint rule based evolution of a vector. Defaults to the trapezoidal rule.
+         *
+         * alpha=0 (implicit)
+         *
+         * alpha=1 (explicit)
+         *
+         * \param &Dt: The change in time.
+         * \param &Ap: The previous value of the vector
+         * \param &DApDt: The previous time rate of change of the vector.
+         * \param *DADt: The current time rate of change of the vector.
+         * \param &dA: The change in the vector
+         * \param &A: The current value of the vector.
+         * \param &DADADt: The derivative of the vector w.r.t. the rate of change of the vector.
+         * \param alpha: The integration parameter.
+         */
+
+        return midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, DADADt, alpha * floatVector( Ap.size( ), 1 ) );
+
+    }
+
+    errorOut midpointEvolution( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                floatVector &dA, floatVector &A, floatMatrix &DADADt, floatMatrix &DADADtp,
+                                const floatType alpha ){
+        /*!
+         * Perform midpoint rule based evolution of a vector. Defaults to the trapezoidal rule.
+         *
+         * alpha=0 (implicit)
+         *
+         * alpha=1 (explicit)
+         * 
+         * Note that the gradient of A w.r.t. Ap is identity and the gradient of dA w.r.t. Ap is zero
+         *
+         * \param &Dt: The change in time.
+         * \param &Ap: The previous value of the vector
+         * \param &DApDt: The previous time rate of change of the vector.
+         * \param *DADt: The current time rate of change of the vector.
+         * \param &dA: The change in the vector
+         * \param &A: The current value of the vector.
+         * \param &DADADt: The derivative of the vector w.r.t. the rate of change of the vector.
+         * \param &DADADtp: The derivative of the vector w.r.t. the previous rate of change of the vector.
+         * \param alpha: The integration parameter.
+         */
+
+        return midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, DADADt, DADADtp, alpha * floatVector( Ap.size( ), 1 ) );
+
+    }
+
+    errorOut midpointEvolutionDiagonalJ( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                         floatVector &dA, floatVector &A, floatVector &DADADt, const floatVector &alpha ){
+        /*!
+         * Perform midpoint rule based evolution of a vector and return the diagonal of the jacobian. Each component
+         * of A only depends on the same component of the rates so the jacobian is diagonal and only the diagonal
+         * \f$\frac{\partial A_i}{\partial \dot{A}_i}\f$ is returned.
+         *
+         * alpha=0 (implicit)
+         *
+         * alpha=1 (explicit)
+         *
+         * \param &Dt: The change in time.
+         * \param &Ap: The previous value of the vector
+         * \param &DApDt: The previous time rate of change of the vector.
+         * \param &DADt: The current time rate of change of the vector.
+         * \param &dA: The change in value of the vector.
+         * \param &A: The current value of the vector.
+         * \param &DADADt: The diagonal of the gradient of A w.r.t. the current rate of change.
+         * \param &alpha: The integration parameter.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, alpha ) );
+
+        DADADt.resize( alpha.size( ) );
+
+        for ( unsigned int i = 0; i < alpha.size( ); i++ ){
+
+            DADADt[ i ] = Dt * ( 1 - alpha[ i ] );
+
+        }
+
+        return NULL;
+
+    }
+
+    errorOut midpointEvolutionDiagonalJ( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                         floatVector &dA, floatVector &A, floatVector &DADADt, floatVector &DADADtp,
+                                         const floatVector &alpha ){
+        /*!
+         * Perform midpoint rule based evolution of a vector and return the diagonals of the jacobians.
+         *
+         * alpha=0 (implicit)
+         *
+         * alpha=1 (explicit)
+         *
+         * Note that the gradient of A w.r.t. Ap is identity and the gradient of dA w.r.t. Ap is zero
+         *
+         * \param &Dt: The change in time.
+         * \param &Ap: The previous value of the vector
+         * \param &DApDt: The previous time rate of change of the vector.
+         * \param &DADt: The current time rate of change of the vector.
+         * \param &dA: The change in value of the vector.
+         * \param &A: The current value of the vector.
+         * \param &DADADt: The diagonal of the gradient of A w.r.t. the current rate of change.
+         * \param &DADADtp: The diagonal of the gradient of A w.r.t. the previous rate of change.
+         * \param &alpha: The integration parameter.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( midpointEvolutionDiagonalJ( Dt, Ap, DApDt, DADt, dA, A, DADADt, alpha ) );
+
+        DADADtp.resize( alpha.size( ) );
+
+        for ( unsigned int i = 0; i < alpha.size( ); i++ ){
+
+            DADADtp[ i ] = Dt * alpha[ i ];
+
+        }
+
+        return NULL;
+
+    }
+
+    errorOut midpointEvolutionDiagonalJ( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                         floatVector &dA, floatVector &A, floatVector &DADADt, const floatType alpha ){
+        /*!
+         * Perform midpoint rule based evolution of a vector with a scalar integration parameter and return the
+         * diagonal of the jacobian.
+         *
+         * alpha=0 (implicit)
+         *
+         * alpha=1 (explicit)
+         *
+         * \param &Dt: The change in time.
+         * \param &Ap: The previous value of the vector
+         * \param &DApDt: The previous time rate of change of the vector.
+         * \param &DADt: The current time rate of change of the vector.
+         * \param &dA: The change in value of the vector.
+         * \param &A: The current value of the vector.
+         * \param &DADADt: The diagonal of the gradient of A w.r.t. the current rate of change.
+         * \param alpha: The integration parameter.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( ( Ap.size( ) == DApDt.size( ) ) && ( Ap.size( ) == DADt.size( ) ), "The size of the previous value of the vector and the two rates are not equal" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( ( alpha >= 0 ) && ( alpha <= 1 ), "Alpha must be between 0 and 1" );
+
+        const unsigned int A_size = Ap.size( );
+
+        dA.resize( A_size );
+
+        A.resize( A_size );
+
+        for ( unsigned int i = 0; i < A_size; i++ ){
+
+            dA[ i ] = Dt * ( alpha * DApDt[ i ] + ( 1 - alpha ) * DADt[ i ] );
+
+            A[ i ]  = Ap[ i ] + dA[ i ];
+
+        }
+
+        DADADt.assign( A_size, Dt * ( 1 - alpha ) );
+
+        return NULL;
+
+    }
+
+    errorOut midpointEvolutionDiagonalJ( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                         floatVector &dA, floatVector &A, floatVector &DADADt, floatVector &DADADtp,
+                                         const floatType alpha ){
+        /*!
+         * Perform midpoint rule based evolution of a vector with a scalar integration parameter and return the
+         * diagonals of the jacobians.
+         *
+         * alpha=0 (implicit)
+         *
+         * alpha=1 (explicit)
+         *
+         * Note that the gradient of A w.r.t. Ap is identity and the gradient of dA w.r.t. Ap is zero
+         *
+         * \param &Dt: The change in time.
+         * \param &Ap: The previous value of the vector
+         * \param &DApDt: The previous time rate of change of the vector.
+         * \param &DADt: The current time rate of change of the vector.
+         * \param &dA: The change in value of the vector.
+         * \param &A: The current value of the vector.
+         * \param &DADADt: The diagonal of the gradient of A w.r.t. the current rate of change.
+         * \param &DADADtp: The diagonal of the gradient of A w.r.t. the previous rate of change.
+         * \param alpha: The integration parameter.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( midpointEvolutionDiagonalJ( Dt, Ap, DApDt, DADt, dA, A, DADADt, alpha ) );
+
+        DADADtp.assign( A.size( ), Dt * alpha );
+
+        return NULL;
+
+    }
+
+    template< typename T >
+    static void midpointEvolutionStream( const unsigned int n, const T a, const T b, const T *DApDt, const T *DADt, T *A, T *dA ){
+        /*!
+         * Stream the midpoint update \f$dA = a \dot{A}_p + b \dot{A}\f$, \f$A \mathrel{+}= dA\f$ over n contiguous values.
+         * The loops are free of branches so that they vectorize.
+         *
+         * \param n: The number of values
+         * \param a: The weight of the previous rate i.e. \f$\Delta t \alpha\f$
+         * \param b: The weight of the current rate i.e. \f$\Delta t \left(1 - \alpha\right)\f$
+         * \param *DApDt: The previous rates
+         * \param *DADt: The current rates
+         * \param *A: The values which are updated in place
+         * \param *dA: The changes in the values (may be NULL)
+         */
+
+        if ( dA ){
+
+            for ( unsigned int i = 0; i < n; i++ ){
+
+                dA[ i ] = a * DApDt[ i ] + b * DADt[ i ];
+
+                A[ i ] += dA[ i ];
+
+            }
+
+        }
+        else{
+
+            for ( unsigned int i = 0; i < n; i++ ){
+
+                A[ i ] += a * DApDt[ i ] + b * DADt[ i ];
+
+            }
+
+        }
+
+    }
+
+    template< typename T >
+    void midpointEvolutionBatched( const unsigned int nValues, const T Dt, const T *DApDt, const T *DADt,
+                                   T *A, T *dA, const T alpha, statusCode &status ){
+        /*!
+         * Perform midpoint rule based evolution of a contiguous array of values in place with a single integration
+         * parameter. No allocations are performed and the integration parameter is only checked once.
+         *
+         * alpha=0 (implicit)
+         *
+         * alpha=1 (explicit)
+         *
+         * \param nValues: The number of values to update
+         * \param Dt: The change in time
+         * \param *DApDt: The previous time rates of change of the values
+         * \param *DADt: The current time rates of change of the values
+         * \param *A: The previous values on entry and the current values on exit
+         * \param *dA: The changes in the values (may be NULL)
+         * \param alpha: The integration parameter
+         * \param &status: The status of the operation
+         */
+
+        status = clearStatus( );
+
+        if ( !( ( alpha >= 0 ) && ( alpha <= 1 ) ) ){
+
+            status = setStatus( statusCode::outOfRange, "Alpha must be between 0 and 1" );
+
+            return;
+
+        }
+
+        midpointEvolutionStream( nValues, Dt * alpha, Dt * ( 1 - alpha ), DApDt, DADt, A, dA );
+
+    }
+
+    template< typename T >
+    void midpointEvolutionBatched( const unsigned int nPoints, const unsigned int nStates, const T Dt, const T *DApDt, const T *DADt,
+                                   T *A, T *dA, const T *alpha, statusCode &status ){
+        /*!
+         * Perform midpoint rule based evolution of the state variables of a batch of points in place where each
+         * state variable has its own integration parameter. No allocations are performed and the integration
+         * parameters are checked once before any value is updated.
+         *
+         * The batch is stored in structure-of-arrays layout i.e. state variable \f$i\f$ of point \f$p\f$ is located
+         * at \f$i n_{points} + p\f$ so the update of each state variable is a contiguous stream over the points.
+         *
+         * alpha=0 (implicit)
+         *
+         * alpha=1 (explicit)
+         *
+         * \param nPoints: The number of points in the batch
+         * \param nStates: The number of state variables of each point
+         * \param Dt: The change in time
+         * \param *DApDt: The previous time rates of change of the state variables ( \f$n_{states} n_{points}\f$ values )
+         * \param *DADt: The current time rates of change of the state variables ( \f$n_{states} n_{points}\f$ values )
+         * \param *A: The previous state variables on entry and the current state variables on exit
+         * \param *dA: The changes in the state variables (may be NULL)
+         * \param *alpha: The integration parameters of the state variables ( \f$n_{states}\f$ values )
+         * \param &status: The status of the operation
+         */
+
+        status = clearStatus( );
+
+        for ( unsigned int i = 0; i < nStates; i++ ){
+
+            if ( !( ( alpha[ i ] >= 0 ) && ( alpha[ i ] <= 1 ) ) ){
+
+                status = setStatus( statusCode::outOfRange, "Alpha must be between 0 and 1" );
+
+                return;
+
+            }
+
+        }
+
+        for ( unsigned int i = 0; i < nStates; i++ ){
+
+            const std::size_t offset = static_cast< std::size_t >( nPoints ) * i;
+
+            midpointEvolutionStream( nPoints, Dt * alpha[ i ], Dt * ( 1 - alpha[ i ] ), DApDt + offset, DADt + offset, A + offset,
+                                     dA ? dA + offset : dA );
+
+        }
+
+    }
+
+    template< class C, typename T >
+    static void evolveFKernel( const T Dt, const T *previousDeformationGradient, const T *Lp, const T *L, const T alpha,
+                        secondOrderTensor< T > &dF, secondOrderTensor< T > &F, secondOrderTensor< T > &invLHS, secondOrderTensor< T > &P,
+                        T *dFdL, T *ddFdFp, T *dFdLp ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method for the configuration C. This
+         * is the kernel behind all of the evolveF overloads. The left hand side is formed and inverted once and the
+         * deformation gradient and any requested Jacobians are computed from that single inverse. The inputs are
+         * not checked.
+         *
+         * \f$M = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1}\f$
+         *
+         * \f$P = \delta_{ij} + \Delta t \alpha L_{ij}^{t}\f$
+         *
+         * so that \f$F^{t+1} = M P F^{t}\f$ (currentConfiguration) or \f$F^{t+1} = F^{t} P M\f$ (referenceConfiguration).
+         *
+         * \param Dt: The change in time.
+         * \param *previousDeformationGradient: The previous value of the deformation gradient (9 values)
+         * \param *Lp: The previous velocity gradient (9 values)
+         * \param *L: The current velocity gradient (9 values)
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param &dF: The change in the deformation gradient \f$\Delta \bf{F}\f$ such that \f$F_{iI}^{t+1} = F_{iI}^t + \Delta F_{iI}\f$
+         * \param &F: The computed current deformation gradient
+         * \param &invLHS: The inverse of the left hand side \f$M\f$
+         * \param &P: The explicit part of the right hand side \f$P\f$
+         * \param *dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient (81 values). Skipped if NULL.
+         * \param *ddFdFp: The derivative of the change in the deformation gradient w.r.t. the previous deformation gradient
+         *     (81 values). Skipped if NULL.
+         * \param *dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient (81 values). Skipped if NULL.
+         */
+
+        static_assert( ( C::mode == 1 ) || ( C::mode == 2 ), "The configuration must be currentConfiguration or referenceConfiguration" );
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        secondOrderTensor< T > LHS, RHS;
+
+        for ( unsigned int i = 0; i < sot_dim; i++ ){
+
+            LHS[ i ] = -Dt * ( 1 - alpha ) * L[ i ];
+
+            P[ i ] = Dt * alpha * Lp[ i ];
+
+            RHS[ i ] = Dt * ( alpha * Lp[ i ] + ( 1 - alpha ) * L[ i ] );
+
+        }
+
+        for ( unsigned int i = 0; i < dim; i++ ){ LHS[ dim * i + i ] += 1; P[ dim * i + i ] += 1; }
+
+        invertSecondOrderTensor( LHS, invLHS );
+
+        Eigen::Map< const Eigen::Matrix< T, dim, dim, Eigen::RowMajor > > Fp( previousDeformationGradient );
+        Eigen::Map< const Eigen::Matrix< T, dim, dim, Eigen::RowMajor > > RHS_map( RHS.data( ) );
+        Eigen::Map< const Eigen::Matrix< T, dim, dim, Eigen::RowMajor > > M( invLHS.data( ) );
+        Eigen::Map< Eigen::Matrix< T, dim, dim, Eigen::RowMajor > > dF_map( dF.data( ) );
+
+        if constexpr ( C::mode == 1 ){
+
+            dF_map = M * ( RHS_map * Fp );
+
+        }
+        else{
+
+            dF_map = ( Fp * RHS_map ) * M;
+
+        }
+
+        for ( unsigned int i = 0; i < sot_dim; i++ ){ F[ i ] = previousDeformationGradient[ i ] + dF[ i ]; }
+
+        const T a = Dt * ( 1 - alpha );
+        const T b = Dt * alpha;
+
+        if ( dFdL ){
+
+            for ( unsigned int j = 0; j < dim; j++ ){
+                for ( unsigned int I = 0; I < dim; I++ ){
+                    for ( unsigned int k = 0; k < dim; k++ ){
+                        for ( unsigned int l = 0; l < dim; l++ ){
+                            if constexpr ( C::mode == 1 ){
+                                dFdL[ dim * sot_dim * j + sot_dim * I + dim * k + l ] = a * invLHS[ dim * j + k ] * F[ dim * l + I ];
+                            }
+                            else{
+                                dFdL[ dim * sot_dim * j + sot_dim * I + dim * k + l ] = a * invLHS[ dim * l + I ] * F[ dim * j + k ];
+                            }
+                        }
+                    }
+                }
+            }
+
+        }
+
+        if ( dFdLp ){
+
+            for ( unsigned int j = 0; j < dim; j++ ){
+                for ( unsigned int I = 0; I < dim; I++ ){
+                    for ( unsigned int k = 0; k < dim; k++ ){
+                        for ( unsigned int l = 0; l < dim; l++ ){
+                            if constexpr ( C::mode == 1 ){
+                                dFdLp[ dim * sot_dim * j + sot_dim * I + dim * k + l ] = b * invLHS[ dim * j + k ] * previousDeformationGradient[ dim * l + I ];
+                            }
+                            else{
+                                dFdLp[ dim * sot_dim * j + sot_dim * I + dim * k + l ] = b * invLHS[ dim * l + I ] * previousDeformationGradient[ dim * j + k ];
+                            }
+                        }
+                    }
+                }
+            }
+
+        }
+
+        if ( ddFdFp ){
+
+            // The derivative of the change w.r.t. the previous deformation gradient only depends on M RHS or RHS M
+            secondOrderTensor< T > MRHS;
+            Eigen::Map< Eigen::Matrix< T, dim, dim, Eigen::RowMajor > > MRHS_map( MRHS.data( ) );
+
+            std::fill( ddFdFp, ddFdFp + sot_dim * sot_dim, T( 0 ) );
+
+            if constexpr ( C::mode == 1 ){
+
+                MRHS_map = M * RHS_map;
+
+                for ( unsigned int j = 0; j < dim; j++ ){
+                    for ( unsigned int I = 0; I < dim; I++ ){
+                        for ( unsigned int k = 0; k < dim; k++ ){
+                            ddFdFp[ dim * sot_dim * j + sot_dim * I + dim * k + I ] = MRHS[ dim * j + k ];
+                        }
+                    }
+                }
+
+            }
+            else{
+
+                MRHS_map = RHS_map * M;
+
+                for ( unsigned int j = 0; j < dim; j++ ){
+                    for ( unsigned int I = 0; I < dim; I++ ){
+                        for ( unsigned int K = 0; K < dim; K++ ){
+                            ddFdFp[ dim * sot_dim * j + sot_dim * I + dim * j + K ] = MRHS[ dim * K + I ];
+                        }
+                    }
+                }
+
+            }
+
+        }
+
+    }
+
+    static errorOut evolveFEngine( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                            const floatType alpha, const unsigned int mode, floatSecondOrderTensor &dF, floatSecondOrderTensor &F,
+                            floatSecondOrderTensor &invLHS, floatSecondOrderTensor &P,
+                            floatType *dFdL, floatType *ddFdFp, floatType *dFdLp ){
+        /*!
+         * Check the inputs of the runtime mode evolveF overloads and dispatch to the kernel of the requested
+         * configuration. See evolveFKernel for details.
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param mode: The form of the ODE. See evolveF for details.
+         * \param &dF: The change in the deformation gradient \f$\Delta \bf{F}\f$ such that \f$F_{iI}^{t+1} = F_{iI}^t + \Delta F_{iI}\f$
+         * \param &F: The computed current deformation gradient
+         * \param &invLHS: The inverse of the left hand side \f$M\f$
+         * \param &P: The explicit part of the right hand side \f$P\f$
+         * \param *dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient (81 values). Skipped if NULL.
+         * \param *ddFdFp: The derivative of the change in the deformation gradient w.r.t. the previous deformation gradient
+         *     (81 values). Skipped if NULL.
+         * \param *dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient (81 values). Skipped if NULL.
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( previousDeformationGradient.size( ) == sot_dim, "The deformation gradient doesn't have enough terms (require 9 for 3D)" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( Lp.size( ) == previousDeformationGradient.size( ), "The previous velocity gradient and deformation gradient aren't the same size" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( previousDeformationGradient.size( ) == L.size( ), "The previous deformation gradient and the current velocity gradient aren't the same size" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( ( mode == 1 ) || ( mode == 2 ), "The mode of evolution is not recognized" );
+
+        if ( mode == 1 ){
+
+            evolveFKernel< currentConfiguration >( Dt, previousDeformationGradient.data( ), Lp.data( ), L.data( ), alpha,
+                                                   dF, F, invLHS, P, dFdL, ddFdFp, dFdLp );
+
+        }
+        else{
+
+            evolveFKernel< referenceConfiguration >( Dt, previousDeformationGradient.data( ), Lp.data( ), L.data( ), alpha,
+                                                     dF, F, invLHS, P, dFdL, ddFdFp, dFdLp );
+
+        }
+
+        return NULL;
+
+    }
+
+    template< class C, typename T >
+    void evolveF( const T &Dt, const secondOrderTensor< T > &previousDeformationGradient, const secondOrderTensor< T > &Lp,
+                  const secondOrderTensor< T > &L, secondOrderTensor< T > &dF, secondOrderTensor< T > &deformationGradient,
+                  const T alpha ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method with the configuration of the
+         * velocity gradient selected at compile time. See the runtime mode overloads for the form of the ODE.
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &dF: The change in the deformation gradient \f$\Delta \bf{F}\f$ such that \f$F_{iI}^{t+1} = F_{iI}^t + \Delta F_{iI}\f$
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         */
+
+        secondOrderTensor< T > invLHS, P;
+
+        evolveFKernel< C, T >( Dt, previousDeformationGradient.data( ), Lp.data( ), L.data( ), alpha,
+                               dF, deformationGradient, invLHS, P, NULL, NULL, NULL );
+
+    }
+
+    template< class C, typename T >
+    void evolveF( const T &Dt, const secondOrderTensor< T > &previousDeformationGradient, const secondOrderTensor< T > &Lp,
+                  const secondOrderTensor< T > &L, secondOrderTensor< T > &dF, secondOrderTensor< T > &deformationGradient,
+                  fourthOrderTensor< T > &dFdL, const T alpha ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method with the configuration of the
+         * velocity gradient selected at compile time and return the Jacobian w.r.t. L. See the runtime mode overloads
+         * for the form of the ODE.
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &dF: The change in the deformation gradient \f$\Delta \bf{F}\f$ such that \f$F_{iI}^{t+1} = F_{iI}^t + \Delta F_{iI}\f$
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         */
+
+        secondOrderTensor< T > invLHS, P;
+
+        evolveFKernel< C, T >( Dt, previousDeformationGradient.data( ), Lp.data( ), L.data( ), alpha,
+                               dF, deformationGradient, invLHS, P, dFdL.data( ), NULL, NULL );
+
+    }
+
+    template< class C, typename T >
+    void evolveF( const T &Dt, const secondOrderTensor< T > &previousDeformationGradient, const secondOrderTensor< T > &Lp,
+                  const secondOrderTensor< T > &L, secondOrderTensor< T > &dF, secondOrderTensor< T > &deformationGradient,
+                  fourthOrderTensor< T > &dFdL, fourthOrderTensor< T > &ddFdFp, fourthOrderTensor< T > &dFdFp,
+                  fourthOrderTensor< T > &dFdLp, const T alpha ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method with the configuration of the
+         * velocity gradient selected at compile time and return the Jacobians w.r.t. L, the previous deformation
+         * gradient, and the previous velocity gradient. See the runtime mode overloads for the form of the ODE.
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &dF: The change in the deformation gradient \f$\Delta \bf{F}\f$ such that \f$F_{iI}^{t+1} = F_{iI}^t + \Delta F_{iI}\f$
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
+         * \param &ddFdFp: The derivative of the change in the deformation gradient w.r.t. the previous deformation gradient
+         * \param &dFdFp: The derivative of the deformation gradient w.r.t. the previous deformation gradient
+         * \param &dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        secondOrderTensor< T > invLHS, P;
+
+        evolveFKernel< C, T >( Dt, previousDeformationGradient.data( ), Lp.data( ), L.data( ), alpha,
+                               dF, deformationGradient, invLHS, P, dFdL.data( ), ddFdFp.data( ), dFdLp.data( ) );
+
+        dFdFp = ddFdFp;
+        for ( unsigned int i = 0; i < sot_dim; i++ ){ dFdFp[ sot_dim * i + i ] += 1; }
+
+    }
+
+    template< class C, typename T >
+    static void evolveFAdaptiveKernel( const T Dt, const secondOrderTensor< T > &previousDeformationGradient, const secondOrderTensor< T > &Lp,
+                                const secondOrderTensor< T > &L, secondOrderTensor< T > &deformationGradient,
+                                T *dFdL, T *dFdFp, T *dFdLp, unsigned int &nSubsteps, statusCode &status,
+                                const T alpha, const T tolerance, const unsigned int maxSubsteps ){
+        /*!
+         * Evolve the deformation gradient over the step with adaptively sized substeps. The velocity gradient is
+         * interpolated linearly between Lp and L over the step. The error of each substep is estimated by step
+         * doubling i.e. by comparing a single midpoint step against two steps of half the size. Substeps whose
+         * relative error exceeds the tolerance are rejected and retried with half the size. Accepted substeps use
+         * the more accurate two half steps and the size is doubled again once the error allows it. The Jacobians of
+         * the accepted half steps are chained through the step.
+         *
+         * The substeps are restricted to dyadic fractions of the step so that the sequence of substeps does not
+         * change under small perturbations of the inputs. The chained Jacobians are then the exact derivatives of
+         * the computed deformation gradient which keeps the tangent of an implicit solver consistent.
+         *
+         * \param Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param *dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient (81 values). Skipped if NULL.
+         * \param *dFdFp: The derivative of the deformation gradient w.r.t. the previous deformation gradient (81 values).
+         *     Skipped if NULL.
+         * \param *dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient (81 values).
+         *     Skipped if NULL.
+         * \param &nSubsteps: The number of accepted substeps. A value of one means the step was not refined.
+         * \param &status: The status of the operation. notConverged if the step could not be completed within the
+         *     allowed number of attempts.
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param tolerance: The tolerance on the relative error of each substep
+         * \param maxSubsteps: The maximum number of attempted (accepted and rejected) substeps
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        constexpr unsigned int dim = 3;
+
+        status = clearStatus( );
+
+        nSubsteps = 0;
+
+        const bool computeJacobians = dFdL || dFdFp || dFdLp;
+
+        // The growth of the local error when the size of a substep is doubled. The midpoint method is second order
+        // accurate for alpha = 0.5 and first order accurate otherwise.
+        const T doublingFactor = ( alpha == T( 0.5 ) ) ? 8 : 4;
+
+        secondOrderTensor< T > F = previousDeformationGradient;
+
+        // The Jacobians of the current value of F w.r.t. the previous deformation gradient and the velocity gradients
+        fourthOrderTensor< T > GFp, GL, GLp;
+
+        if ( computeJacobians ){
+
+            std::fill( GFp.begin( ), GFp.end( ), T( 0 ) );
+            std::fill( GL.begin( ), GL.end( ), T( 0 ) );
+            std::fill( GLp.begin( ), GLp.end( ), T( 0 ) );
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ GFp[ sot_dim * i + i ] = 1; }
+
+        }
+
+        auto interpolate = [ & ]( const T s, secondOrderTensor< T > &Ls ){
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ Ls[ i ] = Lp[ i ] + s * ( L[ i ] - Lp[ i ] ); }
+
+        };
+
+        // Chain the Jacobians of a substep from the fraction sa to sb of the step into the accumulated Jacobians. The
+        // substep maps F to M P F (current configuration) or F P M (reference configuration) so its derivative w.r.t.
+        // the incoming F is applied as a 3x3 product rather than a dense 9x9 one.
+        auto chain = [ & ]( const secondOrderTensor< T > &M, const secondOrderTensor< T > &Ps, const fourthOrderTensor< T > &dFdLb,
+                            const fourthOrderTensor< T > &dFdLa, const T sa, const T sb ){
+
+            secondOrderTensor< T > A;
+
+            Eigen::Map< const Eigen::Matrix< T, dim, dim, Eigen::RowMajor > > M_map( M.data( ) );
+            Eigen::Map< const Eigen::Matrix< T, dim, dim, Eigen::RowMajor > > P_map( Ps.data( ) );
+            Eigen::Map< Eigen::Matrix< T, dim, dim, Eigen::RowMajor > > A_map( A.data( ) );
+
+            if constexpr ( C::mode == 1 ){ A_map = M_map * P_map; }
+            else{ A_map = P_map * M_map; }
+
+            for ( fourthOrderTensor< T > *G : { &GFp, &GL, &GLp } ){
+
+                const fourthOrderTensor< T > Gin = *G;
+
+                for ( unsigned int j = 0; j < dim; j++ ){
+                    for ( unsigned int I = 0; I < dim; I++ ){
+                        for ( unsigned int c = 0; c < sot_dim; c++ ){
+
+                            T value = 0;
+
+                            for ( unsigned int k = 0; k < dim; k++ ){
+
+                                if constexpr ( C::mode == 1 ){ value += A[ dim * j + k ] * Gin[ sot_dim * ( dim * k + I ) + c ]; }
+                                else{ value += Gin[ sot_dim * ( dim * j + k ) + c ] * A[ dim * k + I ]; }
+
+                            }
+
+                            ( *G )[ sot_dim * ( dim * j + I ) + c ] = value;
+
+                        }
+                    }
+                }
+
+            }
+
+            for ( unsigned int i = 0; i < sot_dim * sot_dim; i++ ){
+
+                GL[ i ]  += sb * dFdLb[ i ] + sa * dFdLa[ i ];
+
+                GLp[ i ] += ( 1 - sb ) * dFdLb[ i ] + ( 1 - sa ) * dFdLa[ i ];
+
+            }
+
+        };
+
+        secondOrderTensor< T > La, Lm, Lb, dFs, Ffull, Fhalf, Ftwo, invLHS, P, invLHS1, P1, invLHS2, P2;
+
+        fourthOrderTensor< T > dFdL1, dFdLp1, dFdL2, dFdLp2;
+
+        T s = 0;
+
+        T h = 1;
+
+        unsigned int nAttempts = 0;
+
+        while ( s < 1 ){
+
+            if ( nAttempts >= maxSubsteps ){
+
+                status = setStatus( statusCode::notConverged, "The deformation gradient could not be evolved within the allowed number of substeps" );
+
+                return;
+
+            }
+
+            nAttempts++;
+
+            const T sb = s + h;
+
+            const T sm = s + h / 2;
+
+            interpolate( s, La );
+
+            interpolate( sm, Lm );
+
+            interpolate( sb, Lb );
+
+            // The single step and the two half steps
+            evolveFKernel< C, T >( Dt * h, F.data( ), La.data( ), Lb.data( ), alpha, dFs, Ffull, invLHS, P, NULL, NULL, NULL );
+
+            evolveFKernel< C, T >( Dt * h / 2, F.data( ), La.data( ), Lm.data( ), alpha, dFs, Fhalf, invLHS1, P1,
+                                   computeJacobians ? dFdL1.data( ) : NULL, NULL, computeJacobians ? dFdLp1.data( ) : NULL );
+
+            evolveFKernel< C, T >( Dt * h / 2, Fhalf.data( ), Lm.data( ), Lb.data( ), alpha, dFs, Ftwo, invLHS2, P2,
+                                   computeJacobians ? dFdL2.data( ) : NULL, NULL, computeJacobians ? dFdLp2.data( ) : NULL );
+
+            T errorSquared = 0;
+
+            T normSquared = 0;
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){
+
+                errorSquared += ( Ftwo[ i ] - Ffull[ i ] ) * ( Ftwo[ i ] - Ffull[ i ] );
+
+                normSquared += Ftwo[ i ] * Ftwo[ i ];
+
+            }
+
+            const T error = std::sqrt( errorSquared / normSquared );
+
+            // Non-finite errors e.g. from a singular left hand side are rejected
+            if ( !( error <= tolerance ) ){
+
+                h /= 2;
+
+                continue;
+
+            }
+
+            if ( computeJacobians ){
+
+                chain( invLHS1, P1, dFdL1, dFdLp1, s, sm );
+
+                chain( invLHS2, P2, dFdL2, dFdLp2, sm, sb );
+
+            }
+
+            F = Ftwo;
+
+            s = sb;
+
+            nSubsteps++;
+
+            // Double the size if the error of the doubled substep is expected to satisfy the tolerance and the
+            // doubled substep stays aligned with the dyadic fractions of the step
+            if ( ( h < 1 ) && ( error * doublingFactor <= tolerance ) && ( std::fmod( s, 2 * h ) == 0 ) ){
+
+                h *= 2;
+
+            }
+
+        }
+
+        deformationGradient = F;
+
+        if ( dFdL ){ std::copy( GL.begin( ), GL.end( ), dFdL ); }
+
+        if ( dFdFp ){ std::copy( GFp.begin( ), GFp.end( ), dFdFp ); }
+
+        if ( dFdLp ){ std::copy( GLp.begin( ), GLp.end( ), dFdLp ); }
+
+    }
+
+    template< class C, typename T >
+    void evolveFAdaptive( const T &Dt, const secondOrderTensor< T > &previousDeformationGradient, const secondOrderTensor< T > &Lp,
+                          const secondOrderTensor< T > &L, secondOrderTensor< T > &deformationGradient, unsigned int &nSubsteps,
+                          statusCode &status, const T alpha, const T tolerance, const unsigned int maxSubsteps ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method with adaptively sized substeps.
+         * Only the steps which are large compared to the time scale of the velocity gradient are refined. See
+         * evolveFAdaptiveKernel for details.
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &nSubsteps: The number of accepted substeps. A value of one means the step was not refined.
+         * \param &status: The status of the operation
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param tolerance: The tolerance on the relative error of each substep
+         * \param maxSubsteps: The maximum number of attempted (accepted and rejected) substeps
+         */
+
+        evolveFAdaptiveKernel< C, T >( Dt, previousDeformationGradient, Lp, L, deformationGradient, NULL, NULL, NULL,
+                                       nSubsteps, status, alpha, tolerance, maxSubsteps );
+
+    }
+
+    template< class C, typename T >
+    void evolveFAdaptive( const T &Dt, const secondOrderTensor< T > &previousDeformationGradient, const secondOrderTensor< T > &Lp,
+                          const secondOrderTensor< T > &L, secondOrderTensor< T > &deformationGradient, fourthOrderTensor< T > &dFdL,
+                          fourthOrderTensor< T > &dFdFp, fourthOrderTensor< T > &dFdLp, unsigned int &nSubsteps,
+                          statusCode &status, const T alpha, const T tolerance, const unsigned int maxSubsteps ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method with adaptively sized substeps
+         * and return the Jacobians chained through the substeps. See evolveFAdaptiveKernel for details.
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
+         * \param &dFdFp: The derivative of the deformation gradient w.r.t. the previous deformation gradient
+         * \param &dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient
+         * \param &nSubsteps: The number of accepted substeps. A value of one means the step was not refined.
+         * \param &status: The status of the operation
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param tolerance: The tolerance on the relative error of each substep
+         * \param maxSubsteps: The maximum number of attempted (accepted and rejected) substeps
+         */
+
+        evolveFAdaptiveKernel< C, T >( Dt, previousDeformationGradient, Lp, L, deformationGradient, dFdL.data( ), dFdFp.data( ), dFdLp.data( ),
+                                       nSubsteps, status, alpha, tolerance, maxSubsteps );
+
+    }
+
+    static errorOut evolveFAdaptiveEngine( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                                    const floatType alpha, const unsigned int mode, const floatType tolerance, const unsigned int maxSubsteps,
+                                    floatSecondOrderTensor &F, floatType *dFdL, floatType *dFdFp, floatType *dFdLp, unsigned int &nSubsteps ){
+        /*!
+         * Check the inputs of the runtime mode evolveFAdaptive overloads and dispatch to the kernel of the requested
+         * configuration. See evolveFAdaptiveKernel for details.
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param mode: The form of the ODE. See evolveF for details.
+         * \param tolerance: The tolerance on the relative error of each substep
+         * \param maxSubsteps: The maximum number of attempted (accepted and rejected) substeps
+         * \param &F: The computed current deformation gradient
+         * \param *dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient (81 values). Skipped if NULL.
+         * \param *dFdFp: The derivative of the deformation gradient w.r.t. the previous deformation gradient (81 values).
+         *     Skipped if NULL.
+         * \param *dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient (81 values).
+         *     Skipped if NULL.
+         * \param &nSubsteps: The number of accepted substeps
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( previousDeformationGradient.size( ) == sot_dim, "The deformation gradient doesn't have enough terms (require 9 for 3D)" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( Lp.size( ) == previousDeformationGradient.size( ), "The previous velocity gradient and deformation gradient aren't the same size" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( previousDeformationGradient.size( ) == L.size( ), "The previous deformation gradient and the current velocity gradient aren't the same size" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( ( mode == 1 ) || ( mode == 2 ), "The mode of evolution is not recognized" );
+
+        floatSecondOrderTensor _Fp, _Lp, _L;
+
+        std::copy( previousDeformationGradient.begin( ), previousDeformationGradient.end( ), _Fp.begin( ) );
+
+        std::copy( Lp.begin( ), Lp.end( ), _Lp.begin( ) );
+
+        std::copy( L.begin( ), L.end( ), _L.begin( ) );
+
+        statusCode status;
+
+        if ( mode == 1 ){
+
+            evolveFAdaptiveKernel< currentConfiguration, floatType >( Dt, _Fp, _Lp, _L, F, dFdL, dFdFp, dFdLp, nSubsteps, status,
+                                                                      alpha, tolerance, maxSubsteps );
+
+        }
+        else{
+
+            evolveFAdaptiveKernel< referenceConfiguration, floatType >( Dt, _Fp, _Lp, _L, F, dFdL, dFdFp, dFdLp, nSubsteps, status,
+                                                                        alpha, tolerance, maxSubsteps );
+
+        }
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( status == statusCode::success, statusDescription( status ) );
+
+        return NULL;
+
+    }
+
+    errorOut evolveFAdaptive( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                              floatVector &deformationGradient, unsigned int &nSubsteps, const floatType alpha, const unsigned int mode,
+                              const floatType tolerance, const unsigned int maxSubsteps ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method with adaptively sized substeps.
+         * See evolveFAdaptiveKernel for details.
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient in the current configuration (mode 1) or
+         *     reference configuration (mode 2).
+         * \param &L: The current velocity gradient in the current configuration (mode 1) or
+         *     reference configuration (mode 2).
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &nSubsteps: The number of accepted substeps. A value of one means the step was not refined.
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param mode: The mode of the ODE. See evolveF for details.
+         * \param tolerance: The tolerance on the relative error of each substep
+         * \param maxSubsteps: The maximum number of attempted (accepted and rejected) substeps
+         */
+
+        floatSecondOrderTensor F;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( evolveFAdaptiveEngine( Dt, previousDeformationGradient, Lp, L, alpha, mode, tolerance, maxSubsteps,
+                                                             F, NULL, NULL, NULL, nSubsteps ) );
+
+        deformationGradient.assign( F.begin( ), F.end( ) );
+
+        return NULL;
+
+    }
+
+    errorOut evolveFAdaptiveFlatJ( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                                   floatVector &deformationGradient, floatVector &dFdL, floatVector &dFdFp, floatVector &dFdLp,
+                                   unsigned int &nSubsteps, const floatType alpha, const unsigned int mode,
+                                   const floatType tolerance, const unsigned int maxSubsteps ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method with adaptively sized substeps
+         * and return the Jacobians chained through the substeps. See evolveFAdaptiveKernel for details.
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
+         * \param &dFdFp: The derivative of the deformation gradient w.r.t. the previous deformation gradient
+         * \param &dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient
+         * \param &nSubsteps: The number of accepted substeps. A value of one means the step was not refined.
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param mode: The mode of the ODE. See evolveF for details.
+         * \param tolerance: The tolerance on the relative error of each substep
+         * \param maxSubsteps: The maximum number of attempted (accepted and rejected) substeps
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        floatSecondOrderTensor F;
+
+        dFdL  = floatVector( sot_dim * sot_dim );
+        dFdFp = floatVector( sot_dim * sot_dim );
+        dFdLp = floatVector( sot_dim * sot_dim );
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( evolveFAdaptiveEngine( Dt, previousDeformationGradient, Lp, L, alpha, mode, tolerance, maxSubsteps,
+                                                             F, dFdL.data( ), dFdFp.data( ), dFdLp.data( ), nSubsteps ) );
+
+        deformationGradient.assign( F.begin( ), F.end( ) );
+
+        return NULL;
+
+    }
+
+    errorOut evolveF(const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                     floatVector &dF, floatVector &deformationGradient, const floatType alpha, const unsigned int mode){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method.
+         *
+         * mode 1:
+         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
+         *
+         * mode 2:
+         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient in the current configuration (mode 1) or
+         *     reference configuration (mode 2).
+         * \param &L: The current velocity gradient in the current configuration (mode 1) or
+         *     reference configuration (mode 2).
+         * \param &dF: The change in the deformation gradient \f$\Delta \bf{F}\f$ such that \f$F_{iI}^{t+1} = F_{iI}^t + \Delta F_{iI}\f$
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param alpha: The integration parameter.
+         * \param mode: The mode of the ODE. Whether the velocity gradient is known in the
+         *     current (mode 1) or reference (mode 2) configuration.
+         */
+
+        floatSecondOrderTensor _dF, F, invLHS, P;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( evolveFEngine( Dt, previousDeformationGradient, Lp, L, alpha, mode, _dF, F, invLHS, P, NULL, NULL, NULL ) );
+
+        dF.assign( _dF.begin( ), _dF.end( ) );
+
+        deformationGradient.assign( F.begin( ), F.end( ) );
+
+        return NULL;
+
+    }
+
+    errorOut evolveF(const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                     floatVector &deformationGradient, const floatType alpha, const unsigned int mode){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method.
+         *
+         * mode 1:
+         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
+         *
+         * mode 2:
+         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient in the current configuration (mode 1) or
+         *     reference configuration (mode 2).
+         * \param &L: The current velocity gradient in the current configuration (mode 1) or
+         *     reference configuration (mode 2).
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param alpha: The integration parameter.
+         * \param mode: The mode of the ODE. Whether the velocity gradient is known in the
+         *     current (mode 1) or reference (mode 2) configuration.
+         */
+
+        floatVector dF;
+
+        return evolveF( Dt, previousDeformationGradient, Lp, L, dF, deformationGradient, alpha, mode );
+
+    }
+
+    errorOut evolveF( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                      floatVector &dF, floatVector &deformationGradient, floatMatrix &dFdL, const floatType alpha, const unsigned int mode ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method and return the jacobian w.r.t. L.
+         *
+         * mode 1:
+         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
+         * \f$\frac{\partial F_{jI}^{t + 1}}{\partial L_{kl}^{t+1}} = \left[\delta_{kj} - \Delta t \left(1 - \alpha\right) L_{kj}\right]^{-1} \Delta t \left(1 - \alpha\right) F_{lI}^{t + 1}\f$
+         *
+         * mode 2:
+         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
+         * \f$\frac{\partial F_{iJ}^{t + 1}}{\partial L_{KL}} = \Delta t (1 - \alpha) F_{iK}^{t + 1} \left[\delta_{JL} - \right ]\f$
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &dF: The change in the deformation gradient \f$\Delta \bf{F}\f$ such that \f$F_{iI}^{t+1} = F_{iI}^t + \Delta F_{iI}\f$
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param mode: The form of the ODE. See above for details.
+         */
+
+        constexpr unsigned int dim = 3;
+        const unsigned int sot_dim = dim * dim;
+
+        floatVector _dFdL;
+
+        errorOut error = evolveFFlatJ( Dt, previousDeformationGradient, Lp, L, dF, deformationGradient, _dFdL, alpha, mode );
+
+        if ( error ){
+
+            errorOut result = new errorNode( __func__, "Error when computing the evolved deformation gradient" );
+            result->addNext( error );
+            return result;
+
+        }
+
+        asMatrix( _dFdL, sot_dim ).copyTo( dFdL );
+
+        return error;
+
+    }
+
+    errorOut evolveFFlatJ( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                           floatVector &dF, floatVector &deformationGradient, floatVector &dFdL, const floatType alpha, const unsigned int mode ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method and return the jacobian w.r.t. L.
+         *
+         * mode 1:
+         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
+         * \f$\frac{\partial F_{jI}^{t + 1}}{\partial L_{kl}^{t+1}} = \left[\delta_{kj} - \Delta t \left(1 - \alpha\right) L_{kj}\right]^{-1} \Delta t \left(1 - \alpha\right) F_{lI}^{t + 1}\f$
+         *
+         * mode 2:
+         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
+         * \f$\frac{\partial F_{iJ}^{t + 1}}{\partial L_{KL}} = \Delta t (1 - \alpha) F_{iK}^{t + 1} \left[\delta_{JL} - \right ]\f$
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &dF: The change in the deformation gradient \f$\Delta \bf{F}\f$ such that \f$F_{iI}^{t+1} = F_{iI}^t + \Delta F_{iI}\f$
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param mode: The form of the ODE. See above for details.
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        floatSecondOrderTensor _dF, F, invLHS, P;
+
+        dFdL = floatVector( sot_dim * sot_dim );
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( evolveFEngine( Dt, previousDeformationGradient, Lp, L, alpha, mode, _dF, F, invLHS, P, dFdL.data( ), NULL, NULL ) );
+
+        dF.assign( _dF.begin( ), _dF.end( ) );
+
+        deformationGradient.assign( F.begin( ), F.end( ) );
+
+        return NULL;
+
+    }
+
+    errorOut evolveFFlatJ( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                           floatVector &deformationGradient, floatVector &dFdL, const floatType alpha, const unsigned int mode ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method and return the jacobian w.r.t. L.
+         *
+         * mode 1:
+         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
+         * \f$\frac{\partial F_{jI}^{t + 1}}{\partial L_{kl}^{t+1}} = \left[\delta_{kj} - \Delta t \left(1 - \alpha\right) L_{kj}\right]^{-1} \Delta t \left(1 - \alpha\right) F_{lI}^{t + 1}\f$
+         *
+         * mode 2:
+         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
+         * \f$\frac{\partial F_{iJ}^{t + 1}}{\partial L_{KL}} = \Delta t (1 - \alpha) F_{iK}^{t + 1} \left[\delta_{JL} - \right ]\f$
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param mode: The form of the ODE. See above for details.
+         */
+
+        floatVector dF;
+
+        return evolveFFlatJ( Dt, previousDeformationGradient, Lp, L, dF, deformationGradient, dFdL, alpha, mode );
+
+    }
+
+    errorOut evolveF( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                      floatVector &deformationGradient, floatMatrix &dFdL, const floatType alpha, const unsigned int mode ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method and return the jacobian w.r.t. L.
+         *
+         * mode 1:
+         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
+         * \f$\frac{\partial F_{jI}^{t + 1}}{\partial L_{kl}^{t+1}} = \left[\delta_{kj} - \Delta t \left(1 - \alpha\right) L_{kj}\right]^{-1} \Delta t \left(1 - \alpha\right) F_{lI}^{t + 1}\f$
+         *
+         * mode 2:
+         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
+         * \f$\frac{\partial F_{iJ}^{t + 1}}{\partial L_{KL}} = \Delta t (1 - \alpha) F_{iK}^{t + 1} \left[\delta_{JL} - \right ]\f$
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param mode: The form of the ODE. See above for details.
+         */
+
+        floatVector dF;
+
+        return evolveF( Dt, previousDeformationGradient, Lp, L, dF, deformationGradient, dFdL, alpha, mode );
+
+    }
+
+    errorOut evolveF( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                      floatVector &dF, floatVector &deformationGradient, floatMatrix &dFdL, floatMatrix &ddFdFp, floatMatrix &dFdFp, floatMatrix &dFdLp, const floatType alpha, const unsigned int mode ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method and return the jacobian w.r.t. L.
+         *
+         * mode 1:
+         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
+         * \f$\frac{\partial F_{jI}^{t + 1}}{\partial L_{kl}^{t+1}} = \left[\delta_{kj} - \Delta t \left(1 - \alpha\right) L_{kj}\right]^{-1} \Delta t \left(1 - \alpha\right) F_{lI}^{t + 1}\f$
+         *
+         * mode 2:
+         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
+         * \f$\frac{\partial F_{iJ}^{t + 1}}{\partial L_{KL}} = \Delta t (1 - \alpha) F_{iK}^{t + 1} \left[\delta_{JL} - \right ]\f$
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &dF: The change in the deformation gradient \f$\Delta \bf{F}\f$ such that \f$F_{iI}^{t+1} = F_{iI}^t + \Delta F_{iI}\f$
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
+         * \param &ddFdFp: The derivative of the change in the deformation gradient w.r.t. the previous deformation gradient
+         * \param &dFdFp: The derivative of the deformation gradient w.r.t. the previous deformation gradient
+         * \param &dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param mode: The form of the ODE. See above for details.
+         */
+
+        //Assumes 3D
+        constexpr unsigned int dim = 3;
+        const unsigned int sot_dim = dim * dim;
+
+        floatVector _dFdL;
+        floatVector _ddFdFp;
+        floatVector _dFdFp;
+        floatVector _dFdLp;
+
+        errorOut error = evolveFFlatJ( Dt, previousDeformationGradient, Lp, L,
+                                       dF, deformationGradient, _dFdL, _ddFdFp, _dFdFp, _dFdLp, alpha, mode );
+
+        if ( error ){
+
+            errorOut result = new errorNode( __func__, "Error when computing the evolved deformation gradient" );
+            result->addNext( error );
+            return result;
+
+        }
+
+        asMatrix( _dFdL,   sot_dim ).copyTo( dFdL );
+        asMatrix( _ddFdFp, sot_dim ).copyTo( ddFdFp );
+        asMatrix( _dFdFp,  sot_dim ).copyTo( dFdFp );
+        asMatrix( _dFdLp,  sot_dim ).copyTo( dFdLp );
+
+        return error;
+
+    }
+    errorOut evolveFFlatJ( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                           floatVector &dF, floatVector &deformationGradient, floatVector &dFdL, floatVector &ddFdFp, floatVector &dFdFp, floatVector &dFdLp, const floatType alpha, const unsigned int mode ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method and return the jacobian w.r.t. L.
+         *
+         * mode 1:
+         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
+         * \f$\frac{\partial F_{jI}^{t + 1}}{\partial L_{kl}^{t+1}} = \left[\delta_{kj} - \Delta t \left(1 - \alpha\right) L_{kj}\right]^{-1} \Delta t \left(1 - \alpha\right) F_{lI}^{t + 1}\f$
+         *
+         * mode 2:
+         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
+         * \f$\frac{\partial F_{iJ}^{t + 1}}{\partial L_{KL}} = \Delta t (1 - \alpha) F_{iK}^{t + 1} \left[\delta_{JL} - \right ]\f$
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &dF: The change in the deformation gradient \f$\Delta \bf{F}\f$ such that \f$F_{iI}^{t+1} = F_{iI}^t + \Delta F_{iI}\f$
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
+         * \param &ddFdFp: The derivative of the change in the deformation gradient w.r.t. the previous deformation gradient
+         * \param &dFdFp: The derivative of the deformation gradient w.r.t. the previous deformation gradient
+         * \param &dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param mode: The form of the ODE. See above for details.
+         */
+
+        constexpr unsigned int sot_dim = 9;
+
+        floatSecondOrderTensor _dF, F, invLHS, P;
+
+        dFdL   = floatVector( sot_dim * sot_dim );
+        ddFdFp = floatVector( sot_dim * sot_dim );
+        dFdLp  = floatVector( sot_dim * sot_dim );
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( evolveFEngine( Dt, previousDeformationGradient, Lp, L, alpha, mode, _dF, F, invLHS, P,
+                                                     dFdL.data( ), ddFdFp.data( ), dFdLp.data( ) ) );
+
+        dF.assign( _dF.begin( ), _dF.end( ) );
+
+        deformationGradient.assign( F.begin( ), F.end( ) );
+
+        dFdFp = ddFdFp;
+        for ( unsigned int i = 0; i < sot_dim; i++ ){ dFdFp[ sot_dim * i + i ] += 1; }
+
+        return NULL;
+
+    }
+
+    errorOut evolveFFlatJ( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                           floatVector &deformationGradient, floatVector &dFdL, floatVector &dFdFp, floatVector &dFdLp, const floatType alpha, const unsigned int mode ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method and return the jacobian w.r.t. L.
+         *
+         * mode 1:
+         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
+         * \f$\frac{\partial F_{jI}^{t + 1}}{\partial L_{kl}^{t+1}} = \left[\delta_{kj} - \Delta t \left(1 - \alpha\right) L_{kj}\right]^{-1} \Delta t \left(1 - \alpha\right) F_{lI}^{t + 1}\f$
+         *
+         * mode 2:
+         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
+         * \f$\frac{\partial F_{iJ}^{t + 1}}{\partial L_{KL}} = \Delta t (1 - \alpha) F_{iK}^{t + 1} \left[\delta_{JL} - \right ]\f$
          *
          * \param &Dt: The change in time.
          * \param &previousDeformationGradient: The previous value of the deformation gradient
-         * \param &Lp: The previous velocity gradient in the current configuration (mode 1) or
-         *     reference configuration (mode 2).
-         * \param &L: The current velocity gradient in the current configuration (mode 1) or
-         *     reference configuration (mode 2).
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
          * \param &deformationGradient: The computed current deformation gradient.
-         * \param alpha: The integration parameter.
-         * \param mode: The mode of the ODE. Whether the velocity gradient is known in the
-         *     current (mode 1) or reference (mode 2) configuration.
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the previous deformation gradient
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the previous velocity gradient
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param mode: The form of the ODE. See above for details.
+         */
+
+        floatVector dF;
+        floatVector ddFdFp;
+
+        return evolveFFlatJ( Dt, previousDeformationGradient, Lp, L, dF, deformationGradient, dFdL, ddFdFp, dFdFp, dFdLp, alpha, mode );
+
+    }
+
+    errorOut evolveF( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                      floatVector &deformationGradient, floatMatrix &dFdL, floatMatrix &dFdFp, floatMatrix &dFdLp, const floatType alpha, const unsigned int mode ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method and return the jacobian w.r.t. L.
+         *
+         * mode 1:
+         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
+         * \f$\frac{\partial F_{jI}^{t + 1}}{\partial L_{kl}^{t+1}} = \left[\delta_{kj} - \Delta t \left(1 - \alpha\right) L_{kj}\right]^{-1} \Delta t \left(1 - \alpha\right) F_{lI}^{t + 1}\f$
+         *
+         * mode 2:
+         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
+         * \f$\frac{\partial F_{iJ}^{t + 1}}{\partial L_{KL}} = \Delta t (1 - \alpha) F_{iK}^{t + 1} \left[\delta_{JL} - \right ]\f$
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the previous deformation gradient
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the previous velocity gradient
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param mode: The form of the ODE. See above for details.
+         */
+
+        floatVector dF;
+        floatMatrix ddFdFp;
+
+        return evolveF( Dt, previousDeformationGradient, Lp, L, dF, deformationGradient, dFdL, ddFdFp, dFdFp, dFdLp, alpha, mode );
+
+    }
+
+    errorOut evolveFJvp( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                         const floatVector &deltaL, floatVector &deformationGradient, floatVector &deltaF,
+                         const floatType alpha, const unsigned int mode ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method and apply the Jacobian w.r.t. L
+         * to one or more directions without forming the Jacobian.
+         *
+         * mode 1:
+         * \f$\delta F^{t+1} = \Delta t \left(1 - \alpha\right) M \delta L F^{t+1}\f$
+         *
+         * mode 2:
+         * \f$\delta F^{t+1} = \Delta t \left(1 - \alpha\right) F^{t+1} \delta L M\f$
+         *
+         * where \f$M = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1}\f$
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &deltaL: The directions in which to perturb the velocity gradient. Several directions may be
+         *     stacked one after the other (9 values per direction).
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &deltaF: The directional derivatives of the deformation gradient (9 values per direction)
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param mode: The form of the ODE. See evolveF for details.
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( ( deltaL.size( ) % sot_dim ) == 0, "The velocity gradient directions must have 9 values per direction" );
+
+        floatSecondOrderTensor _dF, F, invLHS, P;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( evolveFEngine( Dt, previousDeformationGradient, Lp, L, alpha, mode, _dF, F, invLHS, P, NULL, NULL, NULL ) );
+
+        deformationGradient.assign( F.begin( ), F.end( ) );
+
+        deltaF.resize( deltaL.size( ) );
+
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F_map( F.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > M( invLHS.data( ) );
+
+        for ( unsigned int d = 0; d < deltaL.size( ) / sot_dim; d++ ){
+
+            Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > dL( deltaL.data( ) + sot_dim * d );
+            Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > dF( deltaF.data( ) + sot_dim * d );
+
+            if ( mode == 1 ){
+
+                dF = Dt * ( 1 - alpha ) * M * ( dL * F_map );
+
+            }
+            else{
+
+                dF = Dt * ( 1 - alpha ) * ( F_map * dL ) * M;
+
+            }
+
+        }
+
+        return NULL;
+
+    }
+
+    errorOut evolveFJvp( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                         const floatVector &deltaL, const floatVector &deltaFp, const floatVector &deltaLp,
+                         floatVector &deformationGradient, floatVector &deltaF, const floatType alpha, const unsigned int mode ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method and apply the Jacobians w.r.t.
+         * L, the previous deformation gradient, and the previous velocity gradient to one or more directions without
+         * forming the Jacobians.
+         *
+         * mode 1:
+         * \f$\delta F^{t+1} = M \left[ \Delta t \left(1 - \alpha\right) \delta L F^{t+1} + \Delta t \alpha \delta L^{t} F^{t} + P \delta F^{t} \right]\f$
+         *
+         * mode 2:
+         * \f$\delta F^{t+1} = \left[ \Delta t \left(1 - \alpha\right) F^{t+1} \delta L + \Delta t \alpha F^{t} \delta L^{t} + \delta F^{t} P \right] M\f$
+         *
+         * where \f$M = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1}\f$ and
+         * \f$P = \delta_{ij} + \Delta t \alpha L_{ij}^{t}\f$
+         *
+         * The directional derivative of the change in the deformation gradient is \f$\delta F^{t+1} - \delta F^{t}\f$.
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &deltaL: The directions in which to perturb the velocity gradient. Several directions may be
+         *     stacked one after the other (9 values per direction).
+         * \param &deltaFp: The directions in which to perturb the previous deformation gradient (9 values per direction)
+         * \param &deltaLp: The directions in which to perturb the previous velocity gradient (9 values per direction)
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &deltaF: The directional derivatives of the deformation gradient (9 values per direction)
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param mode: The form of the ODE. See evolveF for details.
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( ( deltaL.size( ) % sot_dim ) == 0, "The velocity gradient directions must have 9 values per direction" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( deltaFp.size( ) == deltaL.size( ), "The previous deformation gradient directions must be the same size as the velocity gradient directions" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( deltaLp.size( ) == deltaL.size( ), "The previous velocity gradient directions must be the same size as the velocity gradient directions" );
+
+        floatSecondOrderTensor _dF, F, invLHS, P;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( evolveFEngine( Dt, previousDeformationGradient, Lp, L, alpha, mode, _dF, F, invLHS, P, NULL, NULL, NULL ) );
+
+        deformationGradient.assign( F.begin( ), F.end( ) );
+
+        deltaF.resize( deltaL.size( ) );
+
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F_map( F.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > Fp( previousDeformationGradient.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > M( invLHS.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > P_map( P.data( ) );
+
+        for ( unsigned int d = 0; d < deltaL.size( ) / sot_dim; d++ ){
+
+            Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > dL( deltaL.data( ) + sot_dim * d );
+            Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > dFp( deltaFp.data( ) + sot_dim * d );
+            Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > dLp( deltaLp.data( ) + sot_dim * d );
+            Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > dF( deltaF.data( ) + sot_dim * d );
+
+            if ( mode == 1 ){
+
+                dF = M * ( Dt * ( 1 - alpha ) * dL * F_map + Dt * alpha * dLp * Fp + P_map * dFp );
+
+            }
+            else{
+
+                dF = ( Dt * ( 1 - alpha ) * F_map * dL + Dt * alpha * Fp * dLp + dFp * P_map ) * M;
+
+            }
+
+        }
+
+        return NULL;
+
+    }
+
+    errorOut evolveFVjp( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                         const floatVector &v, floatVector &deformationGradient, floatVector &vdFdL,
+                         const floatType alpha, const unsigned int mode ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method and contract one or more
+         * vectors with the Jacobian w.r.t. L from the left without forming the Jacobian.
+         *
+         * mode 1:
+         * \f$v_{ij} \frac{\partial F_{ij}^{t+1}}{\partial L_{kl}} = \Delta t \left(1 - \alpha\right) \left( M^T v F^{t+1,T} \right)_{kl}\f$
+         *
+         * mode 2:
+         * \f$v_{ij} \frac{\partial F_{ij}^{t+1}}{\partial L_{kl}} = \Delta t \left(1 - \alpha\right) \left( F^{t+1,T} v M^T \right)_{kl}\f$
+         *
+         * where \f$M = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1}\f$
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &v: The vectors to contract with the Jacobian. Several vectors may be stacked one after the other
+         *     (9 values per vector).
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &vdFdL: The vector-Jacobian products w.r.t. the velocity gradient (9 values per vector)
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param mode: The form of the ODE. See evolveF for details.
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( ( v.size( ) % sot_dim ) == 0, "The vectors must have 9 values per vector" );
+
+        floatSecondOrderTensor _dF, F, invLHS, P;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( evolveFEngine( Dt, previousDeformationGradient, Lp, L, alpha, mode, _dF, F, invLHS, P, NULL, NULL, NULL ) );
+
+        deformationGradient.assign( F.begin( ), F.end( ) );
+
+        vdFdL.resize( v.size( ) );
+
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F_map( F.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > M( invLHS.data( ) );
+
+        for ( unsigned int d = 0; d < v.size( ) / sot_dim; d++ ){
+
+            Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > v_map( v.data( ) + sot_dim * d );
+            Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > vdFdL_map( vdFdL.data( ) + sot_dim * d );
+
+            if ( mode == 1 ){
+
+                vdFdL_map = Dt * ( 1 - alpha ) * M.transpose( ) * ( v_map * F_map.transpose( ) );
+
+            }
+            else{
+
+                vdFdL_map = Dt * ( 1 - alpha ) * ( F_map.transpose( ) * v_map ) * M.transpose( );
+
+            }
+
+        }
+
+        return NULL;
+
+    }
+
+    errorOut evolveFVjp( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                         const floatVector &v, floatVector &deformationGradient, floatVector &vdFdL, floatVector &vdFdFp, floatVector &vdFdLp,
+                         const floatType alpha, const unsigned int mode ){
+        /*!
+         * Evolve the deformation gradient ( F ) using the midpoint integration method and contract one or more
+         * vectors with the Jacobians w.r.t. L, the previous deformation gradient, and the previous velocity
+         * gradient from the left without forming the Jacobians.
+         *
+         * mode 1:
+         * \f$v:\frac{\partial F^{t+1}}{\partial L} = \Delta t \left(1 - \alpha\right) M^T v F^{t+1,T}\f$
+         * \f$v:\frac{\partial F^{t+1}}{\partial F^{t}} = P^T M^T v\f$
+         * \f$v:\frac{\partial F^{t+1}}{\partial L^{t}} = \Delta t \alpha M^T v F^{t,T}\f$
+         *
+         * mode 2:
+         * \f$v:\frac{\partial F^{t+1}}{\partial L} = \Delta t \left(1 - \alpha\right) F^{t+1,T} v M^T\f$
+         * \f$v:\frac{\partial F^{t+1}}{\partial F^{t}} = v M^T P^T\f$
+         * \f$v:\frac{\partial F^{t+1}}{\partial L^{t}} = \Delta t \alpha F^{t,T} v M^T\f$
+         *
+         * where \f$M = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1}\f$ and
+         * \f$P = \delta_{ij} + \Delta t \alpha L_{ij}^{t}\f$
+         *
+         * \param &Dt: The change in time.
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous velocity gradient.
+         * \param &L: The current velocity gradient.
+         * \param &v: The vectors to contract with the Jacobians. Several vectors may be stacked one after the other
+         *     (9 values per vector).
+         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &vdFdL: The vector-Jacobian products w.r.t. the velocity gradient (9 values per vector)
+         * \param &vdFdFp: The vector-Jacobian products w.r.t. the previous deformation gradient (9 values per vector)
+         * \param &vdFdLp: The vector-Jacobian products w.r.t. the previous velocity gradient (9 values per vector)
+         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
+         * \param mode: The form of the ODE. See evolveF for details.
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( ( v.size( ) % sot_dim ) == 0, "The vectors must have 9 values per vector" );
+
+        floatSecondOrderTensor _dF, F, invLHS, P;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( evolveFEngine( Dt, previousDeformationGradient, Lp, L, alpha, mode, _dF, F, invLHS, P, NULL, NULL, NULL ) );
+
+        deformationGradient.assign( F.begin( ), F.end( ) );
+
+        vdFdL.resize( v.size( ) );
+
+        vdFdFp.resize( v.size( ) );
+
+        vdFdLp.resize( v.size( ) );
+
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F_map( F.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > Fp( previousDeformationGradient.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > M( invLHS.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > P_map( P.data( ) );
+
+        for ( unsigned int d = 0; d < v.size( ) / sot_dim; d++ ){
+
+            Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > v_map( v.data( ) + sot_dim * d );
+            Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > vdFdL_map( vdFdL.data( ) + sot_dim * d );
+            Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > vdFdFp_map( vdFdFp.data( ) + sot_dim * d );
+            Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > vdFdLp_map( vdFdLp.data( ) + sot_dim * d );
+
+            if ( mode == 1 ){
+
+                const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > MTv = M.transpose( ) * v_map;
+
+                vdFdL_map  = Dt * ( 1 - alpha ) * MTv * F_map.transpose( );
+
+                vdFdFp_map = P_map.transpose( ) * MTv;
+
+                vdFdLp_map = Dt * alpha * MTv * Fp.transpose( );
+
+            }
+            else{
+
+                const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > vMT = v_map * M.transpose( );
+
+                vdFdL_map  = Dt * ( 1 - alpha ) * F_map.transpose( ) * vMT;
+
+                vdFdFp_map = vMT * P_map.transpose( );
+
+                vdFdLp_map = Dt * alpha * Fp.transpose( ) * vMT;
+
+            }
+
+        }
+
+        return NULL;
+
+    }
+
+    floatType mac(const floatType &x){
+        /*!
+         * Compute the Macaulay brackets of a scalar x
+         *
+         * returns x if x>0, 0 otherwise
+         *
+         * \param &x: The incoming scalar.
+         */
+
+        return 0.5 * ( fabs( x ) + x );
+    }
+
+    floatType mac( const floatType &x, floatType &dmacdx ){
+        /*!
+         * Compute the Macaulay brackets of the scalar x and
+         * return the jacobian as well.
+         * 
+         * returns x if x>0, 0 otherwise
+         * 
+         * The Jacobian is the Heaviside function
+         * 
+         * \param &x: The incoming scalar
+         * \param &dmacdx: The returned jacobian
+         */
+
+        dmacdx = 0;
+        if ( x >= 0 ){ dmacdx = 1; }
+        return mac( x );
+    }
+
+    errorOut computeUnitNormal(const floatVector &A, floatVector &Anorm){
+        /*!
+         * Compute the unit normal of a second order tensor (or strictly speaking
+         * any tensor).
+         *
+         * \param &A: The second order tensor
+         * \param &Anorm: The unit normal in the direction of A
+         */
+
+        const unsigned int A_size = A.size( );
+
+        floatType norm = sqrt(tardigradeVectorTools::inner(A, A));
+
+        if ( tardigradeVectorTools::fuzzyEquals( norm, 0. ) ){
+            Anorm = floatVector( A_size, 0 );
+        }
+        else {
+            Anorm = A/norm;
+        }
+
+        return NULL;
+    }
+
+    errorOut computeUnitNormal(const floatVector &A, floatVector &Anorm, floatVector &dAnormdA){
+        /*!
+         * Compute the unit normal of a second order tensor (or strictly speaking any
+         * tensor) and the gradient of that unit normal w.r.t. the tensor.
+         *
+         * \param &A: The second order tensor
+         * \param &Anorm: The unit normal in the direction of A
+         * \param &dAnormdA: The gradient of the unit normal w.r.t. A
+         */
+
+        const unsigned int A_size = A.size( );
+
+        floatType norm = sqrt(tardigradeVectorTools::inner(A, A));
+
+        if ( tardigradeVectorTools::fuzzyEquals( norm, 0. ) ){
+            Anorm = floatVector( A_size, 0 );
+        }
+        else {
+            Anorm = A/norm;
+        }
+
+        dAnormdA = floatVector( A_size * A_size, 0 );
+
+        for ( unsigned int i = 0; i < A_size; i++ ){
+
+            dAnormdA[ A_size * i + i ] += 1;
+
+            for ( unsigned int j = 0; j < A_size; j++ ){
+
+                dAnormdA[ A_size * i + j ] -= Anorm[ i ] * Anorm[ j ];
+
+            }
+
+        }
+
+        dAnormdA /= norm;
+
+        return NULL;
+    }
+
+    errorOut computeUnitNormal(const floatVector &A, floatVector &Anorm, floatMatrix &dAnormdA){
+        /*!
+         * Compute the unit normal of a second order tensor (or strictly speaking any
+         * tensor) and the gradient of that unit normal w.r.t. the tensor.
+         *
+         * \param &A: The second order tensor
+         * \param &Anorm: The unit normal in the direction of A
+         * \param &dAnormdA: The gradient of the unit normal w.r.t. A
+         */
+
+        const unsigned int A_size = A.size( );
+
+        floatVector _dAnormdA;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( computeUnitNormal( A, Anorm, _dAnormdA ) );
+
+        asMatrix( _dAnormdA, A_size ).copyTo( dAnormdA );
+
+        return NULL;
+    }
+
+    errorOut pullBackVelocityGradient(const floatVector &velocityGradient, const floatVector &deformationGradient,
+                                      floatVector &pulledBackVelocityGradient){
+        /*!
+         * Pull back the velocity gradient to the configuration indicated by deformationGradient, i.e.
+         *
+         * \f$totalDeformationGradient_{iI} = deformationGradient_{i \bar{I}} remainingDeformationGradient_{\bar{I}I}\f$
+         *
+         * This is done via
+         *
+         * \f$L_{\bar{I} \bar{J}} = deformationGradient_{\bar{I} i}^{-1} velocityGradient_{ij} deformationGradient_{j\bar{J}}\f$
+         *
+         * \param &velocityGradient: The velocity gradient in the current configuration.
+         * \param &deformationGradient: The deformation gradient between the desired configuration
+         *     and the current configuration.
+         * \param &pulledBackVelocityGradient: The pulled back velocity gradient.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pullBackVelocityGradient( velocityGradient, KinematicState( deformationGradient ), pulledBackVelocityGradient ) )
+
+        return NULL;
+    }
+
+    errorOut pullBackVelocityGradient(const floatVector &velocityGradient, const floatVector &deformationGradient,
+                                      floatVector &pulledBackVelocityGradient, floatVector &dPullBackLdL,
+                                      floatVector &dPullBackLdF){
+        /*!
+         * Pull back the velocity gradient to the configuration indicated by deformationGradient, i.e.
+         *
+         * \f$totalDeformationGradient_{iI} = deformationGradient_{i \bar{I}} remainingDeformationGradient_{\bar{I}I}\f$
+         *
+         * This is done via
+         *
+         * \f$L_{\bar{I} \bar{J}} = deformationGradient_{\bar{I} i}^{-1} velocityGradient_{ij} deformationGradient_{j\bar{J}}\f$
+         *
+         * \param &velocityGradient: The velocity gradient in the current configuration.
+         * \param &deformationGradient: The deformation gradient between the desired configuration
+         *     and the current configuration.
+         * \param &pulledBackVelocityGradient: The pulled back velocity gradient.
+         * \param &dPullBackLdL: The gradient of the pulled back velocity gradient
+         *     w.r.t. the velocity gradient.
+         * \param &dPullBackLdF: The gradient of the pulled back velocity gradient
+         *     w.r.t. the deformation gradient.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pullBackVelocityGradient( velocityGradient, KinematicState( deformationGradient ), pulledBackVelocityGradient, dPullBackLdL, dPullBackLdF ) )
+
+        return NULL;
+    }
+
+    errorOut pullBackVelocityGradient(const floatVector &velocityGradient, const floatVector &deformationGradient,
+                                      floatVector &pulledBackVelocityGradient, floatMatrix &dPullBackLdL,
+                                      floatMatrix &dPullBackLdF){
+        /*!
+         * Pull back the velocity gradient to the configuration indicated by deformationGradient, i.e.
+         *
+         * \f$totalDeformationGradient_{iI} = deformationGradient_{i \bar{I}} remainingDeformationGradient_{\bar{I}I}\f$
+         *
+         * This is done via
+         *
+         * \f$L_{\bar{I} \bar{J}} = deformationGradient_{\bar{I} i}^{-1} velocityGradient_{ij} deformationGradient_{j\bar{J}}\f$
+         *
+         * \param &velocityGradient: The velocity gradient in the current configuration.
+         * \param &deformationGradient: The deformation gradient between the desired configuration
+         *     and the current configuration.
+         * \param &pulledBackVelocityGradient: The pulled back velocity gradient.
+         * \param &dPullBackLdL: The gradient of the pulled back velocity gradient
+         *     w.r.t. the velocity gradient.
+         * \param &dPullBackLdF: The gradient of the pulled back velocity gradient
+         *     w.r.t. the deformation gradient.
+         */
+
+        //Assume 3D
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        floatVector _dPullBackLdL, _dPullBackLdF;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pullBackVelocityGradient( velocityGradient, deformationGradient, pulledBackVelocityGradient, _dPullBackLdL, _dPullBackLdF ) );
+
+        asMatrix( _dPullBackLdL, sot_dim ).copyTo( dPullBackLdL );
+
+        asMatrix( _dPullBackLdF, sot_dim ).copyTo( dPullBackLdF );
+
+        return NULL;
+    }
+
+    errorOut pullBackVelocityGradient( const floatVector &velocityGradient, const KinematicState &kinematics,
+                                       floatVector &pulledBackVelocityGradient ){
+        /*!
+         * Pull back the velocity gradient to the configuration indicated by the kinematic state of
+         * deformationGradient, i.e.
+         *
+         * \f$L_{\bar{I} \bar{J}} = deformationGradient_{\bar{I} i}^{-1} velocityGradient_{ij} deformationGradient_{j\bar{J}}\f$
+         *
+         * The cached inverse of the deformation gradient is used.
+         *
+         * \param &velocityGradient: The velocity gradient in the current configuration.
+         * \param &kinematics: The kinematic state of the deformation gradient between the desired configuration
+         *     and the current configuration.
+         * \param &pulledBackVelocityGradient: The pulled back velocity gradient.
+         */
+
+        //Assume 3D
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( velocityGradient.size( ) == sot_dim, "The velocity gradient must be a second order tensor of size " + std::to_string( sot_dim ) + " and it has " + std::to_string( velocityGradient.size( ) ) + " elements" );
+
+        pulledBackVelocityGradient = floatVector( sot_dim, 0 );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F( kinematics.deformationGradient( ).data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > invF( kinematics.inverse( ).data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > L( velocityGradient.data( ) );
+        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > pullBackL( pulledBackVelocityGradient.data( ) );
+
+        pullBackL = ( invF * L * F ).eval( );
+
+        return NULL;
+    }
+
+    errorOut pullBackVelocityGradient( const floatVector &velocityGradient, const KinematicState &kinematics,
+                                       floatVector &pulledBackVelocityGradient, floatVector &dPullBackLdL,
+                                       floatVector &dPullBackLdF ){
+        /*!
+         * Pull back the velocity gradient to the configuration indicated by the kinematic state of
+         * deformationGradient, i.e.
+         *
+         * \f$L_{\bar{I} \bar{J}} = deformationGradient_{\bar{I} i}^{-1} velocityGradient_{ij} deformationGradient_{j\bar{J}}\f$
+         *
+         * The cached inverse of the deformation gradient is used.
+         *
+         * \param &velocityGradient: The velocity gradient in the current configuration.
+         * \param &kinematics: The kinematic state of the deformation gradient between the desired configuration
+         *     and the current configuration.
+         * \param &pulledBackVelocityGradient: The pulled back velocity gradient.
+         * \param &dPullBackLdL: The gradient of the pulled back velocity gradient
+         *     w.r.t. the velocity gradient.
+         * \param &dPullBackLdF: The gradient of the pulled back velocity gradient
+         *     w.r.t. the deformation gradient.
+         */
+
+        //Assume 3D
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( velocityGradient.size( ) == sot_dim, "The velocity gradient must be a second order tensor of size " + std::to_string( sot_dim ) + " and it has " + std::to_string( velocityGradient.size( ) ) + " elements" );
+
+        const floatSecondOrderTensor &deformationGradient = kinematics.deformationGradient( );
+        const floatSecondOrderTensor &inverseDeformationGradient = kinematics.inverse( );
+
+        pulledBackVelocityGradient = floatVector( sot_dim, 0 );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F( deformationGradient.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > invF( inverseDeformationGradient.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > L( velocityGradient.data( ) );
+        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > pullBackL( pulledBackVelocityGradient.data( ) );
+
+        floatSecondOrderTensor term2;
+        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > term2_map( term2.data( ) );
+
+        term2_map = ( invF * L ).eval( );
+
+        //Pull back the velocity gradient
+        pullBackL = ( term2_map * F ).eval( );
+
+        //Construct the gradients
+        dPullBackLdL = floatVector( sot_dim * sot_dim, 0 );
+        dPullBackLdF = floatVector( sot_dim * sot_dim, 0 );
+
+        for (unsigned int I=0; I<dim; I++){
+            for (unsigned int J=0; J<dim; J++){
+                for (unsigned int k=0; k<dim; k++){
+                    for (unsigned int l=0; l<dim; l++){
+                        dPullBackLdL[sot_dim * dim * I + sot_dim * J + dim * k + l ] = inverseDeformationGradient[dim*I + k] * deformationGradient[dim*l + J];
+                    }
+
+                    dPullBackLdF[sot_dim * dim * I + sot_dim * J + dim * k + J ] += term2[dim*I + k];
+
+                    for ( unsigned int K = 0; K < dim; K++ ){
+                        dPullBackLdF[sot_dim * dim * I + sot_dim * J + dim * k + K ] -= inverseDeformationGradient[dim*I + k] * pulledBackVelocityGradient[dim*K + J];
+                    }
+                }
+            }
+        }
+
+        return NULL;
+    }
+
+    errorOut quadraticThermalExpansion(const floatType &temperature, const floatType &referenceTemperature,
+                                       const floatVector &linearParameters, const floatVector &quadraticParameters,
+                                       floatVector &thermalExpansion){
+        /*!
+         * Define a quadratic equation for the thermal expansion. This could be the
+         * thermal strain or the value of the stretch tensor.
+         * 
+         * \f$ e^{\theta}_{ij} = a_{ij} \left(\theta - \theta_0\right) + b_{ij} \left(\theta^2 - \theta_0^2\right)\f$
+         * 
+         * Where \f$e^{\theta}_{ij}\f$ is the thermal expansion, \f$a_{ij}\f$ are the linear parameters,
+         * \f$b_{ij}\f$ are the quadratic parameters, \f$\theta\f$ is the current temperature, and \f$\theta_0\f$
+         * is the reference temperature.
+         *
+         * \param &temperature: The temperature
+         * \param &referenceTemperature: The reference temperature
+         * \param &linearParameters: The linear thermal expansion parameters.
+         * \param &quadraticParameters: The quadratic thermal expansion parameters.
+         * \param &thermalExpansion: The resulting thermal expansion.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( linearParameters.size() == quadraticParameters.size(), "The linear and quadratic parameters must have the same length");
+
+        thermalExpansion = linearParameters * temperature          + quadraticParameters * temperature * temperature
+                         - linearParameters * referenceTemperature - quadraticParameters * referenceTemperature * referenceTemperature;
+
+        return NULL;
+    }
+
+    errorOut quadraticThermalExpansion(const floatType &temperature, const floatType &referenceTemperature,
+                                       const floatVector &linearParameters, const floatVector &quadraticParameters,
+                                       floatVector &thermalExpansion, floatVector &thermalExpansionJacobian){
+        /*!
+         * Define a quadratic equation for the thermal expansion. This could be the
+         * thermal strain or the value of the stretch tensor.
+         * 
+         * \f$ e^{\theta}_{ij} = a_{ij} \left(\theta - \theta_0\right) + b_{ij} \left(\theta^2 - \theta_0^2\right)\f$
+         * 
+         * Where \f$e^{\theta}_{ij}\f$ is the thermal expansion, \f$a_{ij}\f$ are the linear parameters,
+         * \f$b_{ij}\f$ are the quadratic parameters, \f$\theta\f$ is the current temperature, and \f$\theta_0\f$
+         * is the reference temperature.
+         *
+         * \param &temperature: The temperature
+         * \param &referenceTemperature: The reference temperature
+         * \param &linearParameters: The linear thermal expansion parameters.
+         * \param &quadraticParameters: The quadratic thermal expansion parameters.
+         * \param &thermalExpansion: The resulting thermal expansion.
+         * \param &thermalExpansionJacobian: The gradient of the thermal expansion w.r.t.
+         *     the temperature.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( quadraticThermalExpansion(temperature, referenceTemperature, linearParameters, quadraticParameters,
+                                                                thermalExpansion) )
+
+        thermalExpansionJacobian = linearParameters + 2 * quadraticParameters * temperature;
+
+        return NULL;
+    }
+
+    errorOut pushForwardGreenLagrangeStrain(const floatVector &greenLagrangeStrain, const floatVector &deformationGradient,
+                                            floatVector &almansiStrain){
+        /*!
+         * Push forward the Green-Lagrange strain to the current configuration.
+         *
+         * \f$e_{ij} = F_{Ii}^{-1} E_{IJ} F_{Jj}^{-1}\f$
+         *
+         * where \f$e_{ij}\f$ is the Almansi strain (the strain in the current configuration, \f$F_{iI}^{-1}\f$ is the
+         * inverse of the deformation gradient, and \f$E_{IJ}\f$ is the Green-Lagrange strain.
+         *
+         * \param &greenLagrangeStrain: The Green-Lagrange strain.
+         * \param &deformationGradient: The deformation gradient mapping between configurations.
+         * \param &almansiStrain: The strain in the current configuration indicated by the deformation gradient.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pushForwardGreenLagrangeStrain( greenLagrangeStrain, KinematicState( deformationGradient ), almansiStrain ) )
+
+        return NULL;
+    }
+
+    errorOut pushForwardGreenLagrangeStrain(const floatVector &greenLagrangeStrain, const floatVector &deformationGradient,
+                                            floatVector &almansiStrain, floatVector &dAlmansiStraindE, floatVector &dAlmansiStraindF){
+        /*!
+         * Push forward the Green-Lagrange strain to the current configuration
+         * and return the jacobians.
+         *
+         * \f$e_{ij} = F_{Ii}^{-1} E_{IJ} F_{Jj}^{-1}\f$
+         *
+         * \f$\frac{\partial e_{ij}}{\partial E_{KL}} = F_{Ki}^{-1} F_{Kj}^{-1}\f$
+         *
+         * \f$\frac{\partial e_{ij}}{\partial F_{kK}} = -F_{Ik}^{-1} F_{Ki}^{-1} E_{IJ} F_{J j}^{-1} - F_{Ii}^{-1} E_{IJ} F_{Jk}^{-1} F_{Kj}^{-1}\f$
+         *
+         * where \f$e_{ij}\f$ is the Almansi strain (the strain in the current configuration, \f$F_{iI}^{-1}\f$ is the
+         * inverse of the deformation gradient, and \f$E_{IJ}\f$ is the Green-Lagrange strain.
+         *
+         * \param &greenLagrangeStrain: The Green-Lagrange strain.
+         * \param &deformationGradient: The deformation gradient mapping between configurations.
+         * \param &almansiStrain: The strain in the current configuration indicated by the deformation gradient.
+         * \param &dAlmansiStraindE: Compute the derivative of the Almansi strain w.r.t. the Green-Lagrange strain.
+         * \param &dAlmansiStraindF: Compute the derivative of the Almansi strain w.r.t. the deformation gradient.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pushForwardGreenLagrangeStrain( greenLagrangeStrain, KinematicState( deformationGradient ), almansiStrain, dAlmansiStraindE, dAlmansiStraindF ) )
+
+        return NULL;
+    }
+
+    errorOut pushForwardGreenLagrangeStrain(const floatVector &greenLagrangeStrain, const floatVector &deformationGradient,
+                                            floatVector &almansiStrain, floatMatrix &dAlmansiStraindE, floatMatrix &dAlmansiStraindF){
+        /*!
+         * Push forward the Green-Lagrange strain to the current configuration
+         * and return the jacobians.
+         *
+         * \f$e_{ij} = F_{Ii}^{-1} E_{IJ} F_{Jj}^{-1}\f$
+         *
+         * \f$\frac{\partial e_{ij}}{\partial E_{KL}} = F_{Ki}^{-1} F_{Kj}^{-1}\f$
+         *
+         * \f$\frac{\partial e_{ij}}{\partial F_{kK}} = -F_{Ik}^{-1} F_{Ki}^{-1} E_{IJ} F_{J j}^{-1} - F_{Ii}^{-1} E_{IJ} F_{Jk}^{-1} F_{Kj}^{-1}\f$
+         *
+         * where \f$e_{ij}\f$ is the Almansi strain (the strain in the current configuration, \f$F_{iI}^{-1}\f$ is the
+         * inverse of the deformation gradient, and \f$E_{IJ}\f$ is the Green-Lagrange strain.
+         *
+         * \param &greenLagrangeStrain: The Green-Lagrange strain.
+         * \param &deformationGradient: The deformation gradient mapping between configurations.
+         * \param &almansiStrain: The strain in the current configuration indicated by the deformation gradient.
+         * \param &dAlmansiStraindE: Compute the derivative of the Almansi strain w.r.t. the Green-Lagrange strain.
+         * \param &dAlmansiStraindF: Compute the derivative of the Almansi strain w.r.t. the deformation gradient.
+         */
+
+        //Assume 3D
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        floatVector _dAlmansiStraindE, _dAlmansiStraindF;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pushForwardGreenLagrangeStrain( greenLagrangeStrain, deformationGradient, almansiStrain, _dAlmansiStraindE, _dAlmansiStraindF ) );
+
+        asMatrix( _dAlmansiStraindE, sot_dim ).copyTo( dAlmansiStraindE );
+        asMatrix( _dAlmansiStraindF, sot_dim ).copyTo( dAlmansiStraindF );
+
+        return NULL;
+
+    }
+
+    errorOut pushForwardGreenLagrangeStrain( const floatVector &greenLagrangeStrain, const KinematicState &kinematics,
+                                             floatVector &almansiStrain ){
+        /*!
+         * Push forward the Green-Lagrange strain to the current configuration using the cached inverse of the
+         * deformation gradient.
+         *
+         * \f$e_{ij} = F_{Ii}^{-1} E_{IJ} F_{Jj}^{-1}\f$
+         *
+         * \param &greenLagrangeStrain: The Green-Lagrange strain.
+         * \param &kinematics: The kinematic state of the deformation gradient mapping between configurations.
+         * \param &almansiStrain: The strain in the current configuration indicated by the deformation gradient.
+         */
+
+        //Assume 3D
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( greenLagrangeStrain.size( ) == sot_dim, "The Green-Lagrange strain must be a second order tensor of size " + std::to_string( sot_dim ) + " and it has " + std::to_string( greenLagrangeStrain.size( ) ) + " elements" );
+
+        almansiStrain = floatVector( sot_dim, 0 );
+
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > invF( kinematics.inverse( ).data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > E( greenLagrangeStrain.data( ) );
+        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > e( almansiStrain.data( ) );
+
+        //Map the Green-Lagrange strain to the current configuration
+        e = ( invF.transpose( ) * E * invF ).eval( );
+
+        return NULL;
+    }
+
+    errorOut pushForwardGreenLagrangeStrain( const floatVector &greenLagrangeStrain, const KinematicState &kinematics,
+                                             floatVector &almansiStrain, floatVector &dAlmansiStraindE, floatVector &dAlmansiStraindF ){
+        /*!
+         * Push forward the Green-Lagrange strain to the current configuration using the cached inverse of the
+         * deformation gradient and return the jacobians.
+         *
+         * \f$e_{ij} = F_{Ii}^{-1} E_{IJ} F_{Jj}^{-1}\f$
+         *
+         * \f$\frac{\partial e_{ij}}{\partial E_{KL}} = F_{Ki}^{-1} F_{Kj}^{-1}\f$
+         *
+         * \f$\frac{\partial e_{ij}}{\partial F_{kK}} = -F_{Ik}^{-1} F_{Ki}^{-1} E_{IJ} F_{J j}^{-1} - F_{Ii}^{-1} E_{IJ} F_{Jk}^{-1} F_{Kj}^{-1}\f$
+         *
+         * \param &greenLagrangeStrain: The Green-Lagrange strain.
+         * \param &kinematics: The kinematic state of the deformation gradient mapping between configurations.
+         * \param &almansiStrain: The strain in the current configuration indicated by the deformation gradient.
+         * \param &dAlmansiStraindE: Compute the derivative of the Almansi strain w.r.t. the Green-Lagrange strain.
+         * \param &dAlmansiStraindF: Compute the derivative of the Almansi strain w.r.t. the deformation gradient.
+         */
+
+        //Assume 3D
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pushForwardGreenLagrangeStrain( greenLagrangeStrain, kinematics, almansiStrain ) )
+
+        const floatSecondOrderTensor &inverseDeformationGradient = kinematics.inverse( );
+
+        //Compute the jacobians
+        dAlmansiStraindE = floatVector( sot_dim * sot_dim, 0 );
+        dAlmansiStraindF = floatVector( sot_dim * sot_dim, 0 );
+        for (unsigned int i=0; i<dim; i++){
+            for (unsigned int j=0; j<dim; j++){
+                for (unsigned int K=0; K<dim; K++){
+                    for (unsigned int L=0; L<dim; L++){
+                        dAlmansiStraindE[sot_dim * dim * i + sot_dim * j + dim * K + L ] = inverseDeformationGradient[dim*K + i] *
+                                                                                           inverseDeformationGradient[dim*L + j];
+                        dAlmansiStraindF[sot_dim * dim * i + sot_dim * j + dim * K + L ] = -inverseDeformationGradient[dim*L + i ] * almansiStrain[dim*K+j]
+                                                                                           -inverseDeformationGradient[dim*L + j ] * almansiStrain[dim*i+K];
+                    }
+                }
+            }
+        }
+
+        return NULL;
+    }
+
+    errorOut pullBackAlmansiStrain( const floatVector &almansiStrain, const floatVector &deformationGradient,
+                                    floatVector &greenLagrangeStrain ){
+        /*!
+         * Pull back the almansi strain to the configuration indicated by the deformation gradient.
+         *
+         * \param &almansiStrain: The strain in the deformation gradient's current configuration.
+         * \param &deformationGradient: The deformation gradient between configurations.
+         * \param &greenLagrangeStrain: The Green-Lagrange strain which corresponds to the reference
+         *     configuration of the deformation gradient.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pullBackAlmansiStrain( almansiStrain, KinematicState( deformationGradient ), greenLagrangeStrain ) )
+
+        return NULL;
+    }
+
+    errorOut pullBackAlmansiStrain( const floatVector &almansiStrain, const floatVector &deformationGradient,
+                                    floatVector &greenLagrangeStrain, floatVector &dEde, floatVector &dEdF ){
+        /*!
+         * Pull back the almansi strain to the configuration indicated by the deformation gradient.
+         *
+         * Also return the Jacobians.
+         *
+         * \param &almansiStrain: The strain in the deformation gradient's current configuration.
+         * \param &deformationGradient: The deformation gradient between configurations.
+         * \param &greenLagrangeStrain: The Green-Lagrange strain which corresponds to the reference
+         *     configuration of the deformation gradient.
+         * \param &dEde: The derivative of the Green-Lagrange strain w.r.t. the Almansi strain.
+         * \param &dEdF: The derivative of the Green-Lagrange strain w.r.t. the deformation gradient
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pullBackAlmansiStrain( almansiStrain, KinematicState( deformationGradient ), greenLagrangeStrain, dEde, dEdF ) )
+
+        return NULL;
+    }
+
+    errorOut pullBackAlmansiStrain( const floatVector &almansiStrain, const floatVector &deformationGradient,
+                                    floatVector &greenLagrangeStrain, floatMatrix &dEde, floatMatrix &dEdF ){
+        /*!
+         * Pull back the almansi strain to the configuration indicated by the deformation gradient.
+         *
+         * Also return the Jacobians.
+         *
+         * \param &almansiStrain: The strain in the deformation gradient's current configuration.
+         * \param &deformationGradient: The deformation gradient between configurations.
+         * \param &greenLagrangeStrain: The Green-Lagrange strain which corresponds to the reference
+         *     configuration of the deformation gradient.
+         * \param &dEde: The derivative of the Green-Lagrange strain w.r.t. the Almansi strain.
+         * \param &dEdF: The derivative of the Green-Lagrange strain w.r.t. the deformation gradient
+         */
+
+        //Assume 3d
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        floatVector _dEde, _dEdF;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pullBackAlmansiStrain( almansiStrain, deformationGradient, greenLagrangeStrain, _dEde, _dEdF ) )
+
+        asMatrix( _dEde, sot_dim ).copyTo( dEde );
+        asMatrix( _dEdF, sot_dim ).copyTo( dEdF );
+
+        return NULL;
+    }
+
+    errorOut pullBackAlmansiStrain( const floatVector &almansiStrain, const KinematicState &kinematics,
+                                    floatVector &greenLagrangeStrain ){
+        /*!
+         * Pull back the almansi strain to the configuration indicated by the kinematic state of the deformation gradient.
+         *
+         * \f$E_{IJ} = F_{iI} e_{ij} F_{jJ}\f$
+         *
+         * \param &almansiStrain: The strain in the deformation gradient's current configuration.
+         * \param &kinematics: The kinematic state of the deformation gradient between configurations.
+         * \param &greenLagrangeStrain: The Green-Lagrange strain which corresponds to the reference
+         *     configuration of the deformation gradient.
+         */
+
+        //Assume 3d
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( almansiStrain.size( ) == sot_dim, "The Almansi strain must be a second order tensor of size " + std::to_string( sot_dim ) + " and it has " + std::to_string( almansiStrain.size( ) ) + " elements" );
+
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F( kinematics.deformationGradient( ).data( ) );
+
+        greenLagrangeStrain = floatVector( sot_dim, 0 );
+
+        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > E( greenLagrangeStrain.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > e( almansiStrain.data( ) );
+
+        E = ( F.transpose( ) * e * F ).eval( );
+
+        return NULL;
+    }
+
+    errorOut pullBackAlmansiStrain( const floatVector &almansiStrain, const KinematicState &kinematics,
+                                    floatVector &greenLagrangeStrain, floatVector &dEde, floatVector &dEdF ){
+        /*!
+         * Pull back the almansi strain to the configuration indicated by the kinematic state of the deformation gradient.
+         *
+         * Also return the Jacobians.
+         *
+         * \param &almansiStrain: The strain in the deformation gradient's current configuration.
+         * \param &kinematics: The kinematic state of the deformation gradient between configurations.
+         * \param &greenLagrangeStrain: The Green-Lagrange strain which corresponds to the reference
+         *     configuration of the deformation gradient.
+         * \param &dEde: The derivative of the Green-Lagrange strain w.r.t. the Almansi strain.
+         * \param &dEdF: The derivative of the Green-Lagrange strain w.r.t. the deformation gradient
+         */
+
+        //Assume 3d
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pullBackAlmansiStrain( almansiStrain, kinematics, greenLagrangeStrain ) )
+
+        const floatSecondOrderTensor &deformationGradient = kinematics.deformationGradient( );
+
+        dEde = floatVector( sot_dim * sot_dim, 0 );
+        dEdF = floatVector( sot_dim * sot_dim, 0 );
+
+        for ( unsigned int I = 0; I < dim; I++ ){
+            for ( unsigned int J = 0; J < dim; J++ ){
+                for ( unsigned int K = 0; K < dim; K++ ){
+                    for ( unsigned int L = 0; L < dim; L++ ){
+                        dEde[ sot_dim * dim * I + sot_dim * J + dim * K + L ] = deformationGradient[ dim * K + I ] * deformationGradient[ dim * L + J ];
+                        dEdF[ sot_dim * dim * I + sot_dim * J + dim * K + I ] += almansiStrain[ dim * K + L ] * deformationGradient[ dim * L + J ];
+                        dEdF[ sot_dim * dim * I + sot_dim * J + dim * K + J ] += deformationGradient[ dim * L + I ] * almansiStrain[ dim * L + K ];
+                    }
+                }
+            }
+        }
+
+        return NULL;
+    }
+
+    errorOut computeSymmetricPart( const floatVector &A, floatVector &symmA, unsigned int &dim ){
+        /*!
+         * Compute the symmetric part of a second order tensor ( \f$A\f$ ) and return it.
+         *
+         * \f$symm( A )_ij = \frac{1}{2}\left(A_{ij} + A_{ji}\right)\f$
+         *
+         * \param &A: A constant reference to the second order tensor to process ( \f$A\f$ )
+         * \param &symmA: The symmetric part of A ( \f$A^{symm}\f$ )
+         * \param &dim: The dimension of A. Note that this is an output used for help
+         *     with computing the Jacobian. If you don't need dim as an output use the
+         *     version of this function without it.
+         */
+        
+        //Get the dimension of A
+        dim = ( unsigned int )( std::sqrt( ( double )A.size( ) ) + 0.5 );
+        const unsigned int sot_dim = dim * dim;
+   
+        TARDIGRADE_ERROR_TOOLS_CHECK( sot_dim == A.size( ), "A is not a square matrix" );
+ 
+        symmA = floatVector( A.size( ), 0 );
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+            for ( unsigned int j = 0; j < dim; j++ ){
+                symmA[ dim * i + j ] = 0.5 * ( A[ dim * i + j ] + A[ dim * j + i ] );
+            }
+        }
+    
+        return NULL;
+    }
+
+    errorOut computeSymmetricPart( const floatVector &A, floatVector &symmA ){
+        /*!
+         * Compute the symmetric part of a second order tensor ( \f$A\f$ ) and return it.
+         *
+         * \f$symm( A )_ij = \frac{1}{2}\left(A_{ij} + A_{ji}\right)\f$
+         *
+         * \param &A: A constant reference to the second order tensor to process ( \f$A\f$ )
+         * \param &symmA: The symmetric part of A ( \f$A^{symm}\f$ )
+         */
+    
+        unsigned int dim;
+        return computeSymmetricPart( A, symmA, dim );
+    }
+
+    errorOut computeSymmetricPart( const floatVector &A, floatVector &symmA, floatMatrix &dSymmAdA ){
+        /*!
+         * Compute the symmetric part of a second order tensor ( \f$A\f$ ) and return it.
+         *
+         * \f$( A )^{symm}_{ij} = \frac{1}{2}\left(A_{ij} + A_{ji}\right)\f$
+         *
+         * Also computes the jacobian
+         * 
+         * \f$\frac{\partial A^{symm}_{ij}}{\partial A_{kl}} = \frac{1}{2}\left( \delta_{ik} \delta_{jl} + \delta_{jk}\delta_{il} \right)
+         *
+         * \param &A: A constant reference to the second order tensor to process ( \f$A\f$ )
+         * \param &symmA: The symmetric part of A ( \f$A^{symm}\f$ )
+         * \param &dSymmAdA: The Jacobian of the symmetric part of A w.r.t. A ( \f$\frac{\partial A^{symm}}{\partial A}\f$ )
+         */
+     
+        unsigned int dim;
+        TARDIGRADE_ERROR_TOOLS_CATCH( computeSymmetricPart( A, symmA, dim ) );
+        
+        dSymmAdA.resize( symmA.size( ) );
+
+        for ( unsigned int i = 0; i < symmA.size( ); i++ ){
+            dSymmAdA[ i ].assign( A.size( ), 0 );
+        }
+        
+        for ( unsigned int i = 0; i < dim; i++ ){
+            for ( unsigned int j = 0; j < dim; j++ ){
+                dSymmAdA[ dim * i + j ][ dim * i + j ] += 0.5;
+                dSymmAdA[ dim * i + j ][ dim * j + i ] += 0.5;
+            }
+        }
+        
+        return NULL;
+   
+    }
+
+    errorOut computeSymmetricPart( const floatVector &A, floatVector &symmA, floatVector &dSymmAdA ){
+        /*!
+         * Compute the symmetric part of a second order tensor ( \f$A\f$ ) and return it.
+         *
+         * \f$( A )^{symm}_{ij} = \frac{1}{2}\left(A_{ij} + A_{ji}\right)\f$
+         *
+         * Also computes the jacobian
+         * 
+         * \f$\frac{\partial A^{symm}_{ij}}{\partial A_{kl}} = \frac{1}{2}\left( \delta_{ik} \delta_{jl} + \delta_{jk}\delta_{il} \right)
+         *
+         * \param &A: A constant reference to the second order tensor to process ( \f$A\f$ )
+         * \param &symmA: The symmetric part of A ( \f$A^{symm}\f$ )
+         * \param &dSymmAdA: The Jacobian of the symmetric part of A w.r.t. A ( \f$\frac{\partial A^{symm}}{\partial A}\f$ )
+         */
+        
+        unsigned int dim;
+        TARDIGRADE_ERROR_TOOLS_CATCH( computeSymmetricPart( A, symmA, dim ) );
+        
+        const unsigned int Asize = A.size( );
+        
+        dSymmAdA = floatVector( symmA.size( ) * Asize, 0 );
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+            for ( unsigned int j = 0; j < dim; j++ ){
+                dSymmAdA[ dim * Asize * i + Asize * j + dim * i + j ] += 0.5;
+                dSymmAdA[ dim * Asize * i + Asize * j + dim * j + i ] += 0.5;
+            }
+        }
+        
+        return NULL;
+    }
+
+    errorOut pushForwardPK2Stress( const floatVector &PK2, const floatVector &F, floatVector &cauchyStress ){
+        /*!
+         * Push the Second Piola-Kirchhoff stress forward to the current configuration resulting in the Cauchy stress
+         * 
+         * \f$ \sigma_{ij} = \frac{1}{J} F_{iI} S_{IJ} F_{jJ} \f$
+         * 
+         * \param &PK2: The Second Piola-Kirchhoff stress \f$ S_{IJ} \f$
+         * \param &F: The deformation gradient \f$ F_{iI} \f$
+         * \param &cauchyStress: The Cauchy stress \f$ \sigma_{ij} \f$
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( sot_dim == PK2.size( ), "The PK2 stress must have a size of " + std::to_string( sot_dim ) + " and has a size of " + std::to_string( PK2.size( ) ) )
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( PK2.size( ) == F.size( ), "The deformation gradient must have a size of " + std::to_string( PK2.size( ) ) + " and has a size of " + std::to_string( F.size( ) ) );
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pushForwardPK2Stress( PK2, KinematicState( F ), cauchyStress ) )
+
+        return NULL;
+
+    }
+
+    errorOut pushForwardPK2Stress( const floatVector &PK2, const floatVector &F, floatVector &cauchyStress,
+                                   floatVector &dCauchyStressdPK2, floatVector &dCauchyStressdF ){
+        /*!
+         * Push the Second Piola-Kirchhoff stress forward to the current configuration resulting in the Cauchy stress
+         * 
+         * \f$ \sigma_{ij} = \frac{1}{J} F_{iI} S_{IJ} F_{jJ} \f$
+         * 
+         * \param &PK2: The Second Piola-Kirchhoff stress \f$ S_{IJ} \f$
+         * \param &F: The deformation gradient \f$ F_{iI} \f$
+         * \param &cauchyStress: The Cauchy stress \f$ \sigma_{ij} \f$
+         * \param &dCauchyStressdPK2: The gradient of the Cauchy stress w.r.t. the PK2 stress
+         * \param &dCauchyStressdF: The gradient of the Cauchy stress w.r.t. the deformation gradient
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( sot_dim == PK2.size( ), "The PK2 stress must have a size of " + std::to_string( sot_dim ) + " and has a size of " + std::to_string( PK2.size( ) ) )
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( PK2.size( ) == F.size( ), "The deformation gradient must have a size of " + std::to_string( PK2.size( ) ) + " and has a size of " + std::to_string( F.size( ) ) );
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pushForwardPK2Stress( PK2, KinematicState( F ), cauchyStress, dCauchyStressdPK2, dCauchyStressdF ) )
+
+        return NULL;
+
+    }
+
+    errorOut pushForwardPK2Stress( const floatVector &PK2, const floatVector &F, floatVector &cauchyStress,
+                                   floatMatrix &dCauchyStressdPK2, floatMatrix &dCauchyStressdF ){
+        /*!
+         * Push the Second Piola-Kirchhoff stress forward to the current configuration resulting in the Cauchy stress
+         * 
+         * \f$ \sigma_{ij} = \frac{1}{J} F_{iI} S_{IJ} F_{jJ} \f$
+         * 
+         * \param &PK2: The Second Piola-Kirchhoff stress \f$ S_{IJ} \f$
+         * \param &F: The deformation gradient \f$ F_{iI} \f$
+         * \param &cauchyStress: The Cauchy stress \f$ \sigma_{ij} \f$
+         * \param &dCauchyStressdPK2: The gradient of the Cauchy stress w.r.t. the PK2 stress
+         * \param &dCauchyStressdF: The gradient of the Cauchy stress w.r.t. the deformation gradient
+         */
+
+        floatVector _dCauchyStressdPK2, _dCauchyStressdF;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pushForwardPK2Stress( PK2, F, cauchyStress, _dCauchyStressdPK2, _dCauchyStressdF ) )
+
+        asMatrix( _dCauchyStressdPK2, PK2.size( ) ).copyTo( dCauchyStressdPK2 );
+
+        asMatrix( _dCauchyStressdF,   F.size( ) ).copyTo( dCauchyStressdF );
+
+        return NULL;
+
+    }
+
+    errorOut pushForwardPK2Stress( const floatVector &PK2, const KinematicState &kinematics, floatVector &cauchyStress ){
+        /*!
+         * Push the Second Piola-Kirchhoff stress forward to the current configuration resulting in the Cauchy stress
+         * using the cached determinant of the deformation gradient
+         * 
+         * \f$ \sigma_{ij} = \frac{1}{J} F_{iI} S_{IJ} F_{jJ} \f$
+         * 
+         * \param &PK2: The Second Piola-Kirchhoff stress \f$ S_{IJ} \f$
+         * \param &kinematics: The kinematic state of the deformation gradient \f$ F_{iI} \f$
+         * \param &cauchyStress: The Cauchy stress \f$ \sigma_{ij} \f$
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( sot_dim == PK2.size( ), "The PK2 stress must have a size of " + std::to_string( sot_dim ) + " and has a size of " + std::to_string( PK2.size( ) ) )
+
+        cauchyStress = floatVector( sot_dim, 0 );
+
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > PK2_map( PK2.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F_map( kinematics.deformationGradient( ).data( ) );
+        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > cauchyStress_map( cauchyStress.data( ) );
+
+        floatType J = kinematics.determinant( );
+
+        cauchyStress_map = ( F_map * PK2_map * F_map.transpose( ) / J ).eval( );
+
+        return NULL;
+
+    }
+
+    errorOut pushForwardPK2Stress( const floatVector &PK2, const KinematicState &kinematics, floatVector &cauchyStress,
+                                   floatVector &dCauchyStressdPK2, floatVector &dCauchyStressdF ){
+        /*!
+         * Push the Second Piola-Kirchhoff stress forward to the current configuration resulting in the Cauchy stress
+         * using the cached determinant and cofactor of the deformation gradient
+         * 
+         * \f$ \sigma_{ij} = \frac{1}{J} F_{iI} S_{IJ} F_{jJ} \f$
+         * 
+         * \param &PK2: The Second Piola-Kirchhoff stress \f$ S_{IJ} \f$
+         * \param &kinematics: The kinematic state of the deformation gradient \f$ F_{iI} \f$
+         * \param &cauchyStress: The Cauchy stress \f$ \sigma_{ij} \f$
+         * \param &dCauchyStressdPK2: The gradient of the Cauchy stress w.r.t. the PK2 stress
+         * \param &dCauchyStressdF: The gradient of the Cauchy stress w.r.t. the deformation gradient
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+        constexpr unsigned int fot_dim = sot_dim * sot_dim;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pushForwardPK2Stress( PK2, kinematics, cauchyStress ) )
+
+        const floatSecondOrderTensor &F = kinematics.deformationGradient( );
+
+        // The derivative of the determinant w.r.t. the deformation gradient is the cofactor
+        const floatSecondOrderTensor &dJdF = kinematics.cofactor( );
+
+        const floatType J = kinematics.determinant( );
+
+        dCauchyStressdF = floatVector( fot_dim, 0 );
+
+        dCauchyStressdPK2 = floatVector( fot_dim, 0 );
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            for ( unsigned int j = 0; j < dim; j++ ){
+
+                for ( unsigned int A = 0; A < dim; A++ ){
+
+                    for ( unsigned int B = 0; B < dim; B++ ){
+
+                        dCauchyStressdPK2[ dim * sot_dim * i + sot_dim * j + dim * A + B ] += F[ dim * i + A ] * F[ dim * j + B ] / J;
+                        dCauchyStressdF[ dim * sot_dim * i + sot_dim * j + dim * A + B ] -= cauchyStress[ dim * i + j ] * dJdF[ dim * A + B ] / J;
+
+                        dCauchyStressdF[ dim * sot_dim * i + sot_dim * j + dim * i + A ] += PK2[ dim * A + B ] * F[ dim * j + B ] / J;
+
+                        dCauchyStressdF[ dim * sot_dim * i + sot_dim * j + dim * j + A ] += F[ dim * i + B ] * PK2[ dim * B + A ] / J;
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        return NULL;
+
+    }
+
+    errorOut pullBackCauchyStress( const floatVector &cauchyStress, const floatVector &F, floatVector &PK2 ){
+        /*!
+         * Pull back the Cauchy stress to an earlier configuration resulting in the second Piola-Kirchhoff stress
+         * 
+         * \f$ S_{IJ} = J F^{-1}_{Ii} \sigma_{ij} F^{-1}_{Jj} \f$
+         * 
+         * where \f$S_{IJ}\f$ are the components of the second Piola-Kirchhoff stress tensor, \f$J \f$ is the
+         * determinant of the deformation gradient \f$\bf{F}\f$ which has components \f$F_{iI}\f$, and
+         * \f$ \sigma_{ij} \f$ are the components of the Cauchy stress.
+         *
+         * \param &cauchyStress: The cauchy stress tensor in row-major form (all nine components)
+         * \param &F: The deformation gradient
+         * \param &PK2: The resulting second Piola-Kirchhoff stress
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( cauchyStress.size( ) == sot_dim, "The Cauchy stress size is not consistent with the computed dimension\n    cauchyStress.size( ): " + std::to_string( cauchyStress.size( ) ) + "\n    dim * dim           : " + std::to_string( dim * dim ) + "\n" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( cauchyStress.size( ) == F.size( ), "The Cauchy stress and the deformation gradient have inconsistent sizes\n    cauchyStress.size( ): " + std::to_string( cauchyStress.size( ) ) + "\n    F.size( )           : " + std::to_string( F.size( ) ) + "\n" );
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pullBackCauchyStress( cauchyStress, KinematicState( F ), PK2 ) )
+
+        return NULL;
+
+    }
+    
+    errorOut pullBackCauchyStress( const floatVector &cauchyStress, const floatVector &F, floatVector &PK2, 
+                                   floatVector &dPK2dCauchyStress, floatVector &dPK2dF ){
+        /*!
+         * Pull back the Cauchy stress to an earlier configuration resulting in the second Piola-Kirchhoff stress
+         * 
+         * \f$ S_{IJ} = J F^{-1}_{Ii} \sigma_{ij} F^{-1}_{Jj} \f$
+         * 
+         * where \f$S_{IJ}\f$ are the components of the second Piola-Kirchhoff stress tensor, \f$J \f$ is the
+         * determinant of the deformation gradient \f$\bf{F}\f$ which has components \f$F_{iI}\f$, and
+         * \f$ \sigma_{ij} \f$ are the components of the Cauchy stress.
+         *
+         * \param &cauchyStress: The cauchy stress tensor in row-major form (all nine components)
+         * \param &F: The deformation gradient
+         * \param &PK2: The resulting second Piola-Kirchhoff stress
+         * \param &dPK2dCauchyStress: The directional derivative of the second Piola-Kirchhoff stress tensor w.r.t.
+         *     the Cauchy stress
+         * \param &dPK2dF: The directional derivative of the second Piola-Kirchhoff stress tensor w.r.t. the
+         *     deformation gradient
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( cauchyStress.size( ) == sot_dim, "The Cauchy stress size is not consistent with the computed dimension\n    cauchyStress.size( ): " + std::to_string( cauchyStress.size( ) ) + "\n    dim * dim           : " + std::to_string( dim * dim ) + "\n" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( cauchyStress.size( ) == F.size( ), "The Cauchy stress and the deformation gradient have inconsistent sizes\n    cauchyStress.size( ): " + std::to_string( cauchyStress.size( ) ) + "\n    F.size( )           : " + std::to_string( F.size( ) ) + "\n" );
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pullBackCauchyStress( cauchyStress, KinematicState( F ), PK2, dPK2dCauchyStress, dPK2dF ) )
+
+        return NULL;
+
+    }
+
+    errorOut pullBackCauchyStress( const floatVector &cauchyStress, const floatVector &F, floatVector &PK2, 
+                                   floatMatrix &dPK2dCauchyStress, floatMatrix &dPK2dF ){
+        /*!
+         * Pull back the Cauchy stress to an earlier configuration resulting in the second Piola-Kirchhoff stress
+         * 
+         * \f$ S_{IJ} = J F^{-1}_{Ii} \sigma_{ij} F^{-1}_{Jj} \f$
+         * 
+         * where \f$S_{IJ}\f$ are the components of the second Piola-Kirchhoff stress tensor, \f$J \f$ is the
+         * determinant of the deformation gradient \f$\bf{F}\f$ which has components \f$F_{iI}\f$, and
+         * \f$ \sigma_{ij} \f$ are the components of the Cauchy stress.
+         *
+         * \param &cauchyStress: The cauchy stress tensor in row-major form (all nine components)
+         * \param &F: The deformation gradient
+         * \param &PK2: The resulting second Piola-Kirchhoff stress
+         * \param &dPK2dCauchyStress: The directional derivative of the second Piola-Kirchhoff stress tensor w.r.t.
+         *     the Cauchy stress
+         * \param &dPK2dF: The directional derivative of the second Piola-Kirchhoff stress tensor w.r.t. the
+         *     deformation gradient
+         */
+
+
+        floatVector _dPK2dCauchyStress, _dPK2dF;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pullBackCauchyStress( cauchyStress, F, PK2, _dPK2dCauchyStress, _dPK2dF ) )
+
+        asMatrix( _dPK2dCauchyStress, cauchyStress.size( ) ).copyTo( dPK2dCauchyStress );
+
+        asMatrix( _dPK2dF, F.size( ) ).copyTo( dPK2dF );
+
+        return NULL;
+
+    }
+
+    errorOut pullBackCauchyStress( const floatVector &cauchyStress, const KinematicState &kinematics, floatVector &PK2 ){
+        /*!
+         * Pull back the Cauchy stress to an earlier configuration resulting in the second Piola-Kirchhoff stress
+         * using the cached inverse and determinant of the deformation gradient
+         * 
+         * \f$ S_{IJ} = J F^{-1}_{Ii} \sigma_{ij} F^{-1}_{Jj} \f$
+         * 
+         * \param &cauchyStress: The cauchy stress tensor in row-major form (all nine components)
+         * \param &kinematics: The kinematic state of the deformation gradient
+         * \param &PK2: The resulting second Piola-Kirchhoff stress
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( cauchyStress.size( ) == sot_dim, "The Cauchy stress size is not consistent with the computed dimension\n    cauchyStress.size( ): " + std::to_string( cauchyStress.size( ) ) + "\n    dim * dim           : " + std::to_string( dim * dim ) + "\n" );
+
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > cauchyStress_map( cauchyStress.data( ) );
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > Finv_map( kinematics.inverse( ).data( ) );
+
+        floatType J = kinematics.determinant( );
+
+        PK2 = floatVector( sot_dim, 0 );
+        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > PK2_map( PK2.data( ) );
+
+        PK2_map = ( J * Finv_map * cauchyStress_map * Finv_map.transpose( ) ).eval( );
+
+        return NULL;
+
+    }
+
+    errorOut pullBackCauchyStress( const floatVector &cauchyStress, const KinematicState &kinematics, floatVector &PK2,
+                                   floatVector &dPK2dCauchyStress, floatVector &dPK2dF ){
+        /*!
+         * Pull back the Cauchy stress to an earlier configuration resulting in the second Piola-Kirchhoff stress
+         * using the cached inverse and determinant of the deformation gradient
+         * 
+         * \f$ S_{IJ} = J F^{-1}_{Ii} \sigma_{ij} F^{-1}_{Jj} \f$
+         * 
+         * \param &cauchyStress: The cauchy stress tensor in row-major form (all nine components)
+         * \param &kinematics: The kinematic state of the deformation gradient
+         * \param &PK2: The resulting second Piola-Kirchhoff stress
+         * \param &dPK2dCauchyStress: The directional derivative of the second Piola-Kirchhoff stress tensor w.r.t.
+         *     the Cauchy stress
+         * \param &dPK2dF: The directional derivative of the second Piola-Kirchhoff stress tensor w.r.t. the
+         *     deformation gradient
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+        constexpr unsigned int fot_dim = sot_dim * sot_dim;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( pullBackCauchyStress( cauchyStress, kinematics, PK2 ) )
+
+        const floatSecondOrderTensor &Finv = kinematics.inverse( );
+
+        const floatType J = kinematics.determinant( );
+
+        dPK2dCauchyStress = floatVector( fot_dim, 0 );
+        dPK2dF            = floatVector( fot_dim, 0 );
+
+        for ( unsigned int A = 0; A < dim; A++ ){
+
+            for ( unsigned int B = 0; B < dim; B++ ){
+
+                for ( unsigned int k = 0; k < dim; k++ ){
+
+                    for ( unsigned int l = 0; l < dim; l++ ){
+
+                        dPK2dCauchyStress[ dim * dim * dim * A + dim * dim * B + dim * k + l ] = J * Finv[ dim * A + k ] * Finv[ dim * B + l ];
+
+                        dPK2dF[ dim * dim * dim * A + dim * dim * B + dim * k + l ] = Finv[ dim * l + k ] * PK2[ dim * A + B ]
+                                                                                    - Finv[ dim * A + k ] * PK2[ dim * l + B ]
+                                                                                    - Finv[ dim * B + k ] * PK2[ dim * A + l ];
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        return NULL;
+
+    }
+
+    static void matrixExponentialCoefficients( const floatSecondOrderTensor &A, floatType &expShift, floatSecondOrderTensor &B,
+                                        floatSecondOrderTensor &B2, std::array< floatType, 3 > &f, std::array< floatType, 9 > *m ){
+        /*!
+         * Compute the Cayley-Hamilton coefficients of the exponential of a 3x3 matrix
+         *
+         * \f$ \exp\left( A \right) = \exp\left( \frac{tr\left( A \right)}{3} \right) \left( f_0 I + f_1 B + f_2 B^2 \right) \f$
+         *
+         * where \f$ B = A - \frac{tr\left( A \right)}{3} I \f$ is the deviatoric part of \f$ A \f$ which satisfies
+         * \f$ B^3 = p B + q I \f$ with \f$ p = \frac{1}{2} tr\left( B^2 \right) \f$ and \f$ q = det\left( B \right) \f$.
+         * The Frechet derivative is represented as
+         *
+         * \f$ L\left( A, E \right) = \exp\left( \frac{tr\left( A \right)}{3} \right) \sum_{k,l=0}^{2} m_{kl} B^k E B^l \f$
+         *
+         * \f$ B \f$ is scaled by \f$ 2^{-s} \f$ so that the bound on its eigenvalues is less than one half, the coefficients
+         * are computed using the Taylor series reduced by the Cayley-Hamilton theorem and are then squared \f$ s \f$ times.
+         * All of the series and squaring operations are performed on the scalar coefficients so the cost does not
+         * depend on the number of squarings and repeated eigenvalues need no special treatment.
+         *
+         * \param &A: The matrix to exponentiate
+         * \param &expShift: The exponential of one third of the trace of A
+         * \param &B: The deviatoric part of A
+         * \param &B2: The square of the deviatoric part of A
+         * \param &f: The coefficients of \f$ I \f$, \f$ B \f$, and \f$ B^2 \f$
+         * \param *m: The coefficients of the Frechet derivative \f$ m_{kl} \f$ stored as \f$ 3 k + l \f$ (may be NULL)
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int maxTerms = 24;
+        constexpr unsigned int maxSquarings = 64;
+
+        const floatType shift = ( A[ 0 ] + A[ 4 ] + A[ 8 ] ) / 3;
+
+        expShift = std::exp( shift );
+
+        B = A;
+
+        for ( unsigned int i = 0; i < dim; i++ ){ B[ dim * i + i ] -= shift; }
+
+        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > B_map( B.data( ) );
+        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > B2_map( B2.data( ) );
+
+        B2_map = ( B_map * B_map ).eval( );
+
+        floatType p = 0.5 * ( B2[ 0 ] + B2[ 4 ] + B2[ 8 ] );
+
+        floatType q = B[ 0 ] * ( B[ 4 ] * B[ 8 ] - B[ 5 ] * B[ 7 ] )
+                    - B[ 1 ] * ( B[ 3 ] * B[ 8 ] - B[ 5 ] * B[ 6 ] )
+                    + B[ 2 ] * ( B[ 3 ] * B[ 7 ] - B[ 4 ] * B[ 6 ] );
+
+        // Fujiwara's bound on the eigenvalues of B
+        floatType rho = 2 * std::max( std::sqrt( std::fabs( p ) ), std::cbrt( 0.5 * std::fabs( q ) ) );
+
+        unsigned int s = 0;
+
+        while ( ( rho > 0.5 ) && ( s < maxSquarings ) ){
+
+            rho *= 0.5;
+
+            s++;
+
+        }
+
+        p = std::ldexp( p, -2 * ( int )s );
+
+        q = std::ldexp( q, -3 * ( int )s );
+
+        // Multiplication by X = B / 2^s of the coefficients of I, X, and X^2
+        auto shiftCoefficients = [ & ]( const floatType *a, floatType *b, const unsigned int stride ){
+
+            const floatType a0 = a[ 0 ], a1 = a[ stride ], a2 = a[ 2 * stride ];
+
+            b[ 0 ] = q * a2;
+
+            b[ stride ] = a0 + p * a2;
+
+            b[ 2 * stride ] = a1;
+
+        };
+
+        std::array< floatType, 3 > a = { 1, 0, 0 };
+
+        std::array< floatType, 9 > c = { 1, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+        f = a;
+
+        if ( m ){ *m = c; }
+
+        floatType invFactorial = 1;
+
+        for ( unsigned int n = 1; n < maxTerms; n++ ){
+
+            shiftCoefficients( a.data( ), a.data( ), 1 );
+
+            invFactorial /= n;
+
+            floatType magnitude = 0;
+
+            for ( unsigned int k = 0; k < dim; k++ ){
+
+                f[ k ] += a[ k ] * invFactorial;
+
+                magnitude = std::max( magnitude, std::fabs( a[ k ] ) );
+
+            }
+
+            if ( m ){
+
+                // c^{(n)} = X c^{(n-1)} + I \otimes X^n
+                for ( unsigned int l = 0; l < dim; l++ ){ shiftCoefficients( c.data( ) + l, c.data( ) + l, dim ); }
+
+                for ( unsigned int l = 0; l < dim; l++ ){ c[ l ] += a[ l ]; }
+
+                for ( unsigned int kl = 0; kl < dim * dim; kl++ ){
+
+                    ( *m )[ kl ] += c[ kl ] * invFactorial / ( n + 1 );
+
+                    magnitude = std::max( magnitude, std::fabs( c[ kl ] ) );
+
+                }
+
+            }
+
+            if ( magnitude * invFactorial < std::numeric_limits< floatType >::epsilon( ) ){ break; }
+
+        }
+
+        for ( unsigned int step = 0; step < s; step++ ){
+
+            // R is the matrix of the multiplication by exp( X ) acting on the coefficients
+            std::array< floatType, 9 > R;
+
+            for ( unsigned int l = 0; l < dim; l++ ){
+
+                floatType e[ dim ] = { 0, 0, 0 };
+
+                e[ l ] = 1;
+
+                floatType Ke[ dim ], KKe[ dim ];
+
+                shiftCoefficients( e, Ke, 1 );
+
+                shiftCoefficients( Ke, KKe, 1 );
+
+                for ( unsigned int k = 0; k < dim; k++ ){
+
+                    R[ dim * k + l ] = f[ 0 ] * e[ k ] + f[ 1 ] * Ke[ k ] + f[ 2 ] * KKe[ k ];
+
+                }
+
+            }
+
+            // exp( 2 X ) = exp( X ) exp( X )
+            std::array< floatType, 3 > _f = { 0, 0, 0 };
+
+            for ( unsigned int k = 0; k < dim; k++ ){
+
+                for ( unsigned int l = 0; l < dim; l++ ){
+
+                    _f[ k ] += R[ dim * k + l ] * f[ l ];
+
+                }
+
+            }
+
+            f = _f;
+
+            // L( 2X, E ) = 0.5 * ( L( X, E ) exp( X ) + exp( X ) L( X, E ) )
+            if ( m ){
+
+                std::array< floatType, 9 > _m;
+
+                _m.fill( 0 );
+
+                for ( unsigned int k = 0; k < dim; k++ ){
+
+                    for ( unsigned int l = 0; l < dim; l++ ){
+
+                        for ( unsigned int j = 0; j < dim; j++ ){
+
+                            _m[ dim * k + l ] += 0.5 * ( R[ dim * k + j ] * ( *m )[ dim * j + l ] + ( *m )[ dim * k + j ] * R[ dim * l + j ] );
+
+                        }
+
+                    }
+
+                }
+
+                *m = _m;
+
+            }
+
+            // Change the basis from the powers of X to the powers of 2 X
+            f[ 1 ] *= 0.5;
+
+            f[ 2 ] *= 0.25;
+
+            if ( m ){
+
+                for ( unsigned int k = 0; k < dim; k++ ){
+
+                    for ( unsigned int l = 0; l < dim; l++ ){
+
+                        ( *m )[ dim * k + l ] = std::ldexp( ( *m )[ dim * k + l ], -( int )( k + l ) );
+
+                    }
+
+                }
+
+            }
+
+            p *= 4;
+
+            q *= 8;
+
+        }
+
+    }
+
+    void computeMatrixExponential( const floatSecondOrderTensor &A, floatSecondOrderTensor &expA ){
+        /*!
+         * Compute the exponential of a 3x3 matrix using the Cayley-Hamilton theorem. No heap allocations are performed
+         * and the cost is nearly independent of the norm of the matrix.
+         *
+         * \f$ \exp\left( A \right) = \exp\left( \frac{tr\left( A \right)}{3} \right) \left( f_0 I + f_1 B + f_2 B^2 \right) \f$
+         *
+         * where \f$ B \f$ is the deviatoric part of \f$ A \f$.
+         *
+         * \param &A: The matrix to exponentiate stored in row-major order
+         * \param &expA: The exponential of A
          */
 
-        floatVector dF;
+        constexpr unsigned int sot_dim = 9;
 
-        return evolveF( Dt, previousDeformationGradient, Lp, L, dF, deformationGradient, alpha, mode );
+        floatType expShift;
+
+        floatSecondOrderTensor B, B2;
+
+        std::array< floatType, 3 > f;
+
+        matrixExponentialCoefficients( A, expShift, B, B2, f, NULL );
+
+        for ( unsigned int i = 0; i < sot_dim; i++ ){
+
+            expA[ i ] = expShift * ( f[ 1 ] * B[ i ] + f[ 2 ] * B2[ i ] + ( ( i % 4 == 0 ) ? f[ 0 ] : 0 ) );
+
+        }
 
     }
 
-    errorOut evolveF( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
-                      floatVector &dF, floatVector &deformationGradient, floatMatrix &dFdL, const floatType alpha, const unsigned int mode ){
+    void computeMatrixExponential( const floatSecondOrderTensor &A, floatSecondOrderTensor &expA, floatFourthOrderTensor &dExpAdA ){
         /*!
-         * Evolve the deformation gradient ( F ) using the midpoint integration method and return the jacobian w.r.t. L.
+         * Compute the exponential of a 3x3 matrix and its derivative using the Cayley-Hamilton theorem. No heap
+         * allocations are performed and the cost is nearly independent of the norm of the matrix.
          *
-         * mode 1:
-         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
-         * \f$\frac{\partial F_{jI}^{t + 1}}{\partial L_{kl}^{t+1}} = \left[\delta_{kj} - \Delta t \left(1 - \alpha\right) L_{kj}\right]^{-1} \Delta t \left(1 - \alpha\right) F_{lI}^{t + 1}\f$
+         * \f$ \exp\left( A \right) = \exp\left( \frac{tr\left( A \right)}{3} \right) \left( f_0 I + f_1 B + f_2 B^2 \right) \f$
          *
-         * mode 2:
-         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
-         * \f$\frac{\partial F_{iJ}^{t + 1}}{\partial L_{KL}} = \Delta t (1 - \alpha) F_{iK}^{t + 1} \left[\delta_{JL} - \right ]\f$
+         * \f$ \frac{\partial \exp\left( A \right)_{ij}}{\partial A_{ab}} = \exp\left( \frac{tr\left( A \right)}{3} \right) \sum_{k,l=0}^{2} m_{kl} \left( B^k \right)_{ia} \left( B^l \right)_{bj} \f$
          *
-         * \param &Dt: The change in time.
+         * where \f$ B \f$ is the deviatoric part of \f$ A \f$.
+         *
+         * \param &A: The matrix to exponentiate stored in row-major order
+         * \param &expA: The exponential of A
+         * \param &dExpAdA: The derivative of the exponential of A w.r.t. A
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        floatType expShift;
+
+        floatSecondOrderTensor B, B2;
+
+        std::array< floatType, 3 > f;
+
+        std::array< floatType, 9 > m;
+
+        matrixExponentialCoefficients( A, expShift, B, B2, f, &m );
+
+        for ( unsigned int i = 0; i < sot_dim; i++ ){
+
+            expA[ i ] = expShift * ( f[ 1 ] * B[ i ] + f[ 2 ] * B2[ i ] + ( ( i % 4 == 0 ) ? f[ 0 ] : 0 ) );
+
+        }
+
+        // The powers of B and T^l = sum_k m_kl B^k
+        const floatSecondOrderTensor eye = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+        const floatSecondOrderTensor *powers[ dim ] = { &eye, &B, &B2 };
+
+        floatSecondOrderTensor T[ dim ];
+
+        for ( unsigned int l = 0; l < dim; l++ ){
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){
+
+                T[ l ][ i ] = expShift * ( m[ l ] * eye[ i ] + m[ dim + l ] * B[ i ] + m[ 2 * dim + l ] * B2[ i ] );
+
+            }
+
+        }
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            for ( unsigned int j = 0; j < dim; j++ ){
+
+                for ( unsigned int a = 0; a < dim; a++ ){
+
+                    for ( unsigned int b = 0; b < dim; b++ ){
+
+                        floatType value = 0;
+
+                        for ( unsigned int l = 0; l < dim; l++ ){
+
+                            value += T[ l ][ dim * i + a ] * ( *powers[ l ] )[ dim * b + j ];
+
+                        }
+
+                        dExpAdA[ dim * sot_dim * i + sot_dim * j + dim * a + b ] = value;
+
+                    }
+
+                }
+
+            }
+
+        }
+
+    }
+
+    void evolveFExponentialMap( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                                floatVector &deformationGradient, const floatType alpha ){
+        /*!
+         * Evolve the deformation gradient using the exponential map. Assumes the evolution equation is of the form
+         * 
+         * \f$ \dot{F}_{iI} = \ell_{ij} F_{jI} \f$
+         * 
+         * \param &Dt: The change in time
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous value of the velocity gradient
+         * \param &L: The current value of the velocity gradient
+         * \param &deformationGradient: The computed value of the deformation gradient
+         * \param &alpha: The integration parameter (0 is explicit and 1 is implicit)
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( previousDeformationGradient.size( ) == sot_dim, "The previous deformation gradient must have " + std::to_string( sot_dim ) + " values" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( Lp.size( ) == sot_dim, "The previous velocity gradient must have " + std::to_string( sot_dim ) + " values" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( L.size( ) == sot_dim, "The velocity gradient must have " + std::to_string( sot_dim ) + " values" );
+
+        floatSecondOrderTensor DtLalpha, expDtLalpha;
+
+        for ( unsigned int i = 0; i < sot_dim; i++ ){ DtLalpha[ i ] = Dt * ( ( 1 - alpha ) * Lp[ i ] + alpha * L[ i ] ); }
+
+        computeMatrixExponential( DtLalpha, expDtLalpha );
+
+        deformationGradient = floatVector( sot_dim, 0 );
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            for ( unsigned int j = 0; j < dim; j++ ){
+
+                for ( unsigned int k = 0; k < dim; k++ ){
+
+                    deformationGradient[ dim * i + k ] += expDtLalpha[ dim * i + j ] * previousDeformationGradient[ dim * j + k ];
+
+                }
+
+            }
+
+        }
+
+    }
+
+    void evolveFExponentialMap( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                                floatVector &deformationGradient, floatVector &dFdL, const floatType alpha ){
+        /*!
+         * Evolve the deformation gradient using the exponential map. Assumes the evolution equation is of the form
+         * 
+         * \f$ \dot{F}_{iI} = \ell_{ij} F_{jI} \f$
+         * 
+         * \param &Dt: The change in time
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous value of the velocity gradient
+         * \param &L: The current value of the velocity gradient
+         * \param &deformationGradient: The computed value of the deformation gradient
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
+         * \param &alpha: The integration parameter (0 is explicit and 1 is implicit)
+         */
+
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( previousDeformationGradient.size( ) == sot_dim, "The previous deformation gradient must have " + std::to_string( sot_dim ) + " values" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( Lp.size( ) == sot_dim, "The previous velocity gradient must have " + std::to_string( sot_dim ) + " values" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( L.size( ) == sot_dim, "The velocity gradient must have " + std::to_string( sot_dim ) + " values" );
+
+        floatSecondOrderTensor DtLalpha, expDtLalpha;
+
+        floatFourthOrderTensor dExpDtLalphadL;
+
+        for ( unsigned int i = 0; i < sot_dim; i++ ){ DtLalpha[ i ] = Dt * ( ( 1 - alpha ) * Lp[ i ] + alpha * L[ i ] ); }
+
+        computeMatrixExponential( DtLalpha, expDtLalpha, dExpDtLalphadL );
+
+        for ( unsigned int i = 0; i < sot_dim * sot_dim; i++ ){ dExpDtLalphadL[ i ] *= Dt * alpha; }
+
+        deformationGradient = floatVector( sot_dim, 0 );
+
+        dFdL = floatVector( sot_dim * sot_dim, 0 );
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            for ( unsigned int j = 0; j < dim; j++ ){
+
+                for ( unsigned int k = 0; k < dim; k++ ){
+
+                    deformationGradient[ dim * i + k ] += expDtLalpha[ dim * i + j ] * previousDeformationGradient[ dim * j + k ];
+
+                    for ( unsigned int ab = 0; ab < sot_dim; ab++ ){
+
+                        dFdL[ dim * sot_dim * i + sot_dim * k + ab ] += dExpDtLalphadL[ dim * sot_dim * i + sot_dim * j + ab ] * previousDeformationGradient[ dim * j + k ];
+
+                    }
+
+                }
+
+            }
+
+        }
+
+    }
+
+    void evolveFExponentialMap( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                                floatVector &deformationGradient, floatVector &dFdL, floatVector &dFdFp, floatVector &dFdLp, const floatType alpha ){
+        /*!
+         * Evolve the deformation gradient using the exponential map. Assumes the evolution equation is of the form
+         * 
+         * \f$ \dot{F}_{iI} = \ell_{ij} F_{jI} \f$
+         * 
+         * \param &Dt: The change in time
          * \param &previousDeformationGradient: The previous value of the deformation gradient
-         * \param &Lp: The previous velocity gradient.
-         * \param &L: The current velocity gradient.
-         * \param &dF: The change in the deformation gradient \f$\Delta \bf{F}\f$ such that \f$F_{iI}^{t+1} = F_{iI}^t + \Delta F_{iI}\f$
-         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &Lp: The previous value of the velocity gradient
+         * \param &L: The current value of the velocity gradient
+         * \param &deformationGradient: The computed value of the deformation gradient
          * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
-         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
-         * \param mode: The form of the ODE. See above for details.
+         * \param &dFdFp: The derivative of the deformation gradient w.r.t. the previous deformation gradient
+         * \param &dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient
+         * \param &alpha: The integration parameter (0 is explicit and 1 is implicit)
          */
 
         constexpr unsigned int dim = 3;
-        const unsigned int sot_dim = dim * dim;
+        constexpr unsigned int sot_dim = dim * dim;
 
-        floatVector _dFdL;
+        TARDIGRADE_ERROR_TOOLS_CHECK( previousDeformationGradient.size( ) == sot_dim, "The previous deformation gradient must have " + std::to_string( sot_dim ) + " values" );
 
-        errorOut error = evolveFFlatJ( Dt, previousDeformationGradient, Lp, L, dF, deformationGradient, _dFdL, alpha, mode );
+        TARDIGRADE_ERROR_TOOLS_CHECK( Lp.size( ) == sot_dim, "The previous velocity gradient must have " + std::to_string( sot_dim ) + " values" );
 
-        if ( error ){
+        TARDIGRADE_ERROR_TOOLS_CHECK( L.size( ) == sot_dim, "The velocity gradient must have " + std::to_string( sot_dim ) + " values" );
 
-            errorOut result = new errorNode( __func__, "Error when computing the evolved deformation gradient" );
-            result->addNext( error );
-            return result;
+        floatSecondOrderTensor DtLalpha, expDtLalpha;
+
+        floatFourthOrderTensor dExpDtLalphadDtLalpha;
+
+        for ( unsigned int i = 0; i < sot_dim; i++ ){ DtLalpha[ i ] = Dt * ( ( 1 - alpha ) * Lp[ i ] + alpha * L[ i ] ); }
+
+        computeMatrixExponential( DtLalpha, expDtLalpha, dExpDtLalphadDtLalpha );
+
+        deformationGradient = floatVector( sot_dim, 0 );
+
+        dFdFp = floatVector( sot_dim * sot_dim, 0 );
+
+        dFdL = floatVector( sot_dim * sot_dim, 0 );
+
+        dFdLp = floatVector( sot_dim * sot_dim, 0 );
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            for ( unsigned int j = 0; j < dim; j++ ){
+
+                for ( unsigned int k = 0; k < dim; k++ ){
+
+                    deformationGradient[ dim * i + k ] += expDtLalpha[ dim * i + j ] * previousDeformationGradient[ dim * j + k ];
+
+                    dFdFp[ dim * sot_dim * i + sot_dim * j + dim * k + j ] += expDtLalpha[ dim * i + k ];
+
+                    for ( unsigned int ab = 0; ab < sot_dim; ab++ ){
+
+                        dFdL[ dim * sot_dim * i + sot_dim * k + ab ] += dExpDtLalphadDtLalpha[ dim * sot_dim * i + sot_dim * j + ab ] * previousDeformationGradient[ dim * j + k ];
+
+                    }
+
+                }
+
+            }
 
         }
 
-        dFdL = tardigradeVectorTools::inflate( _dFdL, sot_dim, sot_dim );
+        // Both velocity gradients enter through the same product so their derivatives only differ by the scale factor
+        for ( unsigned int i = 0; i < sot_dim * sot_dim; i++ ){
 
-        return error;
+            dFdLp[ i ] = Dt * ( 1 - alpha ) * dFdL[ i ];
+
+            dFdL[ i ] *= Dt * alpha;
+
+        }
 
     }
 
-    errorOut evolveFFlatJ( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
-                           floatVector &dF, floatVector &deformationGradient, floatVector &dFdL, const floatType alpha, const unsigned int mode ){
+    static void applyEvolutionOperator( const floatSecondOrderTensor &Phi, const floatFourthOrderTensor *dPhidL, const floatFourthOrderTensor *dPhidLp,
+                                 const floatVector &previousDeformationGradient, floatVector &deformationGradient,
+                                 floatVector *dFdL, floatVector *dFdFp, floatVector *dFdLp ){
         /*!
-         * Evolve the deformation gradient ( F ) using the midpoint integration method and return the jacobian w.r.t. L.
-         *
-         * mode 1:
-         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
-         * \f$\frac{\partial F_{jI}^{t + 1}}{\partial L_{kl}^{t+1}} = \left[\delta_{kj} - \Delta t \left(1 - \alpha\right) L_{kj}\right]^{-1} \Delta t \left(1 - \alpha\right) F_{lI}^{t + 1}\f$
+         * Apply an evolution operator \f$\Phi\f$ to the previous deformation gradient and form the Jacobians
          *
-         * mode 2:
-         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
-         * \f$\frac{\partial F_{iJ}^{t + 1}}{\partial L_{KL}} = \Delta t (1 - \alpha) F_{iK}^{t + 1} \left[\delta_{JL} - \right ]\f$
+         * \f$F_{iI} = \Phi_{ij} F_{jI}^{t}\f$
          *
-         * \param &Dt: The change in time.
+         * \param &Phi: The evolution operator over the step
+         * \param *dPhidL: The derivative of the operator w.r.t. the current velocity gradient. Only used if dFdL is not NULL.
+         * \param *dPhidLp: The derivative of the operator w.r.t. the previous velocity gradient. Only used if dFdLp is not NULL.
          * \param &previousDeformationGradient: The previous value of the deformation gradient
-         * \param &Lp: The previous velocity gradient.
-         * \param &L: The current velocity gradient.
-         * \param &dF: The change in the deformation gradient \f$\Delta \bf{F}\f$ such that \f$F_{iI}^{t+1} = F_{iI}^t + \Delta F_{iI}\f$
-         * \param &deformationGradient: The computed current deformation gradient.
-         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
-         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
-         * \param mode: The form of the ODE. See above for details.
+         * \param &deformationGradient: The computed value of the deformation gradient
+         * \param *dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient. Skipped if NULL.
+         * \param *dFdFp: The derivative of the deformation gradient w.r.t. the previous deformation gradient. Skipped if NULL.
+         * \param *dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient. Skipped if NULL.
          */
 
-        //Assumes 3D
         constexpr unsigned int dim = 3;
-        const unsigned int sot_dim = dim * dim;
+        constexpr unsigned int sot_dim = dim * dim;
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( evolveF( Dt, previousDeformationGradient, Lp, L, dF, deformationGradient, alpha, mode) );
+        deformationGradient = floatVector( sot_dim, 0 );
 
-        //Compute the left hand side
-        floatVector invLHS = -Dt * ( 1 - alpha ) * L;
-        for ( unsigned int i = 0; i < dim; i++ ){ invLHS[ dim * i + i ] += 1; }
+        for ( unsigned int i = 0; i < dim; i++ ){
 
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > invLHS_map( invLHS.data( ), dim, dim );
+            for ( unsigned int j = 0; j < dim; j++ ){
 
-        invLHS_map = invLHS_map.inverse( ).eval( );
+                for ( unsigned int K = 0; K < dim; K++ ){
+
+                    deformationGradient[ dim * i + K ] += Phi[ dim * i + j ] * previousDeformationGradient[ dim * j + K ];
 
-        //Compute the jacobian
-        dFdL = floatVector( sot_dim * sot_dim, 0 );
-        if ( mode == 1 ){
-            for ( unsigned int j = 0; j < dim; j++ ){
-                for ( unsigned int I = 0; I < dim; I++ ){
-                    for ( unsigned int k = 0; k < dim; k++ ){
-                        for ( unsigned int l = 0; l < dim; l++ ){
-                            dFdL[ dim * sot_dim * j + sot_dim * I + dim * k + l ] += Dt * ( 1 - alpha ) * invLHS[ dim * j + k ] * deformationGradient[ dim * l + I ];
-                        }
-                    }
                 }
+
             }
+
         }
-        if ( mode == 2 ){
-            for ( unsigned int j = 0; j < dim; j++ ){
-                for ( unsigned int I = 0; I < dim; I++ ){
+
+        if ( dFdFp ){
+
+            *dFdFp = floatVector( sot_dim * sot_dim, 0 );
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                for ( unsigned int j = 0; j < dim; j++ ){
+
                     for ( unsigned int K = 0; K < dim; K++ ){
-                        for ( unsigned int _L = 0; _L < dim; _L++ ){
-                            dFdL[ dim * sot_dim * j + sot_dim * I + dim * K + _L ] += Dt * ( 1 - alpha ) * invLHS[ dim * _L + I ] * deformationGradient[ dim * j + K ];
-                        }
+
+                        ( *dFdFp )[ dim * sot_dim * i + sot_dim * K + dim * j + K ] = Phi[ dim * i + j ];
+
                     }
+
                 }
+
             }
+
         }
-        return NULL;
-    }
 
-    errorOut evolveFFlatJ( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
-                           floatVector &deformationGradient, floatVector &dFdL, const floatType alpha, const unsigned int mode ){
-        /*!
-         * Evolve the deformation gradient ( F ) using the midpoint integration method and return the jacobian w.r.t. L.
-         *
-         * mode 1:
-         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
-         * \f$\frac{\partial F_{jI}^{t + 1}}{\partial L_{kl}^{t+1}} = \left[\delta_{kj} - \Delta t \left(1 - \alpha\right) L_{kj}\right]^{-1} \Delta t \left(1 - \alpha\right) F_{lI}^{t + 1}\f$
-         *
-         * mode 2:
-         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
-         * \f$\frac{\partial F_{iJ}^{t + 1}}{\partial L_{KL}} = \Delta t (1 - \alpha) F_{iK}^{t + 1} \left[\delta_{JL} - \right ]\f$
-         *
-         * \param &Dt: The change in time.
-         * \param &previousDeformationGradient: The previous value of the deformation gradient
-         * \param &Lp: The previous velocity gradient.
-         * \param &L: The current velocity gradient.
-         * \param &deformationGradient: The computed current deformation gradient.
-         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
-         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
-         * \param mode: The form of the ODE. See above for details.
-         */
+        const floatFourthOrderTensor *dPhi[ 2 ] = { dPhidL, dPhidLp };
 
-        floatVector dF;
+        floatVector *dF[ 2 ] = { dFdL, dFdLp };
 
-        return evolveFFlatJ( Dt, previousDeformationGradient, Lp, L, dF, deformationGradient, dFdL, alpha, mode );
+        for ( unsigned int v = 0; v < 2; v++ ){
 
-    }
+            if ( !dF[ v ] ){ continue; }
 
-    errorOut evolveF( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
-                      floatVector &deformationGradient, floatMatrix &dFdL, const floatType alpha, const unsigned int mode ){
-        /*!
-         * Evolve the deformation gradient ( F ) using the midpoint integration method and return the jacobian w.r.t. L.
-         *
-         * mode 1:
-         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
-         * \f$\frac{\partial F_{jI}^{t + 1}}{\partial L_{kl}^{t+1}} = \left[\delta_{kj} - \Delta t \left(1 - \alpha\right) L_{kj}\right]^{-1} \Delta t \left(1 - \alpha\right) F_{lI}^{t + 1}\f$
-         *
-         * mode 2:
-         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
-         * \f$\frac{\partial F_{iJ}^{t + 1}}{\partial L_{KL}} = \Delta t (1 - \alpha) F_{iK}^{t + 1} \left[\delta_{JL} - \right ]\f$
-         *
-         * \param &Dt: The change in time.
-         * \param &previousDeformationGradient: The previous value of the deformation gradient
-         * \param &Lp: The previous velocity gradient.
-         * \param &L: The current velocity gradient.
-         * \param &deformationGradient: The computed current deformation gradient.
-         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
-         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
-         * \param mode: The form of the ODE. See above for details.
-         */
+            *dF[ v ] = floatVector( sot_dim * sot_dim, 0 );
 
-        floatVector dF;
+            for ( unsigned int i = 0; i < dim; i++ ){
 
-        return evolveF( Dt, previousDeformationGradient, Lp, L, dF, deformationGradient, dFdL, alpha, mode );
+                for ( unsigned int j = 0; j < dim; j++ ){
+
+                    for ( unsigned int K = 0; K < dim; K++ ){
+
+                        for ( unsigned int ab = 0; ab < sot_dim; ab++ ){
+
+                            ( *dF[ v ] )[ dim * sot_dim * i + sot_dim * K + ab ] += ( *dPhi[ v ] )[ dim * sot_dim * i + sot_dim * j + ab ] * previousDeformationGradient[ dim * j + K ];
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+        }
 
     }
 
-    errorOut evolveF( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
-                      floatVector &dF, floatVector &deformationGradient, floatMatrix &dFdL, floatMatrix &ddFdFp, floatMatrix &dFdFp, floatMatrix &dFdLp, const floatType alpha, const unsigned int mode ){
+    static void evolveFMagnusEngine( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                              floatVector &deformationGradient, floatVector *dFdL, floatVector *dFdFp, floatVector *dFdLp, const unsigned int order ){
         /*!
-         * Evolve the deformation gradient ( F ) using the midpoint integration method and return the jacobian w.r.t. L.
+         * Evolve the deformation gradient using a Magnus integrator. Assumes the evolution equation is of the form
          *
-         * mode 1:
-         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
-         * \f$\frac{\partial F_{jI}^{t + 1}}{\partial L_{kl}^{t+1}} = \left[\delta_{kj} - \Delta t \left(1 - \alpha\right) L_{kj}\right]^{-1} \Delta t \left(1 - \alpha\right) F_{lI}^{t + 1}\f$
+         * \f$ \dot{F}_{iI} = \ell_{ij} F_{jI} \f$
          *
-         * mode 2:
-         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
-         * \f$\frac{\partial F_{iJ}^{t + 1}}{\partial L_{KL}} = \Delta t (1 - \alpha) F_{iK}^{t + 1} \left[\delta_{JL} - \right ]\f$
+         * with the velocity gradient varying linearly from Lp to L over the step so that
          *
-         * \param &Dt: The change in time.
+         * \f$ F^{t+1} = \exp\left( \Omega \right) F^{t} \f$
+         *
+         * The second order method uses the exponential midpoint rule
+         *
+         * \f$ \Omega = \frac{\Delta t}{2} \left( \ell^{t} + \ell^{t+1} \right) \f$
+         *
+         * and the fourth order method uses two point Gauss quadrature of the Magnus expansion which, for a linearly
+         * varying velocity gradient, reduces to
+         *
+         * \f$ \Omega = \frac{\Delta t}{2} \left( \ell^{t} + \ell^{t+1} \right) - \frac{\Delta t^2}{12} \left[ \ell^{t}, \ell^{t+1} \right] \f$
+         *
+         * Both preserve the group structure of F e.g. the determinant is exactly \f$\exp\left( \int tr\left( \ell \right) dt \right) \det F^{t}\f$.
+         *
+         * \param &Dt: The change in time
          * \param &previousDeformationGradient: The previous value of the deformation gradient
-         * \param &Lp: The previous velocity gradient.
-         * \param &L: The current velocity gradient.
-         * \param &dF: The change in the deformation gradient \f$\Delta \bf{F}\f$ such that \f$F_{iI}^{t+1} = F_{iI}^t + \Delta F_{iI}\f$
-         * \param &deformationGradient: The computed current deformation gradient.
-         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
-         * \param &ddFdFp: The derivative of the change in the deformation gradient w.r.t. the previous deformation gradient
-         * \param &dFdFp: The derivative of the deformation gradient w.r.t. the previous deformation gradient
-         * \param &dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient
-         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
-         * \param mode: The form of the ODE. See above for details.
+         * \param &Lp: The previous value of the velocity gradient
+         * \param &L: The current value of the velocity gradient
+         * \param &deformationGradient: The computed value of the deformation gradient
+         * \param *dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient. Skipped if NULL.
+         * \param *dFdFp: The derivative of the deformation gradient w.r.t. the previous deformation gradient. Skipped if NULL.
+         * \param *dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient. Skipped if NULL.
+         * \param order: The order of the method (2 or 4)
          */
 
-        //Assumes 3D
         constexpr unsigned int dim = 3;
-        const unsigned int sot_dim = dim * dim;
+        constexpr unsigned int sot_dim = dim * dim;
 
-        floatVector _dFdL;
-        floatVector _ddFdFp;
-        floatVector _dFdFp;
-        floatVector _dFdLp;
+        TARDIGRADE_ERROR_TOOLS_CHECK( previousDeformationGradient.size( ) == sot_dim, "The previous deformation gradient must have " + std::to_string( sot_dim ) + " values" );
 
-        errorOut error = evolveFFlatJ( Dt, previousDeformationGradient, Lp, L,
-                                       dF, deformationGradient, _dFdL, _ddFdFp, _dFdFp, _dFdLp, alpha, mode );
+        TARDIGRADE_ERROR_TOOLS_CHECK( Lp.size( ) == sot_dim, "The previous velocity gradient must have " + std::to_string( sot_dim ) + " values" );
 
-        if ( error ){
+        TARDIGRADE_ERROR_TOOLS_CHECK( L.size( ) == sot_dim, "The velocity gradient must have " + std::to_string( sot_dim ) + " values" );
 
-            errorOut result = new errorNode( __func__, "Error when computing the evolved deformation gradient" );
-            result->addNext( error );
-            return result;
+        TARDIGRADE_ERROR_TOOLS_CHECK( ( order == 2 ) || ( order == 4 ), "The order of the Magnus integrator must be 2 or 4" );
 
-        }
+        // The weight of the commutator term
+        const floatType c = ( order == 4 ) ? Dt * Dt / 12 : 0;
 
-        dFdL   = tardigradeVectorTools::inflate( _dFdL,   sot_dim, sot_dim );
-        ddFdFp = tardigradeVectorTools::inflate( _ddFdFp, sot_dim, sot_dim );
-        dFdFp  = tardigradeVectorTools::inflate( _dFdFp,  sot_dim, sot_dim );
-        dFdLp  = tardigradeVectorTools::inflate( _dFdLp,  sot_dim, sot_dim );
+        floatSecondOrderTensor Omega, expOmega;
 
-        return error;
+        for ( unsigned int i = 0; i < dim; i++ ){
 
-    }
-    errorOut evolveFFlatJ( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
-                           floatVector &dF, floatVector &deformationGradient, floatVector &dFdL, floatVector &ddFdFp, floatVector &dFdFp, floatVector &dFdLp, const floatType alpha, const unsigned int mode ){
-        /*!
-         * Evolve the deformation gradient ( F ) using the midpoint integration method and return the jacobian w.r.t. L.
-         *
-         * mode 1:
-         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
-         * \f$\frac{\partial F_{jI}^{t + 1}}{\partial L_{kl}^{t+1}} = \left[\delta_{kj} - \Delta t \left(1 - \alpha\right) L_{kj}\right]^{-1} \Delta t \left(1 - \alpha\right) F_{lI}^{t + 1}\f$
-         *
-         * mode 2:
-         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
-         * \f$\frac{\partial F_{iJ}^{t + 1}}{\partial L_{KL}} = \Delta t (1 - \alpha) F_{iK}^{t + 1} \left[\delta_{JL} - \right ]\f$
-         *
-         * \param &Dt: The change in time.
-         * \param &previousDeformationGradient: The previous value of the deformation gradient
-         * \param &Lp: The previous velocity gradient.
-         * \param &L: The current velocity gradient.
-         * \param &dF: The change in the deformation gradient \f$\Delta \bf{F}\f$ such that \f$F_{iI}^{t+1} = F_{iI}^t + \Delta F_{iI}\f$
-         * \param &deformationGradient: The computed current deformation gradient.
-         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
-         * \param &ddFdFp: The derivative of the change in the deformation gradient w.r.t. the previous deformation gradient
-         * \param &dFdFp: The derivative of the deformation gradient w.r.t. the previous deformation gradient
-         * \param &dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient
-         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
-         * \param mode: The form of the ODE. See above for details.
-         */
+            for ( unsigned int j = 0; j < dim; j++ ){
+
+                Omega[ dim * i + j ] = 0.5 * Dt * ( Lp[ dim * i + j ] + L[ dim * i + j ] );
+
+                for ( unsigned int k = 0; k < dim; k++ ){
 
-        //Assumes 3D
-        constexpr unsigned int dim = 3;
-        const unsigned int sot_dim = dim * dim;
+                    Omega[ dim * i + j ] -= c * ( Lp[ dim * i + k ] * L[ dim * k + j ] - L[ dim * i + k ] * Lp[ dim * k + j ] );
 
-        errorOut error = evolveF( Dt, previousDeformationGradient, Lp, L, dF, deformationGradient, alpha, mode);
+                }
 
-        if ( error ){
+            }
 
-            errorOut result = new errorNode( __func__, "Error when computing the evolved deformation gradient" );
-            result->addNext( error );
-            return result;
+        }
+
+        if ( !dFdL && !dFdLp ){
+
+            computeMatrixExponential( Omega, expOmega );
+
+            applyEvolutionOperator( expOmega, NULL, NULL, previousDeformationGradient, deformationGradient, dFdL, dFdFp, dFdLp );
+
+            return;
 
         }
 
-        //Compute L^{t + \alpha}
-        floatVector LtpAlpha = alpha * Lp + ( 1 - alpha ) * L;
+        floatFourthOrderTensor dExpdOmega, dPhidL, dPhidLp;
 
-        //Compute the left hand side
-        floatVector eye( dim * dim );
+        computeMatrixExponential( Omega, expOmega, dExpdOmega );
 
-        tardigradeVectorTools::eye( eye );
+        // Contract the derivative of the exponential with the derivatives of Omega w.r.t. the velocity gradients
+        // dOmega_cd / dL_ab  = Dt / 2 delta_ca delta_db - c ( Lp_ca delta_db - delta_ca Lp_bd )
+        // dOmega_cd / dLp_ab = Dt / 2 delta_ca delta_db - c ( delta_ca L_bd - L_ca delta_db )
+        for ( unsigned int ij = 0; ij < sot_dim; ij++ ){
 
-        floatVector invLHS = -Dt * ( 1 - alpha ) * L;
-        for ( unsigned int i = 0; i < dim; i++ ){ invLHS[ dim * i + i ] += 1; }
+            const floatType *E = dExpdOmega.data( ) + sot_dim * ij;
 
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > invLHS_map( invLHS.data( ), dim, dim );
+            for ( unsigned int a = 0; a < dim; a++ ){
 
-        invLHS_map = invLHS_map.inverse( ).eval( );
+                for ( unsigned int b = 0; b < dim; b++ ){
+
+                    floatType ELp = 0, LpE = 0, EL = 0, LE = 0;
 
-        //Compute the jacobian
-        dFdL   = floatVector( sot_dim * sot_dim, 0 );
-        ddFdFp = floatVector( sot_dim * sot_dim, 0 );
-        dFdLp  = floatVector( sot_dim * sot_dim, 0 );
-        if ( mode == 1 ){
-            for ( unsigned int j = 0; j < dim; j++ ){
-                for ( unsigned int I = 0; I < dim; I++ ){
                     for ( unsigned int k = 0; k < dim; k++ ){
-                        for ( unsigned int l = 0; l < dim; l++ ){
-                            dFdL[ dim * sot_dim * j + sot_dim * I + dim * k + l ]  += Dt * ( 1 - alpha ) * invLHS[ dim * j + k ] * deformationGradient[ dim * l + I ];
-                            dFdLp[ dim * sot_dim * j + sot_dim * I + dim * k + l ] += invLHS[ dim * j + k ] * Dt * alpha * previousDeformationGradient[ dim * l + I ];
-                            ddFdFp[ dim * sot_dim * j + sot_dim * I + dim * k + I ] += Dt * invLHS[ dim * j + l ] * LtpAlpha[ dim * l + k ];
-                        }
-                    }
-                }
-            }
-        }
-        if ( mode == 2 ){
-            for ( unsigned int j = 0; j < dim; j++ ){
-                for ( unsigned int I = 0; I < dim; I++ ){
-                    for ( unsigned int K = 0; K < dim; K++ ){
-                        for ( unsigned int _L = 0; _L < dim; _L++ ){
-                            dFdL[ dim * sot_dim * j + sot_dim * I + dim * K + _L ]  += Dt * ( 1 - alpha ) * invLHS[ dim * _L + I ] * deformationGradient[ dim * j + K ];
-                            dFdLp[ dim * sot_dim * j + sot_dim * I + dim * K + _L ] += Dt * alpha * invLHS[ dim * _L + I ] * previousDeformationGradient[ dim * j + K ];
-                            ddFdFp[ dim * sot_dim * j + sot_dim * I + dim * j + K ] += Dt * LtpAlpha[ dim * K + _L ] * invLHS[ dim * _L + I ];
-                        }
+
+                        // sum_c E_cb X_ca and sum_d E_ad X_bd
+                        ELp += E[ dim * k + b ] * Lp[ dim * k + a ];
+
+                        LpE += E[ dim * a + k ] * Lp[ dim * b + k ];
+
+                        EL  += E[ dim * k + b ] * L[ dim * k + a ];
+
+                        LE  += E[ dim * a + k ] * L[ dim * b + k ];
+
                     }
+
+                    dPhidL[ sot_dim * ij + dim * a + b ]  = 0.5 * Dt * E[ dim * a + b ] - c * ( ELp - LpE );
+
+                    dPhidLp[ sot_dim * ij + dim * a + b ] = 0.5 * Dt * E[ dim * a + b ] - c * ( LE - EL );
+
                 }
+
             }
+
         }
 
-        dFdFp = ddFdFp;
-        for ( unsigned int i = 0; i < sot_dim; i++ ){ dFdFp[ sot_dim * i + i ] += 1; }
+        applyEvolutionOperator( expOmega, &dPhidL, &dPhidLp, previousDeformationGradient, deformationGradient, dFdL, dFdFp, dFdLp );
 
-        return NULL;
     }
 
-    errorOut evolveFFlatJ( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
-                           floatVector &deformationGradient, floatVector &dFdL, floatVector &dFdFp, floatVector &dFdLp, const floatType alpha, const unsigned int mode ){
+    void evolveFMagnus( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                        floatVector &deformationGradient, const unsigned int order ){
         /*!
-         * Evolve the deformation gradient ( F ) using the midpoint integration method and return the jacobian w.r.t. L.
+         * Evolve the deformation gradient using a second or fourth order Magnus integrator. Assumes the evolution
+         * equation is of the form
          *
-         * mode 1:
-         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
-         * \f$\frac{\partial F_{jI}^{t + 1}}{\partial L_{kl}^{t+1}} = \left[\delta_{kj} - \Delta t \left(1 - \alpha\right) L_{kj}\right]^{-1} \Delta t \left(1 - \alpha\right) F_{lI}^{t + 1}\f$
+         * \f$ \dot{F}_{iI} = \ell_{ij} F_{jI} \f$
          *
-         * mode 2:
-         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
-         * \f$\frac{\partial F_{iJ}^{t + 1}}{\partial L_{KL}} = \Delta t (1 - \alpha) F_{iK}^{t + 1} \left[\delta_{JL} - \right ]\f$
+         * with the velocity gradient varying linearly over the step. See evolveFMagnusEngine for details.
          *
-         * \param &Dt: The change in time.
+         * \param &Dt: The change in time
          * \param &previousDeformationGradient: The previous value of the deformation gradient
-         * \param &Lp: The previous velocity gradient.
-         * \param &L: The current velocity gradient.
-         * \param &deformationGradient: The computed current deformation gradient.
-         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
-         * \param &dFdL: The derivative of the deformation gradient w.r.t. the previous deformation gradient
-         * \param &dFdL: The derivative of the deformation gradient w.r.t. the previous velocity gradient
-         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
-         * \param mode: The form of the ODE. See above for details.
+         * \param &Lp: The previous value of the velocity gradient
+         * \param &L: The current value of the velocity gradient
+         * \param &deformationGradient: The computed value of the deformation gradient
+         * \param order: The order of the method (2 or 4)
          */
 
-        floatVector dF;
-        floatVector ddFdFp;
-
-        return evolveFFlatJ( Dt, previousDeformationGradient, Lp, L, dF, deformationGradient, dFdL, ddFdFp, dFdFp, dFdLp, alpha, mode );
+        evolveFMagnusEngine( Dt, previousDeformationGradient, Lp, L, deformationGradient, NULL, NULL, NULL, order );
 
     }
 
-    errorOut evolveF( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
-                      floatVector &deformationGradient, floatMatrix &dFdL, floatMatrix &dFdFp, floatMatrix &dFdLp, const floatType alpha, const unsigned int mode ){
+    void evolveFMagnus( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                        floatVector &deformationGradient, floatVector &dFdL, const unsigned int order ){
         /*!
-         * Evolve the deformation gradient ( F ) using the midpoint integration method and return the jacobian w.r.t. L.
+         * Evolve the deformation gradient using a second or fourth order Magnus integrator. Assumes the evolution
+         * equation is of the form
          *
-         * mode 1:
-         * \f$F_{iI}^{t + 1} = \left[\delta_{ij} - \Delta t \left(1 - \alpha \right) L_{ij}^{t+1} \right]^{-1} \left[F_{iI}^{t} + \Delta t \alpha \dot{F}_{iI}^{t} \right]\f$
-         * \f$\frac{\partial F_{jI}^{t + 1}}{\partial L_{kl}^{t+1}} = \left[\delta_{kj} - \Delta t \left(1 - \alpha\right) L_{kj}\right]^{-1} \Delta t \left(1 - \alpha\right) F_{lI}^{t + 1}\f$
+         * \f$ \dot{F}_{iI} = \ell_{ij} F_{jI} \f$
          *
-         * mode 2:
-         * \f$F_{iI}^{t + 1} = \left[F_{iJ}^{t} + \Delta t \alpha \dot{F}_{iJ}^{t} \right] \left[\delta_{IJ} - \Delta T \left( 1- \alpha \right) L_{IJ}^{t+1} \right]^{-1}\f$
-         * \f$\frac{\partial F_{iJ}^{t + 1}}{\partial L_{KL}} = \Delta t (1 - \alpha) F_{iK}^{t + 1} \left[\delta_{JL} - \right ]\f$
+         * with the velocity gradient varying linearly over the step. See evolveFMagnusEngine for details.
          *
-         * \param &Dt: The change in time.
+         * \param &Dt: The change in time
          * \param &previousDeformationGradient: The previous value of the deformation gradient
-         * \param &Lp: The previous velocity gradient.
-         * \param &L: The current velocity gradient.
-         * \param &deformationGradient: The computed current deformation gradient.
+         * \param &Lp: The previous value of the velocity gradient
+         * \param &L: The current value of the velocity gradient
+         * \param &deformationGradient: The computed value of the deformation gradient
          * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
-         * \param &dFdL: The derivative of the deformation gradient w.r.t. the previous deformation gradient
-         * \param &dFdL: The derivative of the deformation gradient w.r.t. the previous velocity gradient
-         * \param alpha: The integration parameter ( 0 for implicit, 1 for explicit )
-         * \param mode: The form of the ODE. See above for details.
+         * \param order: The order of the method (2 or 4)
          */
 
-        floatVector dF;
-        floatMatrix ddFdFp;
-
-        return evolveF( Dt, previousDeformationGradient, Lp, L, dF, deformationGradient, dFdL, ddFdFp, dFdFp, dFdLp, alpha, mode );
+        evolveFMagnusEngine( Dt, previousDeformationGradient, Lp, L, deformationGradient, &dFdL, NULL, NULL, order );
 
     }
 
-    floatType mac(const floatType &x){
+    void evolveFMagnus( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                        floatVector &deformationGradient, floatVector &dFdL, floatVector &dFdFp, floatVector &dFdLp, const unsigned int order ){
         /*!
-         * Compute the Macaulay brackets of a scalar x
+         * Evolve the deformation gradient using a second or fourth order Magnus integrator. Assumes the evolution
+         * equation is of the form
          *
-         * returns x if x>0, 0 otherwise
+         * \f$ \dot{F}_{iI} = \ell_{ij} F_{jI} \f$
          *
-         * \param &x: The incoming scalar.
+         * with the velocity gradient varying linearly over the step. See evolveFMagnusEngine for details.
+         *
+         * \param &Dt: The change in time
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous value of the velocity gradient
+         * \param &L: The current value of the velocity gradient
+         * \param &deformationGradient: The computed value of the deformation gradient
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
+         * \param &dFdFp: The derivative of the deformation gradient w.r.t. the previous deformation gradient
+         * \param &dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient
+         * \param order: The order of the method (2 or 4)
          */
 
-        return 0.5 * ( fabs( x ) + x );
-    }
-
-    floatType mac( const floatType &x, floatType &dmacdx ){
-        /*!
-         * Compute the Macaulay brackets of the scalar x and
-         * return the jacobian as well.
-         * 
-         * returns x if x>0, 0 otherwise
-         * 
-         * The Jacobian is the Heaviside function
-         * 
-         * \param &x: The incoming scalar
-         * \param &dmacdx: The returned jacobian
-         */
+        evolveFMagnusEngine( Dt, previousDeformationGradient, Lp, L, deformationGradient, &dFdL, &dFdFp, &dFdLp, order );
 
-        dmacdx = 0;
-        if ( x >= 0 ){ dmacdx = 1; }
-        return mac( x );
     }
 
-    errorOut computeUnitNormal(const floatVector &A, floatVector &Anorm){
+    static void evolveFRungeKutta4Engine( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                                   floatVector &deformationGradient, floatVector *dFdL, floatVector *dFdFp, floatVector *dFdLp ){
         /*!
-         * Compute the unit normal of a second order tensor (or strictly speaking
-         * any tensor).
+         * Evolve the deformation gradient using the classical fourth order Runge-Kutta method. Assumes the evolution
+         * equation is of the form
          *
-         * \param &A: The second order tensor
-         * \param &Anorm: The unit normal in the direction of A
+         * \f$ \dot{F}_{iI} = \ell_{ij} F_{jI} \f$
+         *
+         * with the velocity gradient varying linearly from Lp to L over the step. Because the equation is linear in F
+         * the stages are formed as operators acting on the previous deformation gradient
+         *
+         * \f$ K_1 = \ell^{t}, K_2 = \ell^{t + 1/2} \left( I + \frac{\Delta t}{2} K_1 \right), K_3 = \ell^{t + 1/2} \left( I + \frac{\Delta t}{2} K_2 \right), K_4 = \ell^{t+1} \left( I + \Delta t K_3 \right) \f$
+         *
+         * \f$ F^{t+1} = \left[ I + \frac{\Delta t}{6} \left( K_1 + 2 K_2 + 2 K_3 + K_4 \right) \right] F^{t} \f$
+         *
+         * Unlike the Magnus integrators the determinant of F is only preserved to fourth order.
+         *
+         * \param &Dt: The change in time
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous value of the velocity gradient
+         * \param &L: The current value of the velocity gradient
+         * \param &deformationGradient: The computed value of the deformation gradient
+         * \param *dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient. Skipped if NULL.
+         * \param *dFdFp: The derivative of the deformation gradient w.r.t. the previous deformation gradient. Skipped if NULL.
+         * \param *dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient. Skipped if NULL.
          */
 
-        const unsigned int A_size = A.size( );
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
+        constexpr unsigned int fot_dim = sot_dim * sot_dim;
 
-        floatType norm = sqrt(tardigradeVectorTools::inner(A, A));
+        TARDIGRADE_ERROR_TOOLS_CHECK( previousDeformationGradient.size( ) == sot_dim, "The previous deformation gradient must have " + std::to_string( sot_dim ) + " values" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( Lp.size( ) == sot_dim, "The previous velocity gradient must have " + std::to_string( sot_dim ) + " values" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( L.size( ) == sot_dim, "The velocity gradient must have " + std::to_string( sot_dim ) + " values" );
+
+        const bool computeJacobians = dFdL || dFdLp;
+
+        // The stages and their derivatives w.r.t. L ( index 0 ) and Lp ( index 1 )
+        floatSecondOrderTensor K[ 4 ], Lm, Phi;
+
+        floatFourthOrderTensor dK[ 4 ][ 2 ], dPhi[ 2 ];
+
+        for ( unsigned int i = 0; i < sot_dim; i++ ){ K[ 0 ][ i ] = Lp[ i ]; Lm[ i ] = 0.5 * ( Lp[ i ] + L[ i ] ); }
+
+        if ( computeJacobians ){
+
+            for ( unsigned int s = 0; s < 4; s++ ){ dK[ s ][ 0 ].fill( 0 ); dK[ s ][ 1 ].fill( 0 ); }
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ dK[ 0 ][ 1 ][ sot_dim * i + i ] = 1; }
 
-        if ( tardigradeVectorTools::fuzzyEquals( norm, 0. ) ){
-            Anorm = floatVector( A_size, 0 );
         }
-        else {
-            Anorm = A/norm;
+
+        // K_s = X_s ( I + h_s K_{s-1} ) where X_s is the velocity gradient at the stage
+        const floatSecondOrderTensor *X[ 4 ] = { NULL, &Lm, &Lm, NULL };
+
+        floatSecondOrderTensor LTensor;
+
+        std::copy( L.begin( ), L.end( ), LTensor.begin( ) );
+
+        X[ 3 ] = &LTensor;
+
+        // The derivatives of the stage velocity gradients w.r.t. L and Lp
+        const floatType dXdL[ 4 ]  = { 0, 0.5, 0.5, 1 };
+        const floatType dXdLp[ 4 ] = { 1, 0.5, 0.5, 0 };
+
+        const floatType hs[ 4 ] = { 0, 0.5 * Dt, 0.5 * Dt, Dt };
+
+        for ( unsigned int s = 1; s < 4; s++ ){
+
+            // Y = I + h_s K_{s-1}
+            floatSecondOrderTensor Y;
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){ Y[ i ] = hs[ s ] * K[ s - 1 ][ i ]; }
+
+            for ( unsigned int i = 0; i < dim; i++ ){ Y[ dim * i + i ] += 1; }
+
+            K[ s ].fill( 0 );
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                for ( unsigned int j = 0; j < dim; j++ ){
+
+                    for ( unsigned int k = 0; k < dim; k++ ){
+
+                        K[ s ][ dim * i + j ] += ( *X[ s ] )[ dim * i + k ] * Y[ dim * k + j ];
+
+                    }
+
+                }
+
+            }
+
+            if ( !computeJacobians ){ continue; }
+
+            // dK_ij / dZ_ab = dX_ik / dZ_ab Y_kj + h_s X_ik dK_{s-1,kj} / dZ_ab
+            const floatType dXdZ[ 2 ] = { dXdL[ s ], dXdLp[ s ] };
+
+            for ( unsigned int z = 0; z < 2; z++ ){
+
+                for ( unsigned int i = 0; i < dim; i++ ){
+
+                    for ( unsigned int j = 0; j < dim; j++ ){
+
+                        for ( unsigned int b = 0; b < dim; b++ ){
+
+                            dK[ s ][ z ][ dim * sot_dim * i + sot_dim * j + dim * i + b ] += dXdZ[ z ] * Y[ dim * b + j ];
+
+                        }
+
+                        for ( unsigned int k = 0; k < dim; k++ ){
+
+                            for ( unsigned int ab = 0; ab < sot_dim; ab++ ){
+
+                                dK[ s ][ z ][ dim * sot_dim * i + sot_dim * j + ab ] += hs[ s ] * ( *X[ s ] )[ dim * i + k ] * dK[ s - 1 ][ z ][ dim * sot_dim * k + sot_dim * j + ab ];
+
+                            }
+
+                        }
+
+                    }
+
+                }
+
+            }
+
         }
 
-        return NULL;
+        const floatType w[ 4 ] = { Dt / 6, Dt / 3, Dt / 3, Dt / 6 };
+
+        for ( unsigned int i = 0; i < sot_dim; i++ ){
+
+            Phi[ i ] = w[ 0 ] * K[ 0 ][ i ] + w[ 1 ] * K[ 1 ][ i ] + w[ 2 ] * K[ 2 ][ i ] + w[ 3 ] * K[ 3 ][ i ];
+
+        }
+
+        for ( unsigned int i = 0; i < dim; i++ ){ Phi[ dim * i + i ] += 1; }
+
+        if ( computeJacobians ){
+
+            for ( unsigned int z = 0; z < 2; z++ ){
+
+                for ( unsigned int i = 0; i < fot_dim; i++ ){
+
+                    dPhi[ z ][ i ] = w[ 0 ] * dK[ 0 ][ z ][ i ] + w[ 1 ] * dK[ 1 ][ z ][ i ] + w[ 2 ] * dK[ 2 ][ z ][ i ] + w[ 3 ] * dK[ 3 ][ z ][ i ];
+
+                }
+
+            }
+
+        }
+
+        applyEvolutionOperator( Phi, &dPhi[ 0 ], &dPhi[ 1 ], previousDeformationGradient, deformationGradient, dFdL, dFdFp, dFdLp );
+
     }
 
-    errorOut computeUnitNormal(const floatVector &A, floatVector &Anorm, floatVector &dAnormdA){
+    void evolveFRungeKutta4( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                             floatVector &deformationGradient ){
         /*!
-         * Compute the unit normal of a second order tensor (or strictly speaking any
-         * tensor) and the gradient of that unit normal w.r.t. the tensor.
+         * Evolve the deformation gradient using the classical fourth order Runge-Kutta method. Assumes the evolution
+         * equation is of the form
          *
-         * \param &A: The second order tensor
-         * \param &Anorm: The unit normal in the direction of A
-         * \param &dAnormdA: The gradient of the unit normal w.r.t. A
+         * \f$ \dot{F}_{iI} = \ell_{ij} F_{jI} \f$
+         *
+         * with the velocity gradient varying linearly over the step. See evolveFRungeKutta4Engine for details.
+         *
+         * \param &Dt: The change in time
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous value of the velocity gradient
+         * \param &L: The current value of the velocity gradient
+         * \param &deformationGradient: The computed value of the deformation gradient
          */
 
-        const unsigned int A_size = A.size( );
+        evolveFRungeKutta4Engine( Dt, previousDeformationGradient, Lp, L, deformationGradient, NULL, NULL, NULL );
 
-        floatType norm = sqrt(tardigradeVectorTools::inner(A, A));
+    }
+
+    void evolveFRungeKutta4( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                             floatVector &deformationGradient, floatVector &dFdL ){
+        /*!
+         * Evolve the deformation gradient using the classical fourth order Runge-Kutta method. Assumes the evolution
+         * equation is of the form
+         *
+         * \f$ \dot{F}_{iI} = \ell_{ij} F_{jI} \f$
+         *
+         * with the velocity gradient varying linearly over the step. See evolveFRungeKutta4Engine for details.
+         *
+         * \param &Dt: The change in time
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous value of the velocity gradient
+         * \param &L: The current value of the velocity gradient
+         * \param &deformationGradient: The computed value of the deformation gradient
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
+         */
 
-        if ( tardigradeVectorTools::fuzzyEquals( norm, 0. ) ){
-            Anorm = floatVector( A_size, 0 );
-        }
-        else {
-            Anorm = A/norm;
-        }
+        evolveFRungeKutta4Engine( Dt, previousDeformationGradient, Lp, L, deformationGradient, &dFdL, NULL, NULL );
 
-        dAnormdA = floatVector( A_size * A_size, 0 );
+    }
 
-        for ( unsigned int i = 0; i < A_size; i++ ){
+    void evolveFRungeKutta4( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                             floatVector &deformationGradient, floatVector &dFdL, floatVector &dFdFp, floatVector &dFdLp ){
+        /*!
+         * Evolve the deformation gradient using the classical fourth order Runge-Kutta method. Assumes the evolution
+         * equation is of the form
+         *
+         * \f$ \dot{F}_{iI} = \ell_{ij} F_{jI} \f$
+         *
+         * with the velocity gradient varying linearly over the step. See evolveFRungeKutta4Engine for details.
+         *
+         * \param &Dt: The change in time
+         * \param &previousDeformationGradient: The previous value of the deformation gradient
+         * \param &Lp: The previous value of the velocity gradient
+         * \param &L: The current value of the velocity gradient
+         * \param &deformationGradient: The computed value of the deformation gradient
+         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
+         * \param &dFdFp: The derivative of the deformation gradient w.r.t. the previous deformation gradient
+         * \param &dFdLp: The derivative of the deformation gradient w.r.t. the previous velocity gradient
+         */
 
-            dAnormdA[ A_size * i + i ] += 1;
+        evolveFRungeKutta4Engine( Dt, previousDeformationGradient, Lp, L, deformationGradient, &dFdL, &dFdFp, &dFdLp );
 
-            for ( unsigned int j = 0; j < A_size; j++ ){
+    }
 
-                dAnormdA[ A_size * i + j ] -= Anorm[ i ] * Anorm[ j ];
+    void computeDCurrentNormalVectorDF( const floatVector &normalVector, const floatVector &F, floatVector &dNormalVectordF ){
+        /*!
+         * Compute the derivative of the normal vector in the current configuration w.r.t. the deformation gradient
+         * 
+         * \param &normalVector: The unit normal vector in the current configuration
+         * \param &F: The deformation gradient
+         * \param &dNormalVectordF: The derivative of the normal vector w.r.t. the deformation gradient
+         */
 
-            }
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
 
-        }
+        TARDIGRADE_ERROR_TOOLS_CHECK( F.size( ) == sot_dim, "The deformation gradient must be a second order tensor of size " + std::to_string( sot_dim ) + " and it has " + std::to_string( F.size( ) ) + " elements" );
 
-        dAnormdA /= norm;
+        computeDCurrentNormalVectorDF( normalVector, KinematicState( F ), dNormalVectordF );
 
-        return NULL;
     }
 
-    errorOut computeUnitNormal(const floatVector &A, floatVector &Anorm, floatMatrix &dAnormdA){
+    void computeDCurrentAreaWeightedNormalVectorDF( const floatVector &normalVector, const floatVector &F, floatVector &dAreaWeightedNormalVectordF ){
         /*!
-         * Compute the unit normal of a second order tensor (or strictly speaking any
-         * tensor) and the gradient of that unit normal w.r.t. the tensor.
-         *
-         * \param &A: The second order tensor
-         * \param &Anorm: The unit normal in the direction of A
-         * \param &dAnormdA: The gradient of the unit normal w.r.t. A
+         * Compute the derivative of the area weighted normal vector w.r.t. the deformation gradient i.e.
+         * 
+         * \f$ \frac{\partial}{\partial F_{bB}} \left( n_i da \right) \f$
+         * 
+         * Note that if the user passes in the unit normal vector, then the result will be more convenient for the construction of
+         * the jacobian of a surface integral in the current configuration.
+         * 
+         * \param &normalVector: The normal vector (a unit vector is likely what is desired)
+         * \param &F: The deformation gradient
+         * \param &dAreaWeightedNormalVectordF: The derivative of the area weighted normal vector w.r.t. the deformation gradient
          */
 
-        const unsigned int A_size = A.size( );
-
-        floatVector _dAnormdA;
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( computeUnitNormal( A, Anorm, _dAnormdA ) );
+        TARDIGRADE_ERROR_TOOLS_CHECK( F.size( ) == sot_dim, "The deformation gradient must be a second order tensor of size " + std::to_string( sot_dim ) + " and it has " + std::to_string( F.size( ) ) + " elements" );
 
-        dAnormdA = tardigradeVectorTools::inflate( _dAnormdA, A_size, A_size );
+        computeDCurrentAreaWeightedNormalVectorDF( normalVector, KinematicState( F ), dAreaWeightedNormalVectordF );
 
-        return NULL;
     }
 
-    errorOut pullBackVelocityGradient(const floatVector &velocityGradient, const floatVector &deformationGradient,
-                                      floatVector &pulledBackVelocityGradient){
+    void computeDCurrentAreaDF( const floatVector &normalVector, const floatVector &F, floatVector &dCurrentAreadF ){
         /*!
-         * Pull back the velocity gradient to the configuration indicated by deformationGradient, i.e.
-         *
-         * \f$totalDeformationGradient_{iI} = deformationGradient_{i \bar{I}} remainingDeformationGradient_{\bar{I}I}\f$
-         *
-         * This is done via
-         *
-         * \f$L_{\bar{I} \bar{J}} = deformationGradient_{\bar{I} i}^{-1} velocityGradient_{ij} deformationGradient_{j\bar{J}}\f$
-         *
-         * \param &velocityGradient: The velocity gradient in the current configuration.
-         * \param &deformationGradient: The deformation gradient between the desired configuration
-         *     and the current configuration.
-         * \param &pulledBackVelocityGradient: The pulled back velocity gradient.
+         * Compute the derivative of the current area w.r.t. the deformation gradient
+         * 
+         * \param &normalVector: The current unit normal vector
+         * \param &F: The deformation gradient
+         * \param &dCurrentAreadF: The derivative of the current surface area w.r.t. F
          */
 
-        //Assume 3D
         constexpr unsigned int dim = 3;
         constexpr unsigned int sot_dim = dim * dim;
 
-        //Invert the deformation gradient
-        pulledBackVelocityGradient = floatVector( sot_dim, 0 );
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F( deformationGradient.data( ), dim, dim );
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > L( velocityGradient.data( ), dim, dim );
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > pullBackL( pulledBackVelocityGradient.data( ), dim, dim );
+        TARDIGRADE_ERROR_TOOLS_CHECK( F.size( ) == sot_dim, "The deformation gradient must be a second order tensor of size " + std::to_string( sot_dim ) + " and it has " + std::to_string( F.size( ) ) + " elements" );
 
-        pullBackL = ( F.inverse( ) * L * F ).eval( );
+        computeDCurrentAreaDF( normalVector, KinematicState( F ), dCurrentAreadF );
 
-        return NULL;
     }
 
-    errorOut pullBackVelocityGradient(const floatVector &velocityGradient, const floatVector &deformationGradient,
-                                      floatVector &pulledBackVelocityGradient, floatVector &dPullBackLdL,
-                                      floatVector &dPullBackLdF){
+    void computeDCurrentNormalVectorDF( const floatVector &normalVector, const KinematicState &kinematics, floatVector &dNormalVectordF ){
         /*!
-         * Pull back the velocity gradient to the configuration indicated by deformationGradient, i.e.
-         *
-         * \f$totalDeformationGradient_{iI} = deformationGradient_{i \bar{I}} remainingDeformationGradient_{\bar{I}I}\f$
-         *
-         * This is done via
-         *
-         * \f$L_{\bar{I} \bar{J}} = deformationGradient_{\bar{I} i}^{-1} velocityGradient_{ij} deformationGradient_{j\bar{J}}\f$
-         *
-         * \param &velocityGradient: The velocity gradient in the current configuration.
-         * \param &deformationGradient: The deformation gradient between the desired configuration
-         *     and the current configuration.
-         * \param &pulledBackVelocityGradient: The pulled back velocity gradient.
-         * \param &dPullBackLdL: The gradient of the pulled back velocity gradient
-         *     w.r.t. the velocity gradient.
-         * \param &dPullBackLdF: The gradient of the pulled back velocity gradient
-         *     w.r.t. the deformation gradient.
+         * Compute the derivative of the normal vector in the current configuration w.r.t. the deformation gradient
+         * using the cached inverse of the deformation gradient
+         * 
+         * \param &normalVector: The unit normal vector in the current configuration
+         * \param &kinematics: The kinematic state of the deformation gradient
+         * \param &dNormalVectordF: The derivative of the normal vector w.r.t. the deformation gradient
          */
 
-        //Assume 3D
         constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
-
-        pulledBackVelocityGradient = floatVector( sot_dim, 0 );
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F( deformationGradient.data( ), dim, dim );
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > L( velocityGradient.data( ), dim, dim );
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > pullBackL( pulledBackVelocityGradient.data( ), dim, dim );
+        constexpr unsigned int tot_dim = dim * dim * dim;
 
-        floatVector inverseDeformationGradient = deformationGradient;
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > invF_map( inverseDeformationGradient.data( ), dim, dim );
-        invF_map = invF_map.inverse( ).eval( );
+        TARDIGRADE_ERROR_TOOLS_CHECK( normalVector.size( ) == dim, "The normal vector must have " + std::to_string( dim ) + " elements and it has " + std::to_string( normalVector.size( ) ) );
 
-        floatVector term2( sot_dim, 0 );
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > term2_map( term2.data( ), dim, dim );
+        dNormalVectordF = floatVector( tot_dim, 0 );
 
-        term2_map = ( invF_map * L ).eval( );
+        const floatSecondOrderTensor &invF = kinematics.inverse( );
 
-        //Pull back the velocity gradient
-        pullBackL = ( term2_map * F ).eval( );
+        floatType invF_n[ dim ] = { 0, 0, 0 };
 
-        //Construct the gradients
-        dPullBackLdL = floatVector( sot_dim * sot_dim, 0 );
-        dPullBackLdF = floatVector( sot_dim * sot_dim, 0 );
+        for ( unsigned int B = 0; B < dim; B++ ){
 
-        for (unsigned int I=0; I<dim; I++){
-            for (unsigned int J=0; J<dim; J++){
-                for (unsigned int k=0; k<dim; k++){
-                    for (unsigned int l=0; l<dim; l++){
-                        dPullBackLdL[sot_dim * dim * I + sot_dim * J + dim * k + l ] = inverseDeformationGradient[dim*I + k] * deformationGradient[dim*l + J];
-                    }
+            for ( unsigned int j = 0; j < dim; j++ ){
 
-                    dPullBackLdF[sot_dim * dim * I + sot_dim * J + dim * k + J ] += term2[dim*I + k];
+                invF_n[ B ] += invF[ dim * B + j ] * normalVector[ j ];
 
-                    for ( unsigned int K = 0; K < dim; K++ ){
-                        dPullBackLdF[sot_dim * dim * I + sot_dim * J + dim * k + K ] -= inverseDeformationGradient[dim*I + k] * pulledBackVelocityGradient[dim*K + J];
-                    }
-                }
             }
+
         }
 
-        return NULL;
-    }
+        for ( unsigned int i = 0; i < dim; i++ ){
 
-    errorOut pullBackVelocityGradient(const floatVector &velocityGradient, const floatVector &deformationGradient,
-                                      floatVector &pulledBackVelocityGradient, floatMatrix &dPullBackLdL,
-                                      floatMatrix &dPullBackLdF){
-        /*!
-         * Pull back the velocity gradient to the configuration indicated by deformationGradient, i.e.
-         *
-         * \f$totalDeformationGradient_{iI} = deformationGradient_{i \bar{I}} remainingDeformationGradient_{\bar{I}I}\f$
-         *
-         * This is done via
-         *
-         * \f$L_{\bar{I} \bar{J}} = deformationGradient_{\bar{I} i}^{-1} velocityGradient_{ij} deformationGradient_{j\bar{J}}\f$
-         *
-         * \param &velocityGradient: The velocity gradient in the current configuration.
-         * \param &deformationGradient: The deformation gradient between the desired configuration
-         *     and the current configuration.
-         * \param &pulledBackVelocityGradient: The pulled back velocity gradient.
-         * \param &dPullBackLdL: The gradient of the pulled back velocity gradient
-         *     w.r.t. the velocity gradient.
-         * \param &dPullBackLdF: The gradient of the pulled back velocity gradient
-         *     w.r.t. the deformation gradient.
-         */
+            for ( unsigned int b = 0; b < dim; b++ ){
 
-        //Assume 3D
-        constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
+                for ( unsigned int B = 0; B < dim; B++ ){
 
-        floatVector _dPullBackLdL, _dPullBackLdF;
+                    dNormalVectordF[ dim * dim * i + dim * b + B ] += normalVector[ i ] * normalVector[ b ] * invF_n[ B ]
+                                                                    - normalVector[ b ] * invF[ dim * B + i ];
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( pullBackVelocityGradient( velocityGradient, deformationGradient, pulledBackVelocityGradient, _dPullBackLdL, _dPullBackLdF ) );
+                }
 
-        dPullBackLdL = tardigradeVectorTools::inflate( _dPullBackLdL, sot_dim, sot_dim );
+            }
 
-        dPullBackLdF = tardigradeVectorTools::inflate( _dPullBackLdF, sot_dim, sot_dim );
+        }
 
-        return NULL;
     }
 
-    errorOut quadraticThermalExpansion(const floatType &temperature, const floatType &referenceTemperature,
-                                       const floatVector &linearParameters, const floatVector &quadraticParameters,
-                                       floatVector &thermalExpansion){
+    void computeDCurrentAreaWeightedNormalVectorDF( const floatVector &normalVector, const KinematicState &kinematics, floatVector &dAreaWeightedNormalVectordF ){
         /*!
-         * Define a quadratic equation for the thermal expansion. This could be the
-         * thermal strain or the value of the stretch tensor.
+         * Compute the derivative of the area weighted normal vector w.r.t. the deformation gradient using the
+         * cached inverse of the deformation gradient i.e.
          * 
-         * \f$ e^{\theta}_{ij} = a_{ij} \left(\theta - \theta_0\right) + b_{ij} \left(\theta^2 - \theta_0^2\right)\f$
+         * \f$ \frac{\partial}{\partial F_{bB}} \left( n_i da \right) \f$
          * 
-         * Where \f$e^{\theta}_{ij}\f$ is the thermal expansion, \f$a_{ij}\f$ are the linear parameters,
-         * \f$b_{ij}\f$ are the quadratic parameters, \f$\theta\f$ is the current temperature, and \f$\theta_0\f$
-         * is the reference temperature.
-         *
-         * \param &temperature: The temperature
-         * \param &referenceTemperature: The reference temperature
-         * \param &linearParameters: The linear thermal expansion parameters.
-         * \param &quadraticParameters: The quadratic thermal expansion parameters.
-         * \param &thermalExpansion: The resulting thermal expansion.
+         * \param &normalVector: The normal vector (a unit vector is likely what is desired)
+         * \param &kinematics: The kinematic state of the deformation gradient
+         * \param &dAreaWeightedNormalVectordF: The derivative of the area weighted normal vector w.r.t. the deformation gradient
          */
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( linearParameters.size() == quadraticParameters.size(), "The linear and quadratic parameters must have the same length");
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int tot_dim = dim * dim * dim;
 
-        thermalExpansion = linearParameters * temperature          + quadraticParameters * temperature * temperature
-                         - linearParameters * referenceTemperature - quadraticParameters * referenceTemperature * referenceTemperature;
+        TARDIGRADE_ERROR_TOOLS_CHECK( normalVector.size( ) == dim, "The normal vector must have " + std::to_string( dim ) + " elements and it has " + std::to_string( normalVector.size( ) ) );
 
-        return NULL;
-    }
+        dAreaWeightedNormalVectordF = floatVector( tot_dim, 0 );
 
-    errorOut quadraticThermalExpansion(const floatType &temperature, const floatType &referenceTemperature,
-                                       const floatVector &linearParameters, const floatVector &quadraticParameters,
-                                       floatVector &thermalExpansion, floatVector &thermalExpansionJacobian){
-        /*!
-         * Define a quadratic equation for the thermal expansion. This could be the
-         * thermal strain or the value of the stretch tensor.
-         * 
-         * \f$ e^{\theta}_{ij} = a_{ij} \left(\theta - \theta_0\right) + b_{ij} \left(\theta^2 - \theta_0^2\right)\f$
-         * 
-         * Where \f$e^{\theta}_{ij}\f$ is the thermal expansion, \f$a_{ij}\f$ are the linear parameters,
-         * \f$b_{ij}\f$ are the quadratic parameters, \f$\theta\f$ is the current temperature, and \f$\theta_0\f$
-         * is the reference temperature.
-         *
-         * \param &temperature: The temperature
-         * \param &referenceTemperature: The reference temperature
-         * \param &linearParameters: The linear thermal expansion parameters.
-         * \param &quadraticParameters: The quadratic thermal expansion parameters.
-         * \param &thermalExpansion: The resulting thermal expansion.
-         * \param &thermalExpansionJacobian: The gradient of the thermal expansion w.r.t.
-         *     the temperature.
-         */
+        const floatSecondOrderTensor &invF = kinematics.inverse( );
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( quadraticThermalExpansion(temperature, referenceTemperature, linearParameters, quadraticParameters,
-                                                                thermalExpansion) )
+        for ( unsigned int i = 0; i < dim; i++ ){
 
-        thermalExpansionJacobian = linearParameters + 2 * quadraticParameters * temperature;
+            for ( unsigned int b = 0; b < dim; b++ ){
 
-        return NULL;
-    }
+                for ( unsigned int B = 0; B < dim; B++ ){
 
-    errorOut pushForwardGreenLagrangeStrain(const floatVector &greenLagrangeStrain, const floatVector &deformationGradient,
-                                            floatVector &almansiStrain){
-        /*!
-         * Push forward the Green-Lagrange strain to the current configuration.
-         *
-         * \f$e_{ij} = F_{Ii}^{-1} E_{IJ} F_{Jj}^{-1}\f$
-         *
-         * where \f$e_{ij}\f$ is the Almansi strain (the strain in the current configuration, \f$F_{iI}^{-1}\f$ is the
-         * inverse of the deformation gradient, and \f$E_{IJ}\f$ is the Green-Lagrange strain.
-         *
-         * \param &greenLagrangeStrain: The Green-Lagrange strain.
-         * \param &deformationGradient: The deformation gradient mapping between configurations.
-         * \param &almansiStrain: The strain in the current configuration indicated by the deformation gradient.
+                    dAreaWeightedNormalVectordF[ dim * dim * i + dim * b + B ] += normalVector[ i ] * invF[ dim * B + b ]
+                                                                                - normalVector[ b ] * invF[ dim * B + i ];
+
+                }
+
+            }
+
+        }
+
+    }
+
+    void computeDCurrentAreaDF( const floatVector &normalVector, const KinematicState &kinematics, floatVector &dCurrentAreadF ){
+        /*!
+         * Compute the derivative of the current area w.r.t. the deformation gradient using the cached inverse of
+         * the deformation gradient
+         * 
+         * \param &normalVector: The current unit normal vector
+         * \param &kinematics: The kinematic state of the deformation gradient
+         * \param &dCurrentAreadF: The derivative of the current surface area w.r.t. F
          */
 
-        //Assume 3D
         constexpr unsigned int dim = 3;
         constexpr unsigned int sot_dim = dim * dim;
 
-        floatVector inverseDeformationGradient = deformationGradient;
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > invF( inverseDeformationGradient.data( ), dim, dim );
-        invF = invF.inverse( ).eval( );
+        TARDIGRADE_ERROR_TOOLS_CHECK( normalVector.size( ) == dim, "The normal vector must have " + std::to_string( dim ) + " elements and it has " + std::to_string( normalVector.size( ) ) );
 
-        almansiStrain = floatVector( sot_dim, 0 );
+        dCurrentAreadF = floatVector( sot_dim, 0 );
 
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > E( greenLagrangeStrain.data( ), dim, dim );
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > e( almansiStrain.data( ), dim, dim );
+        const floatSecondOrderTensor &invF = kinematics.inverse( );
 
-        //Map the Green-Lagrange strain to the current configuration
-        e = ( invF.transpose( ) * E * invF ).eval( );
+        floatType invF_n[ dim ] = { 0, 0, 0 };
 
-        return NULL;
-    }
+        for ( unsigned int B = 0; B < dim; B++ ){
 
-    errorOut pushForwardGreenLagrangeStrain(const floatVector &greenLagrangeStrain, const floatVector &deformationGradient,
-                                            floatVector &almansiStrain, floatVector &dAlmansiStraindE, floatVector &dAlmansiStraindF){
-        /*!
-         * Push forward the Green-Lagrange strain to the current configuration
-         * and return the jacobians.
-         *
-         * \f$e_{ij} = F_{Ii}^{-1} E_{IJ} F_{Jj}^{-1}\f$
-         *
-         * \f$\frac{\partial e_{ij}}{\partial E_{KL}} = F_{Ki}^{-1} F_{Kj}^{-1}\f$
-         *
-         * \f$\frac{\partial e_{ij}}{\partial F_{kK}} = -F_{Ik}^{-1} F_{Ki}^{-1} E_{IJ} F_{J j}^{-1} - F_{Ii}^{-1} E_{IJ} F_{Jk}^{-1} F_{Kj}^{-1}\f$
-         *
-         * where \f$e_{ij}\f$ is the Almansi strain (the strain in the current configuration, \f$F_{iI}^{-1}\f$ is the
-         * inverse of the deformation gradient, and \f$E_{IJ}\f$ is the Green-Lagrange strain.
-         *
-         * \param &greenLagrangeStrain: The Green-Lagrange strain.
-         * \param &deformationGradient: The deformation gradient mapping between configurations.
-         * \param &almansiStrain: The strain in the current configuration indicated by the deformation gradient.
-         * \param &dAlmansiStraindE: Compute the derivative of the Almansi strain w.r.t. the Green-Lagrange strain.
-         * \param &dAlmansiStraindF: Compute the derivative of the Almansi strain w.r.t. the deformation gradient.
-         */
+            for ( unsigned int i = 0; i < dim; i++ ){
 
-        //Assume 3D
-        constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
+                invF_n[ B ] += invF[ dim * B + i ] * normalVector[ i ];
 
-        floatVector inverseDeformationGradient = deformationGradient;
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > invF( inverseDeformationGradient.data( ), dim, dim );
-        invF = invF.inverse( ).eval( );
+            }
 
-        almansiStrain = floatVector( sot_dim, 0 );
+        }
 
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > E( greenLagrangeStrain.data( ), dim, dim );
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > e( almansiStrain.data( ), dim, dim );
+        for ( unsigned int B = 0; B < dim; B++ ){
 
-        //Map the Green-Lagrange strain to the current configuration
-        e = ( invF.transpose( ) * E * invF ).eval( );
+            for ( unsigned int b = 0; b < dim; b++ ){
+
+                dCurrentAreadF[ dim * b + B ] += invF[ dim * B + b ] - normalVector[ b ] * invF_n[ B ];
 
-        //Compute the jacobians
-        dAlmansiStraindE = floatVector( sot_dim * sot_dim, 0 );
-        dAlmansiStraindF = floatVector( sot_dim * sot_dim, 0 );
-        for (unsigned int i=0; i<dim; i++){
-            for (unsigned int j=0; j<dim; j++){
-                for (unsigned int K=0; K<dim; K++){
-                    for (unsigned int L=0; L<dim; L++){
-                        dAlmansiStraindE[sot_dim * dim * i + sot_dim * j + dim * K + L ] = inverseDeformationGradient[dim*K + i] *
-                                                                                           inverseDeformationGradient[dim*L + j];
-                        dAlmansiStraindF[sot_dim * dim * i + sot_dim * j + dim * K + L ] = -inverseDeformationGradient[dim*L + i ] * almansiStrain[dim*K+j]
-                                                                                           -inverseDeformationGradient[dim*L + j ] * almansiStrain[dim*i+K];
-                    }
-                }
             }
+
         }
 
-        return NULL;
     }
 
-    errorOut pushForwardGreenLagrangeStrain(const floatVector &greenLagrangeStrain, const floatVector &deformationGradient,
-                                            floatVector &almansiStrain, floatMatrix &dAlmansiStraindE, floatMatrix &dAlmansiStraindF){
+    template< typename T >
+    static void surfaceGradUMaps( const firstOrderTensor< T > &normalVector, const secondOrderTensor< T > &gradU, const bool isCurrent,
+                           secondOrderTensor< T > &G, secondOrderTensor< T > &H, firstOrderTensor< T > &a, firstOrderTensor< T > &b ){
         /*!
-         * Push forward the Green-Lagrange strain to the current configuration
-         * and return the jacobians.
+         * Compute the tensors and vectors which the derivatives of the current surface quantities w.r.t. the
+         * displacement gradient \f$ \frac{\partial u_k}{\partial X_l} \f$ or \f$ \frac{\partial u_k}{\partial x_l} \f$
+         * are assembled from. With these, and \f$n\f$ the current unit normal,
          *
-         * \f$e_{ij} = F_{Ii}^{-1} E_{IJ} F_{Jj}^{-1}\f$
+         * \f$ \frac{\partial n_i}{\partial u_{k,l}} = a_k \left( n_i b_l - H_{li} \right) \f$
          *
-         * \f$\frac{\partial e_{ij}}{\partial E_{KL}} = F_{Ki}^{-1} F_{Kj}^{-1}\f$
+         * \f$ \frac{\partial n_i da}{\partial u_{k,l}} = n_i G_{lk} - a_k H_{li} \f$
          *
-         * \f$\frac{\partial e_{ij}}{\partial F_{kK}} = -F_{Ik}^{-1} F_{Ki}^{-1} E_{IJ} F_{J j}^{-1} - F_{Ii}^{-1} E_{IJ} F_{Jk}^{-1} F_{Kj}^{-1}\f$
+         * \f$ \frac{\partial da}{\partial u_{k,l}} = G_{lk} - a_k b_l \f$
          *
-         * where \f$e_{ij}\f$ is the Almansi strain (the strain in the current configuration, \f$F_{iI}^{-1}\f$ is the
-         * inverse of the deformation gradient, and \f$E_{IJ}\f$ is the Green-Lagrange strain.
+         * If isCurrent = false then \f$\frac{\partial F_{bB}}{\partial u_{k,l}} = \delta_{bk} \delta_{Bl}\f$ and
+         * \f$G = H = F^{-1}\f$, \f$a = n\f$, \f$b = F^{-1} n\f$.
          *
-         * \param &greenLagrangeStrain: The Green-Lagrange strain.
-         * \param &deformationGradient: The deformation gradient mapping between configurations.
-         * \param &almansiStrain: The strain in the current configuration indicated by the deformation gradient.
-         * \param &dAlmansiStraindE: Compute the derivative of the Almansi strain w.r.t. the Green-Lagrange strain.
-         * \param &dAlmansiStraindF: Compute the derivative of the Almansi strain w.r.t. the deformation gradient.
+         * If isCurrent = true then \f$\frac{\partial F_{bB}}{\partial u_{k,l}} = F_{bk} F_{lB}\f$ which cancels the
+         * inverse deformation gradients of the derivatives w.r.t. \f$F\f$ so that \f$G = F\f$, \f$H = I\f$,
+         * \f$a = F^T n\f$, \f$b = n\f$ and no inverse beyond forming \f$F\f$ itself is required.
+         *
+         * \param &normalVector: The current unit normal vector
+         * \param &gradU: The displacement gradient
+         * \param &isCurrent: Whether the displacement gradient is with respect to the reference or current configuration
+         * \param &G: The tensor \f$G\f$
+         * \param &H: The tensor \f$H\f$
+         * \param &a: The vector \f$a\f$
+         * \param &b: The vector \f$b\f$
          */
 
-        //Assume 3D
         constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
 
-        floatVector _dAlmansiStraindE, _dAlmansiStraindF;
+        if ( isCurrent ){
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( pushForwardGreenLagrangeStrain( greenLagrangeStrain, deformationGradient, almansiStrain, _dAlmansiStraindE, _dAlmansiStraindF ) );
+            H = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
 
-        dAlmansiStraindE = tardigradeVectorTools::inflate( _dAlmansiStraindE, sot_dim, sot_dim );
-        dAlmansiStraindF = tardigradeVectorTools::inflate( _dAlmansiStraindF, sot_dim, sot_dim );
+            secondOrderTensor< T > invF;
 
-        return NULL;
+            for ( unsigned int i = 0; i < dim * dim; i++ ){ invF[ i ] = H[ i ] - gradU[ i ]; }
 
-    } 
+            invertSecondOrderTensor( invF, G );
 
-    errorOut pullBackAlmansiStrain( const floatVector &almansiStrain, const floatVector &deformationGradient,
-                                    floatVector &greenLagrangeStrain ){
-        /*!
-         * Pull back the almansi strain to the configuration indicated by the deformation gradient.
-         *
-         * \param &almansiStrain: The strain in the deformation gradient's current configuration.
-         * \param &deformationGradient: The deformation gradient between configurations.
-         * \param &greenLagrangeStrain: The Green-Lagrange strain which corresponds to the reference
-         *     configuration of the deformation gradient.
-         */
+            for ( unsigned int k = 0; k < dim; k++ ){
 
-        //Assume 3d
-        constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
+                a[ k ] = G[ dim * 0 + k ] * normalVector[ 0 ] + G[ dim * 1 + k ] * normalVector[ 1 ] + G[ dim * 2 + k ] * normalVector[ 2 ];
 
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F( deformationGradient.data( ), dim, dim );
+            }
 
-        greenLagrangeStrain = floatVector( sot_dim, 0 );
+            b = normalVector;
 
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > E( greenLagrangeStrain.data( ), dim, dim );
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > e( almansiStrain.data( ), dim, dim );
+        }
+        else{
 
-        E = ( F.transpose( ) * e * F ).eval( );
+            secondOrderTensor< T > F;
 
-        return NULL;
-    }
+            computeDeformationGradient( gradU, F, false );
 
-    errorOut pullBackAlmansiStrain( const floatVector &almansiStrain, const floatVector &deformationGradient,
-                                    floatVector &greenLagrangeStrain, floatVector &dEde, floatVector &dEdF ){
-        /*!
-         * Pull back the almansi strain to the configuration indicated by the deformation gradient.
-         *
-         * Also return the Jacobians.
-         *
-         * \param &almansiStrain: The strain in the deformation gradient's current configuration.
-         * \param &deformationGradient: The deformation gradient between configurations.
-         * \param &greenLagrangeStrain: The Green-Lagrange strain which corresponds to the reference
-         *     configuration of the deformation gradient.
-         * \param &dEde: The derivative of the Green-Lagrange strain w.r.t. the Almansi strain.
-         * \param &dEdF: The derivative of the Green-Lagrange strain w.r.t. the deformation gradient
-         */
+            invertSecondOrderTensor( F, G );
 
-        //Assume 3d
-        constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
+            H = G;
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( pullBackAlmansiStrain( almansiStrain, deformationGradient, greenLagrangeStrain ) )
+            a = normalVector;
 
-        floatVector eye( dim * dim );
-        tardigradeVectorTools::eye( eye );
+            for ( unsigned int l = 0; l < dim; l++ ){
 
-        dEde = floatVector( sot_dim * sot_dim, 0 );
-        dEdF = floatVector( sot_dim * sot_dim, 0 );
+                b[ l ] = G[ dim * l + 0 ] * normalVector[ 0 ] + G[ dim * l + 1 ] * normalVector[ 1 ] + G[ dim * l + 2 ] * normalVector[ 2 ];
 
-        for ( unsigned int I = 0; I < dim; I++ ){
-            for ( unsigned int J = 0; J < dim; J++ ){
-                for ( unsigned int K = 0; K < dim; K++ ){
-                    for ( unsigned int L = 0; L < dim; L++ ){
-                        dEde[ sot_dim * dim * I + sot_dim * J + dim * K + L ] = deformationGradient[ dim * K + I ] * deformationGradient[ dim * L + J ];
-                        dEdF[ sot_dim * dim * I + sot_dim * J + dim * K + I ] += almansiStrain[ dim * K + L ] * deformationGradient[ dim * L + J ];
-                        dEdF[ sot_dim * dim * I + sot_dim * J + dim * K + J ] += deformationGradient[ dim * L + I ] * almansiStrain[ dim * L + K ];
-                    }
-                }
             }
+
         }
 
-        return NULL;
     }
 
-    errorOut pullBackAlmansiStrain( const floatVector &almansiStrain, const floatVector &deformationGradient,
-                                    floatVector &greenLagrangeStrain, floatMatrix &dEde, floatMatrix &dEdF ){
+    template< typename T >
+    void computeDCurrentNormalVectorDGradU( const firstOrderTensor< T > &normalVector, const secondOrderTensor< T > &gradU,
+                                            thirdOrderTensor< T > &dNormalVectordGradU, const bool isCurrent ){
         /*!
-         * Pull back the almansi strain to the configuration indicated by the deformation gradient.
-         *
-         * Also return the Jacobians.
+         * Compute the derivative of the normal vector in the current configuration w.r.t. the displacement gradient
+         * in closed form without forming the derivative of the deformation gradient w.r.t. the displacement gradient
          *
-         * \param &almansiStrain: The strain in the deformation gradient's current configuration.
-         * \param &deformationGradient: The deformation gradient between configurations.
-         * \param &greenLagrangeStrain: The Green-Lagrange strain which corresponds to the reference
-         *     configuration of the deformation gradient.
-         * \param &dEde: The derivative of the Green-Lagrange strain w.r.t. the Almansi strain.
-         * \param &dEdF: The derivative of the Green-Lagrange strain w.r.t. the deformation gradient
+         * \param &normalVector: The unit normal vector in the current configuration
+         * \param &gradU: The displacement gradient
+         * \param &dNormalVectordGradU: The derivative of the normal vector w.r.t. the displacement gradient
+         * \param &isCurrent: Whether the displacement gradient is with respect to the reference or current configuration
          */
 
-        //Assume 3d
         constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
 
-        floatVector _dEde, _dEdF;
+        secondOrderTensor< T > G, H;
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( pullBackAlmansiStrain( almansiStrain, deformationGradient, greenLagrangeStrain, _dEde, _dEdF ) )
+        firstOrderTensor< T > a, b;
 
-        dEde = tardigradeVectorTools::inflate( _dEde, sot_dim, sot_dim );
-        dEdF = tardigradeVectorTools::inflate( _dEdF, sot_dim, sot_dim );
+        surfaceGradUMaps( normalVector, gradU, isCurrent, G, H, a, b );
 
-        return NULL;
-    }
+        for ( unsigned int i = 0; i < dim; i++ ){
 
-    errorOut computeSymmetricPart( const floatVector &A, floatVector &symmA, unsigned int &dim ){
-        /*!
-         * Compute the symmetric part of a second order tensor ( \f$A\f$ ) and return it.
-         *
-         * \f$symm( A )_ij = \frac{1}{2}\left(A_{ij} + A_{ji}\right)\f$
-         *
-         * \param &A: A constant reference to the second order tensor to process ( \f$A\f$ )
-         * \param &symmA: The symmetric part of A ( \f$A^{symm}\f$ )
-         * \param &dim: The dimension of A. Note that this is an output used for help
-         *     with computing the Jacobian. If you don't need dim as an output use the
-         *     version of this function without it.
-         */
-        
-        //Get the dimension of A
-        dim = ( unsigned int )( std::sqrt( ( double )A.size( ) ) + 0.5 );
-        const unsigned int sot_dim = dim * dim;
-   
-        TARDIGRADE_ERROR_TOOLS_CHECK( sot_dim == A.size( ), "A is not a square matrix" );
- 
-        symmA = floatVector( A.size( ), 0 );
+            for ( unsigned int k = 0; k < dim; k++ ){
+
+                for ( unsigned int l = 0; l < dim; l++ ){
+
+                    dNormalVectordGradU[ dim * dim * i + dim * k + l ] = a[ k ] * ( normalVector[ i ] * b[ l ] - H[ dim * l + i ] );
+
+                }
 
-        for ( unsigned int i = 0; i < dim; i++ ){
-            for ( unsigned int j = 0; j < dim; j++ ){
-                symmA[ dim * i + j ] = 0.5 * ( A[ dim * i + j ] + A[ dim * j + i ] );
             }
+
         }
-    
-        return NULL;
-    }
 
-    errorOut computeSymmetricPart( const floatVector &A, floatVector &symmA ){
-        /*!
-         * Compute the symmetric part of a second order tensor ( \f$A\f$ ) and return it.
-         *
-         * \f$symm( A )_ij = \frac{1}{2}\left(A_{ij} + A_{ji}\right)\f$
-         *
-         * \param &A: A constant reference to the second order tensor to process ( \f$A\f$ )
-         * \param &symmA: The symmetric part of A ( \f$A^{symm}\f$ )
-         */
-    
-        unsigned int dim;
-        return computeSymmetricPart( A, symmA, dim );
     }
 
-    errorOut computeSymmetricPart( const floatVector &A, floatVector &symmA, floatMatrix &dSymmAdA ){
+    template< typename T >
+    void computeDCurrentAreaWeightedNormalVectorDGradU( const firstOrderTensor< T > &normalVector, const secondOrderTensor< T > &gradU,
+                                                        thirdOrderTensor< T > &dAreaWeightedNormalVectordGradU, const bool isCurrent ){
         /*!
-         * Compute the symmetric part of a second order tensor ( \f$A\f$ ) and return it.
-         *
-         * \f$( A )^{symm}_{ij} = \frac{1}{2}\left(A_{ij} + A_{ji}\right)\f$
+         * Compute the derivative of the area weighted normal vector w.r.t. the displacement gradient in closed form
+         * without forming the derivative of the deformation gradient w.r.t. the displacement gradient
          *
-         * Also computes the jacobian
-         * 
-         * \f$\frac{\partial A^{symm}_{ij}}{\partial A_{kl}} = \frac{1}{2}\left( \delta_{ik} \delta_{jl} + \delta_{jk}\delta_{il} \right)
+         * \f$ \frac{\partial}{\partial u_{i,j}} \left( n_i da \right) \f$
          *
-         * \param &A: A constant reference to the second order tensor to process ( \f$A\f$ )
-         * \param &symmA: The symmetric part of A ( \f$A^{symm}\f$ )
-         * \param &dSymmAdA: The Jacobian of the symmetric part of A w.r.t. A ( \f$\frac{\partial A^{symm}}{\partial A}\f$ )
+         * \param &normalVector: The normal vector (a unit vector is likely what is desired)
+         * \param &gradU: The displacement gradient
+         * \param &dAreaWeightedNormalVectordGradU: The derivative of the area weighted normal vector w.r.t. the displacement gradient
+         * \param &isCurrent: Whether the displacement gradient is with respect to the reference or current configuration
          */
-     
-        unsigned int dim;
-        TARDIGRADE_ERROR_TOOLS_CATCH( computeSymmetricPart( A, symmA, dim ) );
-        
-        dSymmAdA = floatMatrix( symmA.size( ), floatVector( A.size( ), 0 ) );
-        
+
+        constexpr unsigned int dim = 3;
+
+        secondOrderTensor< T > G, H;
+
+        firstOrderTensor< T > a, b;
+
+        surfaceGradUMaps( normalVector, gradU, isCurrent, G, H, a, b );
+
         for ( unsigned int i = 0; i < dim; i++ ){
-            for ( unsigned int j = 0; j < dim; j++ ){
-                dSymmAdA[ dim * i + j ][ dim * i + j ] += 0.5;
-                dSymmAdA[ dim * i + j ][ dim * j + i ] += 0.5;
+
+            for ( unsigned int k = 0; k < dim; k++ ){
+
+                for ( unsigned int l = 0; l < dim; l++ ){
+
+                    dAreaWeightedNormalVectordGradU[ dim * dim * i + dim * k + l ] = normalVector[ i ] * G[ dim * l + k ] - a[ k ] * H[ dim * l + i ];
+
+                }
+
             }
+
         }
-        
-        return NULL;
-   
+
     }
 
-    errorOut computeSymmetricPart( const floatVector &A, floatVector &symmA, floatVector &dSymmAdA ){
-        /*!
-         * Compute the symmetric part of a second order tensor ( \f$A\f$ ) and return it.
-         *
-         * \f$( A )^{symm}_{ij} = \frac{1}{2}\left(A_{ij} + A_{ji}\right)\f$
-         *
-         * Also computes the jacobian
-         * 
-         * \f$\frac{\partial A^{symm}_{ij}}{\partial A_{kl}} = \frac{1}{2}\left( \delta_{ik} \delta_{jl} + \delta_{jk}\delta_{il} \right)
-         *
-         * \param &A: A constant reference to the second order tensor to process ( \f$A\f$ )
-         * \param &symmA: The symmetric part of A ( \f$A^{symm}\f$ )
-         * \param &dSymmAdA: The Jacobian of the symmetric part of A w.r.t. A ( \f$\frac{\partial A^{symm}}{\partial A}\f$ )
+    template< typename T >
+    void computeDCurrentAreaDGradU( const firstOrderTensor< T > &normalVector, const secondOrderTensor< T > &gradU,
+                                    secondOrderTensor< T > &dCurrentAreadGradU, const bool isCurrent ){
+        /*!
+         * Compute the derivative of the current area w.r.t. the displacement gradient in closed form without forming
+         * the derivative of the deformation gradient w.r.t. the displacement gradient
+         *
+         * \param &normalVector: The current unit normal vector
+         * \param &gradU: The displacement gradient
+         * \param &dCurrentAreadGradU: The derivative of the current surface area w.r.t. the displacement gradient
+         * \param &isCurrent: Whether the displacement gradient is with respect to the reference or current configuration
          */
-        
-        unsigned int dim;
-        TARDIGRADE_ERROR_TOOLS_CATCH( computeSymmetricPart( A, symmA, dim ) );
-        
-        const unsigned int Asize = A.size( );
-        
-        dSymmAdA = floatVector( symmA.size( ) * Asize, 0 );
 
-        for ( unsigned int i = 0; i < dim; i++ ){
-            for ( unsigned int j = 0; j < dim; j++ ){
-                dSymmAdA[ dim * Asize * i + Asize * j + dim * i + j ] += 0.5;
-                dSymmAdA[ dim * Asize * i + Asize * j + dim * j + i ] += 0.5;
+        constexpr unsigned int dim = 3;
+
+        secondOrderTensor< T > G, H;
+
+        firstOrderTensor< T > a, b;
+
+        surfaceGradUMaps( normalVector, gradU, isCurrent, G, H, a, b );
+
+        for ( unsigned int k = 0; k < dim; k++ ){
+
+            for ( unsigned int l = 0; l < dim; l++ ){
+
+                dCurrentAreadGradU[ dim * k + l ] = G[ dim * l + k ] - a[ k ] * b[ l ];
+
             }
+
         }
-        
-        return NULL;
+
     }
 
-    errorOut pushForwardPK2Stress( const floatVector &PK2, const floatVector &F, floatVector &cauchyStress ){
+    void computeDCurrentNormalVectorDGradU( const floatVector &normalVector, const floatVector &gradU, floatVector &dNormalVectordGradU, const bool isCurrent ){
         /*!
-         * Push the Second Piola-Kirchhoff stress forward to the current configuration resulting in the Cauchy stress
-         * 
-         * \f$ \sigma_{ij} = \frac{1}{J} F_{iI} S_{IJ} F_{jJ} \f$
+         * Compute the derivative of the normal vector in the current configuration w.r.t. the displacement gradient
          * 
-         * \param &PK2: The Second Piola-Kirchhoff stress \f$ S_{IJ} \f$
-         * \param &F: The deformation gradient \f$ F_{iI} \f$
-         * \param &cauchyStress: The Cauchy stress \f$ \sigma_{ij} \f$
+         * \param &normalVector: The unit normal vector in the current configuration
+         * \param &gradU: The displacement gradient
+         * \param &dNormalVectordF: The derivative of the normal vector w.r.t. the displacement gradient
+         * \param &isCurrent: Whether the displacement gradient is with respect to the reference or current configuration
          */
 
         constexpr unsigned int dim = 3;
         constexpr unsigned int sot_dim = dim * dim;
-        
-        TARDIGRADE_ERROR_TOOLS_CHECK( sot_dim == PK2.size( ), "The PK2 stress must have a size of " + std::to_string( sot_dim ) + " and has a size of " + std::to_string( PK2.size( ) ) )
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( PK2.size( ) == F.size( ), "The deformation gradient must have a size of " + std::to_string( PK2.size( ) ) + " and has a size of " + std::to_string( F.size( ) ) );
+        TARDIGRADE_ERROR_TOOLS_CHECK( normalVector.size( ) == dim, "The normal vector must have " + std::to_string( dim ) + " elements and it has " + std::to_string( normalVector.size( ) ) );
 
-        cauchyStress = floatVector( sot_dim, 0 );
+        TARDIGRADE_ERROR_TOOLS_CHECK( gradU.size( ) == sot_dim, "The displacement gradient must have " + std::to_string( sot_dim ) + " elements and it has " + std::to_string( gradU.size( ) ) );
 
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > PK2_map( PK2.data( ), dim, dim );
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F_map( F.data( ), dim, dim );
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > cauchyStress_map( cauchyStress.data( ), dim, dim );
+        floatFirstOrderTensor _normalVector;
 
-        floatType J = F_map.determinant( );
+        floatSecondOrderTensor _gradU;
 
-        cauchyStress_map = ( F_map * PK2_map * F_map.transpose( ) / J ).eval( );
+        floatThirdOrderTensor _dNormalVectordGradU;
 
-        return NULL;
+        std::copy( normalVector.begin( ), normalVector.end( ), _normalVector.begin( ) );
+
+        std::copy( gradU.begin( ), gradU.end( ), _gradU.begin( ) );
+
+        computeDCurrentNormalVectorDGradU( _normalVector, _gradU, _dNormalVectordGradU, isCurrent );
+
+        dNormalVectordGradU.assign( _dNormalVectordGradU.begin( ), _dNormalVectordGradU.end( ) );
 
     }
 
-    errorOut pushForwardPK2Stress( const floatVector &PK2, const floatVector &F, floatVector &cauchyStress,
-                                   floatVector &dCauchyStressdPK2, floatVector &dCauchyStressdF ){
+    void computeDCurrentAreaWeightedNormalVectorDGradU( const floatVector &normalVector, const floatVector &gradU, floatVector &dAreaWeightedNormalVectordGradU, const bool isCurrent ){
         /*!
-         * Push the Second Piola-Kirchhoff stress forward to the current configuration resulting in the Cauchy stress
+         * Compute the derivative of the area weighted normal vector w.r.t. the displacement gradient
          * 
-         * \f$ \sigma_{ij} = \frac{1}{J} F_{iI} S_{IJ} F_{jJ} \f$
+         * \f$ \frac{\partial}{\partial u_{i,j}} \left( n_i da \right) \f$
          * 
-         * \param &PK2: The Second Piola-Kirchhoff stress \f$ S_{IJ} \f$
-         * \param &F: The deformation gradient \f$ F_{iI} \f$
-         * \param &cauchyStress: The Cauchy stress \f$ \sigma_{ij} \f$
-         * \param &dCauchyStressdPK2: The gradient of the Cauchy stress w.r.t. the PK2 stress
-         * \param &dCauchyStressdF: The gradient of the Cauchy stress w.r.t. the deformation gradient
+         * Note that if the user passes in the unit normal vector, then the result will be more convenient for the construction of
+         * the jacobian of a surface integral in the current configuration.
+         * 
+         * \param &normalVector: The normal vector (a unit vector is likely what is desired)
+         * \param &gradU: The displacement gradient
+         * \param &dAreaWeightedNormalVectordGradU: The derivative of the area weighted normal vector w.r.t. the displacement gradient
+         * \param &isCurrent: Whether the displacement gradient is with respect to the reference or current configuration
          */
 
         constexpr unsigned int dim = 3;
         constexpr unsigned int sot_dim = dim * dim;
-        constexpr unsigned int fot_dim = sot_dim * sot_dim;
-        
-        TARDIGRADE_ERROR_TOOLS_CHECK( dim * dim == PK2.size( ), "The PK2 stress must have a size of " + std::to_string( sot_dim ) + " and has a size of " + std::to_string( PK2.size( ) ) );
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( PK2.size( ) == F.size( ), "The deformation gradient must have a size of " + std::to_string( PK2.size( ) ) + " and has a size of " + std::to_string( F.size( ) ) );
-
-        cauchyStress = floatVector( sot_dim, 0 );
-        floatVector dJdF( sot_dim, 0 );
+        TARDIGRADE_ERROR_TOOLS_CHECK( normalVector.size( ) == dim, "The normal vector must have " + std::to_string( dim ) + " elements and it has " + std::to_string( normalVector.size( ) ) );
 
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > PK2_map( PK2.data( ), dim, dim );
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F_map( F.data( ), dim, dim );
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > cauchyStress_map( cauchyStress.data( ), dim, dim );
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > dJdF_map( dJdF.data( ), dim, dim );
+        TARDIGRADE_ERROR_TOOLS_CHECK( gradU.size( ) == sot_dim, "The displacement gradient must have " + std::to_string( sot_dim ) + " elements and it has " + std::to_string( gradU.size( ) ) );
 
-        floatType J = F_map.determinant( );
+        floatFirstOrderTensor _normalVector;
 
-        cauchyStress_map = ( F_map * PK2_map * F_map.transpose( ) / J ).eval( );
+        floatSecondOrderTensor _gradU;
 
-        dJdF_map = ( J * F_map.inverse( ).transpose( ) ).eval( );
+        floatThirdOrderTensor _dAreaWeightedNormalVectordGradU;
 
-        dCauchyStressdF = floatVector( fot_dim, 0 );
+        std::copy( normalVector.begin( ), normalVector.end( ), _normalVector.begin( ) );
 
-        dCauchyStressdPK2 = floatVector( fot_dim, 0 );
+        std::copy( gradU.begin( ), gradU.end( ), _gradU.begin( ) );
 
-        floatVector eye( dim * dim, 0 );
-        tardigradeVectorTools::eye( eye );
+        computeDCurrentAreaWeightedNormalVectorDGradU( _normalVector, _gradU, _dAreaWeightedNormalVectordGradU, isCurrent );
 
-        for ( unsigned int i = 0; i < dim; i++ ){
+        dAreaWeightedNormalVectordGradU.assign( _dAreaWeightedNormalVectordGradU.begin( ), _dAreaWeightedNormalVectordGradU.end( ) );
 
-            for ( unsigned int j = 0; j < dim; j++ ){
+    }
 
-                for ( unsigned int A = 0; A < dim; A++ ){
+    void computeDCurrentAreaDGradU( const floatVector &normalVector, const floatVector &gradU, floatVector &dCurrentAreadGradU, const bool isCurrent ){
+        /*!
+         * Compute the derivative of the current area w.r.t. the displacement gradient
+         * 
+         * \param &normalVector: The current unit normal vector
+         * \param &gradU: The displacement gradient
+         * \param &dCurrentAreadGradU: The derivative of the current surface area w.r.t. the displacement gradient
+         * \param &isCurrent: Whether the displacement gradient is with respect to the reference or current configuration
+         */
 
-                    for ( unsigned int B = 0; B < dim; B++ ){
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
 
-                        dCauchyStressdPK2[ dim * sot_dim * i + sot_dim * j + dim * A + B ] += F[ dim * i + A ] * F[ dim * j + B ] / J;
-                        dCauchyStressdF[ dim * sot_dim * i + sot_dim * j + dim * A + B ] -= cauchyStress[ dim * i + j ] * dJdF[ dim * A + B ] / J;
+        TARDIGRADE_ERROR_TOOLS_CHECK( normalVector.size( ) == dim, "The normal vector must have " + std::to_string( dim ) + " elements and it has " + std::to_string( normalVector.size( ) ) );
 
-                        dCauchyStressdF[ dim * sot_dim * i + sot_dim * j + dim * i + A ] += PK2[ dim * A + B ] * F[ dim * j + B ] / J;
+        TARDIGRADE_ERROR_TOOLS_CHECK( gradU.size( ) == sot_dim, "The displacement gradient must have " + std::to_string( sot_dim ) + " elements and it has " + std::to_string( gradU.size( ) ) );
 
-                        dCauchyStressdF[ dim * sot_dim * i + sot_dim * j + dim * j + A ] += F[ dim * i + B ] * PK2[ dim * B + A ] / J;
+        floatFirstOrderTensor _normalVector;
 
-                    }
+        floatSecondOrderTensor _gradU, _dCurrentAreadGradU;
 
-                }
+        std::copy( normalVector.begin( ), normalVector.end( ), _normalVector.begin( ) );
 
-            }
+        std::copy( gradU.begin( ), gradU.end( ), _gradU.begin( ) );
 
-        } 
+        computeDCurrentAreaDGradU( _normalVector, _gradU, _dCurrentAreadGradU, isCurrent );
 
-        return NULL;
+        dCurrentAreadGradU.assign( _dCurrentAreadGradU.begin( ), _dCurrentAreadGradU.end( ) );
 
     }
 
-    errorOut pushForwardPK2Stress( const floatVector &PK2, const floatVector &F, floatVector &cauchyStress,
-                                   floatMatrix &dCauchyStressdPK2, floatMatrix &dCauchyStressdF ){
+    constexpr unsigned int mandelRow[ 6 ]    = { 0, 1, 2, 1, 0, 0 }; //!< The first index of each Mandel component
+    constexpr unsigned int mandelColumn[ 6 ] = { 0, 1, 2, 2, 2, 1 }; //!< The second index of each Mandel component
+    constexpr double mandelWeight[ 6 ] = { 1, 1, 1, 1.4142135623730950488, 1.4142135623730950488, 1.4142135623730950488 }; //!< The weight of each Mandel component
+
+    template< typename T, class Function >
+    static void fillMandelMatrix( const Function &D, mandelMatrix< T > &mandelD ){
         /*!
-         * Push the Second Piola-Kirchhoff stress forward to the current configuration resulting in the Cauchy stress
-         * 
-         * \f$ \sigma_{ij} = \frac{1}{J} F_{iI} S_{IJ} F_{jJ} \f$
-         * 
-         * \param &PK2: The Second Piola-Kirchhoff stress \f$ S_{IJ} \f$
-         * \param &F: The deformation gradient \f$ F_{iI} \f$
-         * \param &cauchyStress: The Cauchy stress \f$ \sigma_{ij} \f$
-         * \param &dCauchyStressdPK2: The gradient of the Cauchy stress w.r.t. the PK2 stress
-         * \param &dCauchyStressdF: The gradient of the Cauchy stress w.r.t. the deformation gradient
+         * Form the Mandel representation of the minor symmetric part of a fourth order tensor
+         *
+         * \f$ M_{IK} = w_I w_K \frac{1}{4} \left( D_{ijkl} + D_{jikl} + D_{ijlk} + D_{jilk} \right) \f$
+         *
+         * \param &D: A callable returning \f$D_{ijkl}\f$ given the indices i, j, k, and l
+         * \param &mandelD: The Mandel representation \f$M_{IK}\f$
          */
 
-        floatVector _dCauchyStressdPK2, _dCauchyStressdF;
+        for ( unsigned int I = 0; I < 6; I++ ){
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( pushForwardPK2Stress( PK2, F, cauchyStress, _dCauchyStressdPK2, _dCauchyStressdF ) )
+            const unsigned int i = mandelRow[ I ];
+            const unsigned int j = mandelColumn[ I ];
 
-        dCauchyStressdPK2 = tardigradeVectorTools::inflate( _dCauchyStressdPK2, cauchyStress.size( ), PK2.size( ) );
+            for ( unsigned int K = 0; K < 6; K++ ){
 
-        dCauchyStressdF   = tardigradeVectorTools::inflate( _dCauchyStressdF,   cauchyStress.size( ), F.size( ) );
+                const unsigned int k = mandelRow[ K ];
+                const unsigned int l = mandelColumn[ K ];
 
-        return NULL;
+                mandelD[ 6 * I + K ] = T( 0.25 * mandelWeight[ I ] * mandelWeight[ K ] ) * ( D( i, j, k, l ) + D( j, i, k, l ) + D( i, j, l, k ) + D( j, i, l, k ) );
+
+            }
+
+        }
 
     }
 
-    errorOut pullBackCauchyStress( const floatVector &cauchyStress, const floatVector &F, floatVector &PK2 ){
+    template< typename T, class Function >
+    static void fillMandelGradient( const Function &D, mandelGradient< T > &mandelD ){
         /*!
-         * Pull back the Cauchy stress to an earlier configuration resulting in the second Piola-Kirchhoff stress
-         * 
-         * \f$ S_{IJ} = J F^{-1}_{Ii} \sigma_{ij} F^{-1}_{Jj} \f$
-         * 
-         * where \f$S_{IJ}\f$ are the components of the second Piola-Kirchhoff stress tensor, \f$J \f$ is the
-         * determinant of the deformation gradient \f$\bf{F}\f$ which has components \f$F_{iI}\f$, and
-         * \f$ \sigma_{ij} \f$ are the components of the Cauchy stress.
+         * Form the Mandel representation of the derivative of a symmetric second order tensor w.r.t. a general second
+         * order tensor
          *
-         * \param &cauchyStress: The cauchy stress tensor in row-major form (all nine components)
-         * \param &F: The deformation gradient
-         * \param &PK2: The resulting second Piola-Kirchhoff stress
+         * \f$ G_{Ikl} = w_I \frac{1}{2} \left( D_{ijkl} + D_{jikl} \right) \f$
+         *
+         * \param &D: A callable returning \f$D_{ijkl}\f$ given the indices i, j, k, and l
+         * \param &mandelD: The Mandel representation \f$G_{Ikl}\f$ stored 6x9 in row-major order
          */
 
         constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( cauchyStress.size( ) == sot_dim, "The Cauchy stress size is not consistent with the computed dimension\n    cauchyStress.size( ): " + std::to_string( cauchyStress.size( ) ) + "\n    dim * dim           : " + std::to_string( dim * dim ) + "\n" );
+        for ( unsigned int I = 0; I < 6; I++ ){
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( cauchyStress.size( ) == F.size( ), "The Cauchy stress and the deformation gradient have inconsistent sizes\n    cauchyStress.size( ): " + std::to_string( cauchyStress.size( ) ) + "\n    F.size( )           : " + std::to_string( F.size( ) ) + "\n" );
+            const unsigned int i = mandelRow[ I ];
+            const unsigned int j = mandelColumn[ I ];
 
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > cauchyStress_map( cauchyStress.data( ), dim, dim );
+            for ( unsigned int k = 0; k < dim; k++ ){
 
-        floatVector Finv = F;
+                for ( unsigned int l = 0; l < dim; l++ ){
 
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > Finv_map( Finv.data( ), dim, dim );
-        Finv_map = Finv_map.inverse( ).eval( );
+                    mandelD[ 9 * I + dim * k + l ] = T( 0.5 * mandelWeight[ I ] ) * ( D( i, j, k, l ) + D( j, i, k, l ) );
 
-        floatType J = 1 / Finv_map.determinant( );
+                }
 
-        PK2 = floatVector( sot_dim, 0 );
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > PK2_map( PK2.data( ), dim, dim );
+            }
 
-        PK2_map = ( J * Finv_map * cauchyStress_map * Finv_map.transpose( ) ).eval( );
+        }
 
-        return NULL;
+    }
+
+    template< typename T >
+    void toMandel( const secondOrderTensor< T > &A, mandelVector< T > &mandelA ){
+        /*!
+         * Compute the Mandel representation of the symmetric part of a second order tensor
+         *
+         * \f$ a = \left( A_{11}, A_{22}, A_{33}, \sqrt{2} A^{symm}_{23}, \sqrt{2} A^{symm}_{13}, \sqrt{2} A^{symm}_{12} \right) \f$
+         *
+         * \param &A: The second order tensor stored in row-major order
+         * \param &mandelA: The Mandel representation of the symmetric part of A
+         */
+
+        constexpr unsigned int dim = 3;
+
+        for ( unsigned int I = 0; I < 6; I++ ){
+
+            const unsigned int i = mandelRow[ I ];
+            const unsigned int j = mandelColumn[ I ];
+
+            mandelA[ I ] = T( 0.5 * mandelWeight[ I ] ) * ( A[ dim * i + j ] + A[ dim * j + i ] );
+
+        }
 
     }
-    
-    errorOut pullBackCauchyStress( const floatVector &cauchyStress, const floatVector &F, floatVector &PK2, 
-                                   floatVector &dPK2dCauchyStress, floatVector &dPK2dF ){
+
+    template< typename T >
+    void fromMandel( const mandelVector< T > &mandelA, secondOrderTensor< T > &A ){
         /*!
-         * Pull back the Cauchy stress to an earlier configuration resulting in the second Piola-Kirchhoff stress
-         * 
-         * \f$ S_{IJ} = J F^{-1}_{Ii} \sigma_{ij} F^{-1}_{Jj} \f$
-         * 
-         * where \f$S_{IJ}\f$ are the components of the second Piola-Kirchhoff stress tensor, \f$J \f$ is the
-         * determinant of the deformation gradient \f$\bf{F}\f$ which has components \f$F_{iI}\f$, and
-         * \f$ \sigma_{ij} \f$ are the components of the Cauchy stress.
+         * Expand the Mandel representation of a symmetric second order tensor to all nine components
          *
-         * \param &cauchyStress: The cauchy stress tensor in row-major form (all nine components)
-         * \param &F: The deformation gradient
-         * \param &PK2: The resulting second Piola-Kirchhoff stress
-         * \param &dPK2dCauchyStress: The directional derivative of the second Piola-Kirchhoff stress tensor w.r.t.
-         *     the Cauchy stress
-         * \param &dPK2dF: The directional derivative of the second Piola-Kirchhoff stress tensor w.r.t. the
-         *     deformation gradient
+         * \param &mandelA: The Mandel representation of the tensor
+         * \param &A: The symmetric second order tensor stored in row-major order
          */
 
         constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
-        constexpr unsigned int fot_dim = sot_dim * sot_dim;
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( cauchyStress.size( ) == sot_dim, "The Cauchy stress size is not consistent with the computed dimension\n    cauchyStress.size( ): " + std::to_string( cauchyStress.size( ) ) + "\n    dim * dim           : " + std::to_string( dim * dim ) + "\n" );
+        for ( unsigned int I = 0; I < 6; I++ ){
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( cauchyStress.size( ) == F.size( ), "The Cauchy stress and the deformation gradient have inconsistent sizes\n    cauchyStress.size( ): " + std::to_string( cauchyStress.size( ) ) + "\n    F.size( )           : " + std::to_string( F.size( ) ) + "\n" );
+            const unsigned int i = mandelRow[ I ];
+            const unsigned int j = mandelColumn[ I ];
 
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > cauchyStress_map( cauchyStress.data( ), dim, dim );
+            A[ dim * i + j ] = mandelA[ I ] / T( mandelWeight[ I ] );
+            A[ dim * j + i ] = A[ dim * i + j ];
 
-        floatVector Finv = F;
+        }
 
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > Finv_map( Finv.data( ), dim, dim );
-        Finv_map = Finv_map.inverse( ).eval( );
+    }
 
-        floatType J = 1 / Finv_map.determinant( );
+    template< typename T >
+    void toMandel( const fourthOrderTensor< T > &A, mandelMatrix< T > &mandelA ){
+        /*!
+         * Compute the 6x6 Mandel representation of the minor symmetric part of a fourth order tensor. If A is the
+         * Jacobian of a symmetric tensor w.r.t. a symmetric tensor then the result maps Mandel increments of the
+         * independent variable to Mandel increments of the dependent variable.
+         *
+         * \param &A: The fourth order tensor stored in row-major order
+         * \param &mandelA: The Mandel representation stored 6x6 in row-major order
+         */
 
-        PK2 = floatVector( sot_dim, 0 );
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > PK2_map( PK2.data( ), dim, dim );
+        constexpr unsigned int dim = 3;
 
-        PK2_map = ( J * Finv_map * cauchyStress_map * Finv_map.transpose( ) ).eval( );
+        fillMandelMatrix< T >( [ & ]( const unsigned int i, const unsigned int j, const unsigned int k, const unsigned int l ){
+                                   return A[ dim * dim * dim * i + dim * dim * j + dim * k + l ];
+                               }, mandelA );
 
-        dPK2dCauchyStress = floatVector( fot_dim, 0 );
-        dPK2dF            = floatVector( fot_dim, 0 );
+    }
 
-        for ( unsigned int A = 0; A < dim; A++ ){
+    template< typename T >
+    void fromMandel( const mandelMatrix< T > &mandelA, fourthOrderTensor< T > &A ){
+        /*!
+         * Expand the 6x6 Mandel representation of a fourth order tensor with minor symmetries to all 81 components
+         *
+         * \param &mandelA: The Mandel representation stored 6x6 in row-major order
+         * \param &A: The fourth order tensor stored in row-major order
+         */
 
-            for ( unsigned int B = 0; B < dim; B++ ){
+        constexpr unsigned int dim = 3;
 
-                for ( unsigned int k = 0; k < dim; k++ ){
+        for ( unsigned int I = 0; I < 6; I++ ){
 
-                    for ( unsigned int l = 0; l < dim; l++ ){
+            const unsigned int i = mandelRow[ I ];
+            const unsigned int j = mandelColumn[ I ];
 
-                        dPK2dCauchyStress[ dim * dim * dim * A + dim * dim * B + dim * k + l ] = J * Finv[ dim * A + k ] * Finv[ dim * B + l ];
+            for ( unsigned int K = 0; K < 6; K++ ){
 
-                        dPK2dF[ dim * dim * dim * A + dim * dim * B + dim * k + l ] = Finv[ dim * l + k ] * PK2[ dim * A + B ]
-                                                                                    - Finv[ dim * A + k ] * PK2[ dim * l + B ]
-                                                                                    - Finv[ dim * B + k ] * PK2[ dim * A + l ];
+                const unsigned int k = mandelRow[ K ];
+                const unsigned int l = mandelColumn[ K ];
 
-                    }
+                const T value = mandelA[ 6 * I + K ] / T( mandelWeight[ I ] * mandelWeight[ K ] );
 
-                }
+                A[ dim * dim * dim * i + dim * dim * j + dim * k + l ] = value;
+                A[ dim * dim * dim * j + dim * dim * i + dim * k + l ] = value;
+                A[ dim * dim * dim * i + dim * dim * j + dim * l + k ] = value;
+                A[ dim * dim * dim * j + dim * dim * i + dim * l + k ] = value;
 
             }
 
         }
 
-        return NULL;
+    }
+
+    template< typename T >
+    void toMandel( const fourthOrderTensor< T > &A, mandelGradient< T > &mandelA ){
+        /*!
+         * Compute the 6x9 Mandel representation of the derivative of a symmetric second order tensor w.r.t. a
+         * general second order tensor
+         *
+         * \param &A: The fourth order tensor stored in row-major order
+         * \param &mandelA: The Mandel representation stored 6x9 in row-major order
+         */
+
+        constexpr unsigned int dim = 3;
+
+        fillMandelGradient< T >( [ & ]( const unsigned int i, const unsigned int j, const unsigned int k, const unsigned int l ){
+                                     return A[ dim * dim * dim * i + dim * dim * j + dim * k + l ];
+                                 }, mandelA );
 
     }
 
-    errorOut pullBackCauchyStress( const floatVector &cauchyStress, const floatVector &F, floatVector &PK2, 
-                                   floatMatrix &dPK2dCauchyStress, floatMatrix &dPK2dF ){
+    template< typename T >
+    void fromMandel( const mandelGradient< T > &mandelA, fourthOrderTensor< T > &A ){
         /*!
-         * Pull back the Cauchy stress to an earlier configuration resulting in the second Piola-Kirchhoff stress
-         * 
-         * \f$ S_{IJ} = J F^{-1}_{Ii} \sigma_{ij} F^{-1}_{Jj} \f$
-         * 
-         * where \f$S_{IJ}\f$ are the components of the second Piola-Kirchhoff stress tensor, \f$J \f$ is the
-         * determinant of the deformation gradient \f$\bf{F}\f$ which has components \f$F_{iI}\f$, and
-         * \f$ \sigma_{ij} \f$ are the components of the Cauchy stress.
+         * Expand the 6x9 Mandel representation of the derivative of a symmetric second order tensor w.r.t. a general
+         * second order tensor to all 81 components
          *
-         * \param &cauchyStress: The cauchy stress tensor in row-major form (all nine components)
-         * \param &F: The deformation gradient
-         * \param &PK2: The resulting second Piola-Kirchhoff stress
-         * \param &dPK2dCauchyStress: The directional derivative of the second Piola-Kirchhoff stress tensor w.r.t.
-         *     the Cauchy stress
-         * \param &dPK2dF: The directional derivative of the second Piola-Kirchhoff stress tensor w.r.t. the
-         *     deformation gradient
+         * \param &mandelA: The Mandel representation stored 6x9 in row-major order
+         * \param &A: The fourth order tensor stored in row-major order
          */
 
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
 
-        floatVector _dPK2dCauchyStress, _dPK2dF;
+        for ( unsigned int I = 0; I < 6; I++ ){
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( pullBackCauchyStress( cauchyStress, F, PK2, _dPK2dCauchyStress, _dPK2dF ) )
+            const unsigned int i = mandelRow[ I ];
+            const unsigned int j = mandelColumn[ I ];
 
-        dPK2dCauchyStress = tardigradeVectorTools::inflate( _dPK2dCauchyStress, PK2.size( ), cauchyStress.size( ) );
+            for ( unsigned int kl = 0; kl < sot_dim; kl++ ){
 
-        dPK2dF = tardigradeVectorTools::inflate( _dPK2dF, PK2.size( ), F.size( ) );
+                A[ sot_dim * ( dim * i + j ) + kl ] = mandelA[ sot_dim * I + kl ] / T( mandelWeight[ I ] );
+                A[ sot_dim * ( dim * j + i ) + kl ] = A[ sot_dim * ( dim * i + j ) + kl ];
 
-        return NULL;
+            }
+
+        }
 
     }
 
-    void evolveFExponentialMap( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
-                                floatVector &deformationGradient, const floatType alpha ){
+    errorOut toMandel( const floatVector &A, floatVector &mandelA ){
         /*!
-         * Evolve the deformation gradient using the exponential map. Assumes the evolution equation is of the form
-         * 
-         * \f$ \dot{F}_{iI} = \ell_{ij} F_{jI} \f$
-         * 
-         * \param &Dt: The change in time
-         * \param &previousDeformationGradient: The previous value of the deformation gradient
-         * \param &Lp: The previous value of the velocity gradient
-         * \param &L: The current value of the velocity gradient
-         * \param &deformationGradient: The computed value of the deformation gradient
-         * \param &alpha: The integration parameter (0 is explicit and 1 is implicit)
+         * Compute the Mandel representation of the symmetric part of a second order tensor
+         *
+         * \param &A: The second order tensor stored in row-major order
+         * \param &mandelA: The Mandel representation of the symmetric part of A
          */
 
-        constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
+        floatSecondOrderTensor _A;
+
+        floatMandelVector _mandelA;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( A.size( ) == _A.size( ), "The tensor must have " + std::to_string( _A.size( ) ) + " components and it has " + std::to_string( A.size( ) ) );
+
+        std::copy( A.begin( ), A.end( ), _A.begin( ) );
+
+        toMandel( _A, _mandelA );
 
-        floatVector DtLalpha = Dt * ( ( 1 - alpha ) * Lp + alpha * L );
+        mandelA.assign( _mandelA.begin( ), _mandelA.end( ) );
 
-        floatVector expDtLalpha;
+        return NULL;
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( tardigradeVectorTools::computeMatrixExponentialScalingAndSquaring( DtLalpha, dim, expDtLalpha ) )
+    }
 
-        deformationGradient = floatVector( sot_dim, 0 );
+    errorOut fromMandel( const floatVector &mandelA, floatVector &A ){
+        /*!
+         * Expand the Mandel representation of a symmetric second order tensor to all nine components
+         *
+         * \param &mandelA: The Mandel representation of the tensor
+         * \param &A: The symmetric second order tensor stored in row-major order
+         */
 
-        for ( unsigned int i = 0; i < dim; i++ ){
+        floatMandelVector _mandelA;
 
-            for ( unsigned int j = 0; j < dim; j++ ){
+        floatSecondOrderTensor _A;
 
-                for ( unsigned int k = 0; k < dim; k++ ){
+        TARDIGRADE_ERROR_TOOLS_CHECK( mandelA.size( ) == _mandelA.size( ), "The Mandel vector must have " + std::to_string( _mandelA.size( ) ) + " components and it has " + std::to_string( mandelA.size( ) ) );
 
-                    deformationGradient[ dim * i + k ] += expDtLalpha[ dim * i + j ] * previousDeformationGradient[ dim * j + k ];
+        std::copy( mandelA.begin( ), mandelA.end( ), _mandelA.begin( ) );
 
-                }
+        fromMandel( _mandelA, _A );
 
-            }
+        A.assign( _A.begin( ), _A.end( ) );
 
-        }
+        return NULL;
 
     }
 
-    void evolveFExponentialMap( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
-                                floatVector &deformationGradient, floatVector &dFdL, const floatType alpha ){
+    template< typename T >
+    void computeRightCauchyGreen( const secondOrderTensor< T > &deformationGradient, mandelVector< T > &C ){
         /*!
-         * Evolve the deformation gradient using the exponential map. Assumes the evolution equation is of the form
-         * 
-         * \f$ \dot{F}_{iI} = \ell_{ij} F_{jI} \f$
-         * 
-         * \param &Dt: The change in time
-         * \param &previousDeformationGradient: The previous value of the deformation gradient
-         * \param &Lp: The previous value of the velocity gradient
-         * \param &L: The current value of the velocity gradient
-         * \param &deformationGradient: The computed value of the deformation gradient
-         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
-         * \param &alpha: The integration parameter (0 is explicit and 1 is implicit)
+         * Compute the Mandel representation of the right Cauchy-Green deformation tensor \f$C_{IJ} = F_{iI} F_{iJ}\f$
+         *
+         * \param &deformationGradient: The deformation gradient \f$F_{iI}\f$ stored in row-major order
+         * \param &C: The Mandel representation of the right Cauchy-Green deformation tensor
          */
 
         constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
 
-        floatVector DtLalpha = Dt * ( ( 1 - alpha ) * Lp + alpha * L );
+        const secondOrderTensor< T > &F = deformationGradient;
 
-        floatVector expDtLalpha;
+        for ( unsigned int I = 0; I < 6; I++ ){
 
-        floatVector dExpDtLalphadL;
+            const unsigned int i = mandelRow[ I ];
+            const unsigned int j = mandelColumn[ I ];
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( tardigradeVectorTools::computeMatrixExponentialScalingAndSquaring( DtLalpha, dim, expDtLalpha, dExpDtLalphadL ) )
+            C[ I ] = T( mandelWeight[ I ] ) * ( F[ i ] * F[ j ] + F[ dim + i ] * F[ dim + j ] + F[ 2 * dim + i ] * F[ 2 * dim + j ] );
 
-        dExpDtLalphadL *= Dt * alpha;
+        }
 
-        deformationGradient = floatVector( sot_dim, 0 );
+    }
 
-        dFdL = floatVector( sot_dim * sot_dim, 0 );
+    template< typename T >
+    void computeRightCauchyGreen( const secondOrderTensor< T > &deformationGradient, mandelVector< T > &C, mandelGradient< T > &dCdF ){
+        /*!
+         * Compute the Mandel representation of the right Cauchy-Green deformation tensor \f$C_{IJ} = F_{iI} F_{iJ}\f$
+         * and its 6x9 Jacobian w.r.t. the deformation gradient
+         *
+         * \param &deformationGradient: The deformation gradient \f$F_{iI}\f$ stored in row-major order
+         * \param &C: The Mandel representation of the right Cauchy-Green deformation tensor
+         * \param &dCdF: The Mandel representation of \f$\frac{\partial C}{\partial F}\f$ stored 6x9 in row-major order
+         */
 
-        for ( unsigned int i = 0; i < dim; i++ ){
+        constexpr unsigned int dim = 3;
+        constexpr unsigned int sot_dim = dim * dim;
 
-            for ( unsigned int j = 0; j < dim; j++ ){
+        const secondOrderTensor< T > &F = deformationGradient;
 
-                for ( unsigned int k = 0; k < dim; k++ ){
+        computeRightCauchyGreen( F, C );
 
-                    deformationGradient[ dim * i + k ] += expDtLalpha[ dim * i + j ] * previousDeformationGradient[ dim * j + k ];
+        std::fill( dCdF.begin( ), dCdF.end( ), T( 0 ) );
 
-                    for ( unsigned int ab = 0; ab < sot_dim; ab++ ){
+        for ( unsigned int I = 0; I < 6; I++ ){
 
-                        dFdL[ dim * sot_dim * i + sot_dim * k + ab ] += dExpDtLalphadL[ dim * sot_dim * i + sot_dim * j + ab ] * previousDeformationGradient[ dim * j + k ];
+            const unsigned int i = mandelRow[ I ];
+            const unsigned int j = mandelColumn[ I ];
 
-                    }
+            const T w = T( mandelWeight[ I ] );
 
-                }
+            for ( unsigned int k = 0; k < dim; k++ ){
+
+                dCdF[ sot_dim * I + dim * k + j ] += w * F[ dim * k + i ];
+                dCdF[ sot_dim * I + dim * k + i ] += w * F[ dim * k + j ];
 
             }
 
@@ -2621,344 +10157,536 @@ namespace tardigradeConstitutiveTools{
 
     }
 
-    void evolveFExponentialMap( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
-                                floatVector &deformationGradient, floatVector &dFdL, floatVector &dFdFp, floatVector &dFdLp, const floatType alpha ){
+    template< typename T >
+    void computeGreenLagrangeStrain( const secondOrderTensor< T > &deformationGradient, mandelVector< T > &E ){
         /*!
-         * Evolve the deformation gradient using the exponential map. Assumes the evolution equation is of the form
-         * 
-         * \f$ \dot{F}_{iI} = \ell_{ij} F_{jI} \f$
-         * 
-         * \param &Dt: The change in time
-         * \param &previousDeformationGradient: The previous value of the deformation gradient
-         * \param &Lp: The previous value of the velocity gradient
-         * \param &L: The current value of the velocity gradient
-         * \param &deformationGradient: The computed value of the deformation gradient
-         * \param &dFdL: The derivative of the deformation gradient w.r.t. the velocity gradient
-         * \param &alpha: The integration parameter (0 is explicit and 1 is implicit)
+         * Compute the Mandel representation of the Green-Lagrange strain \f$E_{IJ} = \frac{1}{2} \left( F_{iI} F_{iJ} - \delta_{IJ} \right)\f$
+         *
+         * \param &deformationGradient: The deformation gradient \f$F_{iI}\f$ stored in row-major order
+         * \param &E: The Mandel representation of the Green-Lagrange strain
          */
 
-        constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
-
-        floatVector DtLalpha = Dt * ( ( 1 - alpha ) * Lp + alpha * L );
+        computeRightCauchyGreen( deformationGradient, E );
 
-        floatVector expDtLalpha;
+        for ( unsigned int I = 0; I < 6; I++ ){ E[ I ] *= T( 0.5 ); }
 
-        floatVector dExpDtLalphadL;
+        for ( unsigned int I = 0; I < 3; I++ ){ E[ I ] -= T( 0.5 ); }
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( tardigradeVectorTools::computeMatrixExponentialScalingAndSquaring( DtLalpha, dim, expDtLalpha, dExpDtLalphadL ) )
-
-        floatVector dExpDtLalphadLp = dExpDtLalphadL * Dt * ( 1 - alpha );
-
-        dExpDtLalphadL *= Dt * alpha;
+    }
 
-        deformationGradient = floatVector( sot_dim, 0 );
+    template< typename T >
+    void computeGreenLagrangeStrain( const secondOrderTensor< T > &deformationGradient, mandelVector< T > &E, mandelGradient< T > &dEdF ){
+        /*!
+         * Compute the Mandel representation of the Green-Lagrange strain \f$E_{IJ} = \frac{1}{2} \left( F_{iI} F_{iJ} - \delta_{IJ} \right)\f$
+         * and its 6x9 Jacobian w.r.t. the deformation gradient
+         *
+         * \param &deformationGradient: The deformation gradient \f$F_{iI}\f$ stored in row-major order
+         * \param &E: The Mandel representation of the Green-Lagrange strain
+         * \param &dEdF: The Mandel representation of \f$\frac{\partial E}{\partial F}\f$ stored 6x9 in row-major order
+         */
 
-        dFdFp = floatVector( sot_dim * sot_dim, 0 );
+        computeRightCauchyGreen( deformationGradient, E, dEdF );
 
-        dFdL = floatVector( sot_dim * sot_dim, 0 );
+        for ( unsigned int I = 0; I < 6; I++ ){ E[ I ] *= T( 0.5 ); }
 
-        dFdLp = floatVector( sot_dim * sot_dim, 0 );
+        for ( unsigned int I = 0; I < 3; I++ ){ E[ I ] -= T( 0.5 ); }
 
-        for ( unsigned int i = 0; i < dim; i++ ){
+        for ( unsigned int i = 0; i < dEdF.size( ); i++ ){ dEdF[ i ] *= T( 0.5 ); }
 
-            for ( unsigned int j = 0; j < dim; j++ ){
+    }
 
-                for ( unsigned int k = 0; k < dim; k++ ){
+    template< typename T >
+    errorOut decomposeGreenLagrangeStrain( const mandelVector< T > &E, mandelVector< T > &Ebar, T &J ){
+        /*!
+         * Decompose the Mandel representation of the Green-Lagrange strain tensor ( \f$E\f$ ) into isochoric
+         * ( \f$\bar{E}\f$ ) and volumetric ( \f$J\f$ ) parts where
+         *
+         * \f$J = \sqrt{ det \left( 2 E + I \right) }\f$
+         *
+         * \f$\bar{E} = J^{-\frac{2}{3}} E + \frac{1}{2} \left( J^{-\frac{2}{3}} - 1 \right) I\f$
+         *
+         * \param &E: The Mandel representation of the Green-Lagrange strain tensor ( \f$E\f$ )
+         * \param &Ebar: The Mandel representation of the isochoric Green-Lagrange strain tensor ( \f$\bar{E}\f$ )
+         * \param &J: The Jacobian of deformation ( \f$J\f$ )
+         */
 
-                    deformationGradient[ dim * i + k ] += expDtLalpha[ dim * i + j ] * previousDeformationGradient[ dim * j + k ];
+        constexpr T invSqrt2 = T( 0.70710678118654752440 );
 
-                    dFdFp[ dim * sot_dim * i + sot_dim * j + dim * k + j ] += expDtLalpha[ dim * i + k ];
+        const T C11 = 2 * E[ 0 ] + 1;
+        const T C22 = 2 * E[ 1 ] + 1;
+        const T C33 = 2 * E[ 2 ] + 1;
+        const T C23 = 2 * invSqrt2 * E[ 3 ];
+        const T C13 = 2 * invSqrt2 * E[ 4 ];
+        const T C12 = 2 * invSqrt2 * E[ 5 ];
 
-                    for ( unsigned int ab = 0; ab < sot_dim; ab++ ){
+        const T Jsq = C11 * ( C22 * C33 - C23 * C23 ) - C12 * ( C12 * C33 - C23 * C13 ) + C13 * ( C12 * C23 - C22 * C13 );
 
-                        dFdL[ dim * sot_dim * i + sot_dim * k + ab ] += dExpDtLalphadL[ dim * sot_dim * i + sot_dim * j + ab ] * previousDeformationGradient[ dim * j + k ];
-                        dFdLp[ dim * sot_dim * i + sot_dim * k + ab ] += dExpDtLalphadLp[ dim * sot_dim * i + sot_dim * j + ab ] * previousDeformationGradient[ dim * j + k ];
+        TARDIGRADE_ERROR_TOOLS_CHECK( Jsq > 0, "the determinant of the Green-Lagrange strain is negative" );
 
+        J = std::sqrt( Jsq );
 
-                    }
+        const T invJ23 = 1 / std::cbrt( Jsq );
 
-                }
+        for ( unsigned int I = 0; I < 6; I++ ){ Ebar[ I ] = invJ23 * E[ I ]; }
 
-            }
+        for ( unsigned int I = 0; I < 3; I++ ){ Ebar[ I ] += T( 0.5 ) * ( invJ23 - 1 ); }
 
-        }
+        return NULL;
 
     }
 
-    void computeDCurrentNormalVectorDF( const floatVector &normalVector, const floatVector &F, floatVector &dNormalVectordF ){
+    template< typename T >
+    errorOut decomposeGreenLagrangeStrain( const mandelVector< T > &E, mandelVector< T > &Ebar, T &J,
+                                           mandelMatrix< T > &dEbardE, mandelVector< T > &dJdE ){
         /*!
-         * Compute the derivative of the normal vector in the current configuration w.r.t. the deformation gradient
-         * 
-         * \param &normalVector: The unit normal vector in the current configuration
-         * \param &F: The deformation gradient
-         * \param &dNormalVectordF: The derivative of the normal vector w.r.t. the deformation gradient
+         * Decompose the Mandel representation of the Green-Lagrange strain tensor ( \f$E\f$ ) into isochoric
+         * ( \f$\bar{E}\f$ ) and volumetric ( \f$J\f$ ) parts and compute the Jacobians
+         *
+         * \f$\frac{\partial J}{\partial E} = J C^{-1}\f$
+         *
+         * \f$\frac{\partial \bar{E}}{\partial E} = J^{-\frac{2}{3}} \left( \mathbb{I} - \frac{1}{3} C \otimes C^{-1} \right)\f$
+         *
+         * where \f$C = 2 E + I\f$. As the Mandel representation preserves the inner product both Jacobians are
+         * taken w.r.t. the Mandel components of \f$E\f$.
+         *
+         * \param &E: The Mandel representation of the Green-Lagrange strain tensor ( \f$E\f$ )
+         * \param &Ebar: The Mandel representation of the isochoric Green-Lagrange strain tensor ( \f$\bar{E}\f$ )
+         * \param &J: The Jacobian of deformation ( \f$J\f$ )
+         * \param &dEbardE: The Mandel representation of \f$\frac{\partial \bar{E}}{\partial E}\f$ stored 6x6 in row-major order
+         * \param &dJdE: The Mandel representation of \f$\frac{\partial J}{\partial E}\f$
          */
 
         constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
-        constexpr unsigned int tot_dim = dim * dim * dim;
-
-        dNormalVectordF = floatVector( tot_dim, 0 );
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( F.size( ) == sot_dim, "The deformation gradient must be a second order tensor of size " + std::to_string( sot_dim ) + " and it has " + std::to_string( F.size( ) ) + " elements" );
-
-        floatVector invF( sot_dim, 0 );
+        TARDIGRADE_ERROR_TOOLS_CATCH( decomposeGreenLagrangeStrain( E, Ebar, J ) );
 
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F_map( F.data( ), dim, dim );
+        mandelVector< T > mandelC;
 
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > invF_map( invF.data( ), dim, dim );
+        for ( unsigned int I = 0; I < 6; I++ ){ mandelC[ I ] = 2 * E[ I ]; }
 
-        invF_map = F_map.inverse( );
+        for ( unsigned int I = 0; I < 3; I++ ){ mandelC[ I ] += 1; }
 
-        floatVector invF_n( dim, 0 );
+        secondOrderTensor< T > C, invC;
 
-        for ( unsigned int B = 0; B < dim; B++ ){
+        fromMandel( mandelC, C );
 
-            for ( unsigned int j = 0; j < dim; j++ ){
+        invertSecondOrderTensor( C, invC );
 
-                invF_n[ B ] += invF[ dim * B + j ] * normalVector[ j ];
+        for ( unsigned int I = 0; I < 6; I++ ){
 
-            }
+            dJdE[ I ] = J * T( mandelWeight[ I ] ) * invC[ dim * mandelRow[ I ] + mandelColumn[ I ] ];
 
         }
 
-        for ( unsigned int i = 0; i < dim; i++ ){
+        const T invJ23 = 1 / std::cbrt( J * J );
 
-            for ( unsigned int b = 0; b < dim; b++ ){
+        const T invJ53 = invJ23 / J;
 
-                for ( unsigned int B = 0; B < dim; B++ ){
+        for ( unsigned int I = 0; I < 6; I++ ){
 
-                    dNormalVectordF[ dim * dim * i + dim * b + B ] += normalVector[ i ] * normalVector[ b ] * invF_n[ B ]
-                                                                    - normalVector[ b ] * invF[ dim * B + i ];
+            for ( unsigned int K = 0; K < 6; K++ ){
 
-                }
+                dEbardE[ 6 * I + K ] = -invJ53 * mandelC[ I ] * dJdE[ K ] / 3;
 
             }
 
+            dEbardE[ 6 * I + I ] += invJ23;
+
         }
 
+        return NULL;
+
     }
 
-    void computeDCurrentAreaWeightedNormalVectorDF( const floatVector &normalVector, const floatVector &F, floatVector &dAreaWeightedNormalVectordF ){
+    template< typename T >
+    void pushForwardGreenLagrangeStrain( const mandelVector< T > &greenLagrangeStrain, const secondOrderTensor< T > &deformationGradient,
+                                         mandelVector< T > &almansiStrain ){
         /*!
-         * Compute the derivative of the area weighted normal vector w.r.t. the deformation gradient i.e.
-         * 
-         * \f$ \frac{\partial}{\partial F_{bB}} \left( n_i da \right) \f$
-         * 
-         * Note that if the user passes in the unit normal vector, then the result will be more convenient for the construction of
-         * the jacobian of a surface integral in the current configuration.
-         * 
-         * \param &normalVector: The normal vector (a unit vector is likely what is desired)
-         * \param &F: The deformation gradient
-         * \param &dAreaWeightedNormalVectordF: The derivative of the area weighted normal vector w.r.t. the deformation gradient
+         * Push the Mandel representation of the Green-Lagrange strain forward to the current configuration
+         * resulting in the Almansi strain
+         *
+         * \f$e_{ij} = F_{Ii}^{-1} E_{IJ} F_{Jj}^{-1}\f$
+         *
+         * \param &greenLagrangeStrain: The Mandel representation of the Green-Lagrange strain \f$E_{IJ}\f$
+         * \param &deformationGradient: The deformation gradient \f$F_{iI}\f$ stored in row-major order
+         * \param &almansiStrain: The Mandel representation of the Almansi strain \f$e_{ij}\f$
          */
 
         constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
-        constexpr unsigned int tot_dim = dim * dim * dim;
-
-        dAreaWeightedNormalVectordF = floatVector( tot_dim, 0 );
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( F.size( ) == sot_dim, "The deformation gradient must be a second order tensor of size " + std::to_string( sot_dim ) + " and it has " + std::to_string( F.size( ) ) + " elements" );
+        secondOrderTensor< T > E, invF, EinvF;
 
-        floatVector invF( sot_dim, 0 );
+        fromMandel( greenLagrangeStrain, E );
 
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F_map( F.data( ), dim, dim );
+        invertSecondOrderTensor( deformationGradient, invF );
 
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > invF_map( invF.data( ), dim, dim );
+        for ( unsigned int I = 0; I < dim; I++ ){
 
-        invF_map = F_map.inverse( );
+            for ( unsigned int j = 0; j < dim; j++ ){
 
-        for ( unsigned int i = 0; i < dim; i++ ){
+                EinvF[ dim * I + j ] = E[ dim * I ] * invF[ j ] + E[ dim * I + 1 ] * invF[ dim + j ] + E[ dim * I + 2 ] * invF[ 2 * dim + j ];
 
-            for ( unsigned int b = 0; b < dim; b++ ){
+            }
 
-                for ( unsigned int B = 0; B < dim; B++ ){
+        }
 
-                    dAreaWeightedNormalVectordF[ dim * dim * i + dim * b + B ] += normalVector[ i ] * invF[ dim * B + b ]
-                                                                                - normalVector[ b ] * invF[ dim * B + i ];
+        for ( unsigned int I = 0; I < 6; I++ ){
 
-                }
+            const unsigned int i = mandelRow[ I ];
+            const unsigned int j = mandelColumn[ I ];
 
-            }
+            almansiStrain[ I ] = T( mandelWeight[ I ] ) * ( invF[ i ] * EinvF[ j ] + invF[ dim + i ] * EinvF[ dim + j ] + invF[ 2 * dim + i ] * EinvF[ 2 * dim + j ] );
 
         }
 
     }
 
-    void computeDCurrentAreaDF( const floatVector &normalVector, const floatVector &F, floatVector &dCurrentAreadF ){
+    template< typename T >
+    void pushForwardGreenLagrangeStrain( const mandelVector< T > &greenLagrangeStrain, const secondOrderTensor< T > &deformationGradient,
+                                         mandelVector< T > &almansiStrain, mandelMatrix< T > &dAlmansiStraindE, mandelGradient< T > &dAlmansiStraindF ){
         /*!
-         * Compute the derivative of the current area w.r.t. the deformation gradient
-         * 
-         * \param &normalVector: The current unit normal vector
-         * \param &F: The deformation gradient
-         * \param &dCurrentAreadF: The derivative of the current surface area w.r.t. F
+         * Push the Mandel representation of the Green-Lagrange strain forward to the current configuration
+         * resulting in the Almansi strain and compute the Jacobians
+         *
+         * \f$\frac{\partial e_{ij}}{\partial E_{KL}} = F_{Ki}^{-1} F_{Lj}^{-1}\f$
+         *
+         * \f$\frac{\partial e_{ij}}{\partial F_{kK}} = -F_{Ki}^{-1} e_{kj} - e_{ik} F_{Kj}^{-1}\f$
+         *
+         * \param &greenLagrangeStrain: The Mandel representation of the Green-Lagrange strain \f$E_{IJ}\f$
+         * \param &deformationGradient: The deformation gradient \f$F_{iI}\f$ stored in row-major order
+         * \param &almansiStrain: The Mandel representation of the Almansi strain \f$e_{ij}\f$
+         * \param &dAlmansiStraindE: The Mandel representation of \f$\frac{\partial e}{\partial E}\f$ stored 6x6 in row-major order
+         * \param &dAlmansiStraindF: The Mandel representation of \f$\frac{\partial e}{\partial F}\f$ stored 6x9 in row-major order
          */
 
         constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
 
-        dCurrentAreadF = floatVector( sot_dim, 0 );
+        secondOrderTensor< T > invF, e;
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( F.size( ) == sot_dim, "The deformation gradient must be a second order tensor of size " + std::to_string( sot_dim ) + " and it has " + std::to_string( F.size( ) ) + " elements" );
+        pushForwardGreenLagrangeStrain( greenLagrangeStrain, deformationGradient, almansiStrain );
 
-        floatVector invF( sot_dim, 0 );
+        invertSecondOrderTensor( deformationGradient, invF );
 
-        Eigen::Map< const Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > F_map( F.data( ), dim, dim );
+        fromMandel( almansiStrain, e );
 
-        Eigen::Map< Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > > invF_map( invF.data( ), dim, dim );
+        fillMandelMatrix< T >( [ & ]( const unsigned int i, const unsigned int j, const unsigned int k, const unsigned int l ){
+                                   return invF[ dim * k + i ] * invF[ dim * l + j ];
+                               }, dAlmansiStraindE );
 
-        invF_map = F_map.inverse( );
+        fillMandelGradient< T >( [ & ]( const unsigned int i, const unsigned int j, const unsigned int k, const unsigned int l ){
+                                     return -invF[ dim * l + i ] * e[ dim * k + j ] - e[ dim * i + k ] * invF[ dim * l + j ];
+                                 }, dAlmansiStraindF );
 
-        floatVector invF_n( dim, 0 );
+    }
 
-        for ( unsigned int B = 0; B < dim; B++ ){
+    template< typename T >
+    void pushForwardPK2Stress( const mandelVector< T > &PK2, const secondOrderTensor< T > &F, mandelVector< T > &cauchyStress ){
+        /*!
+         * Push the Mandel representation of the second Piola-Kirchhoff stress forward to the current configuration
+         * resulting in the Cauchy stress
+         *
+         * \f$\sigma_{ij} = \frac{1}{J} F_{iI} S_{IJ} F_{jJ}\f$
+         *
+         * \param &PK2: The Mandel representation of the second Piola-Kirchhoff stress \f$S_{IJ}\f$
+         * \param &F: The deformation gradient \f$F_{iI}\f$ stored in row-major order
+         * \param &cauchyStress: The Mandel representation of the Cauchy stress \f$\sigma_{ij}\f$
+         */
 
-            for ( unsigned int i = 0; i < dim; i++ ){
+        constexpr unsigned int dim = 3;
 
-                invF_n[ B ] += invF[ dim * B + i ] * normalVector[ i ];
+        secondOrderTensor< T > S, FS;
 
-            }
+        fromMandel( PK2, S );
 
-        }
+        const T invJ = 1 / ( F[ 0 ] * ( F[ 4 ] * F[ 8 ] - F[ 5 ] * F[ 7 ] ) + F[ 1 ] * ( F[ 5 ] * F[ 6 ] - F[ 3 ] * F[ 8 ] ) + F[ 2 ] * ( F[ 3 ] * F[ 7 ] - F[ 4 ] * F[ 6 ] ) );
 
-        for ( unsigned int B = 0; B < dim; B++ ){
+        for ( unsigned int i = 0; i < dim; i++ ){
 
-            for ( unsigned int b = 0; b < dim; b++ ){
+            for ( unsigned int J = 0; J < dim; J++ ){
 
-                dCurrentAreadF[ dim * b + B ] += invF[ dim * B + b ] - normalVector[ b ] * invF_n[ B ];
+                FS[ dim * i + J ] = F[ dim * i ] * S[ J ] + F[ dim * i + 1 ] * S[ dim + J ] + F[ dim * i + 2 ] * S[ 2 * dim + J ];
 
             }
 
         }
 
+        for ( unsigned int I = 0; I < 6; I++ ){
+
+            const unsigned int i = mandelRow[ I ];
+            const unsigned int j = mandelColumn[ I ];
+
+            cauchyStress[ I ] = T( mandelWeight[ I ] ) * invJ * ( FS[ dim * i ] * F[ dim * j ] + FS[ dim * i + 1 ] * F[ dim * j + 1 ] + FS[ dim * i + 2 ] * F[ dim * j + 2 ] );
+
+        }
+
     }
 
-    void computeDCurrentNormalVectorDGradU( const floatVector &normalVector, const floatVector &gradU, floatVector &dNormalVectordGradU, const bool isCurrent ){
+    template< typename T >
+    void pushForwardPK2Stress( const mandelVector< T > &PK2, const secondOrderTensor< T > &F, mandelVector< T > &cauchyStress,
+                               mandelMatrix< T > &dCauchyStressdPK2, mandelGradient< T > &dCauchyStressdF ){
         /*!
-         * Compute the derivative of the normal vector in the current configuration w.r.t. the displacement gradient
-         * 
-         * \param &normalVector: The unit normal vector in the current configuration
-         * \param &gradU: The displacement gradient
-         * \param &dNormalVectordF: The derivative of the normal vector w.r.t. the displacement gradient
-         * \param &isCurrent: Whether the displacement gradient is with respect to the reference or current configuration
+         * Push the Mandel representation of the second Piola-Kirchhoff stress forward to the current configuration
+         * resulting in the Cauchy stress and compute the Jacobians
+         *
+         * \f$\frac{\partial \sigma_{ij}}{\partial S_{KL}} = \frac{1}{J} F_{iK} F_{jL}\f$
+         *
+         * \f$\frac{\partial \sigma_{ij}}{\partial F_{kK}} = \frac{1}{J} \left( \delta_{ik} S_{KJ} F_{jJ} + F_{iI} S_{IK} \delta_{jk} \right) - \sigma_{ij} F_{Kk}^{-1}\f$
+         *
+         * \param &PK2: The Mandel representation of the second Piola-Kirchhoff stress \f$S_{IJ}\f$
+         * \param &F: The deformation gradient \f$F_{iI}\f$ stored in row-major order
+         * \param &cauchyStress: The Mandel representation of the Cauchy stress \f$\sigma_{ij}\f$
+         * \param &dCauchyStressdPK2: The Mandel representation of \f$\frac{\partial \sigma}{\partial S}\f$ stored 6x6 in row-major order
+         * \param &dCauchyStressdF: The Mandel representation of \f$\frac{\partial \sigma}{\partial F}\f$ stored 6x9 in row-major order
          */
 
         constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
-        constexpr unsigned int tot_dim = dim * dim * dim;
 
-        floatVector F;
+        secondOrderTensor< T > S, FSJ, invF, sigma;
+
+        fromMandel( PK2, S );
+
+        const T invJ = 1 / invertSecondOrderTensor( F, invF );
 
-        floatVector dFdGradU;
+        for ( unsigned int i = 0; i < dim; i++ ){
 
-        computeDeformationGradient( gradU, F, dFdGradU, isCurrent );
+            for ( unsigned int J = 0; J < dim; J++ ){
 
-        floatVector dNormalVectordF;
+                FSJ[ dim * i + J ] = invJ * ( F[ dim * i ] * S[ J ] + F[ dim * i + 1 ] * S[ dim + J ] + F[ dim * i + 2 ] * S[ 2 * dim + J ] );
 
-        computeDCurrentNormalVectorDF( normalVector, F, dNormalVectordF );
+            }
 
-        dNormalVectordGradU = floatVector( tot_dim, 0 );
+        }
 
         for ( unsigned int i = 0; i < dim; i++ ){
 
-            for ( unsigned int j = 0; j < sot_dim; j++ ){
-
-                for ( unsigned int k = 0; k < sot_dim; k++ ){
+            for ( unsigned int j = i; j < dim; j++ ){
 
-                    dNormalVectordGradU[ sot_dim * i + k ] += dNormalVectordF[ sot_dim * i + j ] * dFdGradU[ sot_dim * j + k ];
+                sigma[ dim * i + j ] = FSJ[ dim * i ] * F[ dim * j ] + FSJ[ dim * i + 1 ] * F[ dim * j + 1 ] + FSJ[ dim * i + 2 ] * F[ dim * j + 2 ];
 
-                }
+                sigma[ dim * j + i ] = sigma[ dim * i + j ];
 
             }
 
         }
 
+        toMandel( sigma, cauchyStress );
+
+        fillMandelMatrix< T >( [ & ]( const unsigned int i, const unsigned int j, const unsigned int k, const unsigned int l ){
+                                   return invJ * F[ dim * i + k ] * F[ dim * j + l ];
+                               }, dCauchyStressdPK2 );
+
+        fillMandelGradient< T >( [ & ]( const unsigned int i, const unsigned int j, const unsigned int k, const unsigned int l ){
+                                     return T( i == k ) * FSJ[ dim * j + l ] + FSJ[ dim * i + l ] * T( j == k ) - sigma[ dim * i + j ] * invF[ dim * l + k ];
+                                 }, dCauchyStressdF );
+
     }
 
-    void computeDCurrentAreaWeightedNormalVectorDGradU( const floatVector &normalVector, const floatVector &gradU, floatVector &dAreaWeightedNormalVectordGradU, const bool isCurrent ){
+    template< typename T >
+    void pullBackCauchyStress( const mandelVector< T > &cauchyStress, const secondOrderTensor< T > &F, mandelVector< T > &PK2 ){
         /*!
-         * Compute the derivative of the area weighted normal vector w.r.t. the displacement gradient
-         * 
-         * \f$ \frac{\partial}{\partial u_{i,j}} \left( n_i da \right) \f$
-         * 
-         * Note that if the user passes in the unit normal vector, then the result will be more convenient for the construction of
-         * the jacobian of a surface integral in the current configuration.
-         * 
-         * \param &normalVector: The normal vector (a unit vector is likely what is desired)
-         * \param &gradU: The displacement gradient
-         * \param &dAreaWeightedNormalVectordGradU: The derivative of the area weighted normal vector w.r.t. the displacement gradient
-         * \param &isCurrent: Whether the displacement gradient is with respect to the reference or current configuration
+         * Pull the Mandel representation of the Cauchy stress back to the reference configuration resulting in the
+         * second Piola-Kirchhoff stress
+         *
+         * \f$S_{IJ} = J F_{Ii}^{-1} \sigma_{ij} F_{Jj}^{-1}\f$
+         *
+         * \param &cauchyStress: The Mandel representation of the Cauchy stress \f$\sigma_{ij}\f$
+         * \param &F: The deformation gradient \f$F_{iI}\f$ stored in row-major order
+         * \param &PK2: The Mandel representation of the second Piola-Kirchhoff stress \f$S_{IJ}\f$
          */
 
         constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
-        constexpr unsigned int tot_dim = dim * dim * dim;
 
-        floatVector F;
+        secondOrderTensor< T > sigma, invF, invFsigma;
 
-        floatVector dFdGradU;
+        fromMandel( cauchyStress, sigma );
 
-        computeDeformationGradient( gradU, F, dFdGradU, isCurrent );
+        const T J = invertSecondOrderTensor( F, invF );
 
-        floatVector dAreaWeightedNormalVectordF;
-
-        computeDCurrentAreaWeightedNormalVectorDF( normalVector, F, dAreaWeightedNormalVectordF );
+        for ( unsigned int I = 0; I < dim; I++ ){
 
-        dAreaWeightedNormalVectordGradU = floatVector( tot_dim, 0 );
+            for ( unsigned int j = 0; j < dim; j++ ){
 
-        for ( unsigned int i = 0; i < dim; i++ ){
+                invFsigma[ dim * I + j ] = J * ( invF[ dim * I ] * sigma[ j ] + invF[ dim * I + 1 ] * sigma[ dim + j ] + invF[ dim * I + 2 ] * sigma[ 2 * dim + j ] );
 
-            for ( unsigned int j = 0; j < sot_dim; j++ ){
+            }
 
-                for ( unsigned int k = 0; k < sot_dim; k++ ){
+        }
 
-                    dAreaWeightedNormalVectordGradU[ sot_dim * i + k ] += dAreaWeightedNormalVectordF[ sot_dim * i + j ] * dFdGradU[ sot_dim * j + k ];
+        for ( unsigned int K = 0; K < 6; K++ ){
 
-                }
+            const unsigned int I = mandelRow[ K ];
+            const unsigned int J_ = mandelColumn[ K ];
 
-            }
+            PK2[ K ] = T( mandelWeight[ K ] ) * ( invFsigma[ dim * I ] * invF[ dim * J_ ] + invFsigma[ dim * I + 1 ] * invF[ dim * J_ + 1 ] + invFsigma[ dim * I + 2 ] * invF[ dim * J_ + 2 ] );
 
         }
 
     }
 
-    void computeDCurrentAreaDGradU( const floatVector &normalVector, const floatVector &gradU, floatVector &dCurrentAreadGradU, const bool isCurrent ){
+    template< typename T >
+    void pullBackCauchyStress( const mandelVector< T > &cauchyStress, const secondOrderTensor< T > &F, mandelVector< T > &PK2,
+                               mandelMatrix< T > &dPK2dCauchyStress, mandelGradient< T > &dPK2dF ){
         /*!
-         * Compute the derivative of the current area w.r.t. the displacement gradient
-         * 
-         * \param &normalVector: The current unit normal vector
-         * \param &gradU: The displacement gradient
-         * \param &dCurrentAreadGradU: The derivative of the current surface area w.r.t. the displacement gradient
-         * \param &isCurrent: Whether the displacement gradient is with respect to the reference or current configuration
+         * Pull the Mandel representation of the Cauchy stress back to the reference configuration resulting in the
+         * second Piola-Kirchhoff stress and compute the Jacobians
+         *
+         * \f$\frac{\partial S_{IJ}}{\partial \sigma_{kl}} = J F_{Ik}^{-1} F_{Jl}^{-1}\f$
+         *
+         * \f$\frac{\partial S_{IJ}}{\partial F_{kK}} = S_{IJ} F_{Kk}^{-1} - F_{Ik}^{-1} S_{KJ} - S_{IK} F_{Jk}^{-1}\f$
+         *
+         * \param &cauchyStress: The Mandel representation of the Cauchy stress \f$\sigma_{ij}\f$
+         * \param &F: The deformation gradient \f$F_{iI}\f$ stored in row-major order
+         * \param &PK2: The Mandel representation of the second Piola-Kirchhoff stress \f$S_{IJ}\f$
+         * \param &dPK2dCauchyStress: The Mandel representation of \f$\frac{\partial S}{\partial \sigma}\f$ stored 6x6 in row-major order
+         * \param &dPK2dF: The Mandel representation of \f$\frac{\partial S}{\partial F}\f$ stored 6x9 in row-major order
          */
 
         constexpr unsigned int dim = 3;
-        constexpr unsigned int sot_dim = dim * dim;
-
-        floatVector F;
-
-        floatVector dFdGradU;
 
-        computeDeformationGradient( gradU, F, dFdGradU, isCurrent );
+        secondOrderTensor< T > S, invF;
 
-        floatVector dCurrentAreadF;
+        pullBackCauchyStress( cauchyStress, F, PK2 );
 
-        computeDCurrentAreaDF( normalVector, F, dCurrentAreadF );
+        const T J = invertSecondOrderTensor( F, invF );
 
-        dCurrentAreadGradU = floatVector( sot_dim, 0 );
+        fromMandel( PK2, S );
 
-        for ( unsigned int i = 0; i < sot_dim; i++ ){
-
-            for ( unsigned int j = 0; j < sot_dim; j++ ){
-
-                dCurrentAreadGradU[ j ] += dCurrentAreadF[ i ] * dFdGradU[ sot_dim * i + j ];
+        fillMandelMatrix< T >( [ & ]( const unsigned int I, const unsigned int J_, const unsigned int k, const unsigned int l ){
+                                   return J * invF[ dim * I + k ] * invF[ dim * J_ + l ];
+                               }, dPK2dCauchyStress );
 
-            }
-
-        }
+        fillMandelGradient< T >( [ & ]( const unsigned int I, const unsigned int J_, const unsigned int k, const unsigned int K ){
+                                     return S[ dim * I + J_ ] * invF[ dim * K + k ] - invF[ dim * I + k ] * S[ dim * K + J_ ] - S[ dim * I + K ] * invF[ dim * J_ + k ];
+                                 }, dPK2dF );
 
     }
 
+    #define TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_SCALAR_KERNELS( T )                                                                                 \
+        template void computeDeformationGradient< T >( const secondOrderTensor< T > &, secondOrderTensor< T > &, const bool );                                    \
+        template void computeDeformationGradient< T >( const secondOrderTensor< T > &, secondOrderTensor< T > &, fourthOrderTensor< T > &, const bool );          \
+        template void computeRightCauchyGreen< T >( const secondOrderTensor< T > &, secondOrderTensor< T > & );                                                   \
+        template void computeRightCauchyGreen< T >( const secondOrderTensor< T > &, secondOrderTensor< T > &, fourthOrderTensor< T > & );                         \
+        template void computeGreenLagrangeStrain< T >( const secondOrderTensor< T > &, secondOrderTensor< T > & );                                                \
+        template void computeGreenLagrangeStrain< T >( const secondOrderTensor< T > &, secondOrderTensor< T > &, fourthOrderTensor< T > & );                      \
+        template void computeDGreenLagrangeStrainDF< T >( const secondOrderTensor< T > &, fourthOrderTensor< T > & );                                             \
+        template T invertSecondOrderTensor< T >( const secondOrderTensor< T > &, secondOrderTensor< T > & );                                                       \
+        template T invertSecondOrderTensor< T >( const secondOrderTensor< T > &, secondOrderTensor< T > &, statusCode &, const T );                                \
+        template void invertSecondOrderTensorBatched< T >( const unsigned int, const T *, T *, T *, statusCode &, const T );                                      \
+        template void computeDeformationGradientBatched< T >( const unsigned int, const T *, T *, const bool );                                                    \
+        template void computeDeformationGradientBatched< T >( const unsigned int, const T *, T *, T *, const bool );                                               \
+        template void computeRightCauchyGreenBatched< T >( const unsigned int, const T *, T * );                                                                   \
+        template void computeRightCauchyGreenBatched< T >( const unsigned int, const T *, T *, T * );                                                              \
+        template void computeGreenLagrangeStrainBatched< T >( const unsigned int, const T *, T * );                                                                \
+        template void computeGreenLagrangeStrainBatched< T >( const unsigned int, const T *, T *, T * );                                                           \
+        template void computeKinematicsBatched< T >( const unsigned int, const T *, T *, T *, T *, const bool );                                                   \
+        template void computeKinematicsBatched< T >( const unsigned int, const T *, T *, T *, T *, T *, T *, T *, const bool );                                    \
+        template void rotateSecondOrderTensor< T >( const secondOrderTensor< T > &, const secondOrderTensor< T > &, secondOrderTensor< T > & );                    \
+        template void rotateSecondOrderTensor< T >( const secondOrderTensor< T > &, const secondOrderTensor< T > &, secondOrderTensor< T > &,                     \
+                                                    fourthOrderTensor< T > & );                                                                                   \
+        template void rotateFourthOrderTensor< T >( const fourthOrderTensor< T > &, const secondOrderTensor< T > &, fourthOrderTensor< T > & );                   \
+        template void rotateFourthOrderTensor< T >( const fourthOrderTensor< T > &, const secondOrderTensor< T > &, fourthOrderTensor< T > &,                     \
+                                                    sixthOrderTensor< T > & );                                                                                    \
+        template void rotateSecondOrderTensorBatched< T >( const unsigned int, const T *, const T *, T * );                                                        \
+        template void rotateFourthOrderTensorBatched< T >( const unsigned int, const T *, const T *, T * );                                                        \
+        template void quaternionToRotationMatrix< T >( const quaternion< T > &, secondOrderTensor< T > & );                                                       \
+        template void quaternionToRotationMatrix< T >( const quaternion< T > &, secondOrderTensor< T > &, std::array< T, 36 > & );                                \
+        template void rotationVectorToQuaternion< T >( const firstOrderTensor< T > &, quaternion< T > & );                                                        \
+        template void rotationVectorToQuaternion< T >( const firstOrderTensor< T > &, quaternion< T > &, std::array< T, 12 > & );                                 \
+        template void rotationVectorToRotationMatrix< T >( const firstOrderTensor< T > &, secondOrderTensor< T > & );                                             \
+        template void rotationVectorToRotationMatrix< T >( const firstOrderTensor< T > &, secondOrderTensor< T > &, thirdOrderTensor< T > & );                    \
+        template void composeQuaternions< T >( const quaternion< T > &, const quaternion< T > &, quaternion< T > & );                                             \
+        template void composeQuaternions< T >( const quaternion< T > &, const quaternion< T > &, quaternion< T > &, std::array< T, 16 > &, std::array< T, 16 > & ); \
+        template void rotateSecondOrderTensor< T >( const secondOrderTensor< T > &, const quaternion< T > &, secondOrderTensor< T > & );                           \
+        template void rotateSecondOrderTensor< T >( const secondOrderTensor< T > &, const quaternion< T > &, secondOrderTensor< T > &, std::array< T, 36 > & );    \
+        template void rotateSecondOrderTensor< T >( const secondOrderTensor< T > &, const firstOrderTensor< T > &, secondOrderTensor< T > & );                     \
+        template void rotateSecondOrderTensor< T >( const secondOrderTensor< T > &, const firstOrderTensor< T > &, secondOrderTensor< T > &,                       \
+                                                    thirdOrderTensor< T > & );                                                                                    \
+        template void rotateFourthOrderTensor< T >( const fourthOrderTensor< T > &, const quaternion< T > &, fourthOrderTensor< T > & );                          \
+        template void rotateFourthOrderTensor< T >( const fourthOrderTensor< T > &, const firstOrderTensor< T > &, fourthOrderTensor< T > & );                    \
+        template void rotateSecondOrderTensorByQuaternionBatched< T >( const unsigned int, const T *, const T *, T * );                                            \
+        template void rotateFourthOrderTensorByQuaternionBatched< T >( const unsigned int, const T *, const T *, T * );                                            \
+        template void computeCurrentSurfaceBatched< T >( const unsigned int, const T *, const T *, T *, T * );                                                     \
+        template void computeCurrentSurfaceBatched< T >( const unsigned int, const T *, const T *, T *, T *, T *, T * );                                          \
+        template void computeCurrentSurfaceBatched< T >( const unsigned int, const T *, const secondOrderTensor< T > &, T *, T * );                                \
+        template void computeCurrentSurfaceBatched< T >( const unsigned int, const T *, const secondOrderTensor< T > &, T *, T *, T *, T * );                     \
+        template void midpointEvolutionBatched< T >( const unsigned int, const T, const T *, const T *, T *, T *, const T, statusCode & );                         \
+        template void midpointEvolutionBatched< T >( const unsigned int, const unsigned int, const T, const T *, const T *, T *, T *, const T *, statusCode & );   \
+        template void computeDCurrentNormalVectorDGradU< T >( const firstOrderTensor< T > &, const secondOrderTensor< T > &, thirdOrderTensor< T > &, const bool ); \
+        template void computeDCurrentAreaWeightedNormalVectorDGradU< T >( const firstOrderTensor< T > &, const secondOrderTensor< T > &,                           \
+                                                                          thirdOrderTensor< T > &, const bool );                                                   \
+        template void computeDCurrentAreaDGradU< T >( const firstOrderTensor< T > &, const secondOrderTensor< T > &, secondOrderTensor< T > &, const bool );       \
+        template void computeIsochoricKinematics< T >( const secondOrderTensor< T > &, secondOrderTensor< T > &, secondOrderTensor< T > &,                         \
+                                                       secondOrderTensor< T > &, T &, const bool );                                                               \
+        template void computeIsochoricKinematics< T >( const secondOrderTensor< T > &, secondOrderTensor< T > &, secondOrderTensor< T > &,                         \
+                                                       secondOrderTensor< T > &, T &, fourthOrderTensor< T > &, secondOrderTensor< T > &, const bool );          \
+        template void toMandel< T >( const secondOrderTensor< T > &, mandelVector< T > & );                                                                        \
+        template void fromMandel< T >( const mandelVector< T > &, secondOrderTensor< T > & );                                                                      \
+        template void toMandel< T >( const fourthOrderTensor< T > &, mandelMatrix< T > & );                                                                        \
+        template void fromMandel< T >( const mandelMatrix< T > &, fourthOrderTensor< T > & );                                                                      \
+        template void toMandel< T >( const fourthOrderTensor< T > &, mandelGradient< T > & );                                                                      \
+        template void fromMandel< T >( const mandelGradient< T > &, fourthOrderTensor< T > & );                                                                    \
+        template void computeRightCauchyGreen< T >( const secondOrderTensor< T > &, mandelVector< T > & );                                                         \
+        template void computeRightCauchyGreen< T >( const secondOrderTensor< T > &, mandelVector< T > &, mandelGradient< T > & );                                  \
+        template void computeGreenLagrangeStrain< T >( const secondOrderTensor< T > &, mandelVector< T > & );                                                      \
+        template void computeGreenLagrangeStrain< T >( const secondOrderTensor< T > &, mandelVector< T > &, mandelGradient< T > & );                               \
+        template errorOut decomposeGreenLagrangeStrain< T >( const mandelVector< T > &, mandelVector< T > &, T & );                                                \
+        template errorOut decomposeGreenLagrangeStrain< T >( const mandelVector< T > &, mandelVector< T > &, T &, mandelMatrix< T > &, mandelVector< T > & );      \
+        template void pushForwardGreenLagrangeStrain< T >( const mandelVector< T > &, const secondOrderTensor< T > &, mandelVector< T > & );                        \
+        template void pushForwardGreenLagrangeStrain< T >( const mandelVector< T > &, const secondOrderTensor< T > &, mandelVector< T > &,                         \
+                                                           mandelMatrix< T > &, mandelGradient< T > & );                                                           \
+        template void pushForwardPK2Stress< T >( const mandelVector< T > &, const secondOrderTensor< T > &, mandelVector< T > & );                                  \
+        template void pushForwardPK2Stress< T >( const mandelVector< T > &, const secondOrderTensor< T > &, mandelVector< T > &,                                   \
+                                                 mandelMatrix< T > &, mandelGradient< T > & );                                                                     \
+        template void pullBackCauchyStress< T >( const mandelVector< T > &, const secondOrderTensor< T > &, mandelVector< T > & );                                  \
+        template void pullBackCauchyStress< T >( const mandelVector< T > &, const secondOrderTensor< T > &, mandelVector< T > &,                                   \
+                                                 mandelMatrix< T > &, mandelGradient< T > & );
+
+    #define TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_EVOLUTION( C, T )                                                                                  \
+        template void evolveF< C, T >( const T &, const secondOrderTensor< T > &, const secondOrderTensor< T > &, const secondOrderTensor< T > &,                 \
+                                       secondOrderTensor< T > &, secondOrderTensor< T > &, const T );                                                             \
+        template void evolveF< C, T >( const T &, const secondOrderTensor< T > &, const secondOrderTensor< T > &, const secondOrderTensor< T > &,                 \
+                                       secondOrderTensor< T > &, secondOrderTensor< T > &, fourthOrderTensor< T > &, const T );                                   \
+        template void evolveF< C, T >( const T &, const secondOrderTensor< T > &, const secondOrderTensor< T > &, const secondOrderTensor< T > &,                 \
+                                       secondOrderTensor< T > &, secondOrderTensor< T > &, fourthOrderTensor< T > &, fourthOrderTensor< T > &,                    \
+                                       fourthOrderTensor< T > &, fourthOrderTensor< T > &, const T );                                                             \
+        template void evolveFAdaptive< C, T >( const T &, const secondOrderTensor< T > &, const secondOrderTensor< T > &, const secondOrderTensor< T > &,         \
+                                               secondOrderTensor< T > &, unsigned int &, statusCode &, const T, const T, const unsigned int );                    \
+        template void evolveFAdaptive< C, T >( const T &, const secondOrderTensor< T > &, const secondOrderTensor< T > &, const secondOrderTensor< T > &,         \
+                                               secondOrderTensor< T > &, fourthOrderTensor< T > &, fourthOrderTensor< T > &, fourthOrderTensor< T > &,            \
+                                               unsigned int &, statusCode &, const T, const T, const unsigned int );
+
+    #define TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_KINEMATICS( K, T )                                                                                 \
+        template void computeDeformationGradient< K, T >( const kinematicTensor< K, T > &, kinematicTensor< K, T > &, const bool );                                \
+        template void computeDeformationGradient< K, T >( const kinematicTensor< K, T > &, kinematicTensor< K, T > &, kinematicJacobian< K, T > &, const bool );   \
+        template T invertDeformationGradient< K, T >( const kinematicTensor< K, T > &, kinematicTensor< K, T > & );                                                \
+        template void computeRightCauchyGreen< K, T >( const kinematicTensor< K, T > &, kinematicTensor< K, T > & );                                               \
+        template void computeRightCauchyGreen< K, T >( const kinematicTensor< K, T > &, kinematicTensor< K, T > &, kinematicJacobian< K, T > & );                  \
+        template void computeGreenLagrangeStrain< K, T >( const kinematicTensor< K, T > &, kinematicTensor< K, T > & );                                            \
+        template void computeGreenLagrangeStrain< K, T >( const kinematicTensor< K, T > &, kinematicTensor< K, T > &, kinematicJacobian< K, T > & );               \
+        template void expandToThreeDimensions< K, T >( const kinematicTensor< K, T > &, secondOrderTensor< T > &, const T );
+
+    // Explicit instantiations of the scalar type templated kernels
+    TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_SCALAR_KERNELS( float )
+    TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_SCALAR_KERNELS( double )
+
+    // Explicit instantiations of the kinematic assumption templated kernels
+    TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_KINEMATICS( uniaxialStrain, float )
+    TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_KINEMATICS( uniaxialStrain, double )
+    TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_KINEMATICS( planeStrain, float )
+    TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_KINEMATICS( planeStrain, double )
+    TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_KINEMATICS( axisymmetric, float )
+    TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_KINEMATICS( axisymmetric, double )
+    TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_KINEMATICS( threeDimensional, float )
+    TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_KINEMATICS( threeDimensional, double )
+
+    // Explicit instantiations of the velocity gradient configuration templated kernels
+    TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_EVOLUTION( currentConfiguration, float )
+    TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_EVOLUTION( currentConfiguration, double )
+    TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_EVOLUTION( referenceConfiguration, float )
+    TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_EVOLUTION( referenceConfiguration, double )
+
+    #undef TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_SCALAR_KERNELS
+    #undef TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_KINEMATICS
+    #undef TARDIGRADE_CONSTITUTIVE_TOOLS_INSTANTIATE_EVOLUTION
+
 }
@@ -27,6 +27,10 @@
 #define TARDIGRADE_CONSTITUTIVE_TOOLS_H
 
 #define USE_EIGEN
+#include<array>
+#include<limits>
+#include<type_traits>
+#include<vector>
 #include<tardigrade_vector_tools.h>
 #include<tardigrade_error_tools.h>
 
@@ -37,31 +41,596 @@ namespace tardigradeConstitutiveTools{
     typedef double floatType; //!< Define the float values type.
     typedef std::vector< floatType > floatVector; //!< Define a vector of floats
     typedef std::vector< std::vector< floatType > > floatMatrix; //!< Define a matrix of floats
+    template< typename T > using firstOrderTensor = std::array< T, 3 >; //!< Define a fixed-size 3D vector of scalar type T
+    template< typename T > using secondOrderTensor = std::array< T, 9 >; //!< Define a fixed-size 3D second order tensor of scalar type T stored in row-major order
+    template< typename T > using thirdOrderTensor = std::array< T, 27 >; //!< Define a fixed-size 3D third order tensor of scalar type T stored in row-major order
+    template< typename T > using fourthOrderTensor = std::array< T, 81 >; //!< Define a fixed-size 3D fourth order tensor of scalar type T stored in row-major order
+    typedef firstOrderTensor< floatType > floatFirstOrderTensor; //!< Define a fixed-size 3D vector
+    typedef secondOrderTensor< floatType > floatSecondOrderTensor; //!< Define a fixed-size 3D second order tensor stored in row-major order
+    typedef thirdOrderTensor< floatType > floatThirdOrderTensor; //!< Define a fixed-size 3D third order tensor stored in row-major order
+    typedef fourthOrderTensor< floatType > floatFourthOrderTensor; //!< Define a fixed-size 3D fourth order tensor stored in row-major order
+    template< typename T > using sixthOrderTensor = std::array< T, 729 >; //!< Define a fixed-size 3D sixth order tensor of scalar type T stored in row-major order
+    template< typename T > using quaternion = std::array< T, 4 >; //!< Define a quaternion of scalar type T stored as w, x, y, z
+    template< typename T > using mandelVector = std::array< T, 6 >; //!< Define a symmetric 3D second order tensor of scalar type T in Mandel notation
+    template< typename T > using mandelMatrix = std::array< T, 36 >; //!< Define a 3D fourth order tensor with minor symmetries of scalar type T in Mandel notation stored in row-major order
+    template< typename T > using mandelGradient = std::array< T, 54 >; //!< Define the Jacobian of a Mandel vector w.r.t. a general 3D second order tensor of scalar type T stored 6x9 in row-major order
+    typedef sixthOrderTensor< floatType > floatSixthOrderTensor; //!< Define a fixed-size 3D sixth order tensor stored in row-major order
+    typedef quaternion< floatType > floatQuaternion; //!< Define a quaternion stored as w, x, y, z
+    typedef mandelVector< floatType > floatMandelVector; //!< Define a symmetric 3D second order tensor in Mandel notation
+    typedef mandelMatrix< floatType > floatMandelMatrix; //!< Define a 3D fourth order tensor with minor symmetries in Mandel notation
+    typedef mandelGradient< floatType > floatMandelGradient; //!< Define the Jacobian of a Mandel vector w.r.t. a general 3D second order tensor
+
+    /*!
+     * Kinematic assumptions
+     *
+     * The kinematic tensors of analyses which are not fully three dimensional are block-diagonal so only their
+     * independent components are stored. Each assumption defines
+     *
+     * - dim: the number of spatial dimensions of the analysis
+     * - blockDim: the size of the square block of general components which is stored first in row-major order
+     * - nHoop: the number of independent diagonal components which are stored after the block
+     * - size: the number of stored components
+     *
+     * The remaining components take the values of the undeformed state i.e. \f$F_{33} = 1\f$ in plane strain.
+     * The kinematic functions are selected with the assumption as an explicit template argument e.g.
+     *
+     * \code
+     * kinematicTensor< planeStrain, floatType > gradU, F;
+     * computeDeformationGradient< planeStrain >( gradU, F, true );
+     * \endcode
+     */
+    struct uniaxialStrain{
+        static constexpr unsigned int dim = 1; //!< The number of spatial dimensions
+        static constexpr unsigned int blockDim = 1; //!< The size of the block of general components i.e. \f$A_{11}\f$
+        static constexpr unsigned int nHoop = 0; //!< The number of independent diagonal components
+        static constexpr unsigned int size = 1; //!< The number of stored components
+    };
+
+    struct planeStrain{
+        static constexpr unsigned int dim = 2; //!< The number of spatial dimensions
+        static constexpr unsigned int blockDim = 2; //!< The size of the block of general components i.e. \f$A_{11}, A_{12}, A_{21}, A_{22}\f$
+        static constexpr unsigned int nHoop = 0; //!< The number of independent diagonal components
+        static constexpr unsigned int size = 4; //!< The number of stored components
+    };
+
+    struct axisymmetric{
+        static constexpr unsigned int dim = 2; //!< The number of spatial dimensions
+        static constexpr unsigned int blockDim = 2; //!< The size of the block of general components i.e. \f$A_{rr}, A_{rz}, A_{zr}, A_{zz}\f$
+        static constexpr unsigned int nHoop = 1; //!< The number of independent diagonal components i.e. the hoop component \f$A_{\theta\theta}\f$
+        static constexpr unsigned int size = 5; //!< The number of stored components
+    };
+
+    struct threeDimensional{
+        static constexpr unsigned int dim = 3; //!< The number of spatial dimensions
+        static constexpr unsigned int blockDim = 3; //!< The size of the block of general components
+        static constexpr unsigned int nHoop = 0; //!< The number of independent diagonal components
+        static constexpr unsigned int size = 9; //!< The number of stored components
+    };
+
+    template< class K, typename T > using kinematicTensor = std::array< T, K::size >; //!< Define the stored components of a second order tensor under the kinematic assumption K
+    template< class K, typename T > using kinematicJacobian = std::array< T, K::size * K::size >; //!< Define the derivative of a kinematic tensor w.r.t. another stored in row-major order
+
+    /*!
+     * Configurations of the velocity gradient used to evolve the deformation gradient
+     *
+     * The runtime overloads of evolveF select the configuration in which the velocity gradient is known with the
+     * mode argument (1 for the current and 2 for the reference configuration). The configuration can instead be
+     * given as an explicit template argument so the kernel is compiled for it directly without branching on or
+     * validating the mode e.g.
+     *
+     * \code
+     * floatSecondOrderTensor Fp, Lp, L, dF, F;
+     * evolveF< currentConfiguration >( Dt, Fp, Lp, L, dF, F, alpha );
+     * \endcode
+     */
+    struct currentConfiguration{
+        static constexpr unsigned int mode = 1; //!< The equivalent runtime mode of evolveF
+    };
+
+    struct referenceConfiguration{
+        static constexpr unsigned int mode = 2; //!< The equivalent runtime mode of evolveF
+    };
+
+    /*!
+     * The status codes reported by the non-allocating overloads which take a trailing statusCode argument.
+     *
+     * These overloads never allocate an errorNode or throw. The checks they perform are selected when the
+     * library is compiled:
+     *
+     * - by default the sizes of the inputs are checked and the reason for the most recent failure on the
+     *   calling thread is written to a fixed-size thread-local buffer which can be read with statusDetail
+     * - if TARDIGRADE_CONSTITUTIVE_TOOLS_STATUS_ONLY is defined the sizes are checked but only the status
+     *   code is reported
+     * - if TARDIGRADE_CONSTITUTIVE_TOOLS_UNCHECKED is defined the size checks are removed and the caller is
+     *   responsible for passing correctly sized inputs. The errorOut overloads always check their inputs.
+     */
+    enum class statusCode{
+        success = 0,        //!< The operation succeeded
+        sizeMismatch,       //!< The inputs have inconsistent sizes
+        notSquare,          //!< A matrix input is not square
+        notThreeDimensional, //!< A tensor input is not 3D
+        outOfRange,          //!< A parameter is outside of its allowed range
+        nearlySingular,      //!< A matrix is singular or too poorly conditioned to be inverted reliably
+        notConverged         //!< An iterative or adaptive procedure did not converge within the allowed number of steps
+    };
+
+    const char *statusMessage( const statusCode status );
+
+    const char *statusDetail( );
+
+    template< typename T >
+    class RowMajorView{
+        /*!
+         * A non-owning view of flat row-major storage which supports the nested \f$J[i][j]\f$ indexing of a
+         * floatMatrix. The view does not allocate or copy and is only valid as long as the storage it refers
+         * to is neither resized nor destroyed.
+         *
+         * Jacobians returned by the flat overloads may be indexed as matrices without a copy using
+         *
+         * \code
+         * floatVector dCdF;
+         * computeRightCauchyGreen( F, C, dCdF );
+         * constFloatMatrixView J = asMatrix( dCdF, 9 );
+         * floatType dC12dF21 = J[ 1 ][ 3 ];
+         * \endcode
+         */
+
+        public:
+
+            RowMajorView( T *data, const unsigned int rows, const unsigned int columns ) : _data( data ), _rows( rows ), _columns( columns ){
+                /*!
+                 * Construct a view of rows x columns values stored in row-major order
+                 *
+                 * \param *data: A pointer to the first value
+                 * \param rows: The number of rows
+                 * \param columns: The number of columns
+                 */
+            }
+
+            template< typename U, typename = typename std::enable_if< std::is_convertible< U*, T* >::value >::type >
+            RowMajorView( const RowMajorView< U > &other ) : _data( other.data( ) ), _rows( other.rows( ) ), _columns( other.columns( ) ){
+                /*!
+                 * Construct a read-only view from a mutable view of the same storage
+                 *
+                 * \param &other: The mutable view
+                 */
+            }
+
+            T *operator[]( const unsigned int i ) const{
+                /*!
+                 * Return a pointer to the first value of row i
+                 *
+                 * \param i: The row index
+                 */
+
+                return _data + _columns * i;
+            }
+
+            unsigned int rows( ) const{
+                /*!
+                 * Return the number of rows
+                 */
+
+                return _rows;
+            }
+
+            unsigned int columns( ) const{
+                /*!
+                 * Return the number of columns
+                 */
+
+                return _columns;
+            }
+
+            unsigned int size( ) const{
+                /*!
+                 * Return the number of rows. Provided so that loops written against floatMatrix may use the view.
+                 */
+
+                return _rows;
+            }
+
+            T *data( ) const{
+                /*!
+                 * Return a pointer to the underlying storage
+                 */
+
+                return _data;
+            }
+
+            void copyTo( std::vector< std::vector< typename std::remove_const< T >::type > > &matrix ) const{
+                /*!
+                 * Copy the viewed values into a nested matrix. The rows of the matrix are only reallocated if the
+                 * shape of the matrix differs from the shape of the view so repeated copies into the same matrix
+                 * do not allocate.
+                 *
+                 * \param &matrix: The matrix to copy the values into
+                 */
+
+                matrix.resize( _rows );
+
+                for ( unsigned int i = 0; i < _rows; i++ ){
+
+                    matrix[ i ].assign( ( *this )[ i ], ( *this )[ i ] + _columns );
+
+                }
+
+            }
+
+        private:
+
+            T *_data; //!< The first viewed value
+
+            unsigned int _rows; //!< The number of rows
+
+            unsigned int _columns; //!< The number of columns
+
+    };
+
+    typedef RowMajorView< floatType > floatMatrixView; //!< Define a mutable row-major view of a flat vector of floats
+    typedef RowMajorView< const floatType > constFloatMatrixView; //!< Define a read-only row-major view of a flat vector of floats
+
+    floatMatrixView asMatrix( floatVector &flat, const unsigned int columns );
+
+    constFloatMatrixView asMatrix( const floatVector &flat, const unsigned int columns );
+
+    class StructuredJacobian{
+        /*!
+         * A fourth order Jacobian \f$J_{ijkl} = \frac{\partial Y_{ij}}{\partial X_{kl}}\f$ between 3D second order tensors
+         * which retains its structure. The Jacobian is stored as the sum of up to maxTerms structured terms and an
+         * optional dense part. The structured terms are
+         *
+         * identity: \f$J_{ijkl} = s \delta_{ik} \delta_{lj}\f$
+         *
+         * kronecker: \f$J_{ijkl} = s A_{ik} B_{lj}\f$ i.e. \f$J:X = s A X B\f$
+         *
+         * transposedKronecker: \f$J_{ijkl} = s A_{il} B_{kj}\f$ i.e. \f$J:X = s A X^T B\f$
+         *
+         * rankOne: \f$J_{ijkl} = s A_{ij} B_{kl}\f$ i.e. \f$J:X = s A \left(B:X\right)\f$
+         *
+         * Structured terms may be contracted with second order tensors and composed with each other without
+         * forming the 81 component dense representation. Terms which do not fit in the fixed capacity are
+         * accumulated into the dense part.
+         */
+
+        public:
+
+            static constexpr unsigned int maxTerms = 4; //!< The maximum number of structured terms
+
+            //! The types of structured terms
+            enum class termType{ identity, kronecker, transposedKronecker, rankOne };
+
+            StructuredJacobian( );
+
+            static StructuredJacobian identity( const floatType scale = 1 );
+
+            static StructuredJacobian kronecker( const floatSecondOrderTensor &A, const floatSecondOrderTensor &B, const floatType scale = 1 );
+
+            static StructuredJacobian transposedKronecker( const floatSecondOrderTensor &A, const floatSecondOrderTensor &B, const floatType scale = 1 );
+
+            static StructuredJacobian rankOne( const floatSecondOrderTensor &A, const floatSecondOrderTensor &B, const floatType scale = 1 );
+
+            static StructuredJacobian dense( const floatFourthOrderTensor &J );
+
+            StructuredJacobian &operator+=( const StructuredJacobian &other );
+
+            StructuredJacobian &operator*=( const floatType scale );
+
+            void apply( const floatSecondOrderTensor &X, floatSecondOrderTensor &Y ) const;
+
+            void applyTranspose( const floatSecondOrderTensor &X, floatSecondOrderTensor &Y ) const;
+
+            StructuredJacobian compose( const StructuredJacobian &other ) const;
+
+            void toDense( floatFourthOrderTensor &J ) const;
+
+            floatVector toVector( ) const;
+
+            unsigned int numTerms( ) const;
+
+            bool hasDense( ) const;
+
+        private:
+
+            struct Term{
+                termType type; //!< The type of the term
+                floatType scale; //!< The scale factor of the term
+                floatSecondOrderTensor A; //!< The first tensor of the term
+                floatSecondOrderTensor B; //!< The second tensor of the term
+            };
+
+            void addTerm( const Term &term );
+
+            void applyStructured( const floatSecondOrderTensor &X, floatSecondOrderTensor &Y ) const;
+
+            static void applyTerm( const Term &term, const floatSecondOrderTensor &X, floatSecondOrderTensor &Y );
+
+            static void applyTermTranspose( const Term &term, const floatSecondOrderTensor &X, floatSecondOrderTensor &Y );
+
+            static Term composeTerms( const Term &a, const Term &b );
+
+            static void addTermToDense( const Term &term, floatFourthOrderTensor &J );
+
+            std::array< Term, maxTerms > _terms; //!< The structured terms
+
+            unsigned int _nTerms; //!< The number of structured terms in use
+
+            bool _hasDense; //!< Flag for whether the dense part is in use
+
+            floatFourthOrderTensor _dense; //!< The dense part of the Jacobian
+
+    };
+
+    class KinematicState{
+        /*!
+         * A cache of the quantities derived from a 3D deformation gradient \f$F_{iI}\f$ which are shared between
+         * the push-forward and pull-back operations. The determinant \f$J\f$, the inverse \f$F_{Ii}^{-1}\f$,
+         * the cofactor \f$J F_{Ii}^{-1}\f$, the right Cauchy-Green deformation tensor \f$C_{IJ}\f$ and its inverse
+         * are computed the first time they are requested and are re-used afterwards so that a material point
+         * which performs several mappings with the same deformation gradient only inverts it once.
+         */
+
+        public:
+
+            explicit KinematicState( const floatVector &deformationGradient );
+
+            explicit KinematicState( const floatSecondOrderTensor &deformationGradient );
+
+            const floatSecondOrderTensor &deformationGradient( ) const;
+
+            floatType determinant( ) const;
+
+            const floatSecondOrderTensor &inverse( ) const;
+
+            const floatSecondOrderTensor &cofactor( ) const;
+
+            const floatSecondOrderTensor &rightCauchyGreen( ) const;
+
+            const floatSecondOrderTensor &inverseRightCauchyGreen( ) const;
+
+        private:
+
+            void computeInverse( ) const;
+
+            floatSecondOrderTensor _F; //!< The deformation gradient
+
+            mutable floatType _J; //!< The determinant of the deformation gradient
+
+            mutable floatSecondOrderTensor _invF; //!< The inverse of the deformation gradient
+
+            mutable floatSecondOrderTensor _cofactor; //!< The cofactor of the deformation gradient
+
+            mutable floatSecondOrderTensor _C; //!< The right Cauchy-Green deformation tensor
+
+            mutable floatSecondOrderTensor _invC; //!< The inverse of the right Cauchy-Green deformation tensor
+
+            mutable bool _hasInverse; //!< Flag for whether the determinant, inverse, and cofactor are set
+
+            mutable bool _hasRightCauchyGreen; //!< Flag for whether the right Cauchy-Green deformation tensor is set
+
+            mutable bool _hasInverseRightCauchyGreen; //!< Flag for whether the inverse right Cauchy-Green deformation tensor is set
+
+    };
 
     floatType deltaDirac(const unsigned int i, const unsigned int j);
 
+    template< typename T >
+    T invertSecondOrderTensor( const secondOrderTensor< T > &A, secondOrderTensor< T > &invA );
+
+    template< typename T >
+    T invertSecondOrderTensor( const secondOrderTensor< T > &A, secondOrderTensor< T > &invA, statusCode &status,
+                               const T tolerance = 1000 * std::numeric_limits< T >::epsilon( ) );
+
+    template< typename T >
+    void invertSecondOrderTensorBatched( const unsigned int nPoints, const T *A, T *invA, T *detA, statusCode &status,
+                                         const T tolerance = 1000 * std::numeric_limits< T >::epsilon( ) );
+
     errorOut rotateMatrix(const floatVector &A, const floatVector &Q, floatVector &rotatedA);
 
+    void rotateMatrix( const floatVector &A, const floatVector &Q, floatVector &rotatedA, statusCode &status );
+
+    errorOut rotateMatrix( const floatVector &A, const floatVector &Q, floatVector &rotatedA, floatVector &dRotatedAdQ );
+
+    errorOut rotateFourthOrderTensor( const floatVector &C, const floatVector &Q, floatVector &rotatedC );
+
+    errorOut rotateFourthOrderTensor( const floatVector &C, const floatVector &Q, floatVector &rotatedC, floatVector &dRotatedCdQ );
+
+    template< typename T >
+    void rotateSecondOrderTensor( const secondOrderTensor< T > &A, const secondOrderTensor< T > &Q, secondOrderTensor< T > &rotatedA );
+
+    template< typename T >
+    void rotateSecondOrderTensor( const secondOrderTensor< T > &A, const secondOrderTensor< T > &Q, secondOrderTensor< T > &rotatedA,
+                                  fourthOrderTensor< T > &dRotatedAdQ );
+
+    template< typename T >
+    void rotateFourthOrderTensor( const fourthOrderTensor< T > &C, const secondOrderTensor< T > &Q, fourthOrderTensor< T > &rotatedC );
+
+    template< typename T >
+    void rotateFourthOrderTensor( const fourthOrderTensor< T > &C, const secondOrderTensor< T > &Q, fourthOrderTensor< T > &rotatedC,
+                                  sixthOrderTensor< T > &dRotatedCdQ );
+
+    template< typename T >
+    void rotateSecondOrderTensorBatched( const unsigned int nPoints, const T *A, const T *Q, T *rotatedA );
+
+    template< typename T >
+    void rotateFourthOrderTensorBatched( const unsigned int nPoints, const T *C, const T *Q, T *rotatedC );
+
+    template< typename T >
+    void quaternionToRotationMatrix( const quaternion< T > &q, secondOrderTensor< T > &Q );
+
+    template< typename T >
+    void quaternionToRotationMatrix( const quaternion< T > &q, secondOrderTensor< T > &Q, std::array< T, 36 > &dQdq );
+
+    template< typename T >
+    void rotationVectorToQuaternion( const firstOrderTensor< T > &rotationVector, quaternion< T > &q );
+
+    template< typename T >
+    void rotationVectorToQuaternion( const firstOrderTensor< T > &rotationVector, quaternion< T > &q, std::array< T, 12 > &dqdRotationVector );
+
+    template< typename T >
+    void rotationVectorToRotationMatrix( const firstOrderTensor< T > &rotationVector, secondOrderTensor< T > &Q );
+
+    template< typename T >
+    void rotationVectorToRotationMatrix( const firstOrderTensor< T > &rotationVector, secondOrderTensor< T > &Q, thirdOrderTensor< T > &dQdRotationVector );
+
+    template< typename T >
+    void composeQuaternions( const quaternion< T > &q1, const quaternion< T > &q2, quaternion< T > &q );
+
+    template< typename T >
+    void composeQuaternions( const quaternion< T > &q1, const quaternion< T > &q2, quaternion< T > &q,
+                             std::array< T, 16 > &dqdq1, std::array< T, 16 > &dqdq2 );
+
+    template< typename T >
+    void rotateSecondOrderTensor( const secondOrderTensor< T > &A, const quaternion< T > &q, secondOrderTensor< T > &rotatedA );
+
+    template< typename T >
+    void rotateSecondOrderTensor( const secondOrderTensor< T > &A, const quaternion< T > &q, secondOrderTensor< T > &rotatedA,
+                                  std::array< T, 36 > &dRotatedAdq );
+
+    template< typename T >
+    void rotateSecondOrderTensor( const secondOrderTensor< T > &A, const firstOrderTensor< T > &rotationVector, secondOrderTensor< T > &rotatedA );
+
+    template< typename T >
+    void rotateSecondOrderTensor( const secondOrderTensor< T > &A, const firstOrderTensor< T > &rotationVector, secondOrderTensor< T > &rotatedA,
+                                  thirdOrderTensor< T > &dRotatedAdRotationVector );
+
+    template< typename T >
+    void rotateFourthOrderTensor( const fourthOrderTensor< T > &C, const quaternion< T > &q, fourthOrderTensor< T > &rotatedC );
+
+    template< typename T >
+    void rotateFourthOrderTensor( const fourthOrderTensor< T > &C, const firstOrderTensor< T > &rotationVector, fourthOrderTensor< T > &rotatedC );
+
+    template< typename T >
+    void rotateSecondOrderTensorByQuaternionBatched( const unsigned int nPoints, const T *A, const T *q, T *rotatedA );
+
+    template< typename T >
+    void rotateFourthOrderTensorByQuaternionBatched( const unsigned int nPoints, const T *C, const T *q, T *rotatedC );
+
     void computeDeformationGradient( const floatVector &displacementGradient, floatVector &F, const bool isCurrent );
 
     void computeDeformationGradient( const floatVector &displacementGradient, floatVector &F, floatVector &dFdGradU, const bool isCurrent );
 
+    template< typename T >
+    void computeDeformationGradient( const secondOrderTensor< T > &displacementGradient, secondOrderTensor< T > &F, const bool isCurrent );
+
+    template< typename T >
+    void computeDeformationGradient( const secondOrderTensor< T > &displacementGradient, secondOrderTensor< T > &F, fourthOrderTensor< T > &dFdGradU, const bool isCurrent );
+
+    template< typename T >
+    void computeRightCauchyGreen( const secondOrderTensor< T > &deformationGradient, secondOrderTensor< T > &C );
+
+    template< typename T >
+    void computeRightCauchyGreen( const secondOrderTensor< T > &deformationGradient, secondOrderTensor< T > &C, fourthOrderTensor< T > &dCdF );
+
+    template< typename T >
+    void computeGreenLagrangeStrain( const secondOrderTensor< T > &deformationGradient, secondOrderTensor< T > &E );
+
+    template< typename T >
+    void computeGreenLagrangeStrain( const secondOrderTensor< T > &deformationGradient, secondOrderTensor< T > &E, fourthOrderTensor< T > &dEdF );
+
+    template< typename T >
+    void computeDGreenLagrangeStrainDF( const secondOrderTensor< T > &deformationGradient, fourthOrderTensor< T > &dEdF );
+
+    template< class K, typename T >
+    void computeDeformationGradient( const kinematicTensor< K, T > &displacementGradient, kinematicTensor< K, T > &F, const bool isCurrent );
+
+    template< class K, typename T >
+    void computeDeformationGradient( const kinematicTensor< K, T > &displacementGradient, kinematicTensor< K, T > &F,
+                                     kinematicJacobian< K, T > &dFdGradU, const bool isCurrent );
+
+    template< class K, typename T >
+    T invertDeformationGradient( const kinematicTensor< K, T > &deformationGradient, kinematicTensor< K, T > &inverseDeformationGradient );
+
+    template< class K, typename T >
+    void computeRightCauchyGreen( const kinematicTensor< K, T > &deformationGradient, kinematicTensor< K, T > &C );
+
+    template< class K, typename T >
+    void computeRightCauchyGreen( const kinematicTensor< K, T > &deformationGradient, kinematicTensor< K, T > &C, kinematicJacobian< K, T > &dCdF );
+
+    template< class K, typename T >
+    void computeGreenLagrangeStrain( const kinematicTensor< K, T > &deformationGradient, kinematicTensor< K, T > &E );
+
+    template< class K, typename T >
+    void computeGreenLagrangeStrain( const kinematicTensor< K, T > &deformationGradient, kinematicTensor< K, T > &E, kinematicJacobian< K, T > &dEdF );
+
+    template< class K, typename T >
+    void expandToThreeDimensions( const kinematicTensor< K, T > &A, secondOrderTensor< T > &A3D, const T undeformedDiagonal );
+
+    void computeDeformationGradient( const floatSecondOrderTensor &displacementGradient, floatSecondOrderTensor &F, StructuredJacobian &dFdGradU, const bool isCurrent );
+
+    void computeRightCauchyGreen( const floatSecondOrderTensor &deformationGradient, floatSecondOrderTensor &C, StructuredJacobian &dCdF );
+
+    void computeGreenLagrangeStrain( const floatSecondOrderTensor &deformationGradient, floatSecondOrderTensor &E, StructuredJacobian &dEdF );
+
     errorOut computeRightCauchyGreen( const floatVector &deformationGradient, floatVector &C );
 
     errorOut computeRightCauchyGreen( const floatVector &deformationGradient, floatVector &C, floatVector &dCdF );
 
     errorOut computeRightCauchyGreen( const floatVector &deformationGradient, floatVector &C, floatMatrix &dCdF );
 
+    void computeRightCauchyGreen( const floatVector &deformationGradient, floatVector &C, statusCode &status );
+
+    void computeRightCauchyGreen( const floatVector &deformationGradient, floatVector &C, floatVector &dCdF, statusCode &status );
+
     errorOut computeGreenLagrangeStrain(const floatVector &deformationGradient, floatVector &E);
 
     errorOut computeGreenLagrangeStrain(const floatVector &deformationGradient, floatVector &E, floatVector &dEdF);
 
     errorOut computeGreenLagrangeStrain(const floatVector &deformationGradient, floatVector &E, floatMatrix &dEdF);
 
+    void computeGreenLagrangeStrain( const floatVector &deformationGradient, floatVector &E, statusCode &status );
+
+    void computeGreenLagrangeStrain( const floatVector &deformationGradient, floatVector &E, floatVector &dEdF, statusCode &status );
+
     errorOut computeDGreenLagrangeStrainDF(const floatVector &deformationGradient, floatVector &dEdF);
 
     errorOut computeDGreenLagrangeStrainDF(const floatVector &deformationGradient, floatMatrix &dEdF);
 
+    void computeDGreenLagrangeStrainDF( const floatVector &deformationGradient, floatVector &dEdF, statusCode &status );
+
+    template< typename T >
+    void computeDeformationGradientBatched( const unsigned int nPoints, const T *displacementGradient, T *F, const bool isCurrent );
+
+    template< typename T >
+    void computeDeformationGradientBatched( const unsigned int nPoints, const T *displacementGradient, T *F, T *dFdGradU, const bool isCurrent );
+
+    template< typename T >
+    void computeRightCauchyGreenBatched( const unsigned int nPoints, const T *deformationGradient, T *C );
+
+    template< typename T >
+    void computeRightCauchyGreenBatched( const unsigned int nPoints, const T *deformationGradient, T *C, T *dCdF );
+
+    template< typename T >
+    void computeGreenLagrangeStrainBatched( const unsigned int nPoints, const T *deformationGradient, T *E );
+
+    template< typename T >
+    void computeGreenLagrangeStrainBatched( const unsigned int nPoints, const T *deformationGradient, T *E, T *dEdF );
+
+    template< typename T >
+    void computeKinematicsBatched( const unsigned int nPoints, const T *displacementGradient,
+                                   T *F, T *C, T *E, const bool isCurrent );
+
+    template< typename T >
+    void computeKinematicsBatched( const unsigned int nPoints, const T *displacementGradient,
+                                   T *F, T *C, T *E,
+                                   T *dFdGradU, T *dCdF, T *dEdF, const bool isCurrent );
+
+    template< typename T >
+    void computeCurrentSurfaceBatched( const unsigned int nFacets, const T *referenceNormal, const T *deformationGradient,
+                                       T *currentNormal, T *areaRatio );
+
+    template< typename T >
+    void computeCurrentSurfaceBatched( const unsigned int nFacets, const T *referenceNormal, const T *deformationGradient,
+                                       T *currentNormal, T *areaRatio, T *dCurrentNormaldF, T *dAreaRatiodF );
+
+    template< typename T >
+    void computeCurrentSurfaceBatched( const unsigned int nFacets, const T *referenceNormal, const secondOrderTensor< T > &deformationGradient,
+                                       T *currentNormal, T *areaRatio );
+
+    template< typename T >
+    void computeCurrentSurfaceBatched( const unsigned int nFacets, const T *referenceNormal, const secondOrderTensor< T > &deformationGradient,
+                                       T *currentNormal, T *areaRatio, T *dCurrentNormaldF, T *dAreaRatiodF );
+
     errorOut decomposeGreenLagrangeStrain(const floatVector &E, floatVector &Ebar, floatType &J);
 
     errorOut decomposeGreenLagrangeStrain(const floatVector &E, floatVector &Ebar, floatType &J,
@@ -70,6 +639,22 @@ namespace tardigradeConstitutiveTools{
     errorOut decomposeGreenLagrangeStrain(const floatVector &E, floatVector &Ebar, floatType &J,
                                           floatMatrix &dEbardE, floatVector &dJdE);
 
+    template< typename T >
+    void computeIsochoricKinematics( const secondOrderTensor< T > &displacementGradient, secondOrderTensor< T > &F,
+                                     secondOrderTensor< T > &E, secondOrderTensor< T > &Ebar, T &J, const bool isCurrent );
+
+    template< typename T >
+    void computeIsochoricKinematics( const secondOrderTensor< T > &displacementGradient, secondOrderTensor< T > &F,
+                                     secondOrderTensor< T > &E, secondOrderTensor< T > &Ebar, T &J,
+                                     fourthOrderTensor< T > &dEbardGradU, secondOrderTensor< T > &dJdGradU, const bool isCurrent );
+
+    errorOut computeIsochoricKinematics( const floatVector &displacementGradient, floatVector &F, floatVector &E,
+                                         floatVector &Ebar, floatType &J, const bool isCurrent );
+
+    errorOut computeIsochoricKinematics( const floatVector &displacementGradient, floatVector &F, floatVector &E,
+                                         floatVector &Ebar, floatType &J, floatVector &dEbardGradU, floatVector &dJdGradU,
+                                         const bool isCurrent );
+
     errorOut mapPK2toCauchy(const floatVector &PK2Stress, const floatVector &deformationGradient, floatVector &cauchyStress);
 
     errorOut WLF(const floatType &temperature, const floatVector &WLFParameters, floatType &factor);
@@ -118,6 +703,28 @@ namespace tardigradeConstitutiveTools{
                                floatVector &dA, floatVector &A, floatMatrix &DADADt, floatMatrix &DADADtp,
                                const floatType alpha=0.5);
 
+    errorOut midpointEvolutionDiagonalJ( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                         floatVector &dA, floatVector &A, floatVector &DADADt, const floatVector &alpha );
+
+    errorOut midpointEvolutionDiagonalJ( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                         floatVector &dA, floatVector &A, floatVector &DADADt, floatVector &DADADtp,
+                                         const floatVector &alpha );
+
+    errorOut midpointEvolutionDiagonalJ( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                         floatVector &dA, floatVector &A, floatVector &DADADt, const floatType alpha );
+
+    errorOut midpointEvolutionDiagonalJ( const floatType &Dt, const floatVector &Ap, const floatVector &DApDt, const floatVector &DADt,
+                                         floatVector &dA, floatVector &A, floatVector &DADADt, floatVector &DADADtp,
+                                         const floatType alpha );
+
+    template< typename T >
+    void midpointEvolutionBatched( const unsigned int nValues, const T Dt, const T *DApDt, const T *DADt,
+                                   T *A, T *dA, const T alpha, statusCode &status );
+
+    template< typename T >
+    void midpointEvolutionBatched( const unsigned int nPoints, const unsigned int nStates, const T Dt, const T *DApDt, const T *DADt,
+                                   T *A, T *dA, const T *alpha, statusCode &status );
+
     errorOut evolveF(const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
                      floatVector &dF, floatVector &deformationGradient, const floatType alpha=0.5, const unsigned int mode = 1);
 
@@ -148,6 +755,62 @@ namespace tardigradeConstitutiveTools{
     errorOut evolveF(const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
                      floatVector &dF, floatVector &deformationGradient, floatMatrix &dFdL, floatMatrix &ddFdFp, floatMatrix &dFdFp, floatMatrix &dFdLp, const floatType alpha=0.5, const unsigned int mode = 1);
 
+    template< class C, typename T >
+    void evolveF( const T &Dt, const secondOrderTensor< T > &previousDeformationGradient, const secondOrderTensor< T > &Lp,
+                  const secondOrderTensor< T > &L, secondOrderTensor< T > &dF, secondOrderTensor< T > &deformationGradient,
+                  const T alpha = 0.5 );
+
+    template< class C, typename T >
+    void evolveF( const T &Dt, const secondOrderTensor< T > &previousDeformationGradient, const secondOrderTensor< T > &Lp,
+                  const secondOrderTensor< T > &L, secondOrderTensor< T > &dF, secondOrderTensor< T > &deformationGradient,
+                  fourthOrderTensor< T > &dFdL, const T alpha = 0.5 );
+
+    template< class C, typename T >
+    void evolveF( const T &Dt, const secondOrderTensor< T > &previousDeformationGradient, const secondOrderTensor< T > &Lp,
+                  const secondOrderTensor< T > &L, secondOrderTensor< T > &dF, secondOrderTensor< T > &deformationGradient,
+                  fourthOrderTensor< T > &dFdL, fourthOrderTensor< T > &ddFdFp, fourthOrderTensor< T > &dFdFp,
+                  fourthOrderTensor< T > &dFdLp, const T alpha = 0.5 );
+
+    template< class C, typename T >
+    void evolveFAdaptive( const T &Dt, const secondOrderTensor< T > &previousDeformationGradient, const secondOrderTensor< T > &Lp,
+                          const secondOrderTensor< T > &L, secondOrderTensor< T > &deformationGradient, unsigned int &nSubsteps,
+                          statusCode &status, const T alpha = 0.5, const T tolerance = 1e-6, const unsigned int maxSubsteps = 64 );
+
+    template< class C, typename T >
+    void evolveFAdaptive( const T &Dt, const secondOrderTensor< T > &previousDeformationGradient, const secondOrderTensor< T > &Lp,
+                          const secondOrderTensor< T > &L, secondOrderTensor< T > &deformationGradient, fourthOrderTensor< T > &dFdL,
+                          fourthOrderTensor< T > &dFdFp, fourthOrderTensor< T > &dFdLp, unsigned int &nSubsteps,
+                          statusCode &status, const T alpha = 0.5, const T tolerance = 1e-6, const unsigned int maxSubsteps = 64 );
+
+    errorOut evolveFAdaptive( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                              floatVector &deformationGradient, unsigned int &nSubsteps, const floatType alpha = 0.5, const unsigned int mode = 1,
+                              const floatType tolerance = 1e-6, const unsigned int maxSubsteps = 64 );
+
+    errorOut evolveFAdaptiveFlatJ( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                                   floatVector &deformationGradient, floatVector &dFdL, floatVector &dFdFp, floatVector &dFdLp,
+                                   unsigned int &nSubsteps, const floatType alpha = 0.5, const unsigned int mode = 1,
+                                   const floatType tolerance = 1e-6, const unsigned int maxSubsteps = 64 );
+
+    errorOut evolveFJvp( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                         const floatVector &deltaL, floatVector &deformationGradient, floatVector &deltaF,
+                         const floatType alpha=0.5, const unsigned int mode = 1 );
+
+    errorOut evolveFJvp( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                         const floatVector &deltaL, const floatVector &deltaFp, const floatVector &deltaLp,
+                         floatVector &deformationGradient, floatVector &deltaF, const floatType alpha=0.5, const unsigned int mode = 1 );
+
+    errorOut evolveFVjp( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                         const floatVector &v, floatVector &deformationGradient, floatVector &vdFdL,
+                         const floatType alpha=0.5, const unsigned int mode = 1 );
+
+    errorOut evolveFVjp( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                         const floatVector &v, floatVector &deformationGradient, floatVector &vdFdL, floatVector &vdFdFp, floatVector &vdFdLp,
+                         const floatType alpha=0.5, const unsigned int mode = 1 );
+
+    void computeMatrixExponential( const floatSecondOrderTensor &A, floatSecondOrderTensor &expA );
+
+    void computeMatrixExponential( const floatSecondOrderTensor &A, floatSecondOrderTensor &expA, floatFourthOrderTensor &dExpAdA );
+
     void evolveFExponentialMap( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
                                 floatVector &deformationGradient, const floatType alpha=0.5 );
 
@@ -157,6 +820,24 @@ namespace tardigradeConstitutiveTools{
     void evolveFExponentialMap( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
                                 floatVector &deformationGradient, floatVector &dFdL, floatVector &dFdFp, floatVector &dFdLp, const floatType alpha=0.5 );
 
+    void evolveFMagnus( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                        floatVector &deformationGradient, const unsigned int order=4 );
+
+    void evolveFMagnus( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                        floatVector &deformationGradient, floatVector &dFdL, const unsigned int order=4 );
+
+    void evolveFMagnus( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                        floatVector &deformationGradient, floatVector &dFdL, floatVector &dFdFp, floatVector &dFdLp, const unsigned int order=4 );
+
+    void evolveFRungeKutta4( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                             floatVector &deformationGradient );
+
+    void evolveFRungeKutta4( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                             floatVector &deformationGradient, floatVector &dFdL );
+
+    void evolveFRungeKutta4( const floatType &Dt, const floatVector &previousDeformationGradient, const floatVector &Lp, const floatVector &L,
+                             floatVector &deformationGradient, floatVector &dFdL, floatVector &dFdFp, floatVector &dFdLp );
+
     floatType mac(const floatType &x);
 
     floatType mac(const floatType &x, floatType &dmacdx);
@@ -176,6 +857,13 @@ namespace tardigradeConstitutiveTools{
                                       floatVector &pulledBackVelocityGradient, floatMatrix &dPullBackLdL,
                                       floatMatrix &dPullBackLdF);
 
+    errorOut pullBackVelocityGradient( const floatVector &velocityGradient, const KinematicState &kinematics,
+                                       floatVector &pulledBackVelocityGradient );
+
+    errorOut pullBackVelocityGradient( const floatVector &velocityGradient, const KinematicState &kinematics,
+                                       floatVector &pulledBackVelocityGradient, floatVector &dPullBackLdL,
+                                       floatVector &dPullBackLdF );
+
     errorOut quadraticThermalExpansion(const floatType &temperature, const floatType &referenceTemperature,
                                        const floatVector &linearParameters, const floatVector &quadraticParameters,
                                        floatVector &thermalExpansion);
@@ -193,6 +881,12 @@ namespace tardigradeConstitutiveTools{
     errorOut pushForwardGreenLagrangeStrain(const floatVector &greenLagrangeStrain, const floatVector &deformationGradient,
                                             floatVector &almansiStrain, floatMatrix &dAlmansiStraindE, floatMatrix &dAlmansiStraindF);
 
+    errorOut pushForwardGreenLagrangeStrain( const floatVector &greenLagrangeStrain, const KinematicState &kinematics,
+                                             floatVector &almansiStrain );
+
+    errorOut pushForwardGreenLagrangeStrain( const floatVector &greenLagrangeStrain, const KinematicState &kinematics,
+                                             floatVector &almansiStrain, floatVector &dAlmansiStraindE, floatVector &dAlmansiStraindF );
+
     errorOut pullBackAlmansiStrain( const floatVector &almansiStrain, const floatVector &deformationGradient,
                                     floatVector &greenLagrangeStrain );
 
@@ -202,6 +896,12 @@ namespace tardigradeConstitutiveTools{
     errorOut pullBackAlmansiStrain( const floatVector &almansiStrain, const floatVector &deformationGradient,
                                     floatVector &greenLagrangeStrain, floatMatrix &dEde, floatMatrix &dEdF );
 
+    errorOut pullBackAlmansiStrain( const floatVector &almansiStrain, const KinematicState &kinematics,
+                                    floatVector &greenLagrangeStrain );
+
+    errorOut pullBackAlmansiStrain( const floatVector &almansiStrain, const KinematicState &kinematics,
+                                    floatVector &greenLagrangeStrain, floatVector &dEde, floatVector &dEdF );
+
     errorOut computeSymmetricPart( const floatVector &A, floatVector &symmA, unsigned int &dim );
 
     errorOut computeSymmetricPart( const floatVector &A, floatVector &symmA );
@@ -218,6 +918,11 @@ namespace tardigradeConstitutiveTools{
     errorOut pushForwardPK2Stress( const floatVector &PK2, const floatVector &F, floatVector &cauchyStress,
                                    floatMatrix &dCauchyStressdPK2, floatMatrix &dCauchyStressdF );
 
+    errorOut pushForwardPK2Stress( const floatVector &PK2, const KinematicState &kinematics, floatVector &cauchyStress );
+
+    errorOut pushForwardPK2Stress( const floatVector &PK2, const KinematicState &kinematics, floatVector &cauchyStress,
+                                   floatVector &dCauchyStressdPK2, floatVector &dCauchyStressdF );
+
     errorOut pullBackCauchyStress( const floatVector &cauchyStress, const floatVector &F, floatVector &PK2 );
 
     errorOut pullBackCauchyStress( const floatVector &cauchyStress, const floatVector &F, floatVector &PK2,
@@ -226,18 +931,114 @@ namespace tardigradeConstitutiveTools{
     errorOut pullBackCauchyStress( const floatVector &cauchyStress, const floatVector &F, floatVector &PK2,
                                    floatMatrix &dPK2dCauchyStress, floatMatrix &dPK2dF );
 
+    errorOut pullBackCauchyStress( const floatVector &cauchyStress, const KinematicState &kinematics, floatVector &PK2 );
+
+    errorOut pullBackCauchyStress( const floatVector &cauchyStress, const KinematicState &kinematics, floatVector &PK2,
+                                   floatVector &dPK2dCauchyStress, floatVector &dPK2dF );
+
     void computeDCurrentNormalVectorDF( const floatVector &normalVector, const floatVector &F, floatVector &dNormalVectordF );
 
     void computeDCurrentAreaWeightedNormalVectorDF( const floatVector &normalVector, const floatVector &F, floatVector &dAreaWeightedNormalVectordF );
 
     void computeDCurrentAreaDF( const floatVector &normalVector, const floatVector &F, floatVector &dCurrentAreadF );
 
+    void computeDCurrentNormalVectorDF( const floatVector &normalVector, const KinematicState &kinematics, floatVector &dNormalVectordF );
+
+    void computeDCurrentAreaWeightedNormalVectorDF( const floatVector &normalVector, const KinematicState &kinematics, floatVector &dAreaWeightedNormalVectordF );
+
+    void computeDCurrentAreaDF( const floatVector &normalVector, const KinematicState &kinematics, floatVector &dCurrentAreadF );
+
     void computeDCurrentNormalVectorDGradU( const floatVector &normalVector, const floatVector &gradU, floatVector &dNormalVectordGradU, const bool isCurrent = true );
 
     void computeDCurrentAreaWeightedNormalVectorDGradU( const floatVector &normalVector, const floatVector &gradU, floatVector &dAreaWeightedNormalVectordGradU, const bool isCurrent = true );
 
     void computeDCurrentAreaDGradU( const floatVector &normalVector, const floatVector &gradU, floatVector &dCurrentAreadGradU, const bool isCurrent = true );
 
+    template< typename T >
+    void computeDCurrentNormalVectorDGradU( const firstOrderTensor< T > &normalVector, const secondOrderTensor< T > &gradU,
+                                            thirdOrderTensor< T > &dNormalVectordGradU, const bool isCurrent );
+
+    template< typename T >
+    void computeDCurrentAreaWeightedNormalVectorDGradU( const firstOrderTensor< T > &normalVector, const secondOrderTensor< T > &gradU,
+                                                        thirdOrderTensor< T > &dAreaWeightedNormalVectordGradU, const bool isCurrent );
+
+    template< typename T >
+    void computeDCurrentAreaDGradU( const firstOrderTensor< T > &normalVector, const secondOrderTensor< T > &gradU,
+                                    secondOrderTensor< T > &dCurrentAreadGradU, const bool isCurrent );
+
+    /*!
+     * Mandel notation
+     *
+     * Symmetric second order tensors are stored as the six components
+     * \f$\left( A_{11}, A_{22}, A_{33}, \sqrt{2} A_{23}, \sqrt{2} A_{13}, \sqrt{2} A_{12} \right)\f$ so that
+     * \f$A_{ij} B_{ij} = a_I b_I\f$ and fourth order tensors with minor symmetries become 6x6 matrices which are
+     * contracted with ordinary matrix-vector products. Derivatives w.r.t. a general second order tensor such as the
+     * deformation gradient are stored as 6x9 matrices.
+     */
+
+    template< typename T >
+    void toMandel( const secondOrderTensor< T > &A, mandelVector< T > &mandelA );
+
+    template< typename T >
+    void fromMandel( const mandelVector< T > &mandelA, secondOrderTensor< T > &A );
+
+    template< typename T >
+    void toMandel( const fourthOrderTensor< T > &A, mandelMatrix< T > &mandelA );
+
+    template< typename T >
+    void fromMandel( const mandelMatrix< T > &mandelA, fourthOrderTensor< T > &A );
+
+    template< typename T >
+    void toMandel( const fourthOrderTensor< T > &A, mandelGradient< T > &mandelA );
+
+    template< typename T >
+    void fromMandel( const mandelGradient< T > &mandelA, fourthOrderTensor< T > &A );
+
+    errorOut toMandel( const floatVector &A, floatVector &mandelA );
+
+    errorOut fromMandel( const floatVector &mandelA, floatVector &A );
+
+    template< typename T >
+    void computeRightCauchyGreen( const secondOrderTensor< T > &deformationGradient, mandelVector< T > &C );
+
+    template< typename T >
+    void computeRightCauchyGreen( const secondOrderTensor< T > &deformationGradient, mandelVector< T > &C, mandelGradient< T > &dCdF );
+
+    template< typename T >
+    void computeGreenLagrangeStrain( const secondOrderTensor< T > &deformationGradient, mandelVector< T > &E );
+
+    template< typename T >
+    void computeGreenLagrangeStrain( const secondOrderTensor< T > &deformationGradient, mandelVector< T > &E, mandelGradient< T > &dEdF );
+
+    template< typename T >
+    errorOut decomposeGreenLagrangeStrain( const mandelVector< T > &E, mandelVector< T > &Ebar, T &J );
+
+    template< typename T >
+    errorOut decomposeGreenLagrangeStrain( const mandelVector< T > &E, mandelVector< T > &Ebar, T &J,
+                                           mandelMatrix< T > &dEbardE, mandelVector< T > &dJdE );
+
+    template< typename T >
+    void pushForwardGreenLagrangeStrain( const mandelVector< T > &greenLagrangeStrain, const secondOrderTensor< T > &deformationGradient,
+                                         mandelVector< T > &almansiStrain );
+
+    template< typename T >
+    void pushForwardGreenLagrangeStrain( const mandelVector< T > &greenLagrangeStrain, const secondOrderTensor< T > &deformationGradient,
+                                         mandelVector< T > &almansiStrain, mandelMatrix< T > &dAlmansiStraindE, mandelGradient< T > &dAlmansiStraindF );
+
+    template< typename T >
+    void pushForwardPK2Stress( const mandelVector< T > &PK2, const secondOrderTensor< T > &F, mandelVector< T > &cauchyStress );
+
+    template< typename T >
+    void pushForwardPK2Stress( const mandelVector< T > &PK2, const secondOrderTensor< T > &F, mandelVector< T > &cauchyStress,
+                               mandelMatrix< T > &dCauchyStressdPK2, mandelGradient< T > &dCauchyStressdF );
+
+    template< typename T >
+    void pullBackCauchyStress( const mandelVector< T > &cauchyStress, const secondOrderTensor< T > &F, mandelVector< T > &PK2 );
+
+    template< typename T >
+    void pullBackCauchyStress( const mandelVector< T > &cauchyStress, const secondOrderTensor< T > &F, mandelVector< T > &PK2,
+                               mandelMatrix< T > &dPK2dCauchyStress, mandelGradient< T > &dPK2dF );
+
 }
 
 #endif
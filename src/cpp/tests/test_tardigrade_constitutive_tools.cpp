@@ -20,6 +20,11 @@ typedef tardigradeConstitutiveTools::errorOut errorOut;
 typedef tardigradeConstitutiveTools::floatType floatType;
 typedef tardigradeConstitutiveTools::floatVector floatVector;
 typedef tardigradeConstitutiveTools::floatMatrix floatMatrix;
+typedef tardigradeConstitutiveTools::floatSecondOrderTensor floatSecondOrderTensor;
+typedef tardigradeConstitutiveTools::floatFourthOrderTensor floatFourthOrderTensor;
+typedef tardigradeConstitutiveTools::floatFirstOrderTensor floatFirstOrderTensor;
+typedef tardigradeConstitutiveTools::floatThirdOrderTensor floatThirdOrderTensor;
+typedef tardigradeConstitutiveTools::floatQuaternion floatQuaternion;
 
 struct cout_redirect{
     cout_redirect( std::streambuf * new_buffer )
@@ -99,1532 +104,4253 @@ BOOST_AUTO_TEST_CASE( testRotateMatrix, * boost::unit_test::tolerance( DEFAULT_T
 
 }
 
-BOOST_AUTO_TEST_CASE( testComputeDeformationGradient, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+BOOST_AUTO_TEST_CASE( testInvertSecondOrderTensor, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
     /*!
-     * Test the calculation of the deformation gradient from the displacement gradient
+     * Test the closed-form inverse and determinant of 3x3 matrices
      */
 
-    floatVector gradU = { -0.01078825, -0.0156822 ,  0.02290497,
-                          -0.00614278, -0.04403221, -0.01019557,
-                           0.02379954, -0.03175083, -0.03245482 };
+    floatSecondOrderTensor A = { 0.69646919, 0.28613933, 0.22685145,
+                                 0.55131477, 0.71946897, 0.42310646,
+                                 0.98076420, 0.68482974, 0.48093190 };
 
-    floatVector answer1 = { 0.98994207, -0.01554229,  0.02211531,
-                           -0.00604919,  0.95820757, -0.00959658,
-                            0.02300559, -0.02982579,  0.96937029 };
+    floatSecondOrderTensor invA, AinvA;
 
-    floatVector answer2 = { 0.98921175, -0.0156822 ,  0.02290497,
-                           -0.00614278,  0.95596779, -0.01019557,
-                            0.02379954, -0.03175083,  0.96754518 };
+    floatType det_answer = A[ 0 ] * ( A[ 4 ] * A[ 8 ] - A[ 5 ] * A[ 7 ] )
+                         - A[ 1 ] * ( A[ 3 ] * A[ 8 ] - A[ 5 ] * A[ 6 ] )
+                         + A[ 2 ] * ( A[ 3 ] * A[ 7 ] - A[ 4 ] * A[ 6 ] );
 
-    floatVector F;
+    floatType det = tardigradeConstitutiveTools::invertSecondOrderTensor( A, invA );
 
-    tardigradeConstitutiveTools::computeDeformationGradient( gradU, F, true );
+    BOOST_TEST( det == det_answer );
 
-    BOOST_TEST( F == answer1, CHECK_PER_ELEMENT );
+    AinvA.fill( 0 );
 
-    F.clear( );
-    tardigradeConstitutiveTools::computeDeformationGradient( gradU, F, false );
+    for ( unsigned int i = 0; i < 3; i++ ){
+        for ( unsigned int j = 0; j < 3; j++ ){
+            for ( unsigned int k = 0; k < 3; k++ ){
+                AinvA[ 3 * i + j ] += A[ 3 * i + k ] * invA[ 3 * k + j ];
+            }
+        }
+    }
 
-    BOOST_TEST( F == answer2, CHECK_PER_ELEMENT );
+    BOOST_TEST( AinvA == floatSecondOrderTensor( { 1, 0, 0, 0, 1, 0, 0, 0, 1 } ), CHECK_PER_ELEMENT );
 
-    floatVector dFdGradU_true, dFdGradU_false;
+    tardigradeConstitutiveTools::statusCode status;
 
-    F.clear( );
-    tardigradeConstitutiveTools::computeDeformationGradient( gradU, F, dFdGradU_true, true );
+    floatSecondOrderTensor invA2;
 
-    BOOST_TEST( F == answer1, CHECK_PER_ELEMENT );
+    det = tardigradeConstitutiveTools::invertSecondOrderTensor( A, invA2, status );
 
-    F.clear( );
-    tardigradeConstitutiveTools::computeDeformationGradient( gradU, F, dFdGradU_false, false );
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
 
-    BOOST_TEST( F == answer2, CHECK_PER_ELEMENT );
+    BOOST_TEST( det == det_answer );
 
-    const float eps = 1e-6;
+    BOOST_TEST( invA2 == invA, CHECK_PER_ELEMENT );
 
-    floatVector j1( 9 * 9, 0 ), j2( 9 * 9, 0 );
+    // The check is independent of the scale of the matrix
+    floatSecondOrderTensor smallA = { 1e-8, 0, 0, 0, 1e-8, 0, 0, 0, 1e-8 };
 
-    for ( unsigned int i = 0; i < 9; i++ ){
+    tardigradeConstitutiveTools::invertSecondOrderTensor( smallA, invA2, status );
 
-        floatVector delta( 9, 0 );
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
 
-        delta[ i ] = eps * std::fabs( gradU[ i ] ) + eps;
+    // Singular matrices are reported without throwing
+    floatSecondOrderTensor singularA = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
 
-        floatVector rp, rm;
+    tardigradeConstitutiveTools::invertSecondOrderTensor( singularA, invA2, status );
 
-        tardigradeConstitutiveTools::computeDeformationGradient( gradU + delta, rp, true );
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::nearlySingular );
 
-        tardigradeConstitutiveTools::computeDeformationGradient( gradU - delta, rm, true );
+    floatSecondOrderTensor zeroA = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-        for ( unsigned int j = 0; j < 9; j++ ){
+    tardigradeConstitutiveTools::invertSecondOrderTensor( zeroA, invA2, status );
 
-            j1[ 9 * j + i ] = ( rp[ j ] - rm[ j ] ) / ( 2 * delta[ i ] );
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::nearlySingular );
 
-        }
+    // Batches long enough to use every lane width along with the scalar tail
+    constexpr unsigned int nPoints = 19;
 
-        tardigradeConstitutiveTools::computeDeformationGradient( gradU + delta, rp, false );
+    floatVector ABatch( 9 * nPoints ), invABatch( 9 * nPoints ), detABatch( nPoints );
 
-        tardigradeConstitutiveTools::computeDeformationGradient( gradU - delta, rm, false );
+    for ( unsigned int p = 0; p < nPoints; p++ ){
 
-        for ( unsigned int j = 0; j < 9; j++ ){
+        for ( unsigned int i = 0; i < 9; i++ ){ ABatch[ i * nPoints + p ] = A[ i ] + 0.1 * std::sin( 1.3 * p + i ); }
 
-            j2[ 9 * j + i ] = ( rp[ j ] - rm[ j ] ) / ( 2 * delta[ i ] );
+    }
 
-        }
+    tardigradeConstitutiveTools::invertSecondOrderTensorBatched( nPoints, ABatch.data( ), invABatch.data( ), detABatch.data( ), status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
+
+    for ( unsigned int p = 0; p < nPoints; p++ ){
+
+        floatSecondOrderTensor Ap, invAp;
+
+        for ( unsigned int i = 0; i < 9; i++ ){ Ap[ i ] = ABatch[ i * nPoints + p ]; }
+
+        BOOST_TEST( detABatch[ p ] == tardigradeConstitutiveTools::invertSecondOrderTensor( Ap, invAp ) );
+
+        for ( unsigned int i = 0; i < 9; i++ ){ BOOST_TEST( invABatch[ i * nPoints + p ] == invAp[ i ] ); }
 
     }
 
-    BOOST_TEST( j1 == dFdGradU_true,  CHECK_PER_ELEMENT );
+    // A singular point is reported, the other points are still inverted, and the inverse may overwrite the input
+    for ( unsigned int i = 0; i < 9; i++ ){ ABatch[ i * nPoints + 5 ] = singularA[ i ]; }
 
-    BOOST_TEST( j2 == dFdGradU_false, CHECK_PER_ELEMENT );
+    floatVector inPlace = ABatch;
 
-}
+    tardigradeConstitutiveTools::invertSecondOrderTensorBatched( nPoints, inPlace.data( ), inPlace.data( ), ( floatType * )NULL, status );
 
-BOOST_AUTO_TEST_CASE( testComputeGreenLagrangeStrain, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
-    /*!
-     * Test the computation of the Green-Lagrange strain
-     */
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::nearlySingular );
 
-    floatVector F = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
-    floatVector E;
+    for ( unsigned int p = 0; p < nPoints; p++ ){
 
-    tardigradeConstitutiveTools::errorOut ret;
-    ret = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, E );
+        if ( p == 5 ){ continue; }
 
-    BOOST_CHECK( ! ret );
+        for ( unsigned int i = 0; i < 9; i++ ){ BOOST_TEST( inPlace[ i * nPoints + p ] == invABatch[ i * nPoints + p ] ); }
 
-    floatVector E_answer_1( 9, 0 );
+    }
 
-    BOOST_TEST( E == E_answer_1, CHECK_PER_ELEMENT );
+    // The scalar and batched checks agree on scaled identities in single precision
+    const float scales[ 5 ] = { 1e-8f, 1e-4f, 1.f, 1e4f, 1e7f };
 
-    F = { 0.69646919, 0.28613933, 0.22685145,
-          0.55131477, 0.71946897, 0.42310646,
-          0.98076420, 0.68482974, 0.4809319 };
+    for ( unsigned int s = 0; s < 5; s++ ){
 
-    ret = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, E );
+        tardigradeConstitutiveTools::secondOrderTensor< float > I = { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, scaledI, invScaledI;
 
-    BOOST_CHECK( ! ret );
+        for ( unsigned int i = 0; i < 9; i++ ){ scaledI[ i ] = scales[ s ] * I[ i ]; }
 
-    floatVector E_answer_2 = { 0.37545786,  0.63379879,  0.43147034,
-                               0.63379879,  0.03425154,  0.34933978,
-                               0.43147034,  0.34933978, -0.26911192 };
+        tardigradeConstitutiveTools::invertSecondOrderTensor( scaledI, invScaledI, status );
 
-    BOOST_TEST( E == E_answer_2, CHECK_PER_ELEMENT );
+        BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
 
-    floatVector EJ;
-    floatMatrix dEdF;
-    ret = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, EJ, dEdF );
+        std::vector< float > scaledIBatch( 9 * nPoints ), invScaledIBatch( 9 * nPoints );
 
-    BOOST_CHECK( ! ret );
+        for ( unsigned int p = 0; p < nPoints; p++ ){
 
-    BOOST_TEST( E == EJ, CHECK_PER_ELEMENT );
+            for ( unsigned int i = 0; i < 9; i++ ){ scaledIBatch[ i * nPoints + p ] = scaledI[ i ]; }
 
-    floatType eps = 1e-6;
-    for ( unsigned int i=0; i<F.size( ); i++ ){
-        floatVector delta( F.size( ), 0 );
+        }
 
-        delta[ i ] = eps * fabs( F[ i ] ) + eps;
+        tardigradeConstitutiveTools::invertSecondOrderTensorBatched( nPoints, scaledIBatch.data( ), invScaledIBatch.data( ), ( float * )NULL, status );
 
-        floatVector EJp, EJm;
+        BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
 
-        ret = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F + delta, EJp );
+        // Collapsing one direction is reported at every scale
+        scaledI[ 8 ] *= 1e-6f;
 
-        ret = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F - delta, EJm );
+        tardigradeConstitutiveTools::invertSecondOrderTensor( scaledI, invScaledI, status );
 
-        BOOST_CHECK( ! ret );
+        BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::nearlySingular );
 
-        floatVector gradCol = ( EJp - EJm )/(2*delta[ i ]);
+        for ( unsigned int p = 0; p < nPoints; p++ ){ scaledIBatch[ 8 * nPoints + p ] = scaledI[ 8 ]; }
+
+        tardigradeConstitutiveTools::invertSecondOrderTensorBatched( nPoints, scaledIBatch.data( ), invScaledIBatch.data( ), ( float * )NULL, status );
+
+        BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::nearlySingular );
 
-        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
-            BOOST_TEST( gradCol[ j ] == dEdF[ j ][ i ] );
-        }
     }
 
 }
 
-BOOST_AUTO_TEST_CASE( testDecomposeGreenLagrangeStrain, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+BOOST_AUTO_TEST_CASE( testRotateTensors, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
     /*!
-     * Test the decomposition of the Green-Lagrange strain into isochoric and
-     * volumetric parts.
+     * Test the rotation of second and fourth order tensors and the derivatives w.r.t. the rotation matrix
      */
 
-    floatVector F = { 0.69646919, 0.28613933, 0.22685145,
-                      0.55131477, 0.71946897, 0.42310646,
-                      0.98076420, 0.68482974, 0.4809319 };
+    floatVector Q = { -0.44956296, -0.88488713, -0.12193405,
+                      -0.37866166,  0.31242661, -0.87120891,
+                       0.80901699, -0.3454915 , -0.47552826 };
 
-    floatType J = tardigradeVectorTools::determinant( F, 3, 3 );
-    floatVector Fbar = F/pow( J, 1./3 );
+    floatVector A = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
 
-    floatVector E, Ebar;
-    errorOut ret = tardigradeConstitutiveTools::computeGreenLagrangeStrain( Fbar, Ebar );
+    floatVector rotatedA_answer = { -0.09485264, -3.38815017, -5.39748037,
+                                    -1.09823916,  2.23262233,  4.68884658,
+                                    -1.68701666,  6.92240128, 12.8622303 };
 
-    BOOST_CHECK( ! ret );
+    // The output must not depend on its previous contents
+    floatVector rotatedA( 9, 100. ), dRotatedAdQ;
 
-    ret = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, E );
+    BOOST_CHECK( !tardigradeConstitutiveTools::rotateMatrix( A, Q, rotatedA, dRotatedAdQ ) );
 
-    BOOST_CHECK( ! ret );
+    BOOST_TEST( rotatedA == rotatedA_answer, CHECK_PER_ELEMENT );
 
-    floatType JOut;
-    floatVector EbarOut;
-    ret = tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( E, EbarOut, JOut );
+    floatType eps = 1e-6;
 
-    BOOST_CHECK( ! ret );
+    for ( unsigned int k = 0; k < 9; k++ ){
 
-    BOOST_TEST( J == JOut );
+        floatType delta = eps * std::fabs( Q[ k ] ) + eps;
 
-    BOOST_TEST( EbarOut == Ebar, CHECK_PER_ELEMENT );
+        floatVector Qp = Q, Qm = Q;
 
-    floatVector EbarOut2;
-    floatType JOut2;
-    floatMatrix dEbardE;
-    floatVector dJdE;
-    ret = tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( E, EbarOut2, JOut2, dEbardE, dJdE );
+        Qp[ k ] += delta;
 
-    BOOST_CHECK( ! ret );
+        Qm[ k ] -= delta;
 
-    BOOST_TEST( EbarOut == EbarOut2, CHECK_PER_ELEMENT );
+        floatVector Ap, Am;
 
-    BOOST_TEST( JOut == JOut2 );
+        BOOST_CHECK( !tardigradeConstitutiveTools::rotateMatrix( A, Qp, Ap ) );
 
-    floatType eps = 1e-8;
-    for ( unsigned int i=0; i<E.size( ); i++ ){
-        floatVector delta( E.size( ), 0 );
-        delta[ i ] =  fabs( eps*E[ i ] );
+        BOOST_CHECK( !tardigradeConstitutiveTools::rotateMatrix( A, Qm, Am ) );
 
-        floatType Jp, Jm;
-        ret = tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( E + delta, EbarOut2, Jp );
-        BOOST_CHECK( ! ret );
+        for ( unsigned int i = 0; i < 9; i++ ){
 
-        ret = tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( E - delta, EbarOut2, Jm );
-        BOOST_CHECK( ! ret );
+            BOOST_TEST( dRotatedAdQ[ 9 * i + k ] == ( Ap[ i ] - Am[ i ] ) / ( 2 * delta ) );
+
+        }
 
-        BOOST_TEST( ( Jp - Jm )/(2*delta[ i ]) == dJdE[ i ] );
     }
 
-    for ( unsigned int i=0; i<E.size( ); i++ ){
-        floatVector delta( E.size( ), 0 );
-        delta[ i ] = fabs( eps*E[ i ] );
+    floatSecondOrderTensor ATensor, QTensor, rotatedATensor;
 
-        floatVector Ebarp, Ebarm;
+    floatFourthOrderTensor dRotatedAdQTensor;
 
-        ret = tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( E + delta, Ebarp, JOut2 );
+    std::copy( A.begin( ), A.end( ), ATensor.begin( ) );
 
-        BOOST_CHECK( ! ret );
+    std::copy( Q.begin( ), Q.end( ), QTensor.begin( ) );
 
-        ret = tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( E - delta, Ebarm, JOut2 );
+    tardigradeConstitutiveTools::rotateSecondOrderTensor( ATensor, QTensor, rotatedATensor );
 
-        BOOST_CHECK( ! ret );
+    BOOST_TEST( floatVector( rotatedATensor.begin( ), rotatedATensor.end( ) ) == rotatedA_answer, CHECK_PER_ELEMENT );
 
-        floatVector gradCol = ( Ebarp - Ebarm )/(2*delta[ i ]);
+    tardigradeConstitutiveTools::rotateSecondOrderTensor( ATensor, QTensor, rotatedATensor, dRotatedAdQTensor );
 
-        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
-            BOOST_TEST( gradCol[ j ] == dEbardE[ j ][ i ] );
+    BOOST_TEST( floatVector( rotatedATensor.begin( ), rotatedATensor.end( ) ) == rotatedA_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( floatVector( dRotatedAdQTensor.begin( ), dRotatedAdQTensor.end( ) ) == dRotatedAdQ, CHECK_PER_ELEMENT );
+
+    // Fourth order tensors
+    floatVector C( 81 );
+
+    for ( unsigned int i = 0; i < 81; i++ ){ C[ i ] = std::sin( 0.3 * i + 0.2 ); }
+
+    floatVector rotatedC_answer( 81, 0 );
+
+    for ( unsigned int i = 0; i < 3; i++ ){
+        for ( unsigned int j = 0; j < 3; j++ ){
+            for ( unsigned int k = 0; k < 3; k++ ){
+                for ( unsigned int l = 0; l < 3; l++ ){
+                    for ( unsigned int I = 0; I < 3; I++ ){
+                        for ( unsigned int J = 0; J < 3; J++ ){
+                            for ( unsigned int K = 0; K < 3; K++ ){
+                                for ( unsigned int L = 0; L < 3; L++ ){
+                                    rotatedC_answer[ 27 * i + 9 * j + 3 * k + l ] += Q[ 3 * I + i ] * Q[ 3 * J + j ] * Q[ 3 * K + k ] * Q[ 3 * L + l ]
+                                                                                   * C[ 27 * I + 9 * J + 3 * K + L ];
+                                }
+                            }
+                        }
+                    }
+                }
+            }
         }
     }
 
-    floatVector badE = { -1, 0, 0, 0, 1, 0, 0, 0, 1 };
+    floatVector rotatedC( 81, 100. ), dRotatedCdQ;
 
-    BOOST_REQUIRE_THROW( tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( badE, EbarOut, JOut ), std::nested_exception );
+    BOOST_CHECK( !tardigradeConstitutiveTools::rotateFourthOrderTensor( C, Q, rotatedC ) );
 
-}
+    BOOST_TEST( rotatedC == rotatedC_answer, CHECK_PER_ELEMENT );
 
-BOOST_AUTO_TEST_CASE( testMapPK2toCauchy, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
-    /*!
-     * Test the mapping of the PK2 stress from the reference
-     * configuration to the current configuration.
-     */
+    BOOST_CHECK( !tardigradeConstitutiveTools::rotateFourthOrderTensor( C, Q, rotatedC, dRotatedCdQ ) );
 
-    floatVector F = { 1.96469186, -2.13860665, -2.73148546,
-                      0.51314769,  2.1946897,  -0.7689354,
-                      4.80764198,  1.84829739, -0.19068099 };
+    BOOST_TEST( rotatedC == rotatedC_answer, CHECK_PER_ELEMENT );
 
-    floatVector PK2 = { -1.07882482, -1.56821984,  2.29049707,
-                        -0.61427755, -4.40322103, -1.01955745,
-                         2.37995406, -3.1750827,  -3.24548244 };
+    for ( unsigned int k = 0; k < 9; k++ ){
 
-    floatVector cauchy;
+        floatType delta = eps * std::fabs( Q[ k ] ) + eps;
 
-    floatVector cauchy_answer = { -2.47696057,  0.48015011, -0.28838671,
-                                   0.16490963, -0.57481137, -0.92071407,
-                                  -0.21450698, -1.22714923, -1.73532173 };
+        floatVector Qp = Q, Qm = Q;
 
-    errorOut error = tardigradeConstitutiveTools::mapPK2toCauchy( PK2, F, cauchy );
+        Qp[ k ] += delta;
 
-    BOOST_CHECK( ! error );
+        Qm[ k ] -= delta;
 
-    BOOST_TEST( cauchy == cauchy_answer, CHECK_PER_ELEMENT );
+        floatVector Cp, Cm;
 
-}
+        BOOST_CHECK( !tardigradeConstitutiveTools::rotateFourthOrderTensor( C, Qp, Cp ) );
 
-BOOST_AUTO_TEST_CASE( testWLF, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
-    /*!
-     * Test the computation of the WLF function.
-     */
+        BOOST_CHECK( !tardigradeConstitutiveTools::rotateFourthOrderTensor( C, Qm, Cm ) );
 
-    floatType T = 145.;
-    floatType Tr = 27.5;
-    floatType C1 = 18.2;
-    floatType C2 = 282.7;
+        for ( unsigned int i = 0; i < 81; i++ ){
 
-    floatType factor, dfactordT;
+            BOOST_TEST( dRotatedCdQ[ 9 * i + k ] == ( Cp[ i ] - Cm[ i ] ) / ( 2 * delta ) );
 
-    floatVector WLFParameters { Tr, C1, C2 };
+        }
 
-    tardigradeConstitutiveTools::WLF( T, WLFParameters, factor );
+    }
 
-    BOOST_TEST( factor == pow( 10, -C1*( T - Tr )/( C2 + ( T - Tr ) ) ) );
+    // Batches of tensors with a different rotation at each point
+    constexpr unsigned int nPoints = 3;
 
-    floatType factor2;
-    tardigradeConstitutiveTools::WLF( T, WLFParameters, factor2, dfactordT );
+    floatVector ABatch( 9 * nPoints ), CBatch( 81 * nPoints ), QBatch( 9 * nPoints );
 
-    BOOST_TEST( factor == factor2 );
+    floatVector QT( 9 );
 
-    floatType delta = fabs( 1e-6*T );
-    floatType fp, fm;
-    tardigradeConstitutiveTools::WLF( T + delta, WLFParameters, fp );
-    tardigradeConstitutiveTools::WLF( T - delta, WLFParameters, fm );
+    for ( unsigned int i = 0; i < 3; i++ ){ for ( unsigned int j = 0; j < 3; j++ ){ QT[ 3 * j + i ] = Q[ 3 * i + j ]; } }
 
-    BOOST_TEST( dfactordT == ( fp - fm )/(2*delta) );
+    const floatVector Qs[ nPoints ] = { Q, QT, { 1, 0, 0, 0, 1, 0, 0, 0, 1 } };
 
-}
+    for ( unsigned int p = 0; p < nPoints; p++ ){
 
-BOOST_AUTO_TEST_CASE( testComputeDGreenLagrangeStrainDF, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
-    /*!
-     * Test the computation of the gradient of the Green-Lagrange
-     * strain w.r.t. the deformation gradient.
-     */
+        for ( unsigned int i = 0; i < 9; i++ ){ ABatch[ i * nPoints + p ] = A[ i ] + p; QBatch[ i * nPoints + p ] = Qs[ p ][ i ]; }
 
-    floatVector F = { 0.69646919, 0.28613933, 0.22685145,
-                      0.55131477, 0.71946897, 0.42310646,
-                      0.98076420, 0.68482974, 0.4809319 };
+        for ( unsigned int i = 0; i < 81; i++ ){ CBatch[ i * nPoints + p ] = C[ i ] - p; }
 
-    floatMatrix dEdF;
+    }
 
-    errorOut error = tardigradeConstitutiveTools::computeDGreenLagrangeStrainDF( F, dEdF );
+    floatVector rotatedABatch( 9 * nPoints ), rotatedCBatch( 81 * nPoints );
 
-    BOOST_CHECK( ! error );
+    tardigradeConstitutiveTools::rotateSecondOrderTensorBatched( nPoints, ABatch.data( ), QBatch.data( ), rotatedABatch.data( ) );
 
-    floatVector E, E2;
-    error = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, E );
+    tardigradeConstitutiveTools::rotateFourthOrderTensorBatched( nPoints, CBatch.data( ), QBatch.data( ), rotatedCBatch.data( ) );
 
-    BOOST_CHECK( ! error );
+    for ( unsigned int p = 0; p < nPoints; p++ ){
 
-    floatType eps = 1e-6;
-    for ( unsigned int i=0; i<F.size( ); i++ ){
-        floatVector delta( F.size( ), 0 );
+        floatVector A_p( 9 ), C_p( 81 ), rotatedA_p, rotatedC_p;
 
-        delta[ i ] = eps * fabs( F[ i ] ) + eps;
+        for ( unsigned int i = 0; i < 9; i++ ){ A_p[ i ] = ABatch[ i * nPoints + p ]; }
 
-        floatVector Ep, Em;
-        error = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F + delta, Ep );
+        for ( unsigned int i = 0; i < 81; i++ ){ C_p[ i ] = CBatch[ i * nPoints + p ]; }
 
-        BOOST_CHECK( !error );
+        BOOST_CHECK( !tardigradeConstitutiveTools::rotateMatrix( A_p, Qs[ p ], rotatedA_p ) );
 
-        error = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F - delta, Em );
+        BOOST_CHECK( !tardigradeConstitutiveTools::rotateFourthOrderTensor( C_p, Qs[ p ], rotatedC_p ) );
 
-        BOOST_CHECK( !error );
+        for ( unsigned int i = 0; i < 9; i++ ){ BOOST_TEST( rotatedABatch[ i * nPoints + p ] == rotatedA_p[ i ] ); }
 
-        floatVector gradCol = ( Ep - Em )/(2*delta[ i ]);
+        for ( unsigned int i = 0; i < 81; i++ ){ BOOST_TEST( rotatedCBatch[ i * nPoints + p ] == rotatedC_p[ i ] ); }
 
-        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
-            BOOST_TEST( gradCol[ j ] == dEdF[ j ][ i ] );
-        }
     }
+
+    BOOST_CHECK_THROW( tardigradeConstitutiveTools::rotateFourthOrderTensor( A, Q, rotatedC ), std::exception );
+
+    BOOST_CHECK_THROW( tardigradeConstitutiveTools::rotateFourthOrderTensor( C, C, rotatedC ), std::exception );
+
+    errorOut error = tardigradeConstitutiveTools::rotateMatrix( floatVector( 8, 0 ), floatVector( 8, 0 ), rotatedA );
+
+    BOOST_CHECK( error );
+
+    delete error;
+
 }
 
-BOOST_AUTO_TEST_CASE( testMidpointEvolution, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+BOOST_AUTO_TEST_CASE( testQuaternionRotations, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
     /*!
-     * Test the midpoint evolution algorithm.
+     * Test the rotation of tensors using quaternions and rotation vectors
      */
 
-    floatType Dt = 2.5;
+    floatType eps = 1e-6;
 
-    floatVector Ap    = { 9, 10, 11, 12 };
+    floatFirstOrderTensor v = { 0.3, -0.5, 0.7 };
 
-    floatVector DApDt = { 1, 2, 3, 4 };
+    floatType theta = std::sqrt( 0.3 * 0.3 + 0.5 * 0.5 + 0.7 * 0.7 );
 
-    floatVector DADt  = { 5, 6, 7, 8 };
+    floatQuaternion q_answer = { std::cos( 0.5 * theta ), std::sin( 0.5 * theta ) * 0.3 / theta,
+                                 -std::sin( 0.5 * theta ) * 0.5 / theta, std::sin( 0.5 * theta ) * 0.7 / theta };
 
-    floatVector alphaVec = { 0.1, 0.2, 0.3, 0.4 };
+    // Rodrigues' formula Q = I + sin( theta ) K + ( 1 - cos( theta ) ) K K with K the skew matrix of the axis
+    floatVector K = { 0, -0.7 / theta, -0.5 / theta,
+                      0.7 / theta, 0, -0.3 / theta,
+                      0.5 / theta, 0.3 / theta, 0 };
 
-    floatVector dA, A;
+    floatVector Q_answer( 9, 0 );
 
-    //Test implicit integration
-    errorOut error = tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, 0 );
+    for ( unsigned int i = 0; i < 3; i++ ){
 
-    BOOST_CHECK( ! error );
+        Q_answer[ 3 * i + i ] = 1;
 
-    BOOST_TEST( dA == Dt * DADt, CHECK_PER_ELEMENT );
+        for ( unsigned int j = 0; j < 3; j++ ){
 
-    //Test explicit integration
-    error = tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, 1 );
+            Q_answer[ 3 * i + j ] += std::sin( theta ) * K[ 3 * i + j ];
 
-    BOOST_CHECK( ! error );
+            for ( unsigned int k = 0; k < 3; k++ ){
 
-    BOOST_TEST( dA == Dt*DApDt, CHECK_PER_ELEMENT );
+                Q_answer[ 3 * i + j ] += ( 1 - std::cos( theta ) ) * K[ 3 * i + k ] * K[ 3 * k + j ];
 
-    //Test midpoint integration
-    error = tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt, dA, A );
+            }
 
-    BOOST_CHECK( ! error );
+        }
 
-    BOOST_TEST(  A == Ap + Dt*0.5*( DApDt + DADt ), CHECK_PER_ELEMENT );
+    }
 
-    BOOST_TEST( dA == Dt*0.5*( DApDt + DADt ), CHECK_PER_ELEMENT );
+    floatQuaternion q;
 
-    error = tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, alphaVec );
+    std::array< floatType, 12 > dqdv;
 
-    BOOST_CHECK( ! error );
+    tardigradeConstitutiveTools::rotationVectorToQuaternion( v, q );
 
-    floatVector A_answer  = { 20.5, 23., 25.5, 28. };
-    floatVector dA_answer = { 11.5, 13., 14.5, 16. };
+    BOOST_TEST( floatVector( q.begin( ), q.end( ) ) == floatVector( q_answer.begin( ), q_answer.end( ) ), CHECK_PER_ELEMENT );
 
-    BOOST_TEST( A == A_answer, CHECK_PER_ELEMENT );
+    tardigradeConstitutiveTools::rotationVectorToQuaternion( v, q, dqdv );
 
-    BOOST_TEST( dA == dA_answer, CHECK_PER_ELEMENT );
+    BOOST_TEST( floatVector( q.begin( ), q.end( ) ) == floatVector( q_answer.begin( ), q_answer.end( ) ), CHECK_PER_ELEMENT );
 
-    //Add test for the jacobian
-    floatType eps = 1e-6;
+    floatSecondOrderTensor Q;
 
-    floatVector A0, Ai, dA0, dAi;
+    std::array< floatType, 36 > dQdq;
 
-    floatMatrix DADADt;
+    floatThirdOrderTensor dQdv;
 
-    error = tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, alphaVec );
+    tardigradeConstitutiveTools::quaternionToRotationMatrix( q, Q );
 
-    error = tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt, dA0, A0, DADADt, alphaVec );
+    BOOST_TEST( floatVector( Q.begin( ), Q.end( ) ) == Q_answer, CHECK_PER_ELEMENT );
 
-    BOOST_CHECK( ! error );
+    tardigradeConstitutiveTools::quaternionToRotationMatrix( q, Q, dQdq );
 
-    BOOST_TEST( A0 == A, CHECK_PER_ELEMENT );
+    BOOST_TEST( floatVector( Q.begin( ), Q.end( ) ) == Q_answer, CHECK_PER_ELEMENT );
 
-    BOOST_TEST( dA0 == dA, CHECK_PER_ELEMENT );
+    tardigradeConstitutiveTools::rotationVectorToRotationMatrix( v, Q );
 
-    for ( unsigned int i=0; i<DADt.size( ); i++ ){
+    BOOST_TEST( floatVector( Q.begin( ), Q.end( ) ) == Q_answer, CHECK_PER_ELEMENT );
 
-        floatVector delta = floatVector( DADt.size( ), 0 );
+    tardigradeConstitutiveTools::rotationVectorToRotationMatrix( v, Q, dQdv );
 
-        delta[ i ] = eps*( DADt[ i ] ) + eps;
+    BOOST_TEST( floatVector( Q.begin( ), Q.end( ) ) == Q_answer, CHECK_PER_ELEMENT );
 
-        floatVector Aip, Aim, dAip, dAim;
+    // The rotated tensors must match the rotations by the rotation matrix
+    floatSecondOrderTensor A = { 1, 2, 3, 4, 5, 6, 7, 8, 9 }, rotatedA_answer, rotatedA;
 
-        error = tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt + delta, dAip, Aip, alphaVec );
+    floatFourthOrderTensor C, rotatedC_answer, rotatedC;
 
-        BOOST_CHECK( !error );
+    for ( unsigned int i = 0; i < 81; i++ ){ C[ i ] = std::sin( 0.3 * i + 0.2 ); }
 
-        error = tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt - delta, dAim, Aim, alphaVec );
+    floatSecondOrderTensor QTensor;
 
-        BOOST_CHECK( !error );
+    std::copy( Q_answer.begin( ), Q_answer.end( ), QTensor.begin( ) );
 
-        floatVector gradCol = ( Aip - Aim )/(2*delta[ i ]);
+    tardigradeConstitutiveTools::rotateSecondOrderTensor( A, QTensor, rotatedA_answer );
 
-        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
+    tardigradeConstitutiveTools::rotateFourthOrderTensor( C, QTensor, rotatedC_answer );
 
-            BOOST_TEST( DADADt[ j ][ i ] == gradCol[ j ] );
+    std::array< floatType, 36 > dRotatedAdq;
 
-        }
+    floatThirdOrderTensor dRotatedAdv;
 
-        gradCol = ( dAip - dAim )/(2*delta[ i ]);
+    tardigradeConstitutiveTools::rotateSecondOrderTensor( A, q, rotatedA );
 
-        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
+    BOOST_TEST( rotatedA == rotatedA_answer, CHECK_PER_ELEMENT );
 
-            BOOST_TEST( DADADt[ j ][ i ] == gradCol[ j ] );
+    tardigradeConstitutiveTools::rotateSecondOrderTensor( A, q, rotatedA, dRotatedAdq );
 
-        }
+    BOOST_TEST( rotatedA == rotatedA_answer, CHECK_PER_ELEMENT );
 
-    }
+    tardigradeConstitutiveTools::rotateSecondOrderTensor( A, v, rotatedA );
 
-    floatVector dA1, A1;
+    BOOST_TEST( rotatedA == rotatedA_answer, CHECK_PER_ELEMENT );
 
-    floatMatrix DADADt1, DADADtp;
+    tardigradeConstitutiveTools::rotateSecondOrderTensor( A, v, rotatedA, dRotatedAdv );
 
-    BOOST_CHECK( !tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt, dA1, A1, DADADt1, DADADtp, alphaVec ) );
+    BOOST_TEST( rotatedA == rotatedA_answer, CHECK_PER_ELEMENT );
 
-    BOOST_TEST( A1 == A, CHECK_PER_ELEMENT );
+    tardigradeConstitutiveTools::rotateFourthOrderTensor( C, q, rotatedC );
 
-    BOOST_TEST( dA1 == dA, CHECK_PER_ELEMENT );
+    BOOST_TEST( rotatedC == rotatedC_answer, CHECK_PER_ELEMENT );
 
-    BOOST_TEST( tardigradeVectorTools::appendVectors( DADADt1 ) == tardigradeVectorTools::appendVectors( DADADt ), CHECK_PER_ELEMENT );
+    tardigradeConstitutiveTools::rotateFourthOrderTensor( C, v, rotatedC );
 
-    floatMatrix DADADtp_answer( Ap.size( ), floatVector( DApDt.size( ), 0 ) );
+    BOOST_TEST( rotatedC == rotatedC_answer, CHECK_PER_ELEMENT );
 
-    for ( unsigned int i = 0; i < DApDt.size( ); i++ ){
+    // Derivatives w.r.t. the quaternion
+    for ( unsigned int a = 0; a < 4; a++ ){
 
-        floatVector delta = floatVector( DApDt.size( ), 0 );
+        floatType delta = eps * std::fabs( q[ a ] ) + eps;
 
-        delta[ i ] = eps * std::fabs( DApDt[ i ] ) + eps;
+        floatQuaternion qp = q, qm = q;
 
-        floatVector _dAp, _dAm;
+        qp[ a ] += delta;
 
-        floatVector _Ap, _Am;
+        qm[ a ] -= delta;
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt + delta, DADt, _dAp, _Ap, alphaVec ) );
+        floatSecondOrderTensor Qp, Qm, Ap, Am;
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt - delta, DADt, _dAm, _Am, alphaVec ) );
+        tardigradeConstitutiveTools::quaternionToRotationMatrix( qp, Qp );
 
-        for ( unsigned int j = 0; j < Ap.size( ); j++ ){
+        tardigradeConstitutiveTools::quaternionToRotationMatrix( qm, Qm );
 
-            DADADtp_answer[ j ][ i ] = ( _Ap[ j ] - _Am[ j ] ) / ( 2 * delta[ i ] );
+        tardigradeConstitutiveTools::rotateSecondOrderTensor( A, qp, Ap );
 
-            BOOST_TEST( DADADtp_answer[ j ][ i ] == ( _dAp[ j ] - _dAm[ j ] ) / ( 2 * delta[ i ] ) );
+        tardigradeConstitutiveTools::rotateSecondOrderTensor( A, qm, Am );
 
-        }
+        for ( unsigned int i = 0; i < 9; i++ ){
 
-    }
+            BOOST_TEST( dQdq[ 4 * i + a ] == ( Qp[ i ] - Qm[ i ] ) / ( 2 * delta ) );
 
-    BOOST_TEST( tardigradeVectorTools::appendVectors( DADADtp ) == tardigradeVectorTools::appendVectors( DADADtp_answer ), CHECK_PER_ELEMENT );
+            BOOST_TEST( dRotatedAdq[ 4 * i + a ] == ( Ap[ i ] - Am[ i ] ) / ( 2 * delta ) );
 
-}
+        }
 
-BOOST_AUTO_TEST_CASE( testComputeDFDt, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
-    /*!
-     * Test the computation of the total time derivative of the
-     * deformation gradient.
-     */
+    }
 
-    floatVector F = { 0.69646919, 0.28613933, 0.22685145,
-                      0.55131477, 0.71946897, 0.42310646,
-                      0.98076420, 0.68482974, 0.4809319 };
+    // Derivatives w.r.t. the rotation vector
+    for ( unsigned int k = 0; k < 3; k++ ){
 
-    floatVector L = { 0.57821272, 0.27720263, 0.45555826,
-                      0.82144027, 0.83961342, 0.95322334,
-                      0.4768852 , 0.93771539, 0.1056616 };
+        floatType delta = eps * std::fabs( v[ k ] ) + eps;
 
-    floatVector answer = { 1.00232848, 0.67686793, 0.46754712,
-                           1.96988645, 1.49191786, 1.00002629,
-                           0.95274131, 0.88347295, 0.55575157 };
+        floatFirstOrderTensor vp = v, vm = v;
 
-    floatVector DFDt;
+        vp[ k ] += delta;
 
-    errorOut error = tardigradeConstitutiveTools::computeDFDt( L, F, DFDt );
+        vm[ k ] -= delta;
 
-    BOOST_CHECK( ! error );
+        floatQuaternion qp, qm;
 
-    BOOST_TEST( DFDt == answer, CHECK_PER_ELEMENT );
+        floatSecondOrderTensor Qp, Qm, Ap, Am;
 
-    //Test the jacobians
-    floatVector DFDtJ;
-    floatMatrix dDFDtdL, dDFDtdF;
-    error = tardigradeConstitutiveTools::computeDFDt( L, F, DFDtJ, dDFDtdL, dDFDtdF );
+        tardigradeConstitutiveTools::rotationVectorToQuaternion( vp, qp );
 
-    BOOST_CHECK( ! error );
+        tardigradeConstitutiveTools::rotationVectorToQuaternion( vm, qm );
 
-    BOOST_TEST( DFDt == DFDtJ, CHECK_PER_ELEMENT );
+        tardigradeConstitutiveTools::rotationVectorToRotationMatrix( vp, Qp );
 
-    //Use finite differences to estimate the jacobian
-    floatType eps = 1e-6;
-    for ( unsigned int i=0; i<F.size( ); i++ ){
+        tardigradeConstitutiveTools::rotationVectorToRotationMatrix( vm, Qm );
 
-        //Compute finite difference gradient w.r.t. L
-        floatVector delta( L.size( ), 0 );
-        delta[ i ] = eps*fabs( L[ i ] ) + eps;
+        tardigradeConstitutiveTools::rotateSecondOrderTensor( A, vp, Ap );
 
-        floatVector DFDtp, DFDtm;
+        tardigradeConstitutiveTools::rotateSecondOrderTensor( A, vm, Am );
 
-        error = tardigradeConstitutiveTools::computeDFDt( L + delta, F, DFDtp );
+        for ( unsigned int a = 0; a < 4; a++ ){
 
-        BOOST_CHECK( ! error );
+            BOOST_TEST( dqdv[ 3 * a + k ] == ( qp[ a ] - qm[ a ] ) / ( 2 * delta ) );
 
-        error = tardigradeConstitutiveTools::computeDFDt( L - delta, F, DFDtm );
+        }
 
-        BOOST_CHECK( ! error );
+        for ( unsigned int i = 0; i < 9; i++ ){
 
-        floatVector gradCol = ( DFDtp - DFDtm )/(2*delta[ i ]);
+            BOOST_TEST( dQdv[ 3 * i + k ] == ( Qp[ i ] - Qm[ i ] ) / ( 2 * delta ) );
+
+            BOOST_TEST( dRotatedAdv[ 3 * i + k ] == ( Ap[ i ] - Am[ i ] ) / ( 2 * delta ) );
 
-        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
-            BOOST_TEST( dDFDtdL[ j ][ i ] == gradCol[ j ] );
         }
 
-        //Compute finite difference gradient w.r.t. F
-        delta = floatVector( F.size( ), 0 );
-        delta[ i ] = eps*fabs( F[ i ] ) + eps;
+    }
 
-        error = tardigradeConstitutiveTools::computeDFDt( L, F + delta, DFDtp );
+    // Small rotations use the series expansion. The derivative at zero is half the identity.
+    floatFirstOrderTensor vSmall = { 1e-5, -2e-5, 3e-5 }, vZero = { 0, 0, 0 };
 
-        BOOST_CHECK( ! error );
+    floatQuaternion qSmall;
 
-        gradCol = ( DFDtJ - DFDt )/delta[ i ];
+    std::array< floatType, 12 > dqdvSmall;
 
-        error = tardigradeConstitutiveTools::computeDFDt( L, F - delta, DFDtm );
+    tardigradeConstitutiveTools::rotationVectorToQuaternion( vSmall, qSmall );
 
-        BOOST_CHECK( ! error );
+    BOOST_TEST( qSmall[ 0 ] == std::cos( 0.5 * std::sqrt( 14e-10 ) ) );
 
-        gradCol = ( DFDtp - DFDtm )/(2*delta[ i ]);
+    BOOST_TEST( qSmall[ 1 ] == 0.5e-5 );
 
-        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
-            BOOST_TEST( dDFDtdF[ j ][ i ] == gradCol[ j ] );
-        }
+    tardigradeConstitutiveTools::rotationVectorToQuaternion( vZero, qSmall, dqdvSmall );
 
+    BOOST_TEST( floatVector( qSmall.begin( ), qSmall.end( ) ) == floatVector( { 1, 0, 0, 0 } ), CHECK_PER_ELEMENT );
 
-    }
+    BOOST_TEST( floatVector( dqdvSmall.begin( ), dqdvSmall.end( ) ) == floatVector( { 0, 0, 0, 0.5, 0, 0, 0, 0.5, 0, 0, 0, 0.5 } ), CHECK_PER_ELEMENT );
 
-}
+    // Composition applies the second rotation first
+    floatQuaternion q1 = q, q2, q12;
 
-BOOST_AUTO_TEST_CASE( testEvolveF, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
-    /*!
-     * Test the evolution of the deformation gradient.
-     */
+    std::array< floatType, 16 > dqdq1, dqdq2;
 
-    floatType Dt = 2.7;
+    tardigradeConstitutiveTools::rotationVectorToQuaternion( floatFirstOrderTensor( { -0.2, 0.1, 0.4 } ), q2 );
 
-    floatVector Fp = { 0.69646919, 0.28613933, 0.22685145,
-                       0.55131477, 0.71946897, 0.42310646,
-                       0.98076420, 0.68482974, 0.4809319 };
+    floatSecondOrderTensor Q1, Q2, Q12;
 
-    floatVector Lp = { 0.69006282, 0.0462321 , 0.88086378,
-                       0.8153887 , 0.54987134, 0.72085876,
-                       0.66559485, 0.63708462, 0.54378588 };
+    tardigradeConstitutiveTools::quaternionToRotationMatrix( q1, Q1 );
 
-    floatVector L = { 0.57821272, 0.27720263, 0.45555826,
-                      0.82144027, 0.83961342, 0.95322334,
-                      0.4768852 , 0.93771539, 0.1056616 };
+    tardigradeConstitutiveTools::quaternionToRotationMatrix( q2, Q2 );
 
-    //Test 1 ( mode 1 fully explicit )
-    floatVector dF, F;
-    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, F, 1, 1 ) );
+    tardigradeConstitutiveTools::composeQuaternions( q1, q2, q12 );
 
-    floatVector answer = { 4.39551129, 2.53782698, 1.84614498,
-                           4.81201673, 3.75047725, 2.48674399,
-                           4.62070491, 3.44211354, 2.32252023 };
+    tardigradeConstitutiveTools::quaternionToRotationMatrix( q12, Q12 );
 
-    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+    floatVector Q12_answer( 9, 0 );
 
-    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dF, F, 1, 1 ) );
+    for ( unsigned int i = 0; i < 3; i++ ){
+        for ( unsigned int j = 0; j < 3; j++ ){
+            for ( unsigned int k = 0; k < 3; k++ ){
+                Q12_answer[ 3 * i + j ] += Q1[ 3 * i + k ] * Q2[ 3 * k + j ];
+            }
+        }
+    }
 
-    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+    BOOST_TEST( floatVector( Q12.begin( ), Q12.end( ) ) == Q12_answer, CHECK_PER_ELEMENT );
 
-    BOOST_TEST( ( answer - Fp ) == dF, CHECK_PER_ELEMENT );
+    tardigradeConstitutiveTools::composeQuaternions( q1, q2, q12, dqdq1, dqdq2 );
 
-    //Test 2 ( mode 1 fully implicit )
-    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, F, 0, 1 ) );
+    for ( unsigned int a = 0; a < 4; a++ ){
 
-    answer = {  0.63522182, -0.1712192 , -0.00846781,
-               -0.81250979, -0.19375022, -0.20193394,
-               -0.36163914, -0.03662069, -0.05769288 };
+        floatType delta = eps;
 
-    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+        floatQuaternion q1p = q1, q1m = q1, q2p = q2, q2m = q2;
 
-    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dF, F, 0, 1 ) );
+        q1p[ a ] += delta;
 
-    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+        q1m[ a ] -= delta;
 
-    BOOST_TEST( ( answer - Fp ) == dF, CHECK_PER_ELEMENT );
+        q2p[ a ] += delta;
 
-    //Test 3 ( mode 1 midpoint rule )
-    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, F, 0.5, 1 ) );
+        q2m[ a ] -= delta;
 
-    answer = {  0.20004929, -0.4409338 , -0.18955924,
-               -3.59005736, -2.17210401, -1.55661536,
-               -1.88391214, -1.13150095, -0.80579654 };
+        floatQuaternion r1p, r1m, r2p, r2m;
 
-    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+        tardigradeConstitutiveTools::composeQuaternions( q1p, q2, r1p );
 
-    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dF, F, 0.5, 1 ) );
+        tardigradeConstitutiveTools::composeQuaternions( q1m, q2, r1m );
 
-    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+        tardigradeConstitutiveTools::composeQuaternions( q1, q2p, r2p );
 
-    BOOST_TEST( ( answer - Fp ) == dF, CHECK_PER_ELEMENT );
+        tardigradeConstitutiveTools::composeQuaternions( q1, q2m, r2m );
 
-    //Tests 4 and 5 ( mode 1 jacobian )
-    floatVector dFJ, FJ;
-    floatMatrix dFdL;
-    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dFJ, FJ, dFdL, 0.5, 1 ) );
+        for ( unsigned int b = 0; b < 4; b++ ){
 
-    BOOST_TEST( answer == FJ, CHECK_PER_ELEMENT );
+            BOOST_TEST( dqdq1[ 4 * b + a ] == ( r1p[ b ] - r1m[ b ] ) / ( 2 * delta ) );
 
-    floatMatrix dFdL_alt, ddFdFp, dFdFp, dFdLp;
+            BOOST_TEST( dqdq2[ 4 * b + a ] == ( r2p[ b ] - r2m[ b ] ) / ( 2 * delta ) );
 
-    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dFJ, FJ, dFdL_alt, ddFdFp, dFdFp, dFdLp, 0.5, 1 ) );
+        }
 
-    BOOST_TEST( answer == FJ, CHECK_PER_ELEMENT );
+    }
 
-    BOOST_TEST( ( answer - Fp ) == dFJ, CHECK_PER_ELEMENT );
+    // Batches with a different quaternion at each point
+    constexpr unsigned int nPoints = 3;
 
-    BOOST_TEST( tardigradeVectorTools::appendVectors( dFdL ) == tardigradeVectorTools::appendVectors( dFdL_alt ), CHECK_PER_ELEMENT );
+    const floatQuaternion qs[ nPoints ] = { q1, q2, q12 };
 
-    floatType eps = 1e-6;
+    floatVector ABatch( 9 * nPoints ), CBatch( 81 * nPoints ), qBatch( 4 * nPoints );
 
-    floatMatrix dFdL_answer( L.size( ), floatVector( L.size( ), 0 ) );
+    for ( unsigned int p = 0; p < nPoints; p++ ){
 
-    for ( unsigned int i=0; i<L.size( ); i++ ){
+        for ( unsigned int i = 0; i < 9; i++ ){ ABatch[ i * nPoints + p ] = A[ i ] + p; }
 
-        floatVector delta( L.size( ), 0 );
-        delta[ i ] = eps * std::fabs( L[ i ] ) + eps;
+        for ( unsigned int i = 0; i < 81; i++ ){ CBatch[ i * nPoints + p ] = C[ i ] - p; }
 
-        floatVector _Fp, _Fm;
+        for ( unsigned int a = 0; a < 4; a++ ){ qBatch[ a * nPoints + p ] = qs[ p ][ a ]; }
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L + delta, _Fp, 0.5, 1 ) );
+    }
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L - delta, _Fm, 0.5, 1 ) );
+    floatVector rotatedABatch( 9 * nPoints ), rotatedCBatch( 81 * nPoints );
 
-        for ( unsigned int j = 0; j < L.size( ); j++ ){
+    tardigradeConstitutiveTools::rotateSecondOrderTensorByQuaternionBatched( nPoints, ABatch.data( ), qBatch.data( ), rotatedABatch.data( ) );
 
-            dFdL_answer[ j ][ i ] = ( _Fp[ j ] - _Fm[ j ] ) / ( 2 * delta[ i ] );
+    tardigradeConstitutiveTools::rotateFourthOrderTensorByQuaternionBatched( nPoints, CBatch.data( ), qBatch.data( ), rotatedCBatch.data( ) );
 
-        }
+    for ( unsigned int p = 0; p < nPoints; p++ ){
 
-    }
+        floatSecondOrderTensor Ap;
 
-    BOOST_TEST( tardigradeVectorTools::appendVectors( dFdL ) == tardigradeVectorTools::appendVectors( dFdL_answer ), CHECK_PER_ELEMENT );
+        floatFourthOrderTensor Cp;
 
-    floatMatrix dFdFp_answer( answer.size( ), floatVector( Fp.size( ), 0 ) );
-    floatMatrix ddFdFp_answer( answer.size( ), floatVector( Fp.size( ), 0 ) );
+        for ( unsigned int i = 0; i < 9; i++ ){ Ap[ i ] = A[ i ] + p; }
 
-    for ( unsigned int i=0; i<Fp.size( ); i++ ){
+        for ( unsigned int i = 0; i < 81; i++ ){ Cp[ i ] = C[ i ] - p; }
 
-        floatVector delta( Fp.size( ), 0 );
-        delta[ i ] = eps * std::fabs( Fp[ i ] ) + eps;
+        tardigradeConstitutiveTools::rotateSecondOrderTensor( Ap, qs[ p ], rotatedA );
 
-        floatVector _Fp, _Fm;
+        tardigradeConstitutiveTools::rotateFourthOrderTensor( Cp, qs[ p ], rotatedC );
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp + delta, Lp, L, _Fp, 0.5, 1 ) );
+        for ( unsigned int i = 0; i < 9; i++ ){ BOOST_TEST( rotatedABatch[ i * nPoints + p ] == rotatedA[ i ] ); }
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp - delta, Lp, L, _Fm, 0.5, 1 ) );
+        for ( unsigned int i = 0; i < 81; i++ ){ BOOST_TEST( rotatedCBatch[ i * nPoints + p ] == rotatedC[ i ] ); }
 
-        for ( unsigned int j = 0; j < L.size( ); j++ ){
+    }
 
-            dFdFp_answer[ j ][ i ] = ( _Fp[ j ] - _Fm[ j ] ) / ( 2 * delta[ i ] );
+}
 
-        }
+BOOST_AUTO_TEST_CASE( testComputeDeformationGradient, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the calculation of the deformation gradient from the displacement gradient
+     */
 
-        floatVector _dFp, _dFm;
+    floatVector gradU = { -0.01078825, -0.0156822 ,  0.02290497,
+                          -0.00614278, -0.04403221, -0.01019557,
+                           0.02379954, -0.03175083, -0.03245482 };
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp + delta, Lp, L, _dFp, _Fp, 0.5, 1 ) );
+    floatVector answer1 = { 0.98994207, -0.01554229,  0.02211531,
+                           -0.00604919,  0.95820757, -0.00959658,
+                            0.02300559, -0.02982579,  0.96937029 };
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp - delta, Lp, L, _dFm, _Fm, 0.5, 1 ) );
+    floatVector answer2 = { 0.98921175, -0.0156822 ,  0.02290497,
+                           -0.00614278,  0.95596779, -0.01019557,
+                            0.02379954, -0.03175083,  0.96754518 };
 
-        for ( unsigned int j = 0; j < L.size( ); j++ ){
+    floatVector F;
 
-            ddFdFp_answer[ j ][ i ] = ( _dFp[ j ] - _dFm[ j ] ) / ( 2 * delta[ i ] );
+    tardigradeConstitutiveTools::computeDeformationGradient( gradU, F, true );
 
-        }
+    BOOST_TEST( F == answer1, CHECK_PER_ELEMENT );
 
-    }
+    F.clear( );
+    tardigradeConstitutiveTools::computeDeformationGradient( gradU, F, false );
 
-    BOOST_TEST( tardigradeVectorTools::appendVectors( dFdFp ) == tardigradeVectorTools::appendVectors(dFdFp_answer ), CHECK_PER_ELEMENT );
-                                                                                                  
-    BOOST_TEST( tardigradeVectorTools::appendVectors( ddFdFp ) == tardigradeVectorTools::appendVectors( ddFdFp_answer ), CHECK_PER_ELEMENT );
+    BOOST_TEST( F == answer2, CHECK_PER_ELEMENT );
 
-    floatMatrix dFdLp_answer( answer.size( ), floatVector( Lp.size( ), 0 ) );
+    floatVector dFdGradU_true, dFdGradU_false;
 
-    for ( unsigned int i=0; i<Lp.size( ); i++ ){
+    F.clear( );
+    tardigradeConstitutiveTools::computeDeformationGradient( gradU, F, dFdGradU_true, true );
 
-        floatVector delta( Lp.size( ), 0 );
-        delta[ i ] = eps * std::fabs( Lp[ i ] ) + eps;
+    BOOST_TEST( F == answer1, CHECK_PER_ELEMENT );
 
-        floatVector _Fp, _Fm;
+    F.clear( );
+    tardigradeConstitutiveTools::computeDeformationGradient( gradU, F, dFdGradU_false, false );
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp + delta, L, _Fp, 0.5, 1 ) );
+    BOOST_TEST( F == answer2, CHECK_PER_ELEMENT );
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp - delta, L, _Fm, 0.5, 1 ) );
+    const float eps = 1e-6;
 
-        for ( unsigned int j = 0; j < L.size( ); j++ ){
+    floatVector j1( 9 * 9, 0 ), j2( 9 * 9, 0 );
 
-            dFdLp_answer[ j ][ i ] = ( _Fp[ j ] - _Fm[ j ] ) / ( 2 * delta[ i ] );
-
-        }
-
-    }
-
-    BOOST_TEST( tardigradeVectorTools::appendVectors( dFdLp ) == tardigradeVectorTools::appendVectors( dFdLp_answer ), CHECK_PER_ELEMENT );
-
-    //Test 6 ( mode 2 fully explicit )
-    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, F, 1, 2 ) );
-
-    answer = { 3.03173544, 1.1881084 , 2.77327313,
-               3.92282144, 2.58424672, 3.75584617,
-               5.18006647, 2.65125419, 4.85252662 };
+    for ( unsigned int i = 0; i < 9; i++ ){
 
-    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+        floatVector delta( 9, 0 );
 
-    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dF, F, 1, 2 ) );
+        delta[ i ] = eps * std::fabs( gradU[ i ] ) + eps;
 
-    BOOST_TEST( ( answer - Fp ) == dF, CHECK_PER_ELEMENT );
+        floatVector rp, rm;
 
-    //Test 7 ( mode 2 fully implicit )
-    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, F, 0, 2 ) );
+        tardigradeConstitutiveTools::computeDeformationGradient( gradU + delta, rp, true );
 
-    answer = {  0.65045472, -0.42475879, -0.09274688,
-               -0.25411831, -0.08867872, -0.16467241,
-                0.45611733, -0.45427799, -0.17799727 };
+        tardigradeConstitutiveTools::computeDeformationGradient( gradU - delta, rm, true );
 
-    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+        for ( unsigned int j = 0; j < 9; j++ ){
 
-    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dF, F, 0, 2 ) );
+            j1[ 9 * j + i ] = ( rp[ j ] - rm[ j ] ) / ( 2 * delta[ i ] );
 
-    BOOST_TEST( ( answer - Fp ) == dF, CHECK_PER_ELEMENT );
+        }
 
-    //Test 8 ( mode 2 midpoint rule )
-    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, F, 0.5, 2 ) );
+        tardigradeConstitutiveTools::computeDeformationGradient( gradU + delta, rp, false );
 
-    answer = { -0.02066217, -1.43862233, -0.42448874,
-               -0.96426544, -1.72139966, -0.83831629,
-               -0.59802055, -2.37943476, -0.88998505 };
+        tardigradeConstitutiveTools::computeDeformationGradient( gradU - delta, rm, false );
 
-    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+        for ( unsigned int j = 0; j < 9; j++ ){
 
-    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dF, F, 0.5, 2 ) );
+            j2[ 9 * j + i ] = ( rp[ j ] - rm[ j ] ) / ( 2 * delta[ i ] );
 
-    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+        }
 
-    BOOST_TEST( ( answer - Fp ) == dF, CHECK_PER_ELEMENT );
+    }
 
-    //Tests 9 and 10 ( mode 2 jacobian )
-    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dFJ, FJ, dFdL, 0.5, 2 ) );
+    BOOST_TEST( j1 == dFdGradU_true,  CHECK_PER_ELEMENT );
 
-    BOOST_TEST( F == FJ, CHECK_PER_ELEMENT );
+    BOOST_TEST( j2 == dFdGradU_false, CHECK_PER_ELEMENT );
 
-    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dFJ, FJ, dFdL_alt, ddFdFp, dFdFp, dFdLp, 0.5, 2 ) );
+}
 
-    BOOST_TEST( answer == FJ, CHECK_PER_ELEMENT );
+template< class K >
+void checkKinematicAssumption( const tardigradeConstitutiveTools::kinematicTensor< K, floatType > &gradU ){
+    /*!
+     * Check the kinematics under the kinematic assumption K against the three dimensional kinematics and the
+     * Jacobians against finite differences
+     *
+     * \param &gradU: The stored components of the displacement gradient
+     */
 
-    BOOST_TEST( ( answer - Fp ) == dFJ, CHECK_PER_ELEMENT );
+    typedef tardigradeConstitutiveTools::kinematicTensor< K, floatType > tensor;
 
-    BOOST_TEST( tardigradeVectorTools::appendVectors( dFdL ) == tardigradeVectorTools::appendVectors( dFdL_alt ), CHECK_PER_ELEMENT );
+    typedef tardigradeConstitutiveTools::kinematicJacobian< K, floatType > jacobian;
 
-    dFdL_answer = floatMatrix( Fp.size( ), floatVector( L.size( ), 0 ) );
+    floatType eps = 1e-6;
 
-    for ( unsigned int i=0; i<L.size( ); i++ ){
+    floatSecondOrderTensor gradU3D;
 
-        floatVector delta( L.size( ), 0 );
-        delta[ i ] = eps * std::fabs( L[ i ] ) + eps;
+    tardigradeConstitutiveTools::expandToThreeDimensions< K >( gradU, gradU3D, 0. );
 
-        floatVector _Fp, _Fm;
+    for ( bool isCurrent : { false, true } ){
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L + delta, _Fp, 0.5, 2 ) );
+        tensor F, C, E, invF;
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L - delta, _Fm, 0.5, 2 ) );
+        jacobian dFdGradU, dCdF, dEdF;
 
-        for ( unsigned int j = 0; j < L.size( ); j++ ){
+        floatSecondOrderTensor F3D, C3D, E3D, invF3D, F_answer, C_answer, E_answer, invF_answer;
 
-            dFdL_answer[ j ][ i ] = ( _Fp[ j ] - _Fm[ j ] ) / ( 2 * delta[ i ] );
+        tardigradeConstitutiveTools::computeDeformationGradient( gradU3D, F_answer, isCurrent );
 
-        }
+        tardigradeConstitutiveTools::computeRightCauchyGreen( F_answer, C_answer );
 
-    }
+        tardigradeConstitutiveTools::computeGreenLagrangeStrain( F_answer, E_answer );
 
-    BOOST_TEST( tardigradeVectorTools::appendVectors( dFdL ) == tardigradeVectorTools::appendVectors( dFdL_answer ), CHECK_PER_ELEMENT );
+        tardigradeConstitutiveTools::computeDeformationGradient< K >( gradU, F, isCurrent );
 
-    dFdFp_answer = floatMatrix( answer.size( ), floatVector( Fp.size( ), 0 ) );
-    ddFdFp_answer = floatMatrix( answer.size( ), floatVector( Fp.size( ), 0 ) );
+        tardigradeConstitutiveTools::expandToThreeDimensions< K >( F, F3D, 1. );
 
-    for ( unsigned int i=0; i<Fp.size( ); i++ ){
+        BOOST_TEST( F3D == F_answer, CHECK_PER_ELEMENT );
 
-        floatVector delta( Fp.size( ), 0 );
-        delta[ i ] = eps * std::fabs( Fp[ i ] ) + eps;
+        tardigradeConstitutiveTools::computeDeformationGradient< K >( gradU, F, dFdGradU, isCurrent );
 
-        floatVector _Fp, _Fm;
+        tardigradeConstitutiveTools::expandToThreeDimensions< K >( F, F3D, 1. );
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp + delta, Lp, L, _Fp, 0.5, 2 ) );
+        BOOST_TEST( F3D == F_answer, CHECK_PER_ELEMENT );
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp - delta, Lp, L, _Fm, 0.5, 2 ) );
+        floatType J = tardigradeConstitutiveTools::invertDeformationGradient< K >( F, invF );
 
-        for ( unsigned int j = 0; j < L.size( ); j++ ){
+        tardigradeConstitutiveTools::expandToThreeDimensions< K >( invF, invF3D, 1. );
 
-            dFdFp_answer[ j ][ i ] = ( _Fp[ j ] - _Fm[ j ] ) / ( 2 * delta[ i ] );
+        tardigradeConstitutiveTools::KinematicState kinematics( F_answer );
 
-        }
+        BOOST_TEST( J == kinematics.determinant( ) );
 
-        floatVector _dFp, _dFm;
+        invF_answer = kinematics.inverse( );
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp + delta, Lp, L, _dFp, _Fp, 0.5, 2 ) );
+        BOOST_TEST( invF3D == invF_answer, CHECK_PER_ELEMENT );
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp - delta, Lp, L, _dFm, _Fm, 0.5, 2 ) );
+        tardigradeConstitutiveTools::computeRightCauchyGreen< K >( F, C );
 
-        for ( unsigned int j = 0; j < L.size( ); j++ ){
+        tardigradeConstitutiveTools::expandToThreeDimensions< K >( C, C3D, 1. );
 
-            ddFdFp_answer[ j ][ i ] = ( _dFp[ j ] - _dFm[ j ] ) / ( 2 * delta[ i ] );
+        BOOST_TEST( C3D == C_answer, CHECK_PER_ELEMENT );
 
-        }
+        tardigradeConstitutiveTools::computeRightCauchyGreen< K >( F, C, dCdF );
 
-    }
+        tardigradeConstitutiveTools::expandToThreeDimensions< K >( C, C3D, 1. );
 
-    BOOST_TEST( tardigradeVectorTools::appendVectors( dFdFp ) == tardigradeVectorTools::appendVectors( dFdFp_answer ), CHECK_PER_ELEMENT );
+        BOOST_TEST( C3D == C_answer, CHECK_PER_ELEMENT );
 
-    BOOST_TEST( tardigradeVectorTools::appendVectors( ddFdFp ) == tardigradeVectorTools::appendVectors( ddFdFp_answer ), CHECK_PER_ELEMENT );
+        tardigradeConstitutiveTools::computeGreenLagrangeStrain< K >( F, E );
 
-    dFdLp_answer = floatMatrix( answer.size( ), floatVector( Lp.size( ), 0 ) );
+        tardigradeConstitutiveTools::expandToThreeDimensions< K >( E, E3D, 0. );
 
-    for ( unsigned int i=0; i<Lp.size( ); i++ ){
+        BOOST_TEST( E3D == E_answer, CHECK_PER_ELEMENT );
 
-        floatVector delta( Lp.size( ), 0 );
-        delta[ i ] = eps * std::fabs( Lp[ i ] ) + eps;
+        tardigradeConstitutiveTools::computeGreenLagrangeStrain< K >( F, E, dEdF );
 
-        floatVector _Fp, _Fm;
+        tardigradeConstitutiveTools::expandToThreeDimensions< K >( E, E3D, 0. );
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp + delta, L, _Fp, 0.5, 2 ) );
+        BOOST_TEST( E3D == E_answer, CHECK_PER_ELEMENT );
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp - delta, L, _Fm, 0.5, 2 ) );
+        for ( unsigned int j = 0; j < K::size; j++ ){
 
-        for ( unsigned int j = 0; j < L.size( ); j++ ){
+            floatType delta = eps * std::fabs( gradU[ j ] ) + eps;
 
-            dFdLp_answer[ j ][ i ] = ( _Fp[ j ] - _Fm[ j ] ) / ( 2 * delta[ i ] );
+            tensor gradUp = gradU, gradUm = gradU, Fp = F, Fm = F, Pp, Pm;
 
-        }
+            gradUp[ j ] += delta;
 
-    }
+            gradUm[ j ] -= delta;
 
-    BOOST_TEST( tardigradeVectorTools::appendVectors( dFdLp ) == tardigradeVectorTools::appendVectors( dFdLp_answer ), CHECK_PER_ELEMENT );
+            tardigradeConstitutiveTools::computeDeformationGradient< K >( gradUp, Pp, isCurrent );
 
-}
+            tardigradeConstitutiveTools::computeDeformationGradient< K >( gradUm, Pm, isCurrent );
 
-BOOST_AUTO_TEST_CASE( testMac, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
-    /*!
-     * Test the computation of the Macullay brackets.
-     */
+            for ( unsigned int i = 0; i < K::size; i++ ){
 
-    floatType x = 1;
-    BOOST_TEST( tardigradeConstitutiveTools::mac( x ) == x );
+                BOOST_TEST( dFdGradU[ K::size * i + j ] == ( Pp[ i ] - Pm[ i ] ) / ( 2 * delta ) );
 
-    x = -1;
-    BOOST_TEST( tardigradeConstitutiveTools::mac( x ) == 0. );
+            }
 
-    floatType xJ = 2;
-    floatType dmacdx;
-    BOOST_TEST( tardigradeConstitutiveTools::mac( xJ ) == tardigradeConstitutiveTools::mac( xJ, dmacdx ) );
+            delta = eps * std::fabs( F[ j ] ) + eps;
 
-    BOOST_TEST( dmacdx == 1. );
+            Fp[ j ] += delta;
 
-    xJ = -2;
-    BOOST_TEST( tardigradeConstitutiveTools::mac( xJ ) == tardigradeConstitutiveTools::mac( xJ, dmacdx ) );
+            Fm[ j ] -= delta;
 
-    BOOST_TEST( dmacdx == 0. );
+            tardigradeConstitutiveTools::computeRightCauchyGreen< K >( Fp, Pp );
 
-}
+            tardigradeConstitutiveTools::computeRightCauchyGreen< K >( Fm, Pm );
 
-BOOST_AUTO_TEST_CASE( testComputeUnitNormal, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
-    /*!
-     * Test the computation of the unit normal.
-     */
+            for ( unsigned int i = 0; i < K::size; i++ ){
 
-    floatVector A = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
-    floatVector Anorm;
+                BOOST_TEST( dCdF[ K::size * i + j ] == ( Pp[ i ] - Pm[ i ] ) / ( 2 * delta ) );
 
-    errorOut error = tardigradeConstitutiveTools::computeUnitNormal( A, Anorm );
+            }
 
-    BOOST_CHECK( ! error );
+            tardigradeConstitutiveTools::computeGreenLagrangeStrain< K >( Fp, Pp );
 
-    BOOST_CHECK( tardigradeVectorTools::inner( Anorm, Anorm ) == 1. );
+            tardigradeConstitutiveTools::computeGreenLagrangeStrain< K >( Fm, Pm );
 
-    //Check the jacobian
-    floatVector AnormJ;
-    floatMatrix dAnormdA;
+            for ( unsigned int i = 0; i < K::size; i++ ){
 
-    error = tardigradeConstitutiveTools::computeUnitNormal( A, AnormJ, dAnormdA );
+                BOOST_TEST( dEdF[ K::size * i + j ] == ( Pp[ i ] - Pm[ i ] ) / ( 2 * delta ) );
 
-    BOOST_CHECK( ! error );
+            }
 
-    //Check the normalized value
-    BOOST_TEST( AnormJ == Anorm, CHECK_PER_ELEMENT );
+        }
 
-    //Check the gradient
-    floatType eps = 1e-6;
-    for ( unsigned int i=0; i<A.size( ); i++ ){
-        floatVector delta( A.size( ), 0 );
-        delta[ i ] = eps*fabs( A[ i ] ) + eps;
+    }
 
-        floatVector Anormp, Anormm;
-        error = tardigradeConstitutiveTools::computeUnitNormal( A + delta, Anormp );
+}
 
-        BOOST_CHECK( ! error );
+BOOST_AUTO_TEST_CASE( testKinematicAssumptions, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the kinematics templated on the kinematic assumption
+     */
 
-        error = tardigradeConstitutiveTools::computeUnitNormal( A - delta, Anormm );
+    checkKinematicAssumption< tardigradeConstitutiveTools::uniaxialStrain >( { 0.12 } );
 
-        BOOST_CHECK( ! error );
+    checkKinematicAssumption< tardigradeConstitutiveTools::planeStrain >( { 0.12, -0.05, 0.08, -0.1 } );
 
-        floatVector gradCol = ( Anormp - Anormm )/(2*delta[ i ]);
+    checkKinematicAssumption< tardigradeConstitutiveTools::axisymmetric >( { 0.12, -0.05, 0.08, -0.1, 0.04 } );
 
-        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
-            BOOST_TEST( dAnormdA[ j ][ i ] == gradCol[ j ] );
-        }
-    }
+    checkKinematicAssumption< tardigradeConstitutiveTools::threeDimensional >( { 0.12, -0.05, 0.03, 0.08, -0.1, 0.02, -0.04, 0.06, 0.07 } );
 
-    A = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+    // Two dimensional floatVector displacement gradients use the plane strain kinematics
+    floatVector gradU = { 0.12, -0.05, 0.08, -0.1 };
 
-    error = tardigradeConstitutiveTools::computeUnitNormal( A, Anorm );
+    tardigradeConstitutiveTools::kinematicTensor< tardigradeConstitutiveTools::planeStrain, floatType > gradUTensor = { 0.12, -0.05, 0.08, -0.1 }, FTensor;
 
-    BOOST_CHECK( ! error );
+    tardigradeConstitutiveTools::kinematicJacobian< tardigradeConstitutiveTools::planeStrain, floatType > dFdGradUTensor;
 
-    BOOST_TEST( Anorm == A, CHECK_PER_ELEMENT );
+    floatVector F, dFdGradU;
 
-    error = tardigradeConstitutiveTools::computeUnitNormal( A, Anorm, dAnormdA );
+    tardigradeConstitutiveTools::computeDeformationGradient< tardigradeConstitutiveTools::planeStrain >( gradUTensor, FTensor, dFdGradUTensor, true );
 
-    BOOST_CHECK( ! error );
+    tardigradeConstitutiveTools::computeDeformationGradient( gradU, F, dFdGradU, true );
 
-    BOOST_TEST( Anorm == A, CHECK_PER_ELEMENT );
+    BOOST_TEST( F == floatVector( FTensor.begin( ), FTensor.end( ) ), CHECK_PER_ELEMENT );
 
-    BOOST_CHECK( std::isnan( tardigradeVectorTools::l2norm( dAnormdA ) ) );
+    BOOST_TEST( dFdGradU == floatVector( dFdGradUTensor.begin( ), dFdGradUTensor.end( ) ), CHECK_PER_ELEMENT );
 
 }
 
-BOOST_AUTO_TEST_CASE( testPullBackVelocityGradient, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+BOOST_AUTO_TEST_CASE( testComputeGreenLagrangeStrain, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
     /*!
-     * Test the pull back operation on the velocity gradient.
+     * Test the computation of the Green-Lagrange strain
      */
 
-    floatVector velocityGradient = { 0.69006282, 0.0462321 , 0.88086378,
-                                     0.8153887 , 0.54987134, 0.72085876,
-                                     0.66559485, 0.63708462, 0.54378588 };
-
-    floatVector deformationGradient = { 0.69646919, 0.28613933, 0.22685145,
-                                        0.55131477, 0.71946897, 0.42310646,
-                                        0.98076420, 0.68482974, 0.4809319 };
-
-    floatVector pullBackL;
-    floatVector expectedPullBackL = {   6.32482111,   3.11877752,   2.43195977,
-                                       20.19439192,  10.22175689,   7.88052809,
-                                      -38.85113898, -18.79212468, -14.76285795 };
-
-    errorOut error = tardigradeConstitutiveTools::pullBackVelocityGradient( velocityGradient, deformationGradient, pullBackL );
-
-    BOOST_CHECK( ! error );
-
-    BOOST_TEST( pullBackL == expectedPullBackL, CHECK_PER_ELEMENT );
+    floatVector F = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+    floatVector E;
 
-    floatVector pullBackLJ;
-    floatMatrix dpbLdL, dpbLdF;
+    tardigradeConstitutiveTools::errorOut ret;
+    ret = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, E );
 
-    //Test of the jacobian
-    error = tardigradeConstitutiveTools::pullBackVelocityGradient( velocityGradient, deformationGradient, pullBackLJ,
-                                                        dpbLdL, dpbLdF );
+    BOOST_CHECK( ! ret );
 
-    BOOST_CHECK( ! error );
+    floatVector E_answer_1( 9, 0 );
 
-    BOOST_TEST( pullBackL == pullBackLJ, CHECK_PER_ELEMENT );
+    BOOST_TEST( E == E_answer_1, CHECK_PER_ELEMENT );
 
-    //Check dpbLdL
-    floatType eps = 1e-6;
-    for ( unsigned int i=0; i<velocityGradient.size( ); i++ ){
-        floatVector delta( velocityGradient.size( ), 0 );
-        delta[ i ] = eps*fabs( velocityGradient[ i ] ) + eps;
+    F = { 0.69646919, 0.28613933, 0.22685145,
+          0.55131477, 0.71946897, 0.42310646,
+          0.98076420, 0.68482974, 0.4809319 };
 
-        floatVector Lp, Lm;
+    ret = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, E );
 
-        error = tardigradeConstitutiveTools::pullBackVelocityGradient( velocityGradient + delta, deformationGradient, Lp );
+    BOOST_CHECK( ! ret );
 
-        BOOST_CHECK( ! error );
+    floatVector E_answer_2 = { 0.37545786,  0.63379879,  0.43147034,
+                               0.63379879,  0.03425154,  0.34933978,
+                               0.43147034,  0.34933978, -0.26911192 };
 
-        error = tardigradeConstitutiveTools::pullBackVelocityGradient( velocityGradient - delta, deformationGradient, Lm );
+    BOOST_TEST( E == E_answer_2, CHECK_PER_ELEMENT );
 
-        BOOST_CHECK( ! error );
+    floatVector EJ;
+    floatMatrix dEdF;
+    ret = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, EJ, dEdF );
 
-        floatVector gradCol = ( Lp - Lm )/(2*delta[ i ]);
+    BOOST_CHECK( ! ret );
 
-        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
-            BOOST_TEST( gradCol[ j ] == dpbLdL[ j ][ i ] );
-        }
-    }
+    BOOST_TEST( E == EJ, CHECK_PER_ELEMENT );
 
-    //Check dpbLdF
-    for ( unsigned int i=0; i<deformationGradient.size( ); i++ ){
-        floatVector delta( deformationGradient.size( ), 0 );
-        delta[ i ] = eps*fabs( deformationGradient[ i ] ) + eps;
+    floatType eps = 1e-6;
+    for ( unsigned int i=0; i<F.size( ); i++ ){
+        floatVector delta( F.size( ), 0 );
 
-        floatVector Lp, Lm;
+        delta[ i ] = eps * fabs( F[ i ] ) + eps;
 
-        error = tardigradeConstitutiveTools::pullBackVelocityGradient( velocityGradient, deformationGradient + delta, Lp );
+        floatVector EJp, EJm;
 
-        BOOST_CHECK( ! error );
+        ret = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F + delta, EJp );
 
-        error = tardigradeConstitutiveTools::pullBackVelocityGradient( velocityGradient, deformationGradient - delta, Lm );
+        ret = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F - delta, EJm );
 
-        BOOST_CHECK( ! error );
+        BOOST_CHECK( ! ret );
 
-        floatVector gradCol = ( Lp - Lm )/(2*delta[ i ]);
+        floatVector gradCol = ( EJp - EJm )/(2*delta[ i ]);
 
         for ( unsigned int j=0; j<gradCol.size( ); j++ ){
-            BOOST_TEST( gradCol[ j ] == dpbLdF[ j ][ i ] );
+            BOOST_TEST( gradCol[ j ] == dEdF[ j ][ i ] );
         }
     }
 
 }
 
-BOOST_AUTO_TEST_CASE( testQuadraticThermalExpansion, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+BOOST_AUTO_TEST_CASE( testDecomposeGreenLagrangeStrain, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
     /*!
-     * Test the computation of the thermal expansion using a
-     * quadratic form.
+     * Test the decomposition of the Green-Lagrange strain into isochoric and
+     * volumetric parts.
      */
 
-    floatType temperature = 283.15;
-    floatType referenceTemperature = 273.15;
+    floatVector F = { 0.69646919, 0.28613933, 0.22685145,
+                      0.55131477, 0.71946897, 0.42310646,
+                      0.98076420, 0.68482974, 0.4809319 };
 
-    floatVector linearParameters = { 1, 2, 3, 4 };
-    floatVector quadraticParameters = { 5, 6, 7, 8 };
+    floatType J = tardigradeVectorTools::determinant( F, 3, 3 );
+    floatVector Fbar = F/pow( J, 1./3 );
 
-    floatVector answer = { 27825., 33398., 38971., 44544. };
+    floatVector E, Ebar;
+    errorOut ret = tardigradeConstitutiveTools::computeGreenLagrangeStrain( Fbar, Ebar );
 
-    floatVector thermalExpansion;
-    errorOut error = tardigradeConstitutiveTools::quadraticThermalExpansion(     temperature, referenceTemperature,
-                                                                  linearParameters,  quadraticParameters,
-                                                                  thermalExpansion );
+    BOOST_CHECK( ! ret );
+
+    ret = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, E );
+
+    BOOST_CHECK( ! ret );
+
+    floatType JOut;
+    floatVector EbarOut;
+    ret = tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( E, EbarOut, JOut );
+
+    BOOST_CHECK( ! ret );
+
+    BOOST_TEST( J == JOut );
+
+    BOOST_TEST( EbarOut == Ebar, CHECK_PER_ELEMENT );
+
+    floatVector EbarOut2;
+    floatType JOut2;
+    floatMatrix dEbardE;
+    floatVector dJdE;
+    ret = tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( E, EbarOut2, JOut2, dEbardE, dJdE );
+
+    BOOST_CHECK( ! ret );
+
+    BOOST_TEST( EbarOut == EbarOut2, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( JOut == JOut2 );
+
+    floatType eps = 1e-8;
+    for ( unsigned int i=0; i<E.size( ); i++ ){
+        floatVector delta( E.size( ), 0 );
+        delta[ i ] =  fabs( eps*E[ i ] );
+
+        floatType Jp, Jm;
+        ret = tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( E + delta, EbarOut2, Jp );
+        BOOST_CHECK( ! ret );
+
+        ret = tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( E - delta, EbarOut2, Jm );
+        BOOST_CHECK( ! ret );
+
+        BOOST_TEST( ( Jp - Jm )/(2*delta[ i ]) == dJdE[ i ] );
+    }
+
+    for ( unsigned int i=0; i<E.size( ); i++ ){
+        floatVector delta( E.size( ), 0 );
+        delta[ i ] = fabs( eps*E[ i ] );
+
+        floatVector Ebarp, Ebarm;
+
+        ret = tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( E + delta, Ebarp, JOut2 );
+
+        BOOST_CHECK( ! ret );
+
+        ret = tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( E - delta, Ebarm, JOut2 );
+
+        BOOST_CHECK( ! ret );
+
+        floatVector gradCol = ( Ebarp - Ebarm )/(2*delta[ i ]);
+
+        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
+            BOOST_TEST( gradCol[ j ] == dEbardE[ j ][ i ] );
+        }
+    }
+
+    floatVector badE = { -1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    BOOST_REQUIRE_THROW( tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( badE, EbarOut, JOut ), std::nested_exception );
+
+}
+
+BOOST_AUTO_TEST_CASE( testComputeIsochoricKinematics, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the fused computation of the isochoric kinematics against the chained computation
+     */
+
+    constexpr unsigned int sot_dim = 9;
+
+    floatVector gradU = {  0.08, -0.03,  0.05,
+                           0.02,  0.11, -0.04,
+                          -0.06,  0.01, -0.07 };
+
+    for ( const bool isCurrent : { false, true } ){
+
+        floatVector F, dFdGradU, E, dEdF, Ebar, dEbardE, dJdE;
+
+        floatType J;
+
+        tardigradeConstitutiveTools::computeDeformationGradient( gradU, F, dFdGradU, isCurrent );
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, E, dEdF ) );
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( E, Ebar, J, dEbardE, dJdE ) );
+
+        floatVector dEbardGradUAnswer( sot_dim * sot_dim, 0 ), dJdGradUAnswer( sot_dim, 0 ), dEdGradU( sot_dim * sot_dim, 0 );
+
+        for ( unsigned int i = 0; i < sot_dim; i++ ){
+
+            for ( unsigned int j = 0; j < sot_dim; j++ ){
+
+                for ( unsigned int k = 0; k < sot_dim; k++ ){
+
+                    dEdGradU[ sot_dim * i + k ] += dEdF[ sot_dim * i + j ] * dFdGradU[ sot_dim * j + k ];
+
+                }
+
+            }
+
+        }
+
+        for ( unsigned int i = 0; i < sot_dim; i++ ){
+
+            for ( unsigned int j = 0; j < sot_dim; j++ ){
+
+                dJdGradUAnswer[ j ] += dJdE[ i ] * dEdGradU[ sot_dim * i + j ];
+
+                for ( unsigned int k = 0; k < sot_dim; k++ ){
+
+                    dEbardGradUAnswer[ sot_dim * i + k ] += dEbardE[ sot_dim * i + j ] * dEdGradU[ sot_dim * j + k ];
+
+                }
+
+            }
+
+        }
+
+        floatVector resultF, resultE, resultEbar, dEbardGradU, dJdGradU;
+
+        floatType resultJ;
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::computeIsochoricKinematics( gradU, resultF, resultE, resultEbar, resultJ, isCurrent ) );
+
+        BOOST_TEST( resultF == F, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( resultE == E, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( resultEbar == Ebar, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( resultJ == J );
+
+        resultF.clear( );
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::computeIsochoricKinematics( gradU, resultF, resultE, resultEbar, resultJ, dEbardGradU, dJdGradU, isCurrent ) );
+
+        BOOST_TEST( resultF == F, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( resultEbar == Ebar, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( resultJ == J );
+
+        BOOST_TEST( dEbardGradU == dEbardGradUAnswer, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( dJdGradU == dJdGradUAnswer, CHECK_PER_ELEMENT );
+
+    }
+
+    floatVector inverted = { -2, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+    floatVector F, E, Ebar;
+
+    floatType J;
+
+    BOOST_CHECK_THROW( tardigradeConstitutiveTools::computeIsochoricKinematics( inverted, F, E, Ebar, J, false ), std::exception );
+
+}
+
+BOOST_AUTO_TEST_CASE( testMapPK2toCauchy, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the mapping of the PK2 stress from the reference
+     * configuration to the current configuration.
+     */
+
+    floatVector F = { 1.96469186, -2.13860665, -2.73148546,
+                      0.51314769,  2.1946897,  -0.7689354,
+                      4.80764198,  1.84829739, -0.19068099 };
+
+    floatVector PK2 = { -1.07882482, -1.56821984,  2.29049707,
+                        -0.61427755, -4.40322103, -1.01955745,
+                         2.37995406, -3.1750827,  -3.24548244 };
+
+    floatVector cauchy;
+
+    floatVector cauchy_answer = { -2.47696057,  0.48015011, -0.28838671,
+                                   0.16490963, -0.57481137, -0.92071407,
+                                  -0.21450698, -1.22714923, -1.73532173 };
+
+    errorOut error = tardigradeConstitutiveTools::mapPK2toCauchy( PK2, F, cauchy );
 
     BOOST_CHECK( ! error );
 
-    BOOST_TEST( thermalExpansion == answer, CHECK_PER_ELEMENT );
+    BOOST_TEST( cauchy == cauchy_answer, CHECK_PER_ELEMENT );
+
+}
+
+BOOST_AUTO_TEST_CASE( testWLF, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the computation of the WLF function.
+     */
+
+    floatType T = 145.;
+    floatType Tr = 27.5;
+    floatType C1 = 18.2;
+    floatType C2 = 282.7;
+
+    floatType factor, dfactordT;
+
+    floatVector WLFParameters { Tr, C1, C2 };
+
+    tardigradeConstitutiveTools::WLF( T, WLFParameters, factor );
+
+    BOOST_TEST( factor == pow( 10, -C1*( T - Tr )/( C2 + ( T - Tr ) ) ) );
+
+    floatType factor2;
+    tardigradeConstitutiveTools::WLF( T, WLFParameters, factor2, dfactordT );
+
+    BOOST_TEST( factor == factor2 );
+
+    floatType delta = fabs( 1e-6*T );
+    floatType fp, fm;
+    tardigradeConstitutiveTools::WLF( T + delta, WLFParameters, fp );
+    tardigradeConstitutiveTools::WLF( T - delta, WLFParameters, fm );
+
+    BOOST_TEST( dfactordT == ( fp - fm )/(2*delta) );
+
+}
+
+BOOST_AUTO_TEST_CASE( testComputeDGreenLagrangeStrainDF, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the computation of the gradient of the Green-Lagrange
+     * strain w.r.t. the deformation gradient.
+     */
+
+    floatVector F = { 0.69646919, 0.28613933, 0.22685145,
+                      0.55131477, 0.71946897, 0.42310646,
+                      0.98076420, 0.68482974, 0.4809319 };
+
+    floatMatrix dEdF;
+
+    errorOut error = tardigradeConstitutiveTools::computeDGreenLagrangeStrainDF( F, dEdF );
+
+    BOOST_CHECK( ! error );
+
+    floatVector E, E2;
+    error = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, E );
+
+    BOOST_CHECK( ! error );
 
-    floatVector thermalExpansionJ, thermalExpansionJp, thermalExpansionJm, thermalExpansionJacobian;
     floatType eps = 1e-6;
-    floatType delta = eps*temperature + eps;
+    for ( unsigned int i=0; i<F.size( ); i++ ){
+        floatVector delta( F.size( ), 0 );
 
-    error = tardigradeConstitutiveTools::quadraticThermalExpansion(      temperature,     referenceTemperature,
-                                                          linearParameters,      quadraticParameters,
-                                                         thermalExpansionJ, thermalExpansionJacobian );
+        delta[ i ] = eps * fabs( F[ i ] ) + eps;
+
+        floatVector Ep, Em;
+        error = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F + delta, Ep );
+
+        BOOST_CHECK( !error );
+
+        error = tardigradeConstitutiveTools::computeGreenLagrangeStrain( F - delta, Em );
+
+        BOOST_CHECK( !error );
+
+        floatVector gradCol = ( Ep - Em )/(2*delta[ i ]);
+
+        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
+            BOOST_TEST( gradCol[ j ] == dEdF[ j ][ i ] );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testMidpointEvolution, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the midpoint evolution algorithm.
+     */
+
+    floatType Dt = 2.5;
+
+    floatVector Ap    = { 9, 10, 11, 12 };
+
+    floatVector DApDt = { 1, 2, 3, 4 };
+
+    floatVector DADt  = { 5, 6, 7, 8 };
+
+    floatVector alphaVec = { 0.1, 0.2, 0.3, 0.4 };
+
+    floatVector dA, A;
+
+    //Test implicit integration
+    errorOut error = tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, 0 );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( dA == Dt * DADt, CHECK_PER_ELEMENT );
+
+    //Test explicit integration
+    error = tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, 1 );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( dA == Dt*DApDt, CHECK_PER_ELEMENT );
+
+    //Test midpoint integration
+    error = tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt, dA, A );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST(  A == Ap + Dt*0.5*( DApDt + DADt ), CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dA == Dt*0.5*( DApDt + DADt ), CHECK_PER_ELEMENT );
+
+    error = tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, alphaVec );
+
+    BOOST_CHECK( ! error );
+
+    floatVector A_answer  = { 20.5, 23., 25.5, 28. };
+    floatVector dA_answer = { 11.5, 13., 14.5, 16. };
+
+    BOOST_TEST( A == A_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dA == dA_answer, CHECK_PER_ELEMENT );
+
+    //Add test for the jacobian
+    floatType eps = 1e-6;
+
+    floatVector A0, Ai, dA0, dAi;
+
+    floatMatrix DADADt;
+
+    error = tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt, dA, A, alphaVec );
+
+    error = tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt, dA0, A0, DADADt, alphaVec );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( A0 == A, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dA0 == dA, CHECK_PER_ELEMENT );
+
+    for ( unsigned int i=0; i<DADt.size( ); i++ ){
+
+        floatVector delta = floatVector( DADt.size( ), 0 );
+
+        delta[ i ] = eps*( DADt[ i ] ) + eps;
+
+        floatVector Aip, Aim, dAip, dAim;
+
+        error = tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt + delta, dAip, Aip, alphaVec );
+
+        BOOST_CHECK( !error );
+
+        error = tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt - delta, dAim, Aim, alphaVec );
+
+        BOOST_CHECK( !error );
+
+        floatVector gradCol = ( Aip - Aim )/(2*delta[ i ]);
+
+        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
+
+            BOOST_TEST( DADADt[ j ][ i ] == gradCol[ j ] );
+
+        }
+
+        gradCol = ( dAip - dAim )/(2*delta[ i ]);
+
+        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
+
+            BOOST_TEST( DADADt[ j ][ i ] == gradCol[ j ] );
+
+        }
+
+    }
+
+    floatVector dA1, A1;
+
+    floatMatrix DADADt1, DADADtp;
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt, dA1, A1, DADADt1, DADADtp, alphaVec ) );
+
+    BOOST_TEST( A1 == A, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dA1 == dA, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( tardigradeVectorTools::appendVectors( DADADt1 ) == tardigradeVectorTools::appendVectors( DADADt ), CHECK_PER_ELEMENT );
+
+    floatMatrix DADADtp_answer( Ap.size( ), floatVector( DApDt.size( ), 0 ) );
+
+    for ( unsigned int i = 0; i < DApDt.size( ); i++ ){
+
+        floatVector delta = floatVector( DApDt.size( ), 0 );
+
+        delta[ i ] = eps * std::fabs( DApDt[ i ] ) + eps;
+
+        floatVector _dAp, _dAm;
+
+        floatVector _Ap, _Am;
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt + delta, DADt, _dAp, _Ap, alphaVec ) );
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt - delta, DADt, _dAm, _Am, alphaVec ) );
+
+        for ( unsigned int j = 0; j < Ap.size( ); j++ ){
+
+            DADADtp_answer[ j ][ i ] = ( _Ap[ j ] - _Am[ j ] ) / ( 2 * delta[ i ] );
+
+            BOOST_TEST( DADADtp_answer[ j ][ i ] == ( _dAp[ j ] - _dAm[ j ] ) / ( 2 * delta[ i ] ) );
+
+        }
+
+    }
+
+    BOOST_TEST( tardigradeVectorTools::appendVectors( DADADtp ) == tardigradeVectorTools::appendVectors( DADADtp_answer ), CHECK_PER_ELEMENT );
+
+}
+
+BOOST_AUTO_TEST_CASE( testMidpointEvolutionDiagonalJ, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the midpoint evolution algorithm which returns the diagonals of the jacobians
+     */
+
+    floatType Dt = 2.5;
+
+    floatVector Ap    = { 9, 10, 11, 12 };
+
+    floatVector DApDt = { 1, 2, 3, 4 };
+
+    floatVector DADt  = { 5, 6, 7, 8 };
+
+    floatVector alphaVec = { 0.1, 0.2, 0.3, 0.4 };
+
+    floatVector dA_answer, A_answer, DADADt_answer, DADADtp_answer;
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::midpointEvolutionFlatJ( Dt, Ap, DApDt, DADt, dA_answer, A_answer, DADADt_answer, DADADtp_answer, alphaVec ) );
+
+    floatVector dA, A, DADADt, DADADtp;
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::midpointEvolutionDiagonalJ( Dt, Ap, DApDt, DADt, dA, A, DADADt, DADADtp, alphaVec ) );
+
+    BOOST_TEST( dA == dA_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( A == A_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( DADADt.size( ) == Ap.size( ) );
+
+    BOOST_TEST( DADADtp.size( ) == Ap.size( ) );
+
+    for ( unsigned int i = 0; i < Ap.size( ); i++ ){
+
+        for ( unsigned int j = 0; j < Ap.size( ); j++ ){
+
+            BOOST_TEST( DADADt_answer[ Ap.size( ) * i + j ] == ( i == j ? DADADt[ i ] : 0. ) );
+
+            BOOST_TEST( DADADtp_answer[ Ap.size( ) * i + j ] == ( i == j ? DADADtp[ i ] : 0. ) );
+
+        }
+
+    }
+
+    floatVector DADADt1;
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::midpointEvolutionDiagonalJ( Dt, Ap, DApDt, DADt, dA, A, DADADt1, alphaVec ) );
+
+    BOOST_TEST( DADADt1 == DADADt, CHECK_PER_ELEMENT );
+
+    //Test the scalar integration parameter
+    BOOST_CHECK( !tardigradeConstitutiveTools::midpointEvolutionFlatJ( Dt, Ap, DApDt, DADt, dA_answer, A_answer, DADADt_answer, DADADtp_answer, 0.3 ) );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::midpointEvolutionDiagonalJ( Dt, Ap, DApDt, DADt, dA, A, DADADt, DADADtp, 0.3 ) );
+
+    BOOST_TEST( dA == dA_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( A == A_answer, CHECK_PER_ELEMENT );
+
+    for ( unsigned int i = 0; i < Ap.size( ); i++ ){
+
+        BOOST_TEST( DADADt[ i ] == DADADt_answer[ Ap.size( ) * i + i ] );
+
+        BOOST_TEST( DADADtp[ i ] == DADADtp_answer[ Ap.size( ) * i + i ] );
+
+    }
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::midpointEvolutionDiagonalJ( Dt, Ap, DApDt, DADt, dA, A, DADADt1, 0.3 ) );
+
+    BOOST_TEST( DADADt1 == DADADt, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK_THROW( tardigradeConstitutiveTools::midpointEvolutionDiagonalJ( Dt, Ap, DApDt, DADt, dA, A, DADADt, 1.5 ), std::exception );
+
+    BOOST_CHECK_THROW( tardigradeConstitutiveTools::midpointEvolutionDiagonalJ( Dt, Ap, floatVector( 3, 0 ), DADt, dA, A, DADADt, 0.5 ), std::exception );
+
+}
+
+BOOST_AUTO_TEST_CASE( testMidpointEvolutionBatched, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the in-place batched midpoint evolution algorithm
+     */
+
+    floatType Dt = 2.5;
+
+    const unsigned int nPoints = 3;
+
+    const unsigned int nStates = 2;
+
+    // State variable i of point p is stored at i * nPoints + p
+    floatVector Ap    = { 9, 10, 11, 12, 13, 14 };
+
+    floatVector DApDt = { 1, 2, 3, 4, 5, 6 };
+
+    floatVector DADt  = { 5, 6, 7, 8, 9, 10 };
+
+    floatVector alpha = { 0.1, 0.7 };
+
+    floatVector A = Ap;
+
+    floatVector dA( Ap.size( ) );
+
+    tardigradeConstitutiveTools::statusCode status;
+
+    tardigradeConstitutiveTools::midpointEvolutionBatched( nPoints, nStates, Dt, DApDt.data( ), DADt.data( ), A.data( ), dA.data( ), alpha.data( ), status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
+
+    for ( unsigned int p = 0; p < nPoints; p++ ){
+
+        floatVector _Ap = { Ap[ p ], Ap[ nPoints + p ] };
+
+        floatVector _DApDt = { DApDt[ p ], DApDt[ nPoints + p ] };
+
+        floatVector _DADt = { DADt[ p ], DADt[ nPoints + p ] };
+
+        floatVector dA_answer, A_answer;
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::midpointEvolution( Dt, _Ap, _DApDt, _DADt, dA_answer, A_answer, alpha ) );
+
+        for ( unsigned int i = 0; i < nStates; i++ ){
+
+            BOOST_TEST( A[ nPoints * i + p ] == A_answer[ i ] );
+
+            BOOST_TEST( dA[ nPoints * i + p ] == dA_answer[ i ] );
+
+        }
+
+    }
+
+    //Test the scalar integration parameter without the change in the values
+    floatVector dA_answer, A_answer;
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::midpointEvolution( Dt, Ap, DApDt, DADt, dA_answer, A_answer, 0.3 ) );
+
+    A = Ap;
+
+    tardigradeConstitutiveTools::midpointEvolutionBatched( Ap.size( ), Dt, DApDt.data( ), DADt.data( ), A.data( ), ( floatType * )nullptr, 0.3, status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
+
+    BOOST_TEST( A == A_answer, CHECK_PER_ELEMENT );
+
+    //Test the single precision kernel
+    std::vector< float > Af( Ap.begin( ), Ap.end( ) ), DApDtf( DApDt.begin( ), DApDt.end( ) ), DADtf( DADt.begin( ), DADt.end( ) );
+
+    tardigradeConstitutiveTools::midpointEvolutionBatched( Af.size( ), 2.5f, DApDtf.data( ), DADtf.data( ), Af.data( ), ( float * )nullptr, 0.3f, status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
+
+    for ( unsigned int i = 0; i < Af.size( ); i++ ){
+
+        BOOST_TEST( Af[ i ] == A_answer[ i ], boost::test_tools::tolerance( 1e-5 ) );
+
+    }
+
+    //Test that invalid integration parameters leave the values unchanged
+    A = Ap;
+
+    alpha[ 1 ] = 1.1;
+
+    tardigradeConstitutiveTools::midpointEvolutionBatched( nPoints, nStates, Dt, DApDt.data( ), DADt.data( ), A.data( ), dA.data( ), alpha.data( ), status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::outOfRange );
+
+    BOOST_TEST( A == Ap, CHECK_PER_ELEMENT );
+
+    tardigradeConstitutiveTools::midpointEvolutionBatched( Ap.size( ), Dt, DApDt.data( ), DADt.data( ), A.data( ), ( floatType * )nullptr, -0.1, status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::outOfRange );
+
+    BOOST_TEST( A == Ap, CHECK_PER_ELEMENT );
+
+}
+
+BOOST_AUTO_TEST_CASE( testComputeDFDt, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the computation of the total time derivative of the
+     * deformation gradient.
+     */
+
+    floatVector F = { 0.69646919, 0.28613933, 0.22685145,
+                      0.55131477, 0.71946897, 0.42310646,
+                      0.98076420, 0.68482974, 0.4809319 };
+
+    floatVector L = { 0.57821272, 0.27720263, 0.45555826,
+                      0.82144027, 0.83961342, 0.95322334,
+                      0.4768852 , 0.93771539, 0.1056616 };
+
+    floatVector answer = { 1.00232848, 0.67686793, 0.46754712,
+                           1.96988645, 1.49191786, 1.00002629,
+                           0.95274131, 0.88347295, 0.55575157 };
+
+    floatVector DFDt;
+
+    errorOut error = tardigradeConstitutiveTools::computeDFDt( L, F, DFDt );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( DFDt == answer, CHECK_PER_ELEMENT );
+
+    //Test the jacobians
+    floatVector DFDtJ;
+    floatMatrix dDFDtdL, dDFDtdF;
+    error = tardigradeConstitutiveTools::computeDFDt( L, F, DFDtJ, dDFDtdL, dDFDtdF );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( DFDt == DFDtJ, CHECK_PER_ELEMENT );
+
+    //Use finite differences to estimate the jacobian
+    floatType eps = 1e-6;
+    for ( unsigned int i=0; i<F.size( ); i++ ){
+
+        //Compute finite difference gradient w.r.t. L
+        floatVector delta( L.size( ), 0 );
+        delta[ i ] = eps*fabs( L[ i ] ) + eps;
+
+        floatVector DFDtp, DFDtm;
+
+        error = tardigradeConstitutiveTools::computeDFDt( L + delta, F, DFDtp );
+
+        BOOST_CHECK( ! error );
+
+        error = tardigradeConstitutiveTools::computeDFDt( L - delta, F, DFDtm );
+
+        BOOST_CHECK( ! error );
+
+        floatVector gradCol = ( DFDtp - DFDtm )/(2*delta[ i ]);
+
+        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
+            BOOST_TEST( dDFDtdL[ j ][ i ] == gradCol[ j ] );
+        }
+
+        //Compute finite difference gradient w.r.t. F
+        delta = floatVector( F.size( ), 0 );
+        delta[ i ] = eps*fabs( F[ i ] ) + eps;
+
+        error = tardigradeConstitutiveTools::computeDFDt( L, F + delta, DFDtp );
+
+        BOOST_CHECK( ! error );
+
+        gradCol = ( DFDtJ - DFDt )/delta[ i ];
+
+        error = tardigradeConstitutiveTools::computeDFDt( L, F - delta, DFDtm );
+
+        BOOST_CHECK( ! error );
+
+        gradCol = ( DFDtp - DFDtm )/(2*delta[ i ]);
+
+        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
+            BOOST_TEST( dDFDtdF[ j ][ i ] == gradCol[ j ] );
+        }
+
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( testEvolveF, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the evolution of the deformation gradient.
+     */
+
+    floatType Dt = 2.7;
+
+    floatVector Fp = { 0.69646919, 0.28613933, 0.22685145,
+                       0.55131477, 0.71946897, 0.42310646,
+                       0.98076420, 0.68482974, 0.4809319 };
+
+    floatVector Lp = { 0.69006282, 0.0462321 , 0.88086378,
+                       0.8153887 , 0.54987134, 0.72085876,
+                       0.66559485, 0.63708462, 0.54378588 };
+
+    floatVector L = { 0.57821272, 0.27720263, 0.45555826,
+                      0.82144027, 0.83961342, 0.95322334,
+                      0.4768852 , 0.93771539, 0.1056616 };
+
+    //Test 1 ( mode 1 fully explicit )
+    floatVector dF, F;
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, F, 1, 1 ) );
+
+    floatVector answer = { 4.39551129, 2.53782698, 1.84614498,
+                           4.81201673, 3.75047725, 2.48674399,
+                           4.62070491, 3.44211354, 2.32252023 };
+
+    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dF, F, 1, 1 ) );
+
+    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( ( answer - Fp ) == dF, CHECK_PER_ELEMENT );
+
+    //Test 2 ( mode 1 fully implicit )
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, F, 0, 1 ) );
+
+    answer = {  0.63522182, -0.1712192 , -0.00846781,
+               -0.81250979, -0.19375022, -0.20193394,
+               -0.36163914, -0.03662069, -0.05769288 };
+
+    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dF, F, 0, 1 ) );
+
+    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( ( answer - Fp ) == dF, CHECK_PER_ELEMENT );
+
+    //Test 3 ( mode 1 midpoint rule )
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, F, 0.5, 1 ) );
+
+    answer = {  0.20004929, -0.4409338 , -0.18955924,
+               -3.59005736, -2.17210401, -1.55661536,
+               -1.88391214, -1.13150095, -0.80579654 };
+
+    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dF, F, 0.5, 1 ) );
+
+    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( ( answer - Fp ) == dF, CHECK_PER_ELEMENT );
+
+    //Tests 4 and 5 ( mode 1 jacobian )
+    floatVector dFJ, FJ;
+    floatMatrix dFdL;
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dFJ, FJ, dFdL, 0.5, 1 ) );
+
+    BOOST_TEST( answer == FJ, CHECK_PER_ELEMENT );
+
+    floatMatrix dFdL_alt, ddFdFp, dFdFp, dFdLp;
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dFJ, FJ, dFdL_alt, ddFdFp, dFdFp, dFdLp, 0.5, 1 ) );
+
+    BOOST_TEST( answer == FJ, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( ( answer - Fp ) == dFJ, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( tardigradeVectorTools::appendVectors( dFdL ) == tardigradeVectorTools::appendVectors( dFdL_alt ), CHECK_PER_ELEMENT );
+
+    floatType eps = 1e-6;
+
+    floatMatrix dFdL_answer( L.size( ), floatVector( L.size( ), 0 ) );
+
+    for ( unsigned int i=0; i<L.size( ); i++ ){
+
+        floatVector delta( L.size( ), 0 );
+        delta[ i ] = eps * std::fabs( L[ i ] ) + eps;
+
+        floatVector _Fp, _Fm;
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L + delta, _Fp, 0.5, 1 ) );
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L - delta, _Fm, 0.5, 1 ) );
+
+        for ( unsigned int j = 0; j < L.size( ); j++ ){
+
+            dFdL_answer[ j ][ i ] = ( _Fp[ j ] - _Fm[ j ] ) / ( 2 * delta[ i ] );
+
+        }
+
+    }
+
+    BOOST_TEST( tardigradeVectorTools::appendVectors( dFdL ) == tardigradeVectorTools::appendVectors( dFdL_answer ), CHECK_PER_ELEMENT );
+
+    floatMatrix dFdFp_answer( answer.size( ), floatVector( Fp.size( ), 0 ) );
+    floatMatrix ddFdFp_answer( answer.size( ), floatVector( Fp.size( ), 0 ) );
+
+    for ( unsigned int i=0; i<Fp.size( ); i++ ){
+
+        floatVector delta( Fp.size( ), 0 );
+        delta[ i ] = eps * std::fabs( Fp[ i ] ) + eps;
+
+        floatVector _Fp, _Fm;
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp + delta, Lp, L, _Fp, 0.5, 1 ) );
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp - delta, Lp, L, _Fm, 0.5, 1 ) );
+
+        for ( unsigned int j = 0; j < L.size( ); j++ ){
+
+            dFdFp_answer[ j ][ i ] = ( _Fp[ j ] - _Fm[ j ] ) / ( 2 * delta[ i ] );
+
+        }
+
+        floatVector _dFp, _dFm;
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp + delta, Lp, L, _dFp, _Fp, 0.5, 1 ) );
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp - delta, Lp, L, _dFm, _Fm, 0.5, 1 ) );
+
+        for ( unsigned int j = 0; j < L.size( ); j++ ){
+
+            ddFdFp_answer[ j ][ i ] = ( _dFp[ j ] - _dFm[ j ] ) / ( 2 * delta[ i ] );
+
+        }
+
+    }
+
+    BOOST_TEST( tardigradeVectorTools::appendVectors( dFdFp ) == tardigradeVectorTools::appendVectors(dFdFp_answer ), CHECK_PER_ELEMENT );
+                                                                                                  
+    BOOST_TEST( tardigradeVectorTools::appendVectors( ddFdFp ) == tardigradeVectorTools::appendVectors( ddFdFp_answer ), CHECK_PER_ELEMENT );
+
+    floatMatrix dFdLp_answer( answer.size( ), floatVector( Lp.size( ), 0 ) );
+
+    for ( unsigned int i=0; i<Lp.size( ); i++ ){
+
+        floatVector delta( Lp.size( ), 0 );
+        delta[ i ] = eps * std::fabs( Lp[ i ] ) + eps;
+
+        floatVector _Fp, _Fm;
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp + delta, L, _Fp, 0.5, 1 ) );
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp - delta, L, _Fm, 0.5, 1 ) );
+
+        for ( unsigned int j = 0; j < L.size( ); j++ ){
+
+            dFdLp_answer[ j ][ i ] = ( _Fp[ j ] - _Fm[ j ] ) / ( 2 * delta[ i ] );
+
+        }
+
+    }
+
+    BOOST_TEST( tardigradeVectorTools::appendVectors( dFdLp ) == tardigradeVectorTools::appendVectors( dFdLp_answer ), CHECK_PER_ELEMENT );
+
+    //Test 6 ( mode 2 fully explicit )
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, F, 1, 2 ) );
+
+    answer = { 3.03173544, 1.1881084 , 2.77327313,
+               3.92282144, 2.58424672, 3.75584617,
+               5.18006647, 2.65125419, 4.85252662 };
+
+    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dF, F, 1, 2 ) );
+
+    BOOST_TEST( ( answer - Fp ) == dF, CHECK_PER_ELEMENT );
+
+    //Test 7 ( mode 2 fully implicit )
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, F, 0, 2 ) );
+
+    answer = {  0.65045472, -0.42475879, -0.09274688,
+               -0.25411831, -0.08867872, -0.16467241,
+                0.45611733, -0.45427799, -0.17799727 };
+
+    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dF, F, 0, 2 ) );
+
+    BOOST_TEST( ( answer - Fp ) == dF, CHECK_PER_ELEMENT );
+
+    //Test 8 ( mode 2 midpoint rule )
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, F, 0.5, 2 ) );
+
+    answer = { -0.02066217, -1.43862233, -0.42448874,
+               -0.96426544, -1.72139966, -0.83831629,
+               -0.59802055, -2.37943476, -0.88998505 };
+
+    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dF, F, 0.5, 2 ) );
+
+    BOOST_TEST( answer == F, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( ( answer - Fp ) == dF, CHECK_PER_ELEMENT );
+
+    //Tests 9 and 10 ( mode 2 jacobian )
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dFJ, FJ, dFdL, 0.5, 2 ) );
+
+    BOOST_TEST( F == FJ, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L, dFJ, FJ, dFdL_alt, ddFdFp, dFdFp, dFdLp, 0.5, 2 ) );
+
+    BOOST_TEST( answer == FJ, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( ( answer - Fp ) == dFJ, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( tardigradeVectorTools::appendVectors( dFdL ) == tardigradeVectorTools::appendVectors( dFdL_alt ), CHECK_PER_ELEMENT );
+
+    dFdL_answer = floatMatrix( Fp.size( ), floatVector( L.size( ), 0 ) );
+
+    for ( unsigned int i=0; i<L.size( ); i++ ){
+
+        floatVector delta( L.size( ), 0 );
+        delta[ i ] = eps * std::fabs( L[ i ] ) + eps;
+
+        floatVector _Fp, _Fm;
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L + delta, _Fp, 0.5, 2 ) );
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp, L - delta, _Fm, 0.5, 2 ) );
+
+        for ( unsigned int j = 0; j < L.size( ); j++ ){
+
+            dFdL_answer[ j ][ i ] = ( _Fp[ j ] - _Fm[ j ] ) / ( 2 * delta[ i ] );
+
+        }
+
+    }
+
+    BOOST_TEST( tardigradeVectorTools::appendVectors( dFdL ) == tardigradeVectorTools::appendVectors( dFdL_answer ), CHECK_PER_ELEMENT );
+
+    dFdFp_answer = floatMatrix( answer.size( ), floatVector( Fp.size( ), 0 ) );
+    ddFdFp_answer = floatMatrix( answer.size( ), floatVector( Fp.size( ), 0 ) );
+
+    for ( unsigned int i=0; i<Fp.size( ); i++ ){
+
+        floatVector delta( Fp.size( ), 0 );
+        delta[ i ] = eps * std::fabs( Fp[ i ] ) + eps;
+
+        floatVector _Fp, _Fm;
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp + delta, Lp, L, _Fp, 0.5, 2 ) );
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp - delta, Lp, L, _Fm, 0.5, 2 ) );
+
+        for ( unsigned int j = 0; j < L.size( ); j++ ){
+
+            dFdFp_answer[ j ][ i ] = ( _Fp[ j ] - _Fm[ j ] ) / ( 2 * delta[ i ] );
+
+        }
+
+        floatVector _dFp, _dFm;
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp + delta, Lp, L, _dFp, _Fp, 0.5, 2 ) );
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp - delta, Lp, L, _dFm, _Fm, 0.5, 2 ) );
+
+        for ( unsigned int j = 0; j < L.size( ); j++ ){
+
+            ddFdFp_answer[ j ][ i ] = ( _dFp[ j ] - _dFm[ j ] ) / ( 2 * delta[ i ] );
+
+        }
+
+    }
+
+    BOOST_TEST( tardigradeVectorTools::appendVectors( dFdFp ) == tardigradeVectorTools::appendVectors( dFdFp_answer ), CHECK_PER_ELEMENT );
+
+    BOOST_TEST( tardigradeVectorTools::appendVectors( ddFdFp ) == tardigradeVectorTools::appendVectors( ddFdFp_answer ), CHECK_PER_ELEMENT );
+
+    dFdLp_answer = floatMatrix( answer.size( ), floatVector( Lp.size( ), 0 ) );
+
+    for ( unsigned int i=0; i<Lp.size( ); i++ ){
+
+        floatVector delta( Lp.size( ), 0 );
+        delta[ i ] = eps * std::fabs( Lp[ i ] ) + eps;
+
+        floatVector _Fp, _Fm;
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp + delta, L, _Fp, 0.5, 2 ) );
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveF( Dt, Fp, Lp - delta, L, _Fm, 0.5, 2 ) );
+
+        for ( unsigned int j = 0; j < L.size( ); j++ ){
+
+            dFdLp_answer[ j ][ i ] = ( _Fp[ j ] - _Fm[ j ] ) / ( 2 * delta[ i ] );
+
+        }
+
+    }
+
+    BOOST_TEST( tardigradeVectorTools::appendVectors( dFdLp ) == tardigradeVectorTools::appendVectors( dFdLp_answer ), CHECK_PER_ELEMENT );
+
+}
+
+BOOST_AUTO_TEST_CASE( testEvolveFJvpVjp, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the Jacobian-vector and vector-Jacobian products of evolveF against the dense Jacobians
+     */
+
+    floatType Dt = 2.7;
+
+    floatType alpha = 0.37;
+
+    floatVector Fp = { 0.69646919, 0.28613933, 0.22685145,
+                       0.55131477, 0.71946897, 0.42310646,
+                       0.98076420, 0.68482974, 0.4809319 };
+
+    floatVector Lp = { 0.57821272, 0.27720263, 0.45555826,
+                       0.82144027, 0.83961342, 0.95322334,
+                       0.4768852 , 0.93771539, 0.1056616 };
+
+    floatVector L = { 0.03820264, 0.78457391, 0.56931064,
+                      0.42002558, 0.46530585, 0.79290119,
+                      0.31683773, 0.91620386, 0.72346014 };
+
+    // Two stacked directions
+    floatVector deltaL = { 0.1, -0.2, 0.3, 0.4, -0.5, 0.6, -0.7, 0.8, 0.9,
+                           0.5, 0.2, -0.1, 0.3, 0.7, -0.4, 0.2, -0.6, 0.8 };
+
+    floatVector deltaFp = { -0.3, 0.1, 0.2, 0.5, 0.4, -0.6, 0.7, -0.1, 0.3,
+                            0.2, 0.9, 0.1, -0.4, 0.3, 0.6, -0.2, 0.5, -0.7 };
+
+    floatVector deltaLp = { 0.6, 0.3, -0.2, 0.1, -0.8, 0.4, 0.2, 0.5, -0.9,
+                            -0.1, 0.4, 0.3, 0.8, -0.2, 0.1, 0.6, -0.3, 0.2 };
+
+    for ( unsigned int mode = 1; mode < 3; mode++ ){
+
+        floatVector F_answer, dFdL, dFdFp, dFdLp;
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveFFlatJ( Dt, Fp, Lp, L, F_answer, dFdL, dFdFp, dFdLp, alpha, mode ) );
+
+        floatVector deltaF_answer( deltaL.size( ), 0 );
+
+        floatVector deltaFL_answer( deltaL.size( ), 0 );
+
+        floatVector vdFdL_answer( deltaL.size( ), 0 );
+
+        floatVector vdFdFp_answer( deltaL.size( ), 0 );
+
+        floatVector vdFdLp_answer( deltaL.size( ), 0 );
+
+        for ( unsigned int d = 0; d < 2; d++ ){
+
+            for ( unsigned int i = 0; i < 9; i++ ){
+
+                for ( unsigned int j = 0; j < 9; j++ ){
+
+                    deltaFL_answer[ 9 * d + i ] += dFdL[ 9 * i + j ] * deltaL[ 9 * d + j ];
+
+                    deltaF_answer[ 9 * d + i ] += dFdL[ 9 * i + j ] * deltaL[ 9 * d + j ]
+                                                + dFdFp[ 9 * i + j ] * deltaFp[ 9 * d + j ]
+                                                + dFdLp[ 9 * i + j ] * deltaLp[ 9 * d + j ];
+
+                    vdFdL_answer[ 9 * d + j ] += deltaL[ 9 * d + i ] * dFdL[ 9 * i + j ];
+
+                    vdFdFp_answer[ 9 * d + j ] += deltaL[ 9 * d + i ] * dFdFp[ 9 * i + j ];
+
+                    vdFdLp_answer[ 9 * d + j ] += deltaL[ 9 * d + i ] * dFdLp[ 9 * i + j ];
+
+                }
+
+            }
+
+        }
+
+        floatVector F, deltaF;
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveFJvp( Dt, Fp, Lp, L, deltaL, F, deltaF, alpha, mode ) );
+
+        BOOST_TEST( F == F_answer, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( deltaF == deltaFL_answer, CHECK_PER_ELEMENT );
+
+        F.clear( );
+
+        deltaF.clear( );
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveFJvp( Dt, Fp, Lp, L, deltaL, deltaFp, deltaLp, F, deltaF, alpha, mode ) );
+
+        BOOST_TEST( F == F_answer, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( deltaF == deltaF_answer, CHECK_PER_ELEMENT );
+
+        floatVector vdFdL, vdFdFp, vdFdLp;
+
+        F.clear( );
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveFVjp( Dt, Fp, Lp, L, deltaL, F, vdFdL, alpha, mode ) );
+
+        BOOST_TEST( F == F_answer, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( vdFdL == vdFdL_answer, CHECK_PER_ELEMENT );
+
+        F.clear( );
+
+        vdFdL.clear( );
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::evolveFVjp( Dt, Fp, Lp, L, deltaL, F, vdFdL, vdFdFp, vdFdLp, alpha, mode ) );
+
+        BOOST_TEST( F == F_answer, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( vdFdL == vdFdL_answer, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( vdFdFp == vdFdFp_answer, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( vdFdLp == vdFdLp_answer, CHECK_PER_ELEMENT );
+
+    }
+
+    floatVector F, deltaF;
+
+    floatVector badDirection = { 1, 2, 3 };
+
+    BOOST_REQUIRE_THROW( tardigradeConstitutiveTools::evolveFJvp( Dt, Fp, Lp, L, badDirection, F, deltaF, alpha, 1 ), std::nested_exception );
+
+}
+
+template< class C >
+void checkEvolveFConfiguration( ){
+    /*!
+     * Check the configuration templated evolveF against the runtime mode overloads
+     */
+
+    floatType Dt = 2.7;
+
+    floatType alpha = 0.37;
+
+    floatVector Fp = { 0.69646919, 0.28613933, 0.22685145,
+                       0.55131477, 0.71946897, 0.42310646,
+                       0.98076420, 0.68482974, 0.4809319 };
+
+    floatVector Lp = { 0.57821272, 0.27720263, 0.45555826,
+                       0.82144027, 0.83961342, 0.95322334,
+                       0.4768852 , 0.93771539, 0.1056616 };
+
+    floatVector L = { 0.03820264, 0.78457391, 0.56931064,
+                      0.42002558, 0.46530585, 0.79290119,
+                      0.31683773, 0.91620386, 0.72346014 };
+
+    floatVector dF_answer, F_answer, dFdL_answer, ddFdFp_answer, dFdFp_answer, dFdLp_answer;
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveFFlatJ( Dt, Fp, Lp, L, dF_answer, F_answer, dFdL_answer, ddFdFp_answer, dFdFp_answer, dFdLp_answer,
+                                                             alpha, C::mode ) );
+
+    floatSecondOrderTensor _Fp, _Lp, _L;
+
+    std::copy( Fp.begin( ), Fp.end( ), _Fp.begin( ) );
+
+    std::copy( Lp.begin( ), Lp.end( ), _Lp.begin( ) );
+
+    std::copy( L.begin( ), L.end( ), _L.begin( ) );
+
+    floatSecondOrderTensor dF, F;
+
+    floatFourthOrderTensor dFdL, ddFdFp, dFdFp, dFdLp;
+
+    tardigradeConstitutiveTools::evolveF< C >( Dt, _Fp, _Lp, _L, dF, F, alpha );
+
+    BOOST_TEST( dF == dF_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( F == F_answer, CHECK_PER_ELEMENT );
+
+    tardigradeConstitutiveTools::evolveF< C >( Dt, _Fp, _Lp, _L, dF, F, dFdL, alpha );
+
+    BOOST_TEST( F == F_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dFdL == dFdL_answer, CHECK_PER_ELEMENT );
+
+    tardigradeConstitutiveTools::evolveF< C >( Dt, _Fp, _Lp, _L, dF, F, dFdL, ddFdFp, dFdFp, dFdLp, alpha );
+
+    BOOST_TEST( F == F_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dFdL == dFdL_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( ddFdFp == ddFdFp_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dFdFp == dFdFp_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dFdLp == dFdLp_answer, CHECK_PER_ELEMENT );
+
+    // The single precision kernels
+    std::array< float, 9 > fFp, fLp, fL, fdF, fF;
+
+    std::copy( Fp.begin( ), Fp.end( ), fFp.begin( ) );
+
+    std::copy( Lp.begin( ), Lp.end( ), fLp.begin( ) );
+
+    std::copy( L.begin( ), L.end( ), fL.begin( ) );
+
+    tardigradeConstitutiveTools::evolveF< C >( float( Dt ), fFp, fLp, fL, fdF, fF, float( alpha ) );
+
+    for ( unsigned int i = 0; i < 9; i++ ){
+
+        BOOST_TEST( fF[ i ] == F_answer[ i ], boost::test_tools::tolerance( 1e-4 ) );
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( testEvolveFConfigurations, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the compile-time configuration versions of evolveF
+     */
+
+    checkEvolveFConfiguration< tardigradeConstitutiveTools::currentConfiguration >( );
+
+    checkEvolveFConfiguration< tardigradeConstitutiveTools::referenceConfiguration >( );
+
+}
+
+template< class C >
+void checkEvolveFAdaptive( ){
+    /*!
+     * Check the adaptive sub-stepping of evolveF for the configuration C
+     */
+
+    floatType alpha = 0.5;
+
+    floatSecondOrderTensor Fp = { 0.69646919, 0.28613933, 0.22685145,
+                                  0.55131477, 0.71946897, 0.42310646,
+                                  0.98076420, 0.68482974, 0.4809319 };
+
+    floatSecondOrderTensor Lp = { 0.57821272, 0.27720263, 0.45555826,
+                                  0.82144027, 0.83961342, 0.95322334,
+                                  0.4768852 , 0.93771539, 0.1056616 };
+
+    floatSecondOrderTensor L = { 0.03820264, 0.78457391, 0.56931064,
+                                 0.42002558, 0.46530585, 0.79290119,
+                                 0.31683773, 0.91620386, 0.72346014 };
+
+    tardigradeConstitutiveTools::statusCode status;
+
+    unsigned int nSubsteps;
+
+    floatSecondOrderTensor F;
+
+    // A small step is taken as two half steps without refinement
+    floatType Dt = 1e-3;
+
+    tardigradeConstitutiveTools::evolveFAdaptive< C >( Dt, Fp, Lp, L, F, nSubsteps, status, alpha );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
+
+    BOOST_CHECK( nSubsteps == 1 );
+
+    floatSecondOrderTensor Lm, dF, Fm, F_answer;
+
+    for ( unsigned int i = 0; i < 9; i++ ){ Lm[ i ] = 0.5 * ( Lp[ i ] + L[ i ] ); }
+
+    tardigradeConstitutiveTools::evolveF< C >( 0.5 * Dt, Fp, Lp, Lm, dF, Fm, alpha );
+
+    tardigradeConstitutiveTools::evolveF< C >( 0.5 * Dt, Fm, Lm, L, dF, F_answer, alpha );
+
+    BOOST_TEST( F == F_answer, CHECK_PER_ELEMENT );
+
+    // A large step is refined and agrees with many uniform steps
+    Dt = 0.5;
+
+    tardigradeConstitutiveTools::evolveFAdaptive< C >( Dt, Fp, Lp, L, F, nSubsteps, status, alpha, 1e-9, 1000 );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
+
+    BOOST_CHECK( nSubsteps > 1 );
+
+    const unsigned int nUniform = 20000;
+
+    F_answer = Fp;
+
+    for ( unsigned int n = 0; n < nUniform; n++ ){
+
+        floatSecondOrderTensor La, Lb, Fn = F_answer;
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            La[ i ] = Lp[ i ] + floatType( n ) / nUniform * ( L[ i ] - Lp[ i ] );
+
+            Lb[ i ] = Lp[ i ] + floatType( n + 1 ) / nUniform * ( L[ i ] - Lp[ i ] );
+
+        }
+
+        tardigradeConstitutiveTools::evolveF< C >( Dt / nUniform, Fn, La, Lb, dF, F_answer, alpha );
+
+    }
+
+    BOOST_TEST( F == F_answer, CHECK_PER_ELEMENT );
+
+    // The Jacobians are chained through the substeps
+    floatFourthOrderTensor dFdL, dFdFp, dFdLp;
+
+    floatSecondOrderTensor FJ;
+
+    unsigned int nSubstepsJ;
+
+    tardigradeConstitutiveTools::evolveFAdaptive< C >( Dt, Fp, Lp, L, FJ, dFdL, dFdFp, dFdLp, nSubstepsJ, status, alpha, 1e-4 );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
+
+    BOOST_CHECK( nSubstepsJ > 1 );
+
+    floatType eps = 1e-6;
+
+    for ( unsigned int i = 0; i < 9; i++ ){
+
+        floatFourthOrderTensor *jacobians[ 3 ] = { &dFdL, &dFdFp, &dFdLp };
+
+        for ( unsigned int v = 0; v < 3; v++ ){
+
+            floatSecondOrderTensor _Fp = Fp, _Lp = Lp, _L = L, _Fm = Fp, _Lpm = Lp, _Lm = L, Fplus, Fminus;
+
+            floatSecondOrderTensor *plus[ 3 ] = { &_L, &_Fp, &_Lp };
+
+            floatSecondOrderTensor *minus[ 3 ] = { &_Lm, &_Fm, &_Lpm };
+
+            floatType delta = eps * std::fabs( ( *plus[ v ] )[ i ] ) + eps;
+
+            ( *plus[ v ] )[ i ] += delta;
+
+            ( *minus[ v ] )[ i ] -= delta;
+
+            unsigned int _nSubsteps;
+
+            tardigradeConstitutiveTools::evolveFAdaptive< C >( Dt, _Fp, _Lp, _L, Fplus, _nSubsteps, status, alpha, 1e-4 );
+
+            tardigradeConstitutiveTools::evolveFAdaptive< C >( Dt, _Fm, _Lpm, _Lm, Fminus, _nSubsteps, status, alpha, 1e-4 );
+
+            for ( unsigned int j = 0; j < 9; j++ ){
+
+                BOOST_TEST( ( *jacobians[ v ] )[ 9 * j + i ] == ( Fplus[ j ] - Fminus[ j ] ) / ( 2 * delta ) );
+
+            }
+
+        }
+
+    }
+
+    // Too few substeps are reported through the status
+    tardigradeConstitutiveTools::evolveFAdaptive< C >( Dt, Fp, Lp, L, F, nSubsteps, status, alpha, 1e-6, 1 );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::notConverged );
+
+    // The runtime mode overloads
+    floatVector _Fp( Fp.begin( ), Fp.end( ) ), _Lp( Lp.begin( ), Lp.end( ) ), _L( L.begin( ), L.end( ) );
+
+    floatVector FVector, FVectorJ, dFdLVector, dFdFpVector, dFdLpVector;
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveFAdaptive( Dt, _Fp, _Lp, _L, FVector, nSubsteps, alpha, C::mode, 1e-4 ) );
+
+    BOOST_CHECK( nSubsteps == nSubstepsJ );
+
+    BOOST_TEST( FVector == FJ, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::evolveFAdaptiveFlatJ( Dt, _Fp, _Lp, _L, FVectorJ, dFdLVector, dFdFpVector, dFdLpVector, nSubsteps,
+                                                                     alpha, C::mode, 1e-4 ) );
+
+    BOOST_TEST( FVectorJ == FJ, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dFdLVector == dFdL, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dFdFpVector == dFdFp, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dFdLpVector == dFdLp, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK_THROW( tardigradeConstitutiveTools::evolveFAdaptive( Dt, _Fp, _Lp, _L, FVector, nSubsteps, alpha, C::mode, 1e-6, 1 ), std::exception );
+
+}
+
+BOOST_AUTO_TEST_CASE( testEvolveFAdaptive, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the adaptive sub-stepping of evolveF
+     */
+
+    checkEvolveFAdaptive< tardigradeConstitutiveTools::currentConfiguration >( );
+
+    checkEvolveFAdaptive< tardigradeConstitutiveTools::referenceConfiguration >( );
+
+}
+
+BOOST_AUTO_TEST_CASE( testMac, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the computation of the Macullay brackets.
+     */
+
+    floatType x = 1;
+    BOOST_TEST( tardigradeConstitutiveTools::mac( x ) == x );
+
+    x = -1;
+    BOOST_TEST( tardigradeConstitutiveTools::mac( x ) == 0. );
+
+    floatType xJ = 2;
+    floatType dmacdx;
+    BOOST_TEST( tardigradeConstitutiveTools::mac( xJ ) == tardigradeConstitutiveTools::mac( xJ, dmacdx ) );
+
+    BOOST_TEST( dmacdx == 1. );
+
+    xJ = -2;
+    BOOST_TEST( tardigradeConstitutiveTools::mac( xJ ) == tardigradeConstitutiveTools::mac( xJ, dmacdx ) );
+
+    BOOST_TEST( dmacdx == 0. );
+
+}
+
+BOOST_AUTO_TEST_CASE( testComputeUnitNormal, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the computation of the unit normal.
+     */
+
+    floatVector A = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    floatVector Anorm;
+
+    errorOut error = tardigradeConstitutiveTools::computeUnitNormal( A, Anorm );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_CHECK( tardigradeVectorTools::inner( Anorm, Anorm ) == 1. );
+
+    //Check the jacobian
+    floatVector AnormJ;
+    floatMatrix dAnormdA;
+
+    error = tardigradeConstitutiveTools::computeUnitNormal( A, AnormJ, dAnormdA );
+
+    BOOST_CHECK( ! error );
+
+    //Check the normalized value
+    BOOST_TEST( AnormJ == Anorm, CHECK_PER_ELEMENT );
+
+    //Check the gradient
+    floatType eps = 1e-6;
+    for ( unsigned int i=0; i<A.size( ); i++ ){
+        floatVector delta( A.size( ), 0 );
+        delta[ i ] = eps*fabs( A[ i ] ) + eps;
+
+        floatVector Anormp, Anormm;
+        error = tardigradeConstitutiveTools::computeUnitNormal( A + delta, Anormp );
+
+        BOOST_CHECK( ! error );
+
+        error = tardigradeConstitutiveTools::computeUnitNormal( A - delta, Anormm );
+
+        BOOST_CHECK( ! error );
+
+        floatVector gradCol = ( Anormp - Anormm )/(2*delta[ i ]);
+
+        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
+            BOOST_TEST( dAnormdA[ j ][ i ] == gradCol[ j ] );
+        }
+    }
+
+    A = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+    error = tardigradeConstitutiveTools::computeUnitNormal( A, Anorm );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( Anorm == A, CHECK_PER_ELEMENT );
+
+    error = tardigradeConstitutiveTools::computeUnitNormal( A, Anorm, dAnormdA );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( Anorm == A, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( std::isnan( tardigradeVectorTools::l2norm( dAnormdA ) ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( testPullBackVelocityGradient, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the pull back operation on the velocity gradient.
+     */
+
+    floatVector velocityGradient = { 0.69006282, 0.0462321 , 0.88086378,
+                                     0.8153887 , 0.54987134, 0.72085876,
+                                     0.66559485, 0.63708462, 0.54378588 };
+
+    floatVector deformationGradient = { 0.69646919, 0.28613933, 0.22685145,
+                                        0.55131477, 0.71946897, 0.42310646,
+                                        0.98076420, 0.68482974, 0.4809319 };
+
+    floatVector pullBackL;
+    floatVector expectedPullBackL = {   6.32482111,   3.11877752,   2.43195977,
+                                       20.19439192,  10.22175689,   7.88052809,
+                                      -38.85113898, -18.79212468, -14.76285795 };
+
+    errorOut error = tardigradeConstitutiveTools::pullBackVelocityGradient( velocityGradient, deformationGradient, pullBackL );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( pullBackL == expectedPullBackL, CHECK_PER_ELEMENT );
+
+    floatVector pullBackLJ;
+    floatMatrix dpbLdL, dpbLdF;
+
+    //Test of the jacobian
+    error = tardigradeConstitutiveTools::pullBackVelocityGradient( velocityGradient, deformationGradient, pullBackLJ,
+                                                        dpbLdL, dpbLdF );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( pullBackL == pullBackLJ, CHECK_PER_ELEMENT );
+
+    //Check dpbLdL
+    floatType eps = 1e-6;
+    for ( unsigned int i=0; i<velocityGradient.size( ); i++ ){
+        floatVector delta( velocityGradient.size( ), 0 );
+        delta[ i ] = eps*fabs( velocityGradient[ i ] ) + eps;
+
+        floatVector Lp, Lm;
+
+        error = tardigradeConstitutiveTools::pullBackVelocityGradient( velocityGradient + delta, deformationGradient, Lp );
+
+        BOOST_CHECK( ! error );
+
+        error = tardigradeConstitutiveTools::pullBackVelocityGradient( velocityGradient - delta, deformationGradient, Lm );
+
+        BOOST_CHECK( ! error );
+
+        floatVector gradCol = ( Lp - Lm )/(2*delta[ i ]);
+
+        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
+            BOOST_TEST( gradCol[ j ] == dpbLdL[ j ][ i ] );
+        }
+    }
+
+    //Check dpbLdF
+    for ( unsigned int i=0; i<deformationGradient.size( ); i++ ){
+        floatVector delta( deformationGradient.size( ), 0 );
+        delta[ i ] = eps*fabs( deformationGradient[ i ] ) + eps;
+
+        floatVector Lp, Lm;
+
+        error = tardigradeConstitutiveTools::pullBackVelocityGradient( velocityGradient, deformationGradient + delta, Lp );
+
+        BOOST_CHECK( ! error );
+
+        error = tardigradeConstitutiveTools::pullBackVelocityGradient( velocityGradient, deformationGradient - delta, Lm );
+
+        BOOST_CHECK( ! error );
+
+        floatVector gradCol = ( Lp - Lm )/(2*delta[ i ]);
+
+        for ( unsigned int j=0; j<gradCol.size( ); j++ ){
+            BOOST_TEST( gradCol[ j ] == dpbLdF[ j ][ i ] );
+        }
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( testQuadraticThermalExpansion, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the computation of the thermal expansion using a
+     * quadratic form.
+     */
+
+    floatType temperature = 283.15;
+    floatType referenceTemperature = 273.15;
+
+    floatVector linearParameters = { 1, 2, 3, 4 };
+    floatVector quadraticParameters = { 5, 6, 7, 8 };
+
+    floatVector answer = { 27825., 33398., 38971., 44544. };
+
+    floatVector thermalExpansion;
+    errorOut error = tardigradeConstitutiveTools::quadraticThermalExpansion(     temperature, referenceTemperature,
+                                                                  linearParameters,  quadraticParameters,
+                                                                  thermalExpansion );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( thermalExpansion == answer, CHECK_PER_ELEMENT );
+
+    floatVector thermalExpansionJ, thermalExpansionJp, thermalExpansionJm, thermalExpansionJacobian;
+    floatType eps = 1e-6;
+    floatType delta = eps*temperature + eps;
+
+    error = tardigradeConstitutiveTools::quadraticThermalExpansion(      temperature,     referenceTemperature,
+                                                          linearParameters,      quadraticParameters,
+                                                         thermalExpansionJ, thermalExpansionJacobian );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( thermalExpansionJ == answer, CHECK_PER_ELEMENT );
+
+    error = tardigradeConstitutiveTools::quadraticThermalExpansion( temperature + delta,   referenceTemperature,
+                                                             linearParameters,    quadraticParameters,
+                                                            thermalExpansionJp );
+
+    BOOST_CHECK( ! error );
+    
+    error = tardigradeConstitutiveTools::quadraticThermalExpansion( temperature - delta,   referenceTemperature,
+                                                             linearParameters,    quadraticParameters,
+                                                            thermalExpansionJm );
+
+    BOOST_CHECK( ! error );
+
+
+    BOOST_TEST( thermalExpansionJacobian == ( thermalExpansionJp - thermalExpansionJm )/(2 * delta), CHECK_PER_ELEMENT );
+
+}
+
+BOOST_AUTO_TEST_CASE( testPushForwardGreenLagrangeStrain, * boost::unit_test::tolerance( 1e-4 ) ){
+    /*!
+     * Test the push-forward operation on the Green-Lagrange strain.
+     */
+
+    floatVector deformationGradient = {  0.30027935, -0.72811411,  0.26475099,
+                                         1.2285819 ,  0.57663593,  1.43113814,
+                                        -0.45871432,  0.2175795 ,  0.54013937 };
+
+    floatVector greenLagrangeStrain;
+    errorOut error = tardigradeConstitutiveTools::computeGreenLagrangeStrain( deformationGradient, greenLagrangeStrain );
+
+    BOOST_CHECK( ! error );
+
+    floatVector almansiStrain = { -0.33393717,  0.0953188 , -0.29053383,
+                                   0.0953188 ,  0.35345526,  0.11588247,
+                                  -0.29053383,  0.11588247, -0.56150741 };
+
+    floatVector result;
+    error = tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( greenLagrangeStrain, deformationGradient,
+                                                              result );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( result == almansiStrain, CHECK_PER_ELEMENT );
+
+    //Test the jacobian
+    floatVector resultJ;
+    floatMatrix dedE, dedF;
+    error = tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( greenLagrangeStrain, deformationGradient,
+                                                              resultJ, dedE, dedF );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( result == resultJ, CHECK_PER_ELEMENT );
+
+    //Check dedE
+    floatType eps = 1e-6;
+    for ( unsigned int i=0; i<greenLagrangeStrain.size( ); i++ ){
+        floatVector delta( greenLagrangeStrain.size( ), 0 );
+        delta[ i ] = eps*fabs( greenLagrangeStrain[ i ] ) + eps;
+
+        floatVector Rp, Rm;
+
+        error = tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( greenLagrangeStrain + delta, deformationGradient, Rp );
+
+        BOOST_CHECK( ! error );
+
+        error = tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( greenLagrangeStrain - delta, deformationGradient, Rm );
+
+        BOOST_CHECK( ! error );
+
+        floatVector grad = ( Rp - Rm )/(2*delta[ i ]);
+
+        for ( unsigned int j=0; j<grad.size( ); j++ ){
+            BOOST_TEST( grad[ j ] == dedE[ j ][ i ] );
+        }
+    }
+
+    //Check dedF
+    for ( unsigned int i=0; i<deformationGradient.size( ); i++ ){
+        floatVector delta( deformationGradient.size( ), 0 );
+        delta[ i ] = eps*fabs( deformationGradient[ i ] ) + eps;
+
+        floatVector Rp, Rm;
+
+        error = tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( greenLagrangeStrain, deformationGradient + delta, Rp );
+
+        BOOST_CHECK( ! error );
+
+        error = tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( greenLagrangeStrain, deformationGradient - delta, Rm );
+
+        BOOST_CHECK( ! error );
+
+        floatVector grad = ( Rp - Rm )/(2*delta[ i ]);
+
+        for ( unsigned int j=0; j<grad.size( ); j++ ){
+            BOOST_TEST( grad[ j ] == dedF[ j ][ i ] );
+        }
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( testPullBackAlmansiStrain, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the pull-back operation on the Green-Lagrange strain.
+     */
+
+    floatVector deformationGradient = {  0.1740535 ,  1.2519364 , -0.9531442 ,
+                                        -0.7512021 , -0.60229072,  0.32640812,
+                                        -0.59754476, -0.06209685, -1.50856757 };
+
+    floatVector almansiStrain = { 0.25045537, 0.48303426, 0.98555979,
+                                  0.51948512, 0.61289453, 0.12062867,
+                                  0.8263408 , 0.60306013, 0.54506801 };
+
+    floatVector answer = {  0.55339061, -0.59325289,  0.92984685,
+                           -0.83130342, -0.25274097, -1.5877536 ,
+                            1.67911302, -0.83554021,  3.47033811 };
+
+    floatVector result;
+    errorOut error = tardigradeConstitutiveTools::pullBackAlmansiStrain( almansiStrain, deformationGradient, result );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( answer == result, CHECK_PER_ELEMENT );
+
+    //Test the jacobians
+    floatVector resultJ;
+    floatMatrix dEde, dEdF;
+
+    error = tardigradeConstitutiveTools::pullBackAlmansiStrain( almansiStrain, deformationGradient, resultJ, dEde, dEdF );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( answer == resultJ, CHECK_PER_ELEMENT );
+
+    //Testing dEde
+    floatType eps = 1e-7;
+    for ( unsigned int i = 0; i < almansiStrain.size( ); i++ ){
+        floatVector delta( almansiStrain.size( ), 0 );
+        delta[ i ] = eps * fabs( almansiStrain[ i ] ) + eps;
+
+        floatVector Rp, Rm;
+
+        error = tardigradeConstitutiveTools::pullBackAlmansiStrain( almansiStrain + delta, deformationGradient, Rp );
+
+        BOOST_CHECK( ! error );
+
+        error = tardigradeConstitutiveTools::pullBackAlmansiStrain( almansiStrain - delta, deformationGradient, Rm );
+
+        BOOST_CHECK( ! error );
+
+        floatVector gradCol = ( Rp - Rm ) / ( 2 * delta[ i ] );
+
+        for ( unsigned int j = 0; j < gradCol.size( ); j++ ){
+            BOOST_TEST( gradCol[ j ] == dEde[ j ][ i ] );
+        }
+    }
+
+    //Testing dEdF
+    for ( unsigned int i = 0; i < deformationGradient.size( ); i++ ){
+        floatVector delta( deformationGradient.size( ), 0 );
+        delta[ i ] = eps * fabs( deformationGradient[ i ] ) + eps;
+
+        floatVector Rp, Rm;
+
+        error = tardigradeConstitutiveTools::pullBackAlmansiStrain( almansiStrain, deformationGradient + delta, Rp );
+
+        BOOST_CHECK( ! error );
+
+        error = tardigradeConstitutiveTools::pullBackAlmansiStrain( almansiStrain, deformationGradient - delta, Rm );
+
+        BOOST_CHECK( ! error );
+
+        floatVector gradCol = ( Rp - Rm ) / ( 2 * delta[ i ] );
+
+        for ( unsigned int j = 0; j < gradCol.size( ); j++ ){
+            BOOST_TEST( gradCol[ j ] == dEdF[ j ][ i ] );
+        }
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( testComputeRightCauchyGreen, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the computation of the Right Cauchy-Green deformation tensor
+     */
+
+    floatVector deformationGradient = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+    floatVector answer = { 66, 78, 90, 78, 93, 108, 90, 108, 126 };
+
+    floatVector result;
+
+    errorOut error = tardigradeConstitutiveTools::computeRightCauchyGreen( deformationGradient, result );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( result == answer, CHECK_PER_ELEMENT );
+
+    //Test Jacobian
+
+    floatVector resultJ;
+    floatMatrix dCdF;
+
+    error = tardigradeConstitutiveTools::computeRightCauchyGreen( deformationGradient, resultJ, dCdF );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( resultJ == answer, CHECK_PER_ELEMENT );
+
+    floatType eps = 1e-6;
+    for ( unsigned int i = 0; i < deformationGradient.size( ); i++ ){
+        floatVector delta( deformationGradient.size( ), 0 );
+        delta[ i ] = eps * fabs( deformationGradient[ i ] ) + eps;
+
+        floatVector Rp, Rm;
+
+        error = tardigradeConstitutiveTools::computeRightCauchyGreen( deformationGradient + delta, Rp );
+
+        BOOST_CHECK( ! error );
+
+        error = tardigradeConstitutiveTools::computeRightCauchyGreen( deformationGradient - delta, Rm );
+
+        BOOST_CHECK( ! error );
+
+        floatVector gradCol = ( Rp - Rm ) / ( 2 * delta[ i ] );
+
+        for ( unsigned int j = 0; j < gradCol.size( ); j++ ){
+            BOOST_TEST( gradCol[ j ] == dCdF[ j ][ i ] );
+        }
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( testRowMajorView, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the row-major view of flat storage and the reuse of the storage of the floatMatrix Jacobians
+     */
+
+    floatVector deformationGradient = { 1.1, 0.2, -0.3, 0.05, 0.9, 0.1, -0.2, 0.15, 1.2 };
+
+    floatVector C, dCdF;
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::computeRightCauchyGreen( deformationGradient, C, dCdF ) );
+
+    tardigradeConstitutiveTools::constFloatMatrixView view = tardigradeConstitutiveTools::asMatrix( dCdF, 9 );
+
+    BOOST_TEST( view.rows( ) == 9 );
+
+    BOOST_TEST( view.columns( ) == 9 );
+
+    BOOST_CHECK( view.data( ) == dCdF.data( ) );
+
+    floatVector C2;
+
+    floatMatrix dCdF2;
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::computeRightCauchyGreen( deformationGradient, C2, dCdF2 ) );
+
+    BOOST_TEST( dCdF2.size( ) == view.size( ) );
+
+    for ( unsigned int i = 0; i < view.rows( ); i++ ){
+
+        for ( unsigned int j = 0; j < view.columns( ); j++ ){
+
+            BOOST_TEST( view[ i ][ j ] == dCdF2[ i ][ j ] );
+
+        }
+
+    }
+
+    // Writes through a mutable view reach the flat storage
+    floatVector flat( 6, 0 );
+
+    tardigradeConstitutiveTools::floatMatrixView mutableView = tardigradeConstitutiveTools::asMatrix( flat, 3 );
+
+    mutableView[ 1 ][ 2 ] = 4.5;
+
+    BOOST_TEST( mutableView.rows( ) == 2 );
+
+    BOOST_TEST( flat[ 5 ] == 4.5 );
+
+    BOOST_CHECK_THROW( tardigradeConstitutiveTools::asMatrix( flat, 4 ), std::exception );
+
+    // Repeated calls into the same floatMatrix reuse the existing rows
+    std::vector< const floatType * > rowData( dCdF2.size( ) );
+
+    for ( unsigned int i = 0; i < dCdF2.size( ); i++ ){
+
+        rowData[ i ] = dCdF2[ i ].data( );
+
+    }
+
+    deformationGradient[ 0 ] += 0.1;
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::computeRightCauchyGreen( deformationGradient, C2, dCdF2 ) );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::computeRightCauchyGreen( deformationGradient, C, dCdF ) );
+
+    view = tardigradeConstitutiveTools::asMatrix( dCdF, 9 );
+
+    for ( unsigned int i = 0; i < dCdF2.size( ); i++ ){
+
+        BOOST_CHECK( dCdF2[ i ].data( ) == rowData[ i ] );
+
+        BOOST_TEST( dCdF2[ i ] == floatVector( view[ i ], view[ i ] + view.columns( ) ), CHECK_PER_ELEMENT );
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( testFixedSizeKinematics, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test that the fixed-size kinematic kernels agree with the vector overloads
+     */
+
+    floatSecondOrderTensor gradU = { 0.69646919, 0.28613933, 0.22685145,
+                                     0.55131477, 0.71946897, 0.42310646,
+                                     0.98076420, 0.68482974, 0.48093190 };
+
+    floatVector gradUVector( gradU.begin( ), gradU.end( ) );
+
+    for ( unsigned int c = 0; c < 2; c++ ){
+
+        bool isCurrent = ( c == 1 );
+
+        floatVector FAnswer, dFdGradUAnswer;
+
+        tardigradeConstitutiveTools::computeDeformationGradient( gradUVector, FAnswer, dFdGradUAnswer, isCurrent );
+
+        floatSecondOrderTensor F;
+
+        floatFourthOrderTensor dFdGradU;
+
+        tardigradeConstitutiveTools::computeDeformationGradient( gradU, F, isCurrent );
+
+        BOOST_TEST( floatVector( F.begin( ), F.end( ) ) == FAnswer, CHECK_PER_ELEMENT );
+
+        F.fill( 0 );
+
+        tardigradeConstitutiveTools::computeDeformationGradient( gradU, F, dFdGradU, isCurrent );
+
+        BOOST_TEST( floatVector( F.begin( ), F.end( ) ) == FAnswer, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( floatVector( dFdGradU.begin( ), dFdGradU.end( ) ) == dFdGradUAnswer, CHECK_PER_ELEMENT );
+
+    }
+
+    floatSecondOrderTensor F = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+    floatVector FVector( F.begin( ), F.end( ) );
+
+    floatVector CAnswer, dCdFAnswer, EAnswer, dEdFAnswer;
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::computeRightCauchyGreen( FVector, CAnswer, dCdFAnswer ) );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::computeGreenLagrangeStrain( FVector, EAnswer, dEdFAnswer ) );
+
+    floatSecondOrderTensor C, E;
+
+    floatFourthOrderTensor dCdF, dEdF;
+
+    tardigradeConstitutiveTools::computeRightCauchyGreen( F, C );
+
+    BOOST_TEST( floatVector( C.begin( ), C.end( ) ) == CAnswer, CHECK_PER_ELEMENT );
+
+    tardigradeConstitutiveTools::computeRightCauchyGreen( F, C, dCdF );
+
+    BOOST_TEST( floatVector( C.begin( ), C.end( ) ) == CAnswer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( floatVector( dCdF.begin( ), dCdF.end( ) ) == dCdFAnswer, CHECK_PER_ELEMENT );
+
+    tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, E );
+
+    BOOST_TEST( floatVector( E.begin( ), E.end( ) ) == EAnswer, CHECK_PER_ELEMENT );
+
+    tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, E, dEdF );
+
+    BOOST_TEST( floatVector( E.begin( ), E.end( ) ) == EAnswer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( floatVector( dEdF.begin( ), dEdF.end( ) ) == dEdFAnswer, CHECK_PER_ELEMENT );
+
+    // The vector overloads must not reallocate outputs which already have sufficient capacity
+
+    floatVector CResult( 9, 0 ), dCdFResult( 81, 0 );
+
+    const floatType *CData = CResult.data( );
+    const floatType *dCdFData = dCdFResult.data( );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::computeRightCauchyGreen( FVector, CResult, dCdFResult ) );
+
+    BOOST_CHECK( CData == CResult.data( ) );
+
+    BOOST_CHECK( dCdFData == dCdFResult.data( ) );
+
+    BOOST_TEST( CResult == CAnswer, CHECK_PER_ELEMENT );
+
+}
+
+BOOST_AUTO_TEST_CASE( testComputeKinematicsBatched, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test that the batched structure-of-arrays kinematics agree with the single point kernels
+     */
+
+    constexpr unsigned int nPoints = 5;
+
+    floatVector gradUs = { -0.01078825, -0.0156822 ,  0.02290497, -0.00614278, -0.04403221, -0.01019557,  0.02379954, -0.03175083, -0.03245482,
+                            0.06964692,  0.02861393,  0.02268515,  0.05513148,  0.07194690,  0.04231065,  0.09807642,  0.06848297,  0.04809319,
+                           -0.03921175,  0.03431780,  0.07290497,  0.04385722, -0.00596779,  0.01980443, -0.02620046,  0.01824917,  0.01754518,
+                            0.00000000,  0.00000000,  0.00000000,  0.00000000,  0.00000000,  0.00000000,  0.00000000,  0.00000000,  0.00000000,
+                            0.12345678, -0.08765432,  0.01928374, -0.04655646,  0.03456789, -0.02837465,  0.07654321,  0.00123456, -0.11111111 };
+
+    // Transpose the points into structure-of-arrays layout
+    floatVector gradUBatch( 9 * nPoints );
+
+    for ( unsigned int p = 0; p < nPoints; p++ ){
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            gradUBatch[ i * nPoints + p ] = gradUs[ 9 * p + i ];
+
+        }
+
+    }
+
+    for ( unsigned int c = 0; c < 2; c++ ){
+
+        bool isCurrent = ( c == 1 );
+
+        floatVector F( 9 * nPoints ), C( 9 * nPoints ), E( 9 * nPoints );
+
+        floatVector FJ( 9 * nPoints ), CJ( 9 * nPoints ), EJ( 9 * nPoints );
+
+        floatVector dFdGradU( 81 * nPoints ), dCdF( 81 * nPoints ), dEdF( 81 * nPoints );
+
+        tardigradeConstitutiveTools::computeKinematicsBatched( nPoints, gradUBatch.data( ), F.data( ), C.data( ), E.data( ), isCurrent );
+
+        tardigradeConstitutiveTools::computeKinematicsBatched( nPoints, gradUBatch.data( ), FJ.data( ), CJ.data( ), EJ.data( ),
+                                                               dFdGradU.data( ), dCdF.data( ), dEdF.data( ), isCurrent );
+
+        for ( unsigned int p = 0; p < nPoints; p++ ){
+
+            floatSecondOrderTensor gradU, FAnswer, CAnswer, EAnswer;
+
+            floatFourthOrderTensor dFdGradUAnswer, dCdFAnswer, dEdFAnswer;
+
+            std::copy( gradUs.begin( ) + 9 * p, gradUs.begin( ) + 9 * ( p + 1 ), gradU.begin( ) );
+
+            tardigradeConstitutiveTools::computeDeformationGradient( gradU, FAnswer, dFdGradUAnswer, isCurrent );
+
+            tardigradeConstitutiveTools::computeRightCauchyGreen( FAnswer, CAnswer, dCdFAnswer );
+
+            tardigradeConstitutiveTools::computeGreenLagrangeStrain( FAnswer, EAnswer, dEdFAnswer );
+
+            for ( unsigned int i = 0; i < 9; i++ ){
+
+                BOOST_TEST( F[ i * nPoints + p ] == FAnswer[ i ] );
+
+                BOOST_TEST( C[ i * nPoints + p ] == CAnswer[ i ] );
+
+                BOOST_TEST( E[ i * nPoints + p ] == EAnswer[ i ] );
+
+                BOOST_TEST( FJ[ i * nPoints + p ] == FAnswer[ i ] );
+
+                BOOST_TEST( CJ[ i * nPoints + p ] == CAnswer[ i ] );
+
+                BOOST_TEST( EJ[ i * nPoints + p ] == EAnswer[ i ] );
+
+            }
+
+            for ( unsigned int i = 0; i < 81; i++ ){
+
+                BOOST_TEST( dFdGradU[ i * nPoints + p ] == dFdGradUAnswer[ i ] );
+
+                BOOST_TEST( dCdF[ i * nPoints + p ] == dCdFAnswer[ i ] );
+
+                BOOST_TEST( dEdF[ i * nPoints + p ] == dEdFAnswer[ i ] );
+
+            }
+
+        }
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( testRightCauchyGreenBatched, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the batched Right Cauchy-Green and Green-Lagrange kernels. The number of points is chosen so that
+     * the vector lanes and the scalar tail are all exercised.
+     */
+
+    constexpr unsigned int nPoints = 13;
+
+    floatVector FBatch( 9 * nPoints );
+
+    for ( unsigned int i = 0; i < FBatch.size( ); i++ ){
+
+        FBatch[ i ] = std::sin( 0.37 * i + 0.1 ) + ( ( ( i / nPoints ) % 4 == 0 ) ? 1 : 0 );
+
+    }
+
+    floatVector C( 9 * nPoints ), dCdF( 81 * nPoints ), CJ( 9 * nPoints );
+
+    floatVector E( 9 * nPoints ), dEdF( 81 * nPoints ), EJ( 9 * nPoints );
+
+    tardigradeConstitutiveTools::computeRightCauchyGreenBatched( nPoints, FBatch.data( ), C.data( ) );
+
+    tardigradeConstitutiveTools::computeRightCauchyGreenBatched( nPoints, FBatch.data( ), CJ.data( ), dCdF.data( ) );
+
+    tardigradeConstitutiveTools::computeGreenLagrangeStrainBatched( nPoints, FBatch.data( ), E.data( ) );
+
+    tardigradeConstitutiveTools::computeGreenLagrangeStrainBatched( nPoints, FBatch.data( ), EJ.data( ), dEdF.data( ) );
+
+    for ( unsigned int p = 0; p < nPoints; p++ ){
+
+        floatSecondOrderTensor F, CAnswer, EAnswer;
+
+        floatFourthOrderTensor dCdFAnswer, dEdFAnswer;
+
+        for ( unsigned int i = 0; i < 9; i++ ){ F[ i ] = FBatch[ i * nPoints + p ]; }
+
+        tardigradeConstitutiveTools::computeRightCauchyGreen( F, CAnswer, dCdFAnswer );
+
+        tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, EAnswer, dEdFAnswer );
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            BOOST_TEST( C[ i * nPoints + p ] == CAnswer[ i ] );
+
+            BOOST_TEST( CJ[ i * nPoints + p ] == CAnswer[ i ] );
+
+            BOOST_TEST( E[ i * nPoints + p ] == EAnswer[ i ] );
+
+            BOOST_TEST( EJ[ i * nPoints + p ] == EAnswer[ i ] );
+
+        }
+
+        for ( unsigned int i = 0; i < 81; i++ ){
+
+            BOOST_TEST( dCdF[ i * nPoints + p ] == dCdFAnswer[ i ] );
+
+            BOOST_TEST( dEdF[ i * nPoints + p ] == dEdFAnswer[ i ] );
+
+        }
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( testComputeCurrentSurfaceBatched, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the batched Nanson's formula kernel against the single facet derivatives for both per-facet and
+     * shared deformation gradients.
+     */
+
+    constexpr unsigned int nFacets = 5;
+
+    floatVector FBatch( 9 * nFacets ), NBatch( 3 * nFacets );
+
+    for ( unsigned int i = 0; i < FBatch.size( ); i++ ){
+
+        FBatch[ i ] = 0.1 * std::sin( 0.37 * i + 0.1 ) + ( ( ( i / nFacets ) % 4 == 0 ) ? 1 : 0 );
+
+    }
+
+    for ( unsigned int p = 0; p < nFacets; p++ ){
+
+        floatVector N = { std::cos( 0.7 * p ), std::sin( 0.7 * p ), 0.3 * p - 0.5 };
+
+        N /= tardigradeVectorTools::l2norm( N );
+
+        for ( unsigned int i = 0; i < 3; i++ ){ NBatch[ i * nFacets + p ] = N[ i ]; }
+
+    }
+
+    floatVector n( 3 * nFacets ), r( nFacets ), dndF( 27 * nFacets ), drdF( 9 * nFacets );
+
+    floatVector nNoJ( 3 * nFacets ), rNoJ( nFacets );
+
+    tardigradeConstitutiveTools::computeCurrentSurfaceBatched( nFacets, NBatch.data( ), FBatch.data( ), n.data( ), r.data( ), dndF.data( ), drdF.data( ) );
+
+    tardigradeConstitutiveTools::computeCurrentSurfaceBatched( nFacets, NBatch.data( ), FBatch.data( ), nNoJ.data( ), rNoJ.data( ) );
+
+    BOOST_TEST( nNoJ == n, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( rNoJ == r, CHECK_PER_ELEMENT );
+
+    for ( unsigned int p = 0; p < nFacets; p++ ){
+
+        floatVector F( 9 ), N( 3 ), n_p( 3 );
+
+        for ( unsigned int i = 0; i < 9; i++ ){ F[ i ] = FBatch[ i * nFacets + p ]; }
+
+        for ( unsigned int i = 0; i < 3; i++ ){ N[ i ] = NBatch[ i * nFacets + p ]; n_p[ i ] = n[ i * nFacets + p ]; }
+
+        // n da = J F^{-T} N dA
+        floatType J = tardigradeVectorTools::determinant( F, 3, 3 );
+
+        const tardigradeConstitutiveTools::KinematicState kinematics( F );
+
+        const floatSecondOrderTensor &invF = kinematics.inverse( );
+
+        floatVector nda( 3, 0 );
+
+        for ( unsigned int i = 0; i < 3; i++ ){
+
+            for ( unsigned int I = 0; I < 3; I++ ){
+
+                nda[ i ] += J * invF[ 3 * I + i ] * N[ I ];
+
+            }
+
+        }
+
+        BOOST_TEST( r[ p ] == tardigradeVectorTools::l2norm( nda ) );
+
+        BOOST_TEST( n_p == nda / tardigradeVectorTools::l2norm( nda ), CHECK_PER_ELEMENT );
+
+        floatVector dNormalVectordF, dCurrentAreadF;
+
+        tardigradeConstitutiveTools::computeDCurrentNormalVectorDF( n_p, F, dNormalVectordF );
+
+        tardigradeConstitutiveTools::computeDCurrentAreaDF( n_p, F, dCurrentAreadF );
+
+        for ( unsigned int i = 0; i < 27; i++ ){
+
+            BOOST_TEST( dndF[ i * nFacets + p ] == dNormalVectordF[ i ] );
+
+        }
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            BOOST_TEST( drdF[ i * nFacets + p ] == r[ p ] * dCurrentAreadF[ i ] );
+
+        }
+
+    }
+
+    // All of the facets share the deformation gradient of the first facet
+    floatSecondOrderTensor sharedF;
+
+    floatVector sharedFBatch( 9 * nFacets );
+
+    for ( unsigned int i = 0; i < 9; i++ ){
+
+        sharedF[ i ] = FBatch[ i * nFacets ];
+
+        for ( unsigned int p = 0; p < nFacets; p++ ){ sharedFBatch[ i * nFacets + p ] = sharedF[ i ]; }
+
+    }
+
+    tardigradeConstitutiveTools::computeCurrentSurfaceBatched( nFacets, NBatch.data( ), sharedFBatch.data( ), n.data( ), r.data( ), dndF.data( ), drdF.data( ) );
+
+    floatVector nShared( 3 * nFacets ), rShared( nFacets ), dndFShared( 27 * nFacets ), drdFShared( 9 * nFacets );
+
+    tardigradeConstitutiveTools::computeCurrentSurfaceBatched( nFacets, NBatch.data( ), sharedF, nShared.data( ), rShared.data( ), dndFShared.data( ), drdFShared.data( ) );
+
+    BOOST_TEST( nShared == n, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( rShared == r, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dndFShared == dndF, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( drdFShared == drdF, CHECK_PER_ELEMENT );
+
+    tardigradeConstitutiveTools::computeCurrentSurfaceBatched( nFacets, NBatch.data( ), sharedF, nNoJ.data( ), rNoJ.data( ) );
+
+    BOOST_TEST( nNoJ == n, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( rNoJ == r, CHECK_PER_ELEMENT );
+
+}
+
+BOOST_AUTO_TEST_CASE( testSinglePrecisionKernels, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test that the single precision instantiations of the fixed-size and batched kernels agree with the double
+     * precision instantiations. The number of points is chosen so that every vector lane width and the scalar
+     * tail are exercised.
+     */
+
+    constexpr unsigned int nPoints = 29;
+
+    constexpr double singleTolerance = 1e-5;
+
+    floatVector gradUBatch( 9 * nPoints );
+
+    std::vector< float > gradUBatchSingle( 9 * nPoints );
+
+    for ( unsigned int i = 0; i < gradUBatch.size( ); i++ ){
+
+        gradUBatchSingle[ i ] = ( float )( 0.1 * std::sin( 0.37 * i + 0.1 ) );
+
+        gradUBatch[ i ] = gradUBatchSingle[ i ];
+
+    }
+
+    for ( unsigned int c = 0; c < 2; c++ ){
+
+        bool isCurrent = ( c == 1 );
+
+        floatVector F( 9 * nPoints ), C( 9 * nPoints ), E( 9 * nPoints );
+
+        floatVector dFdGradU( 81 * nPoints ), dCdF( 81 * nPoints ), dEdF( 81 * nPoints );
+
+        std::vector< float > FSingle( 9 * nPoints ), CSingle( 9 * nPoints ), ESingle( 9 * nPoints );
+
+        std::vector< float > dFdGradUSingle( 81 * nPoints ), dCdFSingle( 81 * nPoints ), dEdFSingle( 81 * nPoints );
+
+        tardigradeConstitutiveTools::computeKinematicsBatched( nPoints, gradUBatch.data( ), F.data( ), C.data( ), E.data( ),
+                                                               dFdGradU.data( ), dCdF.data( ), dEdF.data( ), isCurrent );
+
+        tardigradeConstitutiveTools::computeKinematicsBatched( nPoints, gradUBatchSingle.data( ), FSingle.data( ), CSingle.data( ), ESingle.data( ),
+                                                               dFdGradUSingle.data( ), dCdFSingle.data( ), dEdFSingle.data( ), isCurrent );
+
+        for ( unsigned int i = 0; i < 9 * nPoints; i++ ){
+
+            BOOST_CHECK_SMALL( FSingle[ i ] - F[ i ], singleTolerance );
+
+            BOOST_CHECK_SMALL( CSingle[ i ] - C[ i ], singleTolerance );
+
+            BOOST_CHECK_SMALL( ESingle[ i ] - E[ i ], singleTolerance );
+
+        }
+
+        for ( unsigned int i = 0; i < 81 * nPoints; i++ ){
+
+            BOOST_CHECK_SMALL( dFdGradUSingle[ i ] - dFdGradU[ i ], singleTolerance );
+
+            BOOST_CHECK_SMALL( dCdFSingle[ i ] - dCdF[ i ], singleTolerance );
+
+            BOOST_CHECK_SMALL( dEdFSingle[ i ] - dEdF[ i ], singleTolerance );
+
+        }
+
+        // The fixed-size kernels
+        tardigradeConstitutiveTools::secondOrderTensor< float > gradUSingle, FPointSingle, EPointSingle;
+
+        tardigradeConstitutiveTools::fourthOrderTensor< float > dFdGradUPointSingle, dEdFPointSingle;
+
+        for ( unsigned int i = 0; i < 9; i++ ){ gradUSingle[ i ] = gradUBatchSingle[ i * nPoints ]; }
+
+        tardigradeConstitutiveTools::computeDeformationGradient( gradUSingle, FPointSingle, dFdGradUPointSingle, isCurrent );
+
+        tardigradeConstitutiveTools::computeGreenLagrangeStrain( FPointSingle, EPointSingle, dEdFPointSingle );
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            BOOST_CHECK_SMALL( FPointSingle[ i ] - F[ i * nPoints ], singleTolerance );
+
+            BOOST_CHECK_SMALL( EPointSingle[ i ] - E[ i * nPoints ], singleTolerance );
+
+        }
+
+        for ( unsigned int i = 0; i < 81; i++ ){
+
+            BOOST_CHECK_SMALL( dFdGradUPointSingle[ i ] - dFdGradU[ i * nPoints ], singleTolerance );
+
+            BOOST_CHECK_SMALL( dEdFPointSingle[ i ] - dEdF[ i * nPoints ], singleTolerance );
+
+        }
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( testStructuredJacobian, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the structured fourth order Jacobian
+     */
+
+    typedef tardigradeConstitutiveTools::StructuredJacobian StructuredJacobian;
+
+    floatSecondOrderTensor A = { 0.69646919, 0.28613933, 0.22685145, 0.55131477, 0.71946897, 0.42310646, 0.9807642 , 0.68482974, 0.4809319 };
+
+    floatSecondOrderTensor B = { 0.39211752, 0.34317802, 0.72904971, 0.43857224, 0.0596779 , 0.39804426, 0.73799541, 0.18249173, 0.17545176 };
+
+    floatSecondOrderTensor X = { 0.53155137, 0.53182759, 0.63440096, 0.84943179, 0.72445532, 0.61102351, 0.72244338, 0.32295891, 0.36178866 };
+
+    floatFourthOrderTensor D;
+
+    for ( unsigned int i = 0; i < 81; i++ ){ D[ i ] = std::cos( 0.7 * i ); }
+
+    // Form the expected dense representations
+    std::vector< StructuredJacobian > jacobians = { StructuredJacobian::identity( 2.0 ),
+                                                    StructuredJacobian::kronecker( A, B, 0.5 ),
+                                                    StructuredJacobian::transposedKronecker( A, B, -1.5 ),
+                                                    StructuredJacobian::rankOne( A, B, 3.0 ),
+                                                    StructuredJacobian::dense( D ) };
+
+    std::vector< floatVector > answers( jacobians.size( ), floatVector( 81, 0 ) );
+
+    for ( unsigned int i = 0; i < 3; i++ ){
+        for ( unsigned int j = 0; j < 3; j++ ){
+            for ( unsigned int k = 0; k < 3; k++ ){
+                for ( unsigned int l = 0; l < 3; l++ ){
+                    unsigned int index = 27 * i + 9 * j + 3 * k + l;
+                    answers[ 0 ][ index ] = 2.0 * tardigradeConstitutiveTools::deltaDirac( i, k ) * tardigradeConstitutiveTools::deltaDirac( j, l );
+                    answers[ 1 ][ index ] = 0.5 * A[ 3 * i + k ] * B[ 3 * l + j ];
+                    answers[ 2 ][ index ] = -1.5 * A[ 3 * i + l ] * B[ 3 * k + j ];
+                    answers[ 3 ][ index ] = 3.0 * A[ 3 * i + j ] * B[ 3 * k + l ];
+                    answers[ 4 ][ index ] = D[ index ];
+                }
+            }
+        }
+    }
+
+    for ( unsigned int a = 0; a < jacobians.size( ); a++ ){
+
+        BOOST_TEST( jacobians[ a ].toVector( ) == answers[ a ], CHECK_PER_ELEMENT );
+
+        floatSecondOrderTensor Y, YT;
+
+        floatVector YAnswer( 9, 0 ), YTAnswer( 9, 0 );
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+            for ( unsigned int j = 0; j < 9; j++ ){
+                YAnswer[ i ]  += answers[ a ][ 9 * i + j ] * X[ j ];
+                YTAnswer[ j ] += X[ i ] * answers[ a ][ 9 * i + j ];
+            }
+        }
+
+        jacobians[ a ].apply( X, Y );
+
+        jacobians[ a ].applyTranspose( X, YT );
+
+        BOOST_TEST( floatVector( Y.begin( ), Y.end( ) ) == YAnswer, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( floatVector( YT.begin( ), YT.end( ) ) == YTAnswer, CHECK_PER_ELEMENT );
+
+        // Composition with every other Jacobian
+        for ( unsigned int b = 0; b < jacobians.size( ); b++ ){
+
+            floatVector RAnswer( 81, 0 );
+
+            for ( unsigned int i = 0; i < 9; i++ ){
+                for ( unsigned int j = 0; j < 9; j++ ){
+                    for ( unsigned int k = 0; k < 9; k++ ){
+                        RAnswer[ 9 * i + k ] += answers[ a ][ 9 * i + j ] * answers[ b ][ 9 * j + k ];
+                    }
+                }
+            }
+
+            StructuredJacobian R = jacobians[ a ].compose( jacobians[ b ] );
+
+            BOOST_TEST( R.toVector( ) == RAnswer, CHECK_PER_ELEMENT );
+
+            BOOST_CHECK( R.hasDense( ) == ( ( a == 4 ) || ( b == 4 ) ) );
+
+        }
+
+    }
+
+    // Sums which exceed the term capacity are accumulated into the dense part
+    StructuredJacobian sum;
+
+    floatVector sumAnswer( 81, 0 );
+
+    for ( unsigned int a = 1; a < jacobians.size( ); a++ ){
+
+        sum += jacobians[ a ];
+
+        sum += jacobians[ a ];
+
+        sumAnswer += 2 * answers[ a ];
+
+    }
+
+    BOOST_CHECK( sum.numTerms( ) == StructuredJacobian::maxTerms );
+
+    BOOST_CHECK( sum.hasDense( ) );
+
+    BOOST_TEST( sum.toVector( ) == sumAnswer, CHECK_PER_ELEMENT );
+
+    // Kinematic Jacobians
+    floatSecondOrderTensor F, C, E;
+
+    floatFourthOrderTensor dFdGradU, dCdF, dEdF;
+
+    StructuredJacobian dFdGradUStructured, dCdFStructured, dEdFStructured;
+
+    for ( unsigned int c = 0; c < 2; c++ ){
+
+        tardigradeConstitutiveTools::computeDeformationGradient( X, F, dFdGradU, c == 1 );
+
+        floatSecondOrderTensor FStructured;
+
+        tardigradeConstitutiveTools::computeDeformationGradient( X, FStructured, dFdGradUStructured, c == 1 );
+
+        BOOST_TEST( floatVector( FStructured.begin( ), FStructured.end( ) ) == floatVector( F.begin( ), F.end( ) ), CHECK_PER_ELEMENT );
+
+        BOOST_TEST( dFdGradUStructured.toVector( ) == floatVector( dFdGradU.begin( ), dFdGradU.end( ) ), CHECK_PER_ELEMENT );
+
+    }
+
+    floatSecondOrderTensor CStructured, EStructured;
+
+    tardigradeConstitutiveTools::computeRightCauchyGreen( A, C, dCdF );
+
+    tardigradeConstitutiveTools::computeRightCauchyGreen( A, CStructured, dCdFStructured );
+
+    BOOST_TEST( floatVector( CStructured.begin( ), CStructured.end( ) ) == floatVector( C.begin( ), C.end( ) ), CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dCdFStructured.toVector( ) == floatVector( dCdF.begin( ), dCdF.end( ) ), CHECK_PER_ELEMENT );
+
+    tardigradeConstitutiveTools::computeGreenLagrangeStrain( A, E, dEdF );
+
+    tardigradeConstitutiveTools::computeGreenLagrangeStrain( A, EStructured, dEdFStructured );
+
+    BOOST_TEST( floatVector( EStructured.begin( ), EStructured.end( ) ) == floatVector( E.begin( ), E.end( ) ), CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dEdFStructured.toVector( ) == floatVector( dEdF.begin( ), dEdF.end( ) ), CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !dEdFStructured.hasDense( ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( testKinematicState, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the cached kinematic state and the mappings which consume it
+     */
+
+    floatVector F = { 0.69646919, 0.28613933, 0.22685145,
+                      0.55131477, 0.71946897, 0.42310646,
+                      0.98076420, 0.68482974, 0.4809319 };
+
+    floatVector n = { 0.26726124, 0.53452248, 0.80178373 };
+
+    floatVector A = { 0.39211752, 0.34317802, 0.72904971,
+                      0.43857224, 0.0596779 , 0.39804426,
+                      0.73799541, 0.18249173, 0.17545176 };
+
+    tardigradeConstitutiveTools::KinematicState kinematics( F );
+
+    Eigen::Map< const Eigen::Matrix< floatType, 3, 3, Eigen::RowMajor > > F_map( F.data( ) );
+
+    floatVector invF_answer( 9 ), cofactor_answer( 9 ), C_answer( 9 ), invC_answer( 9 );
+
+    Eigen::Map< Eigen::Matrix< floatType, 3, 3, Eigen::RowMajor > > invF_answer_map( invF_answer.data( ) );
+    Eigen::Map< Eigen::Matrix< floatType, 3, 3, Eigen::RowMajor > > cofactor_answer_map( cofactor_answer.data( ) );
+    Eigen::Map< Eigen::Matrix< floatType, 3, 3, Eigen::RowMajor > > C_answer_map( C_answer.data( ) );
+    Eigen::Map< Eigen::Matrix< floatType, 3, 3, Eigen::RowMajor > > invC_answer_map( invC_answer.data( ) );
+
+    invF_answer_map = F_map.inverse( );
+    cofactor_answer_map = F_map.determinant( ) * F_map.inverse( ).transpose( );
+    C_answer_map = F_map.transpose( ) * F_map;
+    invC_answer_map = ( F_map.transpose( ) * F_map ).inverse( );
+
+    BOOST_TEST( kinematics.determinant( ) == F_map.determinant( ) );
+
+    BOOST_TEST( floatVector( kinematics.deformationGradient( ).begin( ), kinematics.deformationGradient( ).end( ) ) == F, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( floatVector( kinematics.inverse( ).begin( ), kinematics.inverse( ).end( ) ) == invF_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( floatVector( kinematics.cofactor( ).begin( ), kinematics.cofactor( ).end( ) ) == cofactor_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( floatVector( kinematics.rightCauchyGreen( ).begin( ), kinematics.rightCauchyGreen( ).end( ) ) == C_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( floatVector( kinematics.inverseRightCauchyGreen( ).begin( ), kinematics.inverseRightCauchyGreen( ).end( ) ) == invC_answer, CHECK_PER_ELEMENT );
+
+    // The cached values must be stable across repeated requests
+    const floatType *invF_address = kinematics.inverse( ).data( );
+
+    BOOST_CHECK( invF_address == kinematics.inverse( ).data( ) );
+
+    floatSecondOrderTensor F_fixed;
+
+    std::copy( F.begin( ), F.end( ), F_fixed.begin( ) );
+
+    tardigradeConstitutiveTools::KinematicState fixedKinematics( F_fixed );
+
+    BOOST_TEST( fixedKinematics.determinant( ) == kinematics.determinant( ) );
+
+    floatVector result, result_answer, dRdA, dRdA_answer, dRdF, dRdF_answer;
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardPK2Stress( A, F, result_answer, dRdA_answer, dRdF_answer ) );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardPK2Stress( A, kinematics, result ) );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardPK2Stress( A, kinematics, result, dRdA, dRdF ) );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dRdA == dRdA_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dRdF == dRdF_answer, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::pullBackCauchyStress( A, F, result_answer, dRdA_answer, dRdF_answer ) );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::pullBackCauchyStress( A, kinematics, result ) );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::pullBackCauchyStress( A, kinematics, result, dRdA, dRdF ) );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dRdA == dRdA_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dRdF == dRdF_answer, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( A, F, result_answer, dRdA_answer, dRdF_answer ) );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( A, kinematics, result ) );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( A, kinematics, result, dRdA, dRdF ) );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dRdA == dRdA_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dRdF == dRdF_answer, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::pullBackAlmansiStrain( A, F, result_answer, dRdA_answer, dRdF_answer ) );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::pullBackAlmansiStrain( A, kinematics, result ) );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::pullBackAlmansiStrain( A, kinematics, result, dRdA, dRdF ) );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dRdA == dRdA_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dRdF == dRdF_answer, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::pullBackVelocityGradient( A, F, result_answer, dRdA_answer, dRdF_answer ) );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::pullBackVelocityGradient( A, kinematics, result ) );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::pullBackVelocityGradient( A, kinematics, result, dRdA, dRdF ) );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dRdA == dRdA_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( dRdF == dRdF_answer, CHECK_PER_ELEMENT );
+
+    tardigradeConstitutiveTools::computeDCurrentNormalVectorDF( n, F, result_answer );
+
+    tardigradeConstitutiveTools::computeDCurrentNormalVectorDF( n, kinematics, result );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    tardigradeConstitutiveTools::computeDCurrentAreaWeightedNormalVectorDF( n, F, result_answer );
+
+    tardigradeConstitutiveTools::computeDCurrentAreaWeightedNormalVectorDF( n, kinematics, result );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    tardigradeConstitutiveTools::computeDCurrentAreaDF( n, F, result_answer );
+
+    tardigradeConstitutiveTools::computeDCurrentAreaDF( n, kinematics, result );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    floatVector badF = { 1, 2, 3 };
+
+    BOOST_REQUIRE_THROW( tardigradeConstitutiveTools::KinematicState badKinematics( badF ), std::nested_exception );
+
+}
+
+BOOST_AUTO_TEST_CASE( testStatusCodeOverloads, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the overloads which report failures through a status code
+     */
+
+    floatVector F = { 0.69646919, 0.28613933, 0.22685145,
+                      0.55131477, 0.71946897, 0.42310646,
+                      0.98076420, 0.68482974, 0.4809319 };
+
+    floatVector Q = { 0, -1, 0,
+                      1,  0, 0,
+                      0,  0, 1 };
+
+    tardigradeConstitutiveTools::statusCode status;
+
+    floatVector result, result_answer, jacobian, jacobian_answer;
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::rotateMatrix( F, Q, result_answer ) );
+
+    tardigradeConstitutiveTools::rotateMatrix( F, Q, result, status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::computeRightCauchyGreen( F, result_answer, jacobian_answer ) );
+
+    tardigradeConstitutiveTools::computeRightCauchyGreen( F, result, status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    tardigradeConstitutiveTools::computeRightCauchyGreen( F, result, jacobian, status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( jacobian == jacobian_answer, CHECK_PER_ELEMENT );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, result_answer, jacobian_answer ) );
+
+    tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, result, status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    // Re-using the outputs must not change their storage
+    const floatType *E_address = result.data( );
+
+    const floatType *dEdF_address = jacobian.data( );
+
+    tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, result, jacobian, status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
+
+    BOOST_CHECK( E_address == result.data( ) );
+
+    BOOST_CHECK( dEdF_address == jacobian.data( ) );
+
+    BOOST_TEST( result == result_answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( jacobian == jacobian_answer, CHECK_PER_ELEMENT );
+
+    tardigradeConstitutiveTools::computeDGreenLagrangeStrainDF( F, jacobian, status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
+
+    BOOST_TEST( jacobian == jacobian_answer, CHECK_PER_ELEMENT );
+
+    floatVector badF = { 1, 2, 3, 4 };
+
+#ifndef TARDIGRADE_CONSTITUTIVE_TOOLS_UNCHECKED
+    tardigradeConstitutiveTools::computeGreenLagrangeStrain( badF, result, status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::notThreeDimensional );
+
+    tardigradeConstitutiveTools::computeRightCauchyGreen( badF, result, jacobian, status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::notThreeDimensional );
+
+    tardigradeConstitutiveTools::computeDGreenLagrangeStrainDF( badF, jacobian, status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::notThreeDimensional );
+
+    tardigradeConstitutiveTools::rotateMatrix( badF, Q, result, status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::sizeMismatch );
+
+#ifndef TARDIGRADE_CONSTITUTIVE_TOOLS_STATUS_ONLY
+    BOOST_CHECK( std::string( tardigradeConstitutiveTools::statusDetail( ) ) == "A and Q must have the same number of values" );
+#endif
+
+    BOOST_CHECK( std::string( tardigradeConstitutiveTools::statusMessage( status ) ) == "The inputs have inconsistent sizes" );
+
+    // A successful call clears the detail of the previous failure
+    tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, result, status );
+
+    BOOST_CHECK( status == tardigradeConstitutiveTools::statusCode::success );
+
+    BOOST_CHECK( std::string( tardigradeConstitutiveTools::statusDetail( ) ).empty( ) );
+#endif
+
+    // The errorOut overloads check their inputs regardless of the error policy
+    tardigradeConstitutiveTools::errorOut error = tardigradeConstitutiveTools::computeGreenLagrangeStrain( badF, result );
+
+    BOOST_CHECK( error );
+
+    delete error;
+
+    error = tardigradeConstitutiveTools::computeDGreenLagrangeStrainDF( badF, jacobian );
+
+    BOOST_CHECK( error );
+
+    delete error;
+
+    error = tardigradeConstitutiveTools::rotateMatrix( badF, Q, result );
+
+    BOOST_CHECK( error );
+
+    delete error;
+
+    BOOST_REQUIRE_THROW( tardigradeConstitutiveTools::computeRightCauchyGreen( badF, result ), std::nested_exception );
+
+}
+
+BOOST_AUTO_TEST_CASE( testComputeSymmetricPart, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the computation of the symmetric part of a matrix
+     *
+     * \param &results: The output file
+     */
+
+    floatVector A = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+    floatVector answer = { 1., 3., 5., 3., 5., 7., 5., 7., 9. };
+
+    floatVector result;
+
+    errorOut error = tardigradeConstitutiveTools::computeSymmetricPart( A, result );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( result == answer, CHECK_PER_ELEMENT );
+
+    floatVector resultJ;
+    floatMatrix dSymmAdA;
+
+    error = tardigradeConstitutiveTools::computeSymmetricPart( A, resultJ, dSymmAdA );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( result == answer, CHECK_PER_ELEMENT );
+
+    floatVector resultJv;
+
+    floatVector dSymmAdAv;
+
+    error = tardigradeConstitutiveTools::computeSymmetricPart( A, resultJv, dSymmAdAv );
+
+    BOOST_CHECK( ! error );
+
+    BOOST_TEST( resultJv == answer, CHECK_PER_ELEMENT );
+
+    BOOST_TEST( tardigradeVectorTools::appendVectors( dSymmAdA ) == dSymmAdAv, CHECK_PER_ELEMENT );
+
+    floatType eps = 1e-6;
+    for ( unsigned int i = 0; i < A.size( ); i++ ){
+        floatVector delta( A.size( ), 0 );
+        delta[ i ] = eps * fabs( A[ i ] ) + eps;
 
-    BOOST_CHECK( ! error );
+        floatVector Rp, Rm;
 
-    BOOST_TEST( thermalExpansionJ == answer, CHECK_PER_ELEMENT );
+        error = tardigradeConstitutiveTools::computeSymmetricPart( A + delta, Rp );
 
-    error = tardigradeConstitutiveTools::quadraticThermalExpansion( temperature + delta,   referenceTemperature,
-                                                             linearParameters,    quadraticParameters,
-                                                            thermalExpansionJp );
+        BOOST_CHECK( ! error );
 
-    BOOST_CHECK( ! error );
-    
-    error = tardigradeConstitutiveTools::quadraticThermalExpansion( temperature - delta,   referenceTemperature,
-                                                             linearParameters,    quadraticParameters,
-                                                            thermalExpansionJm );
+        error = tardigradeConstitutiveTools::computeSymmetricPart( A - delta, Rm );
 
-    BOOST_CHECK( ! error );
+        BOOST_CHECK( ! error );
 
+        floatVector gradCol = ( Rp - Rm ) / ( 2 * delta[ i ] );
 
-    BOOST_TEST( thermalExpansionJacobian == ( thermalExpansionJp - thermalExpansionJm )/(2 * delta), CHECK_PER_ELEMENT );
+        for ( unsigned int j = 0; j < gradCol.size( ); j++ ){
+            BOOST_TEST( gradCol[ j ] == dSymmAdA[ j ][ i ] );
+        }
+    }
 
 }
 
-BOOST_AUTO_TEST_CASE( testPushForwardGreenLagrangeStrain, * boost::unit_test::tolerance( 1e-4 ) ){
+BOOST_AUTO_TEST_CASE( testPushForwardPK2Stress, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
     /*!
-     * Test the push-forward operation on the Green-Lagrange strain.
+     * Test the push forward the PK2 stress to the current configuration
      */
 
-    floatVector deformationGradient = {  0.30027935, -0.72811411,  0.26475099,
-                                         1.2285819 ,  0.57663593,  1.43113814,
-                                        -0.45871432,  0.2175795 ,  0.54013937 };
-
-    floatVector greenLagrangeStrain;
-    errorOut error = tardigradeConstitutiveTools::computeGreenLagrangeStrain( deformationGradient, greenLagrangeStrain );
+    floatVector PK2 = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
 
-    BOOST_CHECK( ! error );
+    floatVector F = { 1, 4, 2, 5, 2, 1, 3, 4, 1 };
 
-    floatVector almansiStrain = { -0.33393717,  0.0953188 , -0.29053383,
-                                   0.0953188 ,  0.35345526,  0.11588247,
-                                  -0.29053383,  0.11588247, -0.56150741 };
+    floatVector cauchyStressAnswer = { 15.16666667, 15.33333333, 16.11111111,
+                                       11.33333333, 10.66666667, 11.55555556,
+                                       13.66666667, 13.33333333, 14.22222222 };
 
     floatVector result;
-    error = tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( greenLagrangeStrain, deformationGradient,
-                                                              result );
 
-    BOOST_CHECK( ! error );
+    BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardPK2Stress( PK2, F, result ) );
 
-    BOOST_TEST( result == almansiStrain, CHECK_PER_ELEMENT );
+    BOOST_TEST( result == cauchyStressAnswer, CHECK_PER_ELEMENT );
 
-    //Test the jacobian
-    floatVector resultJ;
-    floatMatrix dedE, dedF;
-    error = tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( greenLagrangeStrain, deformationGradient,
-                                                              resultJ, dedE, dedF );
+    floatVector result2;
 
-    BOOST_CHECK( ! error );
+    floatMatrix dCauchyStressdPK2, dCauchyStressdF;
 
-    BOOST_TEST( result == resultJ, CHECK_PER_ELEMENT );
+    BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardPK2Stress( PK2, F, result2, dCauchyStressdPK2, dCauchyStressdF ) );
+
+    BOOST_TEST( result2 == cauchyStressAnswer, CHECK_PER_ELEMENT );
+
+    floatMatrix dCauchyStressdPK2Answer( cauchyStressAnswer.size( ), floatVector( PK2.size( ), 0 ) );
+
+    floatMatrix dCauchyStressdFAnswer( cauchyStressAnswer.size( ), floatVector( F.size( ), 0 ) );
 
-    //Check dedE
     floatType eps = 1e-6;
-    for ( unsigned int i=0; i<greenLagrangeStrain.size( ); i++ ){
-        floatVector delta( greenLagrangeStrain.size( ), 0 );
-        delta[ i ] = eps*fabs( greenLagrangeStrain[ i ] ) + eps;
 
-        floatVector Rp, Rm;
+    for ( unsigned int i = 0; i < PK2.size( ); i++ ){
 
-        error = tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( greenLagrangeStrain + delta, deformationGradient, Rp );
+        floatVector delta( PK2.size( ), 0 );
 
-        BOOST_CHECK( ! error );
+        delta[ i ] = eps * std::fabs( PK2[ i ] ) + eps;
 
-        error = tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( greenLagrangeStrain - delta, deformationGradient, Rm );
+        floatVector cp, cm;
 
-        BOOST_CHECK( ! error );
+        BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardPK2Stress( PK2 + delta, F, cp ) );
 
-        floatVector grad = ( Rp - Rm )/(2*delta[ i ]);
+        BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardPK2Stress( PK2 - delta, F, cm ) );
+
+        for ( unsigned int j = 0; j < PK2.size( ); j++ ){
+
+            dCauchyStressdPK2Answer[ j ][ i ] = ( cp[ j ] - cm[ j ] ) / ( 2 * delta[ i ] );
 
-        for ( unsigned int j=0; j<grad.size( ); j++ ){
-            BOOST_TEST( grad[ j ] == dedE[ j ][ i ] );
         }
+
     }
 
-    //Check dedF
-    for ( unsigned int i=0; i<deformationGradient.size( ); i++ ){
-        floatVector delta( deformationGradient.size( ), 0 );
-        delta[ i ] = eps*fabs( deformationGradient[ i ] ) + eps;
+    BOOST_TEST( tardigradeVectorTools::appendVectors( dCauchyStressdPK2 ) == tardigradeVectorTools::appendVectors( dCauchyStressdPK2Answer ), CHECK_PER_ELEMENT );
 
-        floatVector Rp, Rm;
+    for ( unsigned int i = 0; i < F.size( ); i++ ){
 
-        error = tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( greenLagrangeStrain, deformationGradient + delta, Rp );
+        floatVector delta( F.size( ), 0 );
 
-        BOOST_CHECK( ! error );
+        delta[ i ] = eps * std::fabs( F[ i ] ) + eps;
 
-        error = tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( greenLagrangeStrain, deformationGradient - delta, Rm );
+        floatVector cp, cm;
 
-        BOOST_CHECK( ! error );
+        BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardPK2Stress( PK2, F + delta, cp ) );
 
-        floatVector grad = ( Rp - Rm )/(2*delta[ i ]);
+        BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardPK2Stress( PK2, F - delta, cm ) );
+
+        for ( unsigned int j = 0; j < F.size( ); j++ ){
+
+            dCauchyStressdFAnswer[ j ][ i ] = ( cp[ j ] - cm[ j ] ) / ( 2 * delta[ i ] );
 
-        for ( unsigned int j=0; j<grad.size( ); j++ ){
-            BOOST_TEST( grad[ j ] == dedF[ j ][ i ] );
         }
+
     }
 
+    BOOST_TEST( tardigradeVectorTools::appendVectors( dCauchyStressdF ) == tardigradeVectorTools::appendVectors( dCauchyStressdFAnswer ), CHECK_PER_ELEMENT );
+
 }
 
-BOOST_AUTO_TEST_CASE( testPullBackAlmansiStrain, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
-    /*!
-     * Test the pull-back operation on the Green-Lagrange strain.
-     */
+BOOST_AUTO_TEST_CASE( testPullBackCauchyStress, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
 
-    floatVector deformationGradient = {  0.1740535 ,  1.2519364 , -0.9531442 ,
-                                        -0.7512021 , -0.60229072,  0.32640812,
-                                        -0.59754476, -0.06209685, -1.50856757 };
+    floatVector cauchyStress = { 0.69646919, 0.28613933, 0.22685145,
+                                 0.55131477, 0.71946897, 0.42310646,
+                                 0.9807642 , 0.68482974, 0.4809319 };
 
-    floatVector almansiStrain = { 0.25045537, 0.48303426, 0.98555979,
-                                  0.51948512, 0.61289453, 0.12062867,
-                                  0.8263408 , 0.60306013, 0.54506801 };
+    floatVector F = { 0.39211752, 0.34317802, 0.72904971,
+                      0.43857224, 0.0596779 , 0.39804426,
+                      0.73799541, 0.18249173, 0.17545176 };
 
-    floatVector answer = {  0.55339061, -0.59325289,  0.92984685,
-                           -0.83130342, -0.25274097, -1.5877536 ,
-                            1.67911302, -0.83554021,  3.47033811 };
+    floatVector answer = { 0.09712486, -0.22265266,  0.17348893,
+                          -0.28540852,  1.00439495, -0.24683974,
+                           0.08027086, -0.27916041,  0.08903243 };
 
-    floatVector result;
-    errorOut error = tardigradeConstitutiveTools::pullBackAlmansiStrain( almansiStrain, deformationGradient, result );
+    floatVector result, result2;
 
-    BOOST_CHECK( ! error );
+    BOOST_CHECK( !tardigradeConstitutiveTools::pullBackCauchyStress( cauchyStress, F, result ) );
 
-    BOOST_TEST( answer == result, CHECK_PER_ELEMENT );
+    BOOST_TEST( result == answer, CHECK_PER_ELEMENT );
 
-    //Test the jacobians
-    floatVector resultJ;
-    floatMatrix dEde, dEdF;
+    floatMatrix dPK2dCauchyStress, dPK2dF;
 
-    error = tardigradeConstitutiveTools::pullBackAlmansiStrain( almansiStrain, deformationGradient, resultJ, dEde, dEdF );
+    floatMatrix dPK2dCauchyStress_answer( answer.size( ), floatVector( cauchyStress.size( ), 0 ) );
 
-    BOOST_CHECK( ! error );
+    floatMatrix dPK2dF_answer( answer.size( ), floatVector( F.size( ), 0 ) );
 
-    BOOST_TEST( answer == resultJ, CHECK_PER_ELEMENT );
+    floatType eps = 1e-6;
 
-    //Testing dEde
-    floatType eps = 1e-7;
-    for ( unsigned int i = 0; i < almansiStrain.size( ); i++ ){
-        floatVector delta( almansiStrain.size( ), 0 );
-        delta[ i ] = eps * fabs( almansiStrain[ i ] ) + eps;
+    BOOST_CHECK( !tardigradeConstitutiveTools::pullBackCauchyStress( cauchyStress, F, result2,
+                                                                     dPK2dCauchyStress, dPK2dF ) );
 
-        floatVector Rp, Rm;
+    BOOST_TEST( result2 == answer, CHECK_PER_ELEMENT );
 
-        error = tardigradeConstitutiveTools::pullBackAlmansiStrain( almansiStrain + delta, deformationGradient, Rp );
+    for ( unsigned int i = 0; i < cauchyStress.size( ); i++ ){
 
-        BOOST_CHECK( ! error );
+        floatVector delta( cauchyStress.size( ), 0 );
 
-        error = tardigradeConstitutiveTools::pullBackAlmansiStrain( almansiStrain - delta, deformationGradient, Rm );
+        delta[ i ] = eps * std::fabs( cauchyStress[ i ] ) + eps;
 
-        BOOST_CHECK( ! error );
+        floatVector resultP, resultM;
 
-        floatVector gradCol = ( Rp - Rm ) / ( 2 * delta[ i ] );
+        BOOST_CHECK( !tardigradeConstitutiveTools::pullBackCauchyStress( cauchyStress + delta, F, resultP ) );
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::pullBackCauchyStress( cauchyStress - delta, F, resultM ) );
+
+        for ( unsigned int j = 0; j < answer.size( ); j++ ){
+
+            dPK2dCauchyStress_answer[ j ][ i ] = ( resultP[ j ] - resultM[ j ] ) / ( 2 * delta[ i ] );
 
-        for ( unsigned int j = 0; j < gradCol.size( ); j++ ){
-            BOOST_TEST( gradCol[ j ] == dEde[ j ][ i ] );
         }
+
     }
 
-    //Testing dEdF
-    for ( unsigned int i = 0; i < deformationGradient.size( ); i++ ){
-        floatVector delta( deformationGradient.size( ), 0 );
-        delta[ i ] = eps * fabs( deformationGradient[ i ] ) + eps;
+    for ( unsigned int i = 0; i < F.size( ); i++ ){
 
-        floatVector Rp, Rm;
+        floatVector delta( F.size( ), 0 );
 
-        error = tardigradeConstitutiveTools::pullBackAlmansiStrain( almansiStrain, deformationGradient + delta, Rp );
+        delta[ i ] = eps * std::fabs( F[ i ] ) + eps;
 
-        BOOST_CHECK( ! error );
+        floatVector resultP, resultM;
 
-        error = tardigradeConstitutiveTools::pullBackAlmansiStrain( almansiStrain, deformationGradient - delta, Rm );
+        BOOST_CHECK( !tardigradeConstitutiveTools::pullBackCauchyStress( cauchyStress, F + delta, resultP ) );
 
-        BOOST_CHECK( ! error );
+        BOOST_CHECK( !tardigradeConstitutiveTools::pullBackCauchyStress( cauchyStress, F - delta, resultM ) );
 
-        floatVector gradCol = ( Rp - Rm ) / ( 2 * delta[ i ] );
+        for ( unsigned int j = 0; j < answer.size( ); j++ ){
+
+            dPK2dF_answer[ j ][ i ] = ( resultP[ j ] - resultM[ j ] ) / ( 2 * delta[ i ] );
 
-        for ( unsigned int j = 0; j < gradCol.size( ); j++ ){
-            BOOST_TEST( gradCol[ j ] == dEdF[ j ][ i ] );
         }
+
     }
 
+    BOOST_TEST( tardigradeVectorTools::appendVectors( dPK2dCauchyStress ) == tardigradeVectorTools::appendVectors( dPK2dCauchyStress_answer ), CHECK_PER_ELEMENT );
+
+    BOOST_TEST( tardigradeVectorTools::appendVectors( dPK2dF ) == tardigradeVectorTools::appendVectors( dPK2dF_answer ), CHECK_PER_ELEMENT );
+
 }
 
-BOOST_AUTO_TEST_CASE( testComputeRightCauchyGreen, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+BOOST_AUTO_TEST_CASE( testMandelNotation, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
     /*!
-     * Test the computation of the Right Cauchy-Green deformation tensor
+     * Test the Mandel notation conversions and kernels against the full storage versions
      */
 
-    floatVector deformationGradient = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    typedef tardigradeConstitutiveTools::floatMandelVector floatMandelVector;
+    typedef tardigradeConstitutiveTools::floatMandelMatrix floatMandelMatrix;
+    typedef tardigradeConstitutiveTools::floatMandelGradient floatMandelGradient;
 
-    floatVector answer = { 66, 78, 90, 78, 93, 108, 90, 108, 126 };
+    auto toFourthOrder = [ ]( const floatVector &A ){
+        floatFourthOrderTensor result;
+        std::copy( A.begin( ), A.end( ), result.begin( ) );
+        return result;
+    };
 
-    floatVector result;
+    auto toVector = [ ]( const auto &A ){
+        return floatVector( A.begin( ), A.end( ) );
+    };
 
-    errorOut error = tardigradeConstitutiveTools::computeRightCauchyGreen( deformationGradient, result );
+    floatVector F = { 1.05, 0.12, -0.07,
+                      0.03, 0.94, 0.11,
+                     -0.09, 0.06, 1.13 };
 
-    BOOST_CHECK( ! error );
+    floatSecondOrderTensor fixedF;
+    std::copy( F.begin( ), F.end( ), fixedF.begin( ) );
 
-    BOOST_TEST( result == answer, CHECK_PER_ELEMENT );
+    floatVector S = { 0.7, 0.2, -0.3,
+                      0.2, 0.5, 0.1,
+                     -0.3, 0.1, 0.9 };
 
-    //Test Jacobian
+    // Conversions preserve symmetric tensors and their inner product
+    floatVector mandelS, S2;
 
-    floatVector resultJ;
-    floatMatrix dCdF;
+    BOOST_CHECK( !tardigradeConstitutiveTools::toMandel( S, mandelS ) );
 
-    error = tardigradeConstitutiveTools::computeRightCauchyGreen( deformationGradient, resultJ, dCdF );
+    BOOST_CHECK( !tardigradeConstitutiveTools::fromMandel( mandelS, S2 ) );
 
-    BOOST_CHECK( ! error );
+    BOOST_TEST( S2 == S, CHECK_PER_ELEMENT );
 
-    BOOST_TEST( resultJ == answer, CHECK_PER_ELEMENT );
+    BOOST_TEST( tardigradeVectorTools::inner( mandelS, mandelS ) == tardigradeVectorTools::inner( S, S ) );
 
-    floatType eps = 1e-6;
-    for ( unsigned int i = 0; i < deformationGradient.size( ); i++ ){
-        floatVector delta( deformationGradient.size( ), 0 );
-        delta[ i ] = eps * fabs( deformationGradient[ i ] ) + eps;
+    BOOST_CHECK_THROW( tardigradeConstitutiveTools::toMandel( mandelS, S2 ), std::exception );
 
-        floatVector Rp, Rm;
+    BOOST_CHECK_THROW( tardigradeConstitutiveTools::fromMandel( S, S2 ), std::exception );
 
-        error = tardigradeConstitutiveTools::computeRightCauchyGreen( deformationGradient + delta, Rp );
+    floatMandelVector fixedMandelS;
+    std::copy( mandelS.begin( ), mandelS.end( ), fixedMandelS.begin( ) );
 
-        BOOST_CHECK( ! error );
+    // Green-Lagrange strain
+    floatVector E, dEdF;
 
-        error = tardigradeConstitutiveTools::computeRightCauchyGreen( deformationGradient - delta, Rm );
+    BOOST_CHECK( !tardigradeConstitutiveTools::computeGreenLagrangeStrain( F, E, dEdF ) );
 
-        BOOST_CHECK( ! error );
+    floatMandelVector mandelE;
+    floatMandelGradient mandelDEDF, answerMandelDEDF;
 
-        floatVector gradCol = ( Rp - Rm ) / ( 2 * delta[ i ] );
+    tardigradeConstitutiveTools::computeGreenLagrangeStrain( fixedF, mandelE, mandelDEDF );
 
-        for ( unsigned int j = 0; j < gradCol.size( ); j++ ){
-            BOOST_TEST( gradCol[ j ] == dCdF[ j ][ i ] );
-        }
-    }
+    tardigradeConstitutiveTools::toMandel( toFourthOrder( dEdF ), answerMandelDEDF );
 
-}
+    BOOST_CHECK( !tardigradeConstitutiveTools::toMandel( E, mandelS ) );
 
-BOOST_AUTO_TEST_CASE( testComputeSymmetricPart, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
-    /*!
-     * Test the computation of the symmetric part of a matrix
-     *
-     * \param &results: The output file
-     */
+    BOOST_TEST( toVector( mandelE ) == mandelS, CHECK_PER_ELEMENT );
 
-    floatVector A = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    BOOST_TEST( toVector( mandelDEDF ) == toVector( answerMandelDEDF ), CHECK_PER_ELEMENT );
 
-    floatVector answer = { 1., 3., 5., 3., 5., 7., 5., 7., 9. };
+    floatFourthOrderTensor expandedDEDF;
 
-    floatVector result;
+    tardigradeConstitutiveTools::fromMandel( mandelDEDF, expandedDEDF );
 
-    errorOut error = tardigradeConstitutiveTools::computeSymmetricPart( A, result );
+    BOOST_TEST( toVector( expandedDEDF ) == dEdF, CHECK_PER_ELEMENT );
 
-    BOOST_CHECK( ! error );
+    // Isochoric decomposition
+    floatVector Ebar, dEbardE, dJdE;
+    floatType J;
 
-    BOOST_TEST( result == answer, CHECK_PER_ELEMENT );
+    BOOST_CHECK( !tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( E, Ebar, J, dEbardE, dJdE ) );
 
-    floatVector resultJ;
-    floatMatrix dSymmAdA;
+    floatMandelVector mandelEbar, mandelDJDE;
+    floatMandelMatrix mandelDEbarDE, answerMandelDEbarDE;
+    floatType mandelJ;
 
-    error = tardigradeConstitutiveTools::computeSymmetricPart( A, resultJ, dSymmAdA );
+    BOOST_CHECK( !tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( mandelE, mandelEbar, mandelJ, mandelDEbarDE, mandelDJDE ) );
 
-    BOOST_CHECK( ! error );
+    tardigradeConstitutiveTools::toMandel( toFourthOrder( dEbardE ), answerMandelDEbarDE );
 
-    BOOST_TEST( result == answer, CHECK_PER_ELEMENT );
+    BOOST_TEST( mandelJ == J );
+
+    BOOST_CHECK( !tardigradeConstitutiveTools::toMandel( Ebar, mandelS ) );
+
+    BOOST_TEST( toVector( mandelEbar ) == mandelS, CHECK_PER_ELEMENT );
 
-    floatVector resultJv;
+    BOOST_CHECK( !tardigradeConstitutiveTools::toMandel( dJdE, mandelS ) );
 
-    floatVector dSymmAdAv;
+    BOOST_TEST( toVector( mandelDJDE ) == mandelS, CHECK_PER_ELEMENT );
 
-    error = tardigradeConstitutiveTools::computeSymmetricPart( A, resultJv, dSymmAdAv );
+    BOOST_TEST( toVector( mandelDEbarDE ) == toVector( answerMandelDEbarDE ), CHECK_PER_ELEMENT );
 
-    BOOST_CHECK( ! error );
+    floatMandelVector badE = { -0.6, -0.6, -0.6, 0, 0, 0 };
 
-    BOOST_TEST( resultJv == answer, CHECK_PER_ELEMENT );
+    BOOST_CHECK_THROW( tardigradeConstitutiveTools::decomposeGreenLagrangeStrain( badE, mandelEbar, mandelJ ), std::exception );
 
-    BOOST_TEST( tardigradeVectorTools::appendVectors( dSymmAdA ) == dSymmAdAv, CHECK_PER_ELEMENT );
+    // Almansi strain
+    floatVector e, dedE, dedF;
 
-    floatType eps = 1e-6;
-    for ( unsigned int i = 0; i < A.size( ); i++ ){
-        floatVector delta( A.size( ), 0 );
-        delta[ i ] = eps * fabs( A[ i ] ) + eps;
+    BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( E, F, e, dedE, dedF ) );
 
-        floatVector Rp, Rm;
+    floatMandelVector mandelAlmansi;
+    floatMandelMatrix mandelDeDE, answerMandelDeDE;
+    floatMandelGradient mandelDeDF, answerMandelDeDF;
 
-        error = tardigradeConstitutiveTools::computeSymmetricPart( A + delta, Rp );
+    tardigradeConstitutiveTools::pushForwardGreenLagrangeStrain( mandelE, fixedF, mandelAlmansi, mandelDeDE, mandelDeDF );
 
-        BOOST_CHECK( ! error );
+    tardigradeConstitutiveTools::toMandel( toFourthOrder( dedE ), answerMandelDeDE );
 
-        error = tardigradeConstitutiveTools::computeSymmetricPart( A - delta, Rm );
+    tardigradeConstitutiveTools::toMandel( toFourthOrder( dedF ), answerMandelDeDF );
 
-        BOOST_CHECK( ! error );
+    BOOST_CHECK( !tardigradeConstitutiveTools::toMandel( e, mandelS ) );
 
-        floatVector gradCol = ( Rp - Rm ) / ( 2 * delta[ i ] );
+    BOOST_TEST( toVector( mandelAlmansi ) == mandelS, CHECK_PER_ELEMENT );
 
-        for ( unsigned int j = 0; j < gradCol.size( ); j++ ){
-            BOOST_TEST( gradCol[ j ] == dSymmAdA[ j ][ i ] );
-        }
-    }
+    BOOST_TEST( toVector( mandelDeDE ) == toVector( answerMandelDeDE ), CHECK_PER_ELEMENT );
 
-}
+    BOOST_TEST( toVector( mandelDeDF ) == toVector( answerMandelDeDF ), CHECK_PER_ELEMENT );
 
-BOOST_AUTO_TEST_CASE( testPushForwardPK2Stress, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
-    /*!
-     * Test the push forward the PK2 stress to the current configuration
-     */
+    // Push forward of the second Piola-Kirchhoff stress
+    floatVector cauchy, dCauchydS, dCauchydF;
 
-    floatVector PK2 = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardPK2Stress( S, F, cauchy, dCauchydS, dCauchydF ) );
 
-    floatVector F = { 1, 4, 2, 5, 2, 1, 3, 4, 1 };
+    floatMandelVector mandelCauchy;
+    floatMandelMatrix mandelDCauchyDS, answerMandelDCauchyDS;
+    floatMandelGradient mandelDCauchyDF, answerMandelDCauchyDF;
 
-    floatVector cauchyStressAnswer = { 15.16666667, 15.33333333, 16.11111111,
-                                       11.33333333, 10.66666667, 11.55555556,
-                                       13.66666667, 13.33333333, 14.22222222 };
+    tardigradeConstitutiveTools::pushForwardPK2Stress( fixedMandelS, fixedF, mandelCauchy, mandelDCauchyDS, mandelDCauchyDF );
 
-    floatVector result;
+    tardigradeConstitutiveTools::toMandel( toFourthOrder( dCauchydS ), answerMandelDCauchyDS );
 
-    BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardPK2Stress( PK2, F, result ) );
+    tardigradeConstitutiveTools::toMandel( toFourthOrder( dCauchydF ), answerMandelDCauchyDF );
 
-    BOOST_TEST( result == cauchyStressAnswer, CHECK_PER_ELEMENT );
+    BOOST_CHECK( !tardigradeConstitutiveTools::toMandel( cauchy, mandelS ) );
 
-    floatVector result2;
+    BOOST_TEST( toVector( mandelCauchy ) == mandelS, CHECK_PER_ELEMENT );
 
-    floatMatrix dCauchyStressdPK2, dCauchyStressdF;
+    BOOST_TEST( toVector( mandelDCauchyDS ) == toVector( answerMandelDCauchyDS ), CHECK_PER_ELEMENT );
 
-    BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardPK2Stress( PK2, F, result2, dCauchyStressdPK2, dCauchyStressdF ) );
+    BOOST_TEST( toVector( mandelDCauchyDF ) == toVector( answerMandelDCauchyDF ), CHECK_PER_ELEMENT );
 
-    BOOST_TEST( result2 == cauchyStressAnswer, CHECK_PER_ELEMENT );
+    // Pull back of the Cauchy stress
+    floatVector PK2, dPK2dCauchy, dPK2dF;
 
-    floatMatrix dCauchyStressdPK2Answer( cauchyStressAnswer.size( ), floatVector( PK2.size( ), 0 ) );
+    BOOST_CHECK( !tardigradeConstitutiveTools::pullBackCauchyStress( cauchy, F, PK2, dPK2dCauchy, dPK2dF ) );
 
-    floatMatrix dCauchyStressdFAnswer( cauchyStressAnswer.size( ), floatVector( F.size( ), 0 ) );
+    floatMandelVector mandelPK2;
+    floatMandelMatrix mandelDPK2DCauchy, answerMandelDPK2DCauchy;
+    floatMandelGradient mandelDPK2DF, answerMandelDPK2DF;
 
-    floatType eps = 1e-6;
+    tardigradeConstitutiveTools::pullBackCauchyStress( mandelCauchy, fixedF, mandelPK2, mandelDPK2DCauchy, mandelDPK2DF );
 
-    for ( unsigned int i = 0; i < PK2.size( ); i++ ){
+    tardigradeConstitutiveTools::toMandel( toFourthOrder( dPK2dCauchy ), answerMandelDPK2DCauchy );
 
-        floatVector delta( PK2.size( ), 0 );
+    tardigradeConstitutiveTools::toMandel( toFourthOrder( dPK2dF ), answerMandelDPK2DF );
 
-        delta[ i ] = eps * std::fabs( PK2[ i ] ) + eps;
+    BOOST_TEST( toVector( mandelPK2 ) == toVector( fixedMandelS ), CHECK_PER_ELEMENT );
 
-        floatVector cp, cm;
+    BOOST_TEST( toVector( mandelDPK2DCauchy ) == toVector( answerMandelDPK2DCauchy ), CHECK_PER_ELEMENT );
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardPK2Stress( PK2 + delta, F, cp ) );
+    BOOST_TEST( toVector( mandelDPK2DF ) == toVector( answerMandelDPK2DF ), CHECK_PER_ELEMENT );
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardPK2Stress( PK2 - delta, F, cm ) );
+    // The Mandel Jacobians contract directly with Mandel increments
+    floatMandelMatrix expandedCheck;
+    floatFourthOrderTensor expandedDCauchyDS;
 
-        for ( unsigned int j = 0; j < PK2.size( ); j++ ){
+    tardigradeConstitutiveTools::fromMandel( mandelDCauchyDS, expandedDCauchyDS );
 
-            dCauchyStressdPK2Answer[ j ][ i ] = ( cp[ j ] - cm[ j ] ) / ( 2 * delta[ i ] );
+    tardigradeConstitutiveTools::toMandel( expandedDCauchyDS, expandedCheck );
 
-        }
+    BOOST_TEST( toVector( expandedCheck ) == toVector( mandelDCauchyDS ), CHECK_PER_ELEMENT );
 
-    }
+    floatType eps = 1e-6;
 
-    BOOST_TEST( tardigradeVectorTools::appendVectors( dCauchyStressdPK2 ) == tardigradeVectorTools::appendVectors( dCauchyStressdPK2Answer ), CHECK_PER_ELEMENT );
+    for ( unsigned int K = 0; K < 6; K++ ){
 
-    for ( unsigned int i = 0; i < F.size( ); i++ ){
+        floatMandelVector Sp = fixedMandelS, Sm = fixedMandelS;
 
-        floatVector delta( F.size( ), 0 );
+        Sp[ K ] += eps;
 
-        delta[ i ] = eps * std::fabs( F[ i ] ) + eps;
+        Sm[ K ] -= eps;
 
-        floatVector cp, cm;
+        floatMandelVector cauchyP, cauchyM;
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardPK2Stress( PK2, F + delta, cp ) );
+        tardigradeConstitutiveTools::pushForwardPK2Stress( Sp, fixedF, cauchyP );
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::pushForwardPK2Stress( PK2, F - delta, cm ) );
+        tardigradeConstitutiveTools::pushForwardPK2Stress( Sm, fixedF, cauchyM );
 
-        for ( unsigned int j = 0; j < F.size( ); j++ ){
+        for ( unsigned int I = 0; I < 6; I++ ){
 
-            dCauchyStressdFAnswer[ j ][ i ] = ( cp[ j ] - cm[ j ] ) / ( 2 * delta[ i ] );
+            BOOST_TEST( mandelDCauchyDS[ 6 * I + K ] == ( cauchyP[ I ] - cauchyM[ I ] ) / ( 2 * eps ) );
 
         }
 
     }
 
-    BOOST_TEST( tardigradeVectorTools::appendVectors( dCauchyStressdF ) == tardigradeVectorTools::appendVectors( dCauchyStressdFAnswer ), CHECK_PER_ELEMENT );
+    // Single precision
+    tardigradeConstitutiveTools::secondOrderTensor< float > floatF;
+    tardigradeConstitutiveTools::mandelVector< float > singleE;
+    tardigradeConstitutiveTools::mandelGradient< float > singleDEDF;
 
-}
+    std::copy( F.begin( ), F.end( ), floatF.begin( ) );
 
-BOOST_AUTO_TEST_CASE( testPullBackCauchyStress, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    tardigradeConstitutiveTools::computeGreenLagrangeStrain( floatF, singleE, singleDEDF );
 
-    floatVector cauchyStress = { 0.69646919, 0.28613933, 0.22685145,
-                                 0.55131477, 0.71946897, 0.42310646,
-                                 0.9807642 , 0.68482974, 0.4809319 };
+    for ( unsigned int I = 0; I < 6; I++ ){
 
-    floatVector F = { 0.39211752, 0.34317802, 0.72904971,
-                      0.43857224, 0.0596779 , 0.39804426,
-                      0.73799541, 0.18249173, 0.17545176 };
+        BOOST_CHECK_SMALL( singleE[ I ] - mandelE[ I ], 1e-5 );
 
-    floatVector answer = { 0.09712486, -0.22265266,  0.17348893,
-                          -0.28540852,  1.00439495, -0.24683974,
-                           0.08027086, -0.27916041,  0.08903243 };
+    }
 
-    floatVector result, result2;
+}
 
-    BOOST_CHECK( !tardigradeConstitutiveTools::pullBackCauchyStress( cauchyStress, F, result ) );
+BOOST_AUTO_TEST_CASE( testComputeMatrixExponential, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the Cayley-Hamilton matrix exponential against the general scaling and squaring implementation. The
+     * matrices include repeated eigenvalues, a Jordan block, complex eigenvalues, a nilpotent shear, and a matrix
+     * large enough to require squaring.
+     */
 
-    BOOST_TEST( result == answer, CHECK_PER_ELEMENT );
+    std::vector< floatSecondOrderTensor > matrices = {
+        { 0.69646919, 0.28613933, 0.22685145, 0.55131477, 0.71946897, 0.42310646, 0.98076420, 0.68482974, 0.48093190 },
+        { -6.9646919, 2.8613933, 2.2685145, 5.5131477, -7.1946897, 4.2310646, 9.8076420, 6.8482974, -4.8093190 },
+        { 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, -2.0 },
+        { 1.0, 1.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, -2.0 },
+        { 0.0, -3.0, 1.0, 3.0, 0.0, -0.5, -1.0, 0.5, 0.0 },
+        { 0.0, 5.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+        { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 }
+    };
 
-    floatMatrix dPK2dCauchyStress, dPK2dF;
+    floatType eps = 1e-6;
 
-    floatMatrix dPK2dCauchyStress_answer( answer.size( ), floatVector( cauchyStress.size( ), 0 ) );
+    for ( auto A = matrices.begin( ); A != matrices.end( ); A++ ){
 
-    floatMatrix dPK2dF_answer( answer.size( ), floatVector( F.size( ), 0 ) );
+        floatVector AVector( A->begin( ), A->end( ) );
 
-    floatType eps = 1e-6;
+        floatVector answer;
 
-    BOOST_CHECK( !tardigradeConstitutiveTools::pullBackCauchyStress( cauchyStress, F, result2,
-                                                                     dPK2dCauchyStress, dPK2dF ) );
+        tardigradeVectorTools::computeMatrixExponentialScalingAndSquaring( AVector, 3, answer );
 
-    BOOST_TEST( result2 == answer, CHECK_PER_ELEMENT );
+        floatSecondOrderTensor result, resultJ;
 
-    for ( unsigned int i = 0; i < cauchyStress.size( ); i++ ){
+        floatFourthOrderTensor dExpAdA;
 
-        floatVector delta( cauchyStress.size( ), 0 );
+        tardigradeConstitutiveTools::computeMatrixExponential( *A, result );
 
-        delta[ i ] = eps * std::fabs( cauchyStress[ i ] ) + eps;
+        BOOST_TEST( floatVector( result.begin( ), result.end( ) ) == answer, CHECK_PER_ELEMENT );
 
-        floatVector resultP, resultM;
+        tardigradeConstitutiveTools::computeMatrixExponential( *A, resultJ, dExpAdA );
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::pullBackCauchyStress( cauchyStress + delta, F, resultP ) );
+        BOOST_TEST( floatVector( resultJ.begin( ), resultJ.end( ) ) == answer, CHECK_PER_ELEMENT );
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::pullBackCauchyStress( cauchyStress - delta, F, resultM ) );
+        floatVector dExpAdA_num( 81, 0 );
 
-        for ( unsigned int j = 0; j < answer.size( ); j++ ){
+        for ( unsigned int i = 0; i < 9; i++ ){
 
-            dPK2dCauchyStress_answer[ j ][ i ] = ( resultP[ j ] - resultM[ j ] ) / ( 2 * delta[ i ] );
+            floatType delta = eps * std::fabs( ( *A )[ i ] ) + eps;
 
-        }
+            floatSecondOrderTensor Ap = *A;
 
-    }
+            floatSecondOrderTensor Am = *A;
 
-    for ( unsigned int i = 0; i < F.size( ); i++ ){
+            Ap[ i ] += delta;
 
-        floatVector delta( F.size( ), 0 );
+            Am[ i ] -= delta;
 
-        delta[ i ] = eps * std::fabs( F[ i ] ) + eps;
+            floatSecondOrderTensor vp, vm;
 
-        floatVector resultP, resultM;
+            tardigradeConstitutiveTools::computeMatrixExponential( Ap, vp );
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::pullBackCauchyStress( cauchyStress, F + delta, resultP ) );
+            tardigradeConstitutiveTools::computeMatrixExponential( Am, vm );
 
-        BOOST_CHECK( !tardigradeConstitutiveTools::pullBackCauchyStress( cauchyStress, F - delta, resultM ) );
+            for ( unsigned int j = 0; j < 9; j++ ){
 
-        for ( unsigned int j = 0; j < answer.size( ); j++ ){
+                dExpAdA_num[ 9 * j + i ] = ( vp[ j ] - vm[ j ] ) / ( 2 * delta );
 
-            dPK2dF_answer[ j ][ i ] = ( resultP[ j ] - resultM[ j ] ) / ( 2 * delta[ i ] );
+            }
 
         }
 
-    }
-
-    BOOST_TEST( tardigradeVectorTools::appendVectors( dPK2dCauchyStress ) == tardigradeVectorTools::appendVectors( dPK2dCauchyStress_answer ), CHECK_PER_ELEMENT );
+        BOOST_TEST( floatVector( dExpAdA.begin( ), dExpAdA.end( ) ) == dExpAdA_num, CHECK_PER_ELEMENT );
 
-    BOOST_TEST( tardigradeVectorTools::appendVectors( dPK2dF ) == tardigradeVectorTools::appendVectors( dPK2dF_answer ), CHECK_PER_ELEMENT );
+    }
 
 }
 
@@ -1922,6 +4648,169 @@ floatVector normalVectorUtilityFunction( floatVector F, floatVector N ){
 
 }
 
+BOOST_AUTO_TEST_CASE( testEvolveFHigherOrder, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the Magnus and fourth order Runge-Kutta integrators of the deformation gradient
+     */
+
+    floatType Dt = 0.2;
+
+    floatVector Fp = { 0.99684486, -0.00318276, -0.0134401 ,
+                      -0.03494318,  0.97755447, -0.01110235,
+                      -0.02224434,  0.01770411,  1.01382113 };
+
+    floatVector Lp = { 0.21576496,  0.31364397, -0.45809941,
+                       0.12285551,  0.88064421,  0.20391149,
+                      -0.47599081,  0.63501654,  0.64909649 };
+
+    floatVector L = { -0.39293837,  0.42772133,  0.54629709,
+                      -0.10262954, -0.43893794,  0.15378708,
+                      -0.9615284 , -0.36965948,  0.0381362 };
+
+    // The methods are the second and fourth order Magnus integrators and the fourth order Runge-Kutta method
+    auto evolve = [ ]( const unsigned int method, const floatType &_Dt, const floatVector &_Fp, const floatVector &_Lp, const floatVector &_L, floatVector &F ){
+
+        if ( method == 2 ){
+
+            tardigradeConstitutiveTools::evolveFRungeKutta4( _Dt, _Fp, _Lp, _L, F );
+
+        }
+        else{
+
+            tardigradeConstitutiveTools::evolveFMagnus( _Dt, _Fp, _Lp, _L, F, 2 + 2 * method );
+
+        }
+
+    };
+
+    // Integrate over the step using N substeps with the velocity gradient interpolated linearly
+    auto integrate = [ & ]( const unsigned int method, const unsigned int N ){
+
+        floatVector F = Fp, Fn;
+
+        for ( unsigned int n = 0; n < N; n++ ){
+
+            evolve( method, Dt / N, F, Lp + ( floatType )( n ) / N * ( L - Lp ), Lp + ( floatType )( n + 1 ) / N * ( L - Lp ), Fn );
+
+            F = Fn;
+
+        }
+
+        return F;
+
+    };
+
+    // The second order Magnus integrator is the exponential midpoint rule
+    floatVector F2, FExp;
+
+    tardigradeConstitutiveTools::evolveFMagnus( Dt, Fp, Lp, L, F2, 2 );
+
+    tardigradeConstitutiveTools::evolveFExponentialMap( Dt, Fp, Lp, L, FExp, 0.5 );
+
+    BOOST_TEST( F2 == FExp, CHECK_PER_ELEMENT );
+
+    // A constant velocity gradient is integrated exactly
+    floatVector F4;
+
+    tardigradeConstitutiveTools::evolveFMagnus( Dt, Fp, L, L, F4 );
+
+    tardigradeConstitutiveTools::evolveFExponentialMap( Dt, Fp, L, L, FExp );
+
+    BOOST_TEST( F4 == FExp, CHECK_PER_ELEMENT );
+
+    // The Magnus integrators preserve the determinant exactly
+    tardigradeConstitutiveTools::evolveFMagnus( Dt, Fp, Lp, L, F4 );
+
+    floatType traceL = 0.5 * ( Lp[ 0 ] + Lp[ 4 ] + Lp[ 8 ] + L[ 0 ] + L[ 4 ] + L[ 8 ] );
+
+    BOOST_TEST( tardigradeVectorTools::determinant( F4, 3, 3 ) == std::exp( Dt * traceL ) * tardigradeVectorTools::determinant( Fp, 3, 3 ) );
+
+    // Check the order of convergence against a converged reference solution
+    floatVector reference = integrate( 2, 1000 );
+
+    const floatType orders[ 3 ] = { 2, 4, 4 };
+
+    for ( unsigned int method = 0; method < 3; method++ ){
+
+        floatType ratio = tardigradeVectorTools::l2norm( integrate( method, 1 ) - reference ) / tardigradeVectorTools::l2norm( integrate( method, 2 ) - reference );
+
+        BOOST_CHECK( std::fabs( std::log2( ratio ) - orders[ method ] ) < 0.5 );
+
+    }
+
+    // Check the Jacobians against finite differences over a large step
+    Dt = 2.3;
+
+    floatType eps = 1e-6;
+
+    for ( unsigned int method = 0; method < 3; method++ ){
+
+        floatVector F, FJ, dFdL, FJ2, dFdL2, dFdFp, dFdLp;
+
+        evolve( method, Dt, Fp, Lp, L, F );
+
+        if ( method == 2 ){
+
+            tardigradeConstitutiveTools::evolveFRungeKutta4( Dt, Fp, Lp, L, FJ, dFdL );
+
+            tardigradeConstitutiveTools::evolveFRungeKutta4( Dt, Fp, Lp, L, FJ2, dFdL2, dFdFp, dFdLp );
+
+        }
+        else{
+
+            tardigradeConstitutiveTools::evolveFMagnus( Dt, Fp, Lp, L, FJ, dFdL, 2 + 2 * method );
+
+            tardigradeConstitutiveTools::evolveFMagnus( Dt, Fp, Lp, L, FJ2, dFdL2, dFdFp, dFdLp, 2 + 2 * method );
+
+        }
+
+        BOOST_TEST( FJ == F, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( FJ2 == F, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( dFdL2 == dFdL, CHECK_PER_ELEMENT );
+
+        floatVector *jacobians[ 3 ] = { &dFdL, &dFdFp, &dFdLp };
+
+        for ( unsigned int v = 0; v < 3; v++ ){
+
+            for ( unsigned int i = 0; i < 9; i++ ){
+
+                floatVector _Fp = Fp, _Lp = Lp, _L = L, _Fm = Fp, _Lpm = Lp, _Lm = L, Fplus, Fminus;
+
+                floatVector *plus[ 3 ] = { &_L, &_Fp, &_Lp };
+
+                floatVector *minus[ 3 ] = { &_Lm, &_Fm, &_Lpm };
+
+                floatType delta = eps * std::fabs( ( *plus[ v ] )[ i ] ) + eps;
+
+                ( *plus[ v ] )[ i ] += delta;
+
+                ( *minus[ v ] )[ i ] -= delta;
+
+                evolve( method, Dt, _Fp, _Lp, _L, Fplus );
+
+                evolve( method, Dt, _Fm, _Lpm, _Lm, Fminus );
+
+                for ( unsigned int j = 0; j < 9; j++ ){
+
+                    // The round-off of the finite difference is absolute so small components are compared with an absolute tolerance
+                    BOOST_CHECK_SMALL( ( *jacobians[ v ] )[ 9 * j + i ] - ( Fplus[ j ] - Fminus[ j ] ) / ( 2 * delta ), 1e-8 );
+
+                }
+
+            }
+
+        }
+
+    }
+
+    BOOST_CHECK_THROW( tardigradeConstitutiveTools::evolveFMagnus( Dt, Fp, Lp, L, F4, 3 ), std::exception );
+
+    BOOST_CHECK_THROW( tardigradeConstitutiveTools::evolveFRungeKutta4( Dt, Fp, Lp, floatVector( 4, 0 ), F4 ), std::exception );
+
+}
+
 BOOST_AUTO_TEST_CASE( test_computeDCurrentNormalVectorDF, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
 
     floatVector N = { 1, 2, 3 };
@@ -2381,3 +5270,97 @@ BOOST_AUTO_TEST_CASE( test_computeDCurrentAreaDGradU, * boost::unit_test::tolera
     BOOST_TEST( jacobian == ( dCurrentAreadGradU * da ), CHECK_PER_ELEMENT );
 
 }
+
+BOOST_AUTO_TEST_CASE( test_surfaceDerivativesDGradUChainRule, * boost::unit_test::tolerance( DEFAULT_TEST_TOLERANCE ) ){
+    /*!
+     * Test the closed form derivatives of the surface quantities w.r.t. the displacement gradient against the chain
+     * rule through the derivatives w.r.t. the deformation gradient for both configurations
+     */
+
+    floatVector n = { 1, 2, 3 };
+
+    n = n / tardigradeVectorTools::l2norm( n );
+
+    floatVector gradU = { 0.01964692, -0.02138607, -0.02731485,
+                          0.00513148,  0.0219469 , -0.00768935,
+                          0.04807642,  0.01848297, -0.00190681 };
+
+    for ( const bool isCurrent : { true, false } ){
+
+        floatVector F, dFdGradU;
+
+        tardigradeConstitutiveTools::computeDeformationGradient( gradU, F, dFdGradU, isCurrent );
+
+        floatVector dNormalVectordF, dAreaWeightedNormalVectordF, dCurrentAreadF;
+
+        tardigradeConstitutiveTools::computeDCurrentNormalVectorDF( n, F, dNormalVectordF );
+
+        tardigradeConstitutiveTools::computeDCurrentAreaWeightedNormalVectorDF( n, F, dAreaWeightedNormalVectordF );
+
+        tardigradeConstitutiveTools::computeDCurrentAreaDF( n, F, dCurrentAreadF );
+
+        floatVector dNormalVectordGradU_answer( 27, 0 ), dAreaWeightedNormalVectordGradU_answer( 27, 0 ), dCurrentAreadGradU_answer( 9, 0 );
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            for ( unsigned int j = 0; j < 9; j++ ){
+
+                for ( unsigned int k = 0; k < 3; k++ ){
+
+                    dNormalVectordGradU_answer[ 9 * k + j ] += dNormalVectordF[ 9 * k + i ] * dFdGradU[ 9 * i + j ];
+
+                    dAreaWeightedNormalVectordGradU_answer[ 9 * k + j ] += dAreaWeightedNormalVectordF[ 9 * k + i ] * dFdGradU[ 9 * i + j ];
+
+                }
+
+                dCurrentAreadGradU_answer[ j ] += dCurrentAreadF[ i ] * dFdGradU[ 9 * i + j ];
+
+            }
+
+        }
+
+        floatVector dNormalVectordGradU, dAreaWeightedNormalVectordGradU, dCurrentAreadGradU;
+
+        tardigradeConstitutiveTools::computeDCurrentNormalVectorDGradU( n, gradU, dNormalVectordGradU, isCurrent );
+
+        tardigradeConstitutiveTools::computeDCurrentAreaWeightedNormalVectorDGradU( n, gradU, dAreaWeightedNormalVectordGradU, isCurrent );
+
+        tardigradeConstitutiveTools::computeDCurrentAreaDGradU( n, gradU, dCurrentAreadGradU, isCurrent );
+
+        BOOST_TEST( dNormalVectordGradU == dNormalVectordGradU_answer, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( dAreaWeightedNormalVectordGradU == dAreaWeightedNormalVectordGradU_answer, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( dCurrentAreadGradU == dCurrentAreadGradU_answer, CHECK_PER_ELEMENT );
+
+        tardigradeConstitutiveTools::floatFirstOrderTensor nTensor = { n[ 0 ], n[ 1 ], n[ 2 ] };
+
+        tardigradeConstitutiveTools::floatSecondOrderTensor gradUTensor;
+
+        std::copy( gradU.begin( ), gradU.end( ), gradUTensor.begin( ) );
+
+        tardigradeConstitutiveTools::floatThirdOrderTensor dNormalVectordGradUTensor, dAreaWeightedNormalVectordGradUTensor;
+
+        tardigradeConstitutiveTools::floatSecondOrderTensor dCurrentAreadGradUTensor;
+
+        tardigradeConstitutiveTools::computeDCurrentNormalVectorDGradU( nTensor, gradUTensor, dNormalVectordGradUTensor, isCurrent );
+
+        tardigradeConstitutiveTools::computeDCurrentAreaWeightedNormalVectorDGradU( nTensor, gradUTensor, dAreaWeightedNormalVectordGradUTensor, isCurrent );
+
+        tardigradeConstitutiveTools::computeDCurrentAreaDGradU( nTensor, gradUTensor, dCurrentAreadGradUTensor, isCurrent );
+
+        BOOST_TEST( floatVector( dNormalVectordGradUTensor.begin( ), dNormalVectordGradUTensor.end( ) ) == dNormalVectordGradU_answer, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( floatVector( dAreaWeightedNormalVectordGradUTensor.begin( ), dAreaWeightedNormalVectordGradUTensor.end( ) ) == dAreaWeightedNormalVectordGradU_answer, CHECK_PER_ELEMENT );
+
+        BOOST_TEST( floatVector( dCurrentAreadGradUTensor.begin( ), dCurrentAreadGradUTensor.end( ) ) == dCurrentAreadGradU_answer, CHECK_PER_ELEMENT );
+
+    }
+
+    floatVector result;
+
+    BOOST_CHECK_THROW( tardigradeConstitutiveTools::computeDCurrentAreaDGradU( floatVector( 2, 0 ), gradU, result ), std::exception );
+
+    BOOST_CHECK_THROW( tardigradeConstitutiveTools::computeDCurrentNormalVectorDGradU( n, floatVector( 4, 0 ), result ), std::exception );
+
+}